@@ -205,6 +205,10 @@ public:
 	friend void read1(istream&, sv_attribute&);
 	friend sv_attribute read_at_r1(istream&);
 
+// Memory accounting (memuse.cxx) needs to see inside
+
+	friend class sv_mem_walk;
+
 };
 
 // ******** Externs
@@ -0,0 +1,96 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Conservative boxes round primitive surfaces and set solids
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_BOUNDS
+#define SVLIS_BOUNDS
+
+// All these bounds are found by chopping the box up and throwing
+// away the pieces that interval arithmetic shows can't contain what's
+// wanted, so they are always conservative (too big, never too small).
+// An answer with no volume means there's nothing in the box.
+
+// True if a box has no volume (any of its intervals is empty)
+
+extern int box_void(const sv_box&);
+
+// Chop a box in half across its longest side
+
+extern void bound_halve(const sv_box&, sv_box*, sv_box*);
+
+// A box round the part of a primitive's zero surface inside a box.  
+// The results are cached against the primitive, so asking again
+// for a box inside one already asked about is cheap.
+
+extern sv_box surface_bounds(const sv_primitive&, const sv_box&);
+
+// A box round the part of a primitive's solid inside a box
+
+extern sv_box solid_bounds(const sv_primitive&, const sv_box&);
+
+// A box round the part of a set's solid inside a box
+
+extern sv_box solid_bounds(const sv_set&, const sv_box&);
+
+// How many times to halve a box when finding bounds (default 9)
+
+extern void set_bound_depth(sv_integer);
+extern sv_integer get_bound_depth();
+
+// Empty the surface bounds cache (it holds references to primitives)
+
+extern void clear_bounds_cache();
+
+#endif
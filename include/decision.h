@@ -82,4 +82,16 @@ extern void set_smart_strategy(sv_integer);
 
 extern sv_integer get_smart_strategy();
 
+// Cost-model (surface area times contents) division; the traverse
+// cost is the cost of visiting a box relative to that of testing one
+// primitive, and the bins are the number of candidate cuts per axis
+
+extern void cost_decision(const sv_model&, sv_integer, void*,
+    mod_kind*, sv_real*, sv_model*, sv_model*);
+
+extern void set_cost_traverse(sv_real);
+extern sv_real get_cost_traverse();
+extern void set_cost_bins(sv_integer);
+extern sv_integer get_cost_bins();
+
 #endif
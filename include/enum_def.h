@@ -166,6 +166,15 @@ extern sv_integer text_tag();
 
 #define SV_CV_POL 0x40000000
 
+// Flag bit for a model tree that holds instances (see sv_model::instance())
+
+#define SV_INST_FLAG 0x08000000
+
+// Flag bit for a model tree with sub-trees paged out to disk (see
+// page_model())
+
+#define SV_PAGE_FLAG 0x04000000
+
 // Version number write/check
 
 #define SV_VER 4
@@ -263,7 +272,8 @@ enum prim_op
 	SV_COS,
 	SV_EXP,
 	SV_SSQRT,
-        SV_SIGN
+        SV_SIGN,
+	SV_XFORM	// Affine transform (see sv_xform.h)
 };
 
 #define MONADIC SV_COMP	// First monadic operator
@@ -337,7 +347,8 @@ enum mod_kind
 	LEAF_M,		// Undivided leaf model
 	X_DIV,		// Divided in x direction
 	Y_DIV,		// Divided in y direction
-	Z_DIV		// Divided in z direction
+	Z_DIV,		// Divided in z direction
+	INSTANCE_M	// A transformed copy of another model, and the rest
 };
 
 // Set the box swell factor
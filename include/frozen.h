@@ -0,0 +1,192 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Frozen models: a divided model flattened into arrays
+ * for fast point location, membership and ray-tracing
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_FROZEN
+#define SVLIS_FROZEN
+
+// One node of a frozen division tree.  The nodes are stored depth
+// first, so child_1 of node i is always node i + 1; index is the
+// node number of child_2 for a divided node, or the leaf number for
+// a leaf.  c1_hi and c2_lo are the faces of the (swelled) child boxes
+// across the cut, which is all the ray-tracer needs to know about them.
+
+struct sv_frozen_node
+{
+	sv_real coord;		// The division coordinate
+	sv_real c1_hi;		// Top of child_1's box across the cut
+	sv_real c2_lo;		// Bottom of child_2's box across the cut
+	int kind;		// mod_kind
+	int index;		// child_2's node, or the leaf number
+};
+
+// A frozen model is an immutable copy of a divided model laid out
+// in contiguous arrays.  Queries on it don't touch any reference
+// counts until they reach the sets in a leaf, so it can be shared
+// between threads.  Re-freeze after (re)dividing the original.
+
+class sv_frozen_model
+{
+private:
+
+   struct frozen_data : public sv_refct
+   {
+	friend class sv_smart_ptr<frozen_data>;
+
+	sv_model m;			// What was frozen
+	void* owner;			// or, for a model's own copy, its model_data
+					// (read and cleared under owner_lock())
+	sv_box b;			// Its box
+
+	sv_frozen_node* node;		// The tree
+	sv_integer node_count;
+
+	sv_box* leaf_box;		// The leaf boxes
+	sv_model* leaf_model;		// and the leaves themselves
+	sv_integer* leaf_first;		// Leaf i has sets leaf_first[i] to leaf_first[i+1] - 1
+	sv_integer leaf_count;
+
+	sv_set* set;			// All the leaves' sets, leaf by leaf
+	sv_integer set_count;
+
+	frozen_data(const sv_model&, int);
+
+	~frozen_data()
+	{
+		delete [] node;
+		delete [] leaf_box;
+		delete [] leaf_model;
+		delete [] leaf_first;
+		delete [] set;
+	}
+
+	void count(const sv_model&);
+	void fill(const sv_model&);
+	sv_integer leaf_index(const sv_point&) const;
+	sv_set ray(sv_integer, const sv_line&, const sv_real&, const sv_interval&, 
+		sv_real*) const;
+	sv_integer occluded(sv_integer, const sv_line&, const sv_real&, 
+		const sv_interval&) const;
+   }; // frozen_data
+
+   sv_smart_ptr<frozen_data> frozen_info;
+
+// A model's own copy (see sv_model::frozen()) doesn't hold on to the
+// model, as the model holds on to it
+
+	sv_frozen_model(const sv_model& m, int keep) { frozen_info = new frozen_data(m, keep); }
+
+	friend class sv_model;
+	friend void sv_frozen_drop(sv_frozen_model*);
+
+public:
+
+// Null frozen model
+
+	sv_frozen_model() { }
+
+// Freeze a model
+
+	sv_frozen_model(const sv_model& m) { frozen_info = new frozen_data(m, 1); }
+
+// Copy
+
+	sv_frozen_model(const sv_frozen_model& f) { *this = f; }
+
+	int exists() const { return(frozen_info.exists()); }
+
+// The original model, and its box
+
+	sv_model model() const;
+	sv_box box() const { return(frozen_info->b); }
+
+// Sizes
+
+	sv_integer nodes() const { return(frozen_info->node_count); }
+	sv_integer leaves() const { return(frozen_info->leaf_count); }
+
+// Return the leaf that contains a point (null if none)
+
+	sv_model leaf(const sv_point&) const;
+
+// Membership test
+
+	mem_test member(const sv_point&, sv_primitive*) const;
+
+	mem_test member(const sv_point& p) const
+	{
+		sv_primitive x;
+		return(member(p, &x));
+	}
+
+// Ray-trace; these behave exactly like sv_model::fire_ray
+
+	sv_set fire_ray(const sv_line&, const sv_interval&, sv_real*) const;
+
+	sv_set fire_ray(const sv_line& l, sv_real* r) const
+	{
+		sv_interval i = line_box(l, box());
+		sv_set result;
+		if(!i.empty()) result = fire_ray(l, i, r);
+		return(result);
+	}
+
+// Does a ray cross any surface in an interval of it?  As sv_model::occluded
+
+	sv_integer occluded(const sv_line&, const sv_interval&) const;
+};
+
+#endif
@@ -0,0 +1,131 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Interference (clash) detection between two divided models
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_INTERFERE
+#define SVLIS_INTERFERE
+
+// One region where two models interfere: the overlap of a leaf
+// box from each, and the pair of sets that meet in it.  certainty
+// is SV_SOLID if some of the box is definitely inside both sets,
+// or SV_SURFACE if the two could only be shown to come close.
+
+struct sv_clash
+{
+	sv_box b;		// Overlap of the two leaf boxes
+	sv_set set_a;		// The set from the first model
+	sv_set set_b;		// The set from the second model
+	mem_test certainty;	// SV_SOLID or SV_SURFACE
+	sv_clash* next;
+};
+
+// A list of clashes, in the order in which they were found
+
+class sv_clash_list
+{
+private:
+
+	sv_clash* list;
+	sv_clash* last;
+	sv_integer n;
+
+// Lists own their entries, so don't allow copies
+
+	sv_clash_list(const sv_clash_list&);
+	sv_clash_list& operator=(const sv_clash_list&);
+
+public:
+
+	sv_clash_list() { list = 0; last = 0; n = 0; }
+
+	~sv_clash_list() { clear(); }
+
+// Add a clash to the end of the list
+
+	void add(const sv_box&, const sv_set&, const sv_set&, mem_test);
+
+// Empty the list
+
+	void clear();
+
+// How many clashes, and how many of those are definite
+
+	sv_integer count() const { return(n); }
+	sv_integer definite() const;
+
+// The first entry (follow next for the rest)
+
+	sv_clash* entry() const { return(list); }
+};
+
+// Walk two divided models together, only looking inside pairs of
+// leaf boxes that overlap, and add every interfering region to the
+// list.  Returns the number of clashes added.
+
+extern sv_integer interference(const sv_model&, const sv_model&, sv_clash_list&);
+
+// Early-exit test: returns SV_SOLID as soon as a definite clash is
+// found, SV_SURFACE if the models only possibly touch, and SV_AIR
+// if they are clear of each other.
+
+extern mem_test interfere(const sv_model&, const sv_model&);
+
+// How many times an overlap box may be halved when trying to decide
+// whether a clash is definite (default 12)
+
+extern void set_clash_depth(sv_integer);
+extern sv_integer get_clash_depth();
+
+#endif
@@ -0,0 +1,96 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Memory accounting for models and everything they hold
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_MEMUSE
+#define SVLIS_MEMUSE
+
+// Live nodes of one kind reached by a memory walk.  Each node is
+// counted once however many handles point at it; refs is how many
+// times it was reached, so refs/nodes says how much sharing there is.
+// bytes includes the heap-allocated child handles each node owns,
+// rounded up as malloc would.
+
+struct sv_mem_count
+{
+	sv_integer nodes;	// Distinct nodes
+	sv_integer refs;	// Times they were reached
+	sv_integer shared;	// Nodes reached more than once
+	long bytes;
+};
+
+struct sv_mem_stats
+{
+	sv_mem_count model;
+	sv_mem_count set_list;
+	sv_mem_count set;
+	sv_mem_count prim;
+	sv_mem_count attribute;
+	sv_integer polygons;	// Polygon attributes
+	sv_integer vertices;	// Vertices in them
+	long polygon_bytes;
+	long total_bytes;	// Everything above
+	long peak_rss;		// Peak process resident size in kB (-1 if unknown)
+};
+
+// Walk a model (its tree, set lists, sets, primitives and attributes)
+
+extern void memory_use(const sv_model& m, sv_mem_stats* ms);
+
+// Peak resident set size of the process in kB, or -1 if unknown
+
+extern long peak_rss();
+
+#endif
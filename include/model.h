@@ -67,6 +67,16 @@ typedef void (*sv_decision) (const sv_model&, sv_integer, void*,  mod_kind*,
 		    
 class sv_div_data;
 
+// A sub-tree paged out to disk (sv_page.cxx)
+
+struct sv_model_page;
+extern void sv_page_drop(sv_model_page*);
+
+// A model's frozen copy (frozen.cxx)
+
+class sv_frozen_model;
+extern void sv_frozen_drop(sv_frozen_model*);
+
 // As usual models are handles pointing to a hidden class, with reference
 // counting storage de-allocation
 
@@ -77,6 +87,19 @@ extern istream& operator>>(istream&, mod_kind&);
 extern void facet_decision(const sv_model&, sv_integer, void*, mod_kind*, 
     sv_real*, sv_model*, sv_model*);
 
+// Limits for budgeted division (see sv_model::divide_budget); any
+// that are zero are ignored.  bytes is an estimate of the heap the 
+// new boxes and their pruned set lists will take up.
+
+struct sv_div_budget
+{
+	sv_integer nodes;	// Maximum number of boxes in the whole tree
+	long bytes;		// Maximum memory for the tree
+	sv_real millisecs;	// Maximum (processor) time to spend
+
+	sv_div_budget() { nodes = 0; bytes = 0; millisecs = 0; }
+};
+
 // The svLis model class
 
 class sv_model
@@ -97,8 +120,20 @@ private:
 
 	mod_kind kind;		// Leaf, or divided in X, Y, or Z
 	sv_real coord;		// The division coordinate
+
+	sv_xform* xf;		// For instances: world to child_1, and back
+	key_table<sv_set>* ws;	// For instances: prototype sets placed in the world
+
+	sv_model_page* pg;	// If the children are kept on disk
+
+	sv_frozen_model* fz;	// Frozen copy, made when first wanted
 	
-        ~model_data() { delete child_1; delete child_2; delete p; }
+        ~model_data() 
+	{ 
+		if(fz) sv_frozen_drop(fz);
+		if(pg) sv_page_drop(pg);
+		delete child_1; delete child_2; delete p; delete [] xf; delete ws;
+	}
 
 // Constructor to build a leaf model
 
@@ -108,6 +143,10 @@ private:
 		sl = sls;
 		kind = LEAF_M;
 		coord = 0;
+		xf = 0;
+		ws = 0;
+		pg = 0;
+		fz = 0;
 	        child_1 = new sv_model();
 	        child_2 = new sv_model();
 	        p = new sv_model(pt);
@@ -122,6 +161,10 @@ private:
 		sl = sls;
 		kind = k;
 		coord = c;
+		xf = 0;
+		ws = 0;
+		pg = 0;
+		fz = 0;
 	        child_1 = new sv_model(c1);
 	        child_2 = new sv_model(c2);
 	        p = new sv_model(pt);
@@ -136,11 +179,45 @@ private:
 		sl = pt.set_list();
 		kind = k;
 		coord = c;
+		xf = 0;
+		ws = 0;
+		pg = 0;
+		fz = 0;
 	        child_1 = new sv_model(c1);
 	        child_2 = new sv_model(c2);
 	        p = new sv_model(pt);
 	}
 
+// Constructor to build an instance: child_1 is the prototype, placed in
+// the world by the map, and child_2 is the rest of the world model
+
+	model_data(const sv_model& proto, const sv_xform& place, const sv_model& rest)
+	{
+		b = place.map(proto.box()) | rest.box();
+		sl = sv_set_list(sv_set(SV_NOTHING));
+		kind = INSTANCE_M;
+		coord = 0;
+		xf = new sv_xform[2];
+		xf[0] = place.inverse();
+		xf[1] = place;
+		ws = 0;
+		pg = 0;
+		fz = 0;
+	        child_1 = new sv_model(proto);
+	        child_2 = new sv_model(rest);
+	        p = new sv_model();
+		set_flags(SV_INST_FLAG);
+	}
+
+// The frozen copy, and letting go of it when the tree changes
+
+	sv_frozen_model frozen(const sv_model&);
+	void thaw();
+
+// A prototype set placed in the world, made the first time it's wanted
+
+	sv_set placed(const sv_set&);
+
    }; // model_data
 
 // This is the pointer that gets ref counted
@@ -152,6 +229,10 @@ private:
         void set_flags_priv(sv_integer a) { model_info->set_flags(a); }
 	void reset_flags_priv(sv_integer a) { model_info->reset_flags(a); }
 
+// Bring paged-out children back from disk
+
+	void page_in() const;
+
 public:
 
 // Constructor for null model
@@ -187,6 +268,15 @@ public:
 	sv_model(const sv_model& pt, const sv_set_list& sls, const sv_box& bx, const sv_model& c1, const sv_model& c2, 
 		    mod_kind k, sv_real c, sv_integer f) { model_info = new model_data(pt, sls, bx, c1, c2, k, c, f); }
 
+// Constructor to place a copy of a (divided) prototype model in the
+// world with a rigid map, in front of the rest of the world model.
+// The prototype is shared, not copied, and queries are mapped into it;
+// an identity map can be used to join two models.  Models holding
+// instances are not divided further by divide() and its relatives.
+
+	sv_model(const sv_model& prototype, const sv_xform& place, const sv_model& rest);
+	sv_model(const sv_model& prototype, const sv_xform& place);
+
 // Initialization of a model
 
 	sv_model(const sv_model& m) { *this = m; }
@@ -198,15 +288,35 @@ public:
 	mod_kind kind() const { return(model_info->kind); }
 	sv_real coord() const { return(model_info->coord); }
 
+// For an INSTANCE_M model, the map from the prototype (child_1) to the
+// world, and its inverse
+
+	sv_xform place() const { return(model_info->xf[1]); }
+	sv_xform unplace() const { return(model_info->xf[0]); }
+
+// For an INSTANCE_M model, a set from the prototype mapped by place();
+// each one is made once and kept, so rays can hand back world sets
+// cheaply
+
+	sv_set placed(const sv_set& s) const { return(model_info->placed(s)); }
+
 // Return the leaf that contains a point
 
 	sv_model leaf(const sv_point&) const;
 
 // Note that the children may be null if the model is a leaf - check with
-// m_kind first.
+// m_kind first.  Children that have been paged out are read back in.
 
-	sv_model child_1() const { return(*(model_info->child_1)); }
-	sv_model child_2() const { return(*(model_info->child_2)); }
+	sv_model child_1() const 
+	{ 
+		if(model_info->pg) page_in();
+		return(*(model_info->child_1)); 
+	}
+	sv_model child_2() const 
+	{ 
+		if(model_info->pg) page_in();
+		return(*(model_info->child_2)); 
+	}
 	sv_model parent() const { return(*(model_info->p)); }
 
 // Make a deep copy
@@ -249,6 +359,16 @@ public:
 
 	sv_model divide(void* vp, sv_decision) const;
 
+// Best-first division: always divide the leaf with the biggest contents
+// times volume next, stopping when the decision procedure is satisfied
+// everywhere or the budget runs out.  complete (if given) is set to 1 
+// in the first case, 0 in the second.  Calling it again on the result
+// carries on refining it.  Like divide(), it balances the sets first if
+// set_balance_division() is on and the model is undivided.
+
+	sv_model divide_budget(void* vp, sv_decision, const sv_div_budget&, 
+		sv_integer* complete = 0) const;
+
 
 // The procedures that (re)facet a model
 
@@ -270,11 +390,27 @@ public:
 		return(member(p, &x));
 	}
 
+// Reorder the sets in the leaves, and the children of their unions
+// and intersections, to make member() cheaper, judged by sampling
+// points in each leaf box (see sv_set::reorder)
+
+	sv_model reorder(sv_integer samples) const;
+
 // Ray-trace into a model
 
 	sv_set fire_ray(const sv_line&, const sv_interval&, sv_real*) const;
 	sv_set fire_ray(const sv_line&, sv_real*) const;
 
+// Does a ray cross any surface in an interval of it (for shadows)?
+
+	sv_integer occluded(const sv_line&, const sv_interval&) const;
+
+// The model's frozen copy (see frozen.h).  It is made on the first call
+// and kept until the model goes; models with sub-trees paged out to
+// disk aren't frozen, and get a null one.
+
+	sv_frozen_model frozen() const;
+
 // Find an approximation to the minimum enclosing box round the objects in
 // a model using the faceter
 
@@ -299,6 +435,10 @@ public:
 
 	void div_stat_report(ostream&) const;
 
+// report the memory the model uses to a stream (memuse.cxx)
+
+	void mem_stat_report(ostream&) const;
+
 // Write and read are public so that the other classes can get at them
 // without everything having to be a friend of everything else.  The
 // user shouldn't normally call these.
@@ -307,6 +447,18 @@ public:
 	friend void write(ostream&, sv_model&,  sv_integer);
 	friend void read(istream&, sv_model&);
 	friend void read1(istream&, sv_model&);
+
+// Memory accounting (memuse.cxx) needs to see inside
+
+	friend class sv_mem_walk;
+
+// So does paging (sv_page.cxx)
+
+	friend struct sv_model_page;
+
+// and frozen copies
+
+	friend class sv_frozen_model;
 	
 // Unique tag
 
@@ -369,6 +521,19 @@ extern sv_model root_model();
 extern void set_swell_fac(sv_real);
 extern sv_real get_swell_fac();
 
+// Balance long union and intersection chains in a model's sets
+// (see sv_set::balance) before dividing it; off by default
+
+extern void set_balance_division(sv_integer);
+extern sv_integer get_balance_division();
+
+// Build a model of n placed copies of prototypes (the prototypes
+// can repeat, and should have been divided already).  The instances
+// are sorted into a tree of boxes so that queries only visit those
+// nearby.
+
+extern sv_model instance_model(const sv_model*, const sv_xform*, sv_integer);
+
 // Two models the same?
 
 extern prim_op same(const sv_model&, const sv_model&);
@@ -382,6 +547,17 @@ extern istream& operator>>(istream&, sv_model&);
 
 extern look_up<sv_model> m_write_list;
 
+// The i/o functions that << and >> call, for other parts of svLis
+// that write and read models
+
+extern void unwrite(sv_model&);
+extern void write(ostream&, sv_model&, sv_integer);
+extern void read(istream&, sv_model&);
+
+// The recursive divider (its argument is an sv_div_data*)
+
+extern void redivide_r(void*);
+
 // The did_ and force_facet procedures; these are in polygon.cxx
 
 extern sv_integer did_facet(const sv_model&, const sv_set&);
@@ -73,6 +73,16 @@
 extern sv_integer degree_s(sv_integer);
 extern sv_integer degree_user(sv_integer);
 
+// Registered user shapes are counted by the primitive records whose
+// kinds are theirs (see sv_uprim.h)
+
+class sv_user_prim_base;
+struct sv_user_eval;
+extern sv_user_prim_base* user_prim(sv_integer);
+extern const sv_user_eval* user_prim_eval(sv_integer);
+extern void user_prim_hold(sv_integer);
+extern void user_prim_drop(sv_integer);
+
 // Note there is no extern istream& operator>>(istream&, prim_kind&)
 // as the kind value in hidden_prim can be any positive integer
 
@@ -80,6 +90,26 @@ extern istream& operator>>(istream&, prim_op&);
 extern void read(istream&, prim_op&);
 extern void read1(istream&, prim_op&);
 
+// The parameters of a sphere, cylinder, cone or torus, found from its
+// planes when its kind is set, so that value(), range() and the 
+// raytracer can use closed forms rather than walking its tree.  If 
+// the planes' normals have length k the value (with d = p - c and 
+// h = d.ax) is
+//
+//	sphere:		k2*d.d - a
+//	cylinder:	k2*(d.d - h^2) - a
+//	cone:		k2*(d.d - (1 + a)*h^2)
+//	torus:		k2*h^2 + (k*sqrt(d.d - h^2) - a)^2 - b
+
+struct sv_shape_data
+{
+	sv_point c;		// Centre, point on the axis, or apex
+	sv_point ax;		// Unit axis
+	sv_real k2, k;		// Squared length of the normals, and length
+	sv_real a, b;		// Radii etc, as above
+	sv_integer along;	// 0, 1 or 2 if ax is along x, y or z, else -1
+};
+
 
 class sv_primitive
 {
@@ -93,71 +123,95 @@ private:
         friend class sv_smart_ptr<prim_data>;
 
         sv_integer kind;	// Indicates if this is a plane, real or compound
-	sv_plane flat;		// Arithmetic is done on planes and reals
-	sv_box block;           // The actual block primitive
-	sv_real r;
 	prim_op op;		// If compound, this says +, -, *, /, ^, or one of the monadics
 	sv_integer degree;	// Highest power (trancendentals add one)
-	sv_primitive *child_1;	// Children if compound
-	sv_primitive *child_2;
-	sv_primitive *grad_x;	// The grad vector of the primitive
-	sv_primitive *grad_y;
-	sv_primitive *grad_z;
 
-        ~prim_data() { delete child_1; delete child_2; delete grad_x; delete grad_y; delete grad_z; }
+// Only one of these is ever wanted, so they share the space; which one
+// is in use is set by op for transforms, and by kind otherwise.  The
+// others (compounds, old-style user primitives, complemented blocks)
+// have block set to 0.
+
+	union
+	{
+		sv_plane flat;		// SV_PLANE: arithmetic is done on planes
+		sv_real r;		// SV_REAL: and reals
+		sv_box* block;		// SV_BLOCK: the actual block (rare, so not inline)
+		sv_xform* xform;	// SV_XFORM: the map into child_1's space
+		const sv_user_eval* user;	// Registered user shapes: how to evaluate
+	};
+
+	sv_shape_data* shape;	// For the special shapes, their parameters
+	sv_smart_ptr<prim_data> child_1;	// Children if compound
+	sv_smart_ptr<prim_data> child_2;
+	sv_smart_ptr<prim_data> grad_x;	// The grad vector of the primitive
+	sv_smart_ptr<prim_data> grad_y;
+	sv_smart_ptr<prim_data> grad_z;
+
+        ~prim_data() 
+	{ 
+		if(op == SV_XFORM) 
+			delete xform;
+		else if(kind == SV_BLOCK) 
+			delete block;
+		delete shape; 
+		if(kind >= S_U_PRIM) user_prim_drop(kind);
+	}
+
+// Records come from a pool, not new
+
+	static void* operator new(size_t s)
+	{
+		if(s != sizeof(prim_data)) return(::operator new(s));
+		return(sv_pool_get(SV_PRIM_POOL, s));
+	}
+
+	static void operator delete(void* p, size_t s)
+	{
+		if(s != sizeof(prim_data)) 
+			::operator delete(p);
+		else
+			sv_pool_put(SV_PRIM_POOL, p);
+	}
 
 // Make a block primitive -- irina
 
-	prim_data(const sv_point& low,const sv_point& high)
+	prim_data(const sv_point& low,const sv_point& high) : block(new sv_box(low, high))
 	{
 		kind = SV_BLOCK;
-		block = sv_box(low, high);
+		shape = 0;
 		degree = 0;
 		op = SV_ZERO;
-		child_1 = new sv_primitive();
-		child_2 = new sv_primitive();
-		grad_x = new sv_primitive();
-		grad_y = new sv_primitive();
-		grad_z = new sv_primitive();
 	}
      // </irina>
 
 // Make a single-plane primitive
 
-	prim_data(const sv_plane& a)
+	prim_data(const sv_plane& a) : flat(a)
 	{
 		kind = SV_PLANE;
-		flat = a;
+		shape = 0;
 		degree = 1;
 		op = SV_ZERO;
-		child_1 = new sv_primitive();
-		child_2 = new sv_primitive();
-		grad_x = new sv_primitive();
-		grad_y = new sv_primitive();
-		grad_z = new sv_primitive();
 	}
 
 // Make a single-real primitive
 
-	prim_data(sv_real a)
+	prim_data(sv_real a) : block(0)
 	{
 		kind = SV_REAL;
 		r = a;
+		shape = 0;
 		degree = 0;
 		op = SV_ZERO;
-		child_1 = new sv_primitive();
-		child_2 = new sv_primitive();
-		grad_x = new sv_primitive();
-		grad_y = new sv_primitive();
-		grad_z = new sv_primitive();
 	}
 
 // Build a compound primitive from two others and a diadic operator
 
-        prim_data(const sv_primitive& a, const sv_primitive& b, prim_op optr)
+        prim_data(const sv_primitive& a, const sv_primitive& b, prim_op optr) : block(0)
 	{
 		kind = SV_GENERAL;
 		op = optr;
+		shape = 0;
 		switch (op)
 		{
 		case SV_PLUS:
@@ -181,31 +235,36 @@ private:
 			svlis_error("hidden_prim constructor", 
 			    "dud operator",SV_CORRUPT);
 		}
-		child_1 = new sv_primitive(a);
-		child_2 = new sv_primitive(b);
-		grad_x = new sv_primitive();
-		grad_y = new sv_primitive();
-		grad_z = new sv_primitive();
+		child_1 = a.prim_info;
+		child_2 = b.prim_info;
 	}
 
 
 // Build a compound primitive from one other and a monadic operator
 
-	prim_data(const sv_primitive& a,  prim_op optr)
+	prim_data(const sv_primitive& a,  prim_op optr) : block(0)
 	{
 		kind = SV_GENERAL;
 		op = optr;
+		shape = 0;
 		degree = a.degree() + 1; // Sort of convention . . .
-		child_1 = new sv_primitive(a);
-		child_2 = new sv_primitive();
-		grad_x = new sv_primitive();
-		grad_y = new sv_primitive();
-		grad_z = new sv_primitive();
+		child_1 = a.prim_info;
+	}
+
+// Transform a primitive; m maps points to where a is evaluated
+
+	prim_data(const sv_primitive& a, const sv_xform& m) : xform(new sv_xform(m))
+	{
+		kind = SV_GENERAL;
+		op = SV_XFORM;
+		shape = 0;
+		degree = a.degree();
+		child_1 = a.prim_info;
 	}
 
 // Make a user-primitive
 
-	prim_data(sv_integer up, sv_integer upx, sv_integer upy, sv_integer upz)
+	prim_data(sv_integer up, sv_integer upx, sv_integer upy, sv_integer upz) : block(0)
 	{
 		kind = up;
 		if (up < S_U_PRIM)
@@ -213,11 +272,21 @@ private:
 		else
 			degree = degree_user(up);
 		op = SV_ZERO;
-		child_1 = new sv_primitive();
-		child_2 = new sv_primitive();
-		grad_x = new sv_primitive();
-		grad_y = new sv_primitive();
-		grad_z = new sv_primitive();
+		shape = 0;
+		if(up >= S_U_PRIM)
+		{
+			user_prim_hold(up);
+			user = user_prim_eval(up);
+		}
+	}
+
+// Change the kind, keeping the count of a user shape's records right
+
+	void re_kind(sv_integer k)
+	{
+		if(k >= S_U_PRIM) user_prim_hold(k);
+		if(kind >= S_U_PRIM) user_prim_drop(kind);
+		kind = k;
 	}
    }; // prim_data
 
@@ -239,6 +308,13 @@ private:
 	  prim_info = new prim_data(a, optr);
 	}
 
+// Build a transform node
+
+	sv_primitive(const sv_primitive& a, const sv_xform& m)
+	{
+	  prim_info = new prim_data(a, m);
+	}
+
 // Priveleged (Re)Set flag bit(s)
 
     void set_flags_priv(sv_integer a) { prim_info->set_flags(a); }
@@ -246,10 +322,24 @@ private:
 
 // Set the special shapes
 
-    void set_kind(sv_integer k) { prim_info->kind = k; }
+    void set_kind(sv_integer k) { prim_info->re_kind(k); fit_shape(); }
+    void fit_shape();
+
+// Wrap a record in a handle (the children are kept as bare records)
+
+    static sv_primitive wrap(const sv_smart_ptr<prim_data>& p)
+    {
+	sv_primitive w;
+	w.prim_info = p;
+	return(w);
+    }
 
     friend void lazy_grad(const sv_primitive&, sv_primitive&, sv_primitive&, sv_primitive&);
 
+// Push transforms down to the planes (see bake())
+
+    static sv_primitive bake_back(const sv_primitive&, const sv_xform*);
+
 public:
 
 // Null primitive
@@ -280,16 +370,17 @@ public:
 // Functions to return the hidden data
 
 	sv_integer flags() const { return(prim_info->flags()); }
-	sv_plane plane() const { return(prim_info->flat); }
-	sv_real real() const { return(prim_info->r); }
-	sv_box block() const { return(prim_info->block); } // --irina
+	sv_plane plane() const { return(prim_info->kind == SV_PLANE ? prim_info->flat : sv_plane()); }
+	sv_real real() const { return(prim_info->kind == SV_REAL ? prim_info->r : 0); }
+	sv_box block() const { return( (prim_info->kind == SV_BLOCK) && (prim_info->op != SV_XFORM) && 
+		prim_info->block ? *(prim_info->block) : sv_box()); } // --irina
 	sv_integer kind() const { return(prim_info->kind); }
 	prim_op parameters(sv_integer*, sv_real*, sv_real*, sv_real*, sv_plane*, 
 		sv_point*, sv_line*) const;
 	prim_op op() const { return(prim_info->op); }
 	sv_integer degree() const  { return(prim_info->degree); }
-	sv_primitive child_1() const { return(*(prim_info->child_1)); }
-	sv_primitive child_2() const { return(*(prim_info->child_2)); }
+	sv_primitive child_1() const { return(wrap(prim_info->child_1)); }
+	sv_primitive child_2() const { return(wrap(prim_info->child_2)); }
 	sv_primitive grad_x() const;
 	sv_primitive grad_y() const;
 	sv_primitive grad_z() const;
@@ -368,6 +459,21 @@ public:
 
 	sv_primitive scale(const sv_line&, sv_real) const;
 
+// Any affine transform, done lazily: the result is a node that maps
+// points back before evaluating this, so it takes no time whatever
+// the size of the primitive, and transforming it again just combines
+// the maps.  bake() pushes the maps down onto the planes, as the
+// transforms above do (user primitives stay lazy).  For an SV_XFORM
+// node xform() is the map back into child_1()'s space.
+
+	sv_primitive transform(const sv_xform&) const;
+	sv_primitive bake() const;
+	sv_xform xform() const { return(prim_info->op == SV_XFORM ? *(prim_info->xform) : sv_xform()); }
+
+// The closed-form parameters of a special shape (0 if there are none)
+
+	const sv_shape_data* shape() const { return(prim_info->shape); }
+
 // Complement a sv_primitive
 
 	friend sv_primitive operator-(const sv_primitive&);
@@ -415,6 +521,10 @@ public:
 	friend void write(ostream&, sv_primitive&, sv_integer);
 	friend void read(istream&, sv_primitive&);
 	friend void read1(istream&, sv_primitive&);
+
+// Memory accounting (memuse.cxx) needs to see inside
+
+	friend class sv_mem_walk;
 };
 
 
@@ -521,40 +631,40 @@ extern istream& operator>>(istream&, sv_primitive&);
 inline sv_primitive sv_primitive::grad_x() const 
 {
         sv_primitive x, y, z;
-	if (!prim_info->grad_x->exists()) 
+	if (!prim_info->grad_x.exists()) 
 	{
 	  lazy_grad(*this, x, y, z);
-	  *(prim_info->grad_x) = x;
-	  *(prim_info->grad_y) = y;
-	  *(prim_info->grad_z) = z;
+	  prim_info->grad_x = x.prim_info;
+	  prim_info->grad_y = y.prim_info;
+	  prim_info->grad_z = z.prim_info;
 	}
-	return(*(prim_info->grad_x));
+	return(wrap(prim_info->grad_x));
 }
 
 inline sv_primitive sv_primitive::grad_y() const 
 {
         sv_primitive x, y, z;
-	if (!prim_info->grad_y->exists()) 
+	if (!prim_info->grad_y.exists()) 
 	{
 	  lazy_grad(*this, x, y, z);
-	  *(prim_info->grad_x) = x;
-	  *(prim_info->grad_y) = y;
-	  *(prim_info->grad_z) = z;
+	  prim_info->grad_x = x.prim_info;
+	  prim_info->grad_y = y.prim_info;
+	  prim_info->grad_z = z.prim_info;
 	}
-	return(*(prim_info->grad_y));
+	return(wrap(prim_info->grad_y));
 }
 
 inline sv_primitive sv_primitive::grad_z() const 
 {
         sv_primitive x, y, z;
-	if (!prim_info->grad_z->exists()) 
+	if (!prim_info->grad_z.exists()) 
 	{
 	  lazy_grad(*this, x, y, z);
-	  *(prim_info->grad_x) = x;
-	  *(prim_info->grad_y) = y;
-	  *(prim_info->grad_z) = z;
+	  prim_info->grad_x = x.prim_info;
+	  prim_info->grad_y = y.prim_info;
+	  prim_info->grad_z = z.prim_info;
 	}
-	return(*(prim_info->grad_z));
+	return(wrap(prim_info->grad_z));
 }
 
 
@@ -566,9 +676,17 @@ inline sv_primitive operator-(const sv_primitive& a)
 {
         if(a.op() == SV_COMP) return(a.child_1());
 
+// Registered user shapes complement themselves
+
+	if( (a.kind() >= S_U_PRIM) && user_prim(a.kind()) )
+	{
+		sv_primitive u = complement_user(a.kind());
+		if(u.exists()) return(u);
+	}
+
 	sv_primitive b = sv_primitive(a, SV_COMP);
 
-	b.prim_info->kind = a.kind();	// Shape's the same
+	b.prim_info->re_kind(a.kind());	// Shape's the same
 	if(a.kind() == SV_REAL) b.prim_info->r = -a.real();
 	if(a.kind() == SV_PLANE) b.prim_info->flat = -a.plane();
 	return(b);
@@ -62,8 +62,20 @@
 
 sv_set ray_model_test(const sv_model&, const sv_line&, const sv_real&, 
     const sv_interval&, sv_real*);
+sv_set ray_instance_test(const sv_model&, const sv_line&, const sv_real&, 
+    const sv_interval&, sv_real*);
 sv_set ray_leaf_node_test(const sv_set_list&, const sv_line& , const sv_real& , 
 	const sv_interval&, sv_real*);
+sv_set ray_leaf_node_test(const sv_set*, sv_integer, const sv_line& , const sv_real& , 
+	const sv_interval&, sv_real*);
+sv_integer ray_model_occluded(const sv_model&, const sv_line&, const sv_real&, 
+    const sv_interval&);
+sv_integer ray_instance_occluded(const sv_model&, const sv_line&, const sv_real&, 
+    const sv_interval&);
+sv_integer ray_leaf_node_occluded(const sv_set_list&, const sv_line& , const sv_real& , 
+	const sv_interval&);
+sv_integer ray_leaf_node_occluded(const sv_set*, sv_integer, const sv_line& , const sv_real& , 
+	const sv_interval&);
 sorted_interval_list ray_set_intersection_test(const sv_set&, const sv_line&, 
 	const sv_real&, const sv_real&);
 sorted_interval_list ray_test(const sv_set&, const sv_line&, const sv_real&, const sv_real&);
@@ -73,4 +85,10 @@ sv_integer prim_is_polynomial(const sv_primitive&);
 void set_debug_ray_number(sv_integer);
 sv_integer get_debug_ray_number(void);
 
+// Non-polynomial primitives are marched along rays using bounds on
+// their grads, rather than just subdivided (non-zero; the default is 0)
+
+void set_arf_march(sv_integer);
+sv_integer get_arf_march(void);
+
 #endif
@@ -61,8 +61,18 @@
 #define SVLIS_SHADE
 
 void init_surface_data(void);
+
+// The surfaces of the sets in a model, looked up once for a render.
+// Each render makes its own and passes it to shade(); with none, the
+// surface is looked up every time a set is hit.
+
+struct sv_shade_materials;
+sv_shade_materials* make_shade_materials(const sv_model&);
+void drop_shade_materials(sv_shade_materials*);
+
 sv_point shade(const sv_model&, const sv_point, const sv_set, const sv_point&, 
-    const sv_view&, const sv_light_list&,const sv_real&, const sv_real&);
+    const sv_view&, const sv_light_list&,const sv_real&, const sv_real&,
+    const sv_shade_materials* = 0);
 void set_ambient_light_level(sv_point, sv_real);
 void set_mist(const sv_point&);
 void set_back(sv_real);
@@ -216,6 +216,19 @@ class sv_refct
      lock.open();
    }
 
+// Add a reference only if someone else still holds one; a record whose
+// count has reached 0 is being deleted and mustn't be brought back
+
+   int add_live_reference()
+   {
+     int live;
+     lock.shut();
+     live = (ref_count > 0);
+     if(live) ++ref_count;
+     lock.open();
+     return(live);
+   }
+
    virtual void remove_reference() 
    {
      lock.shut();
@@ -398,6 +411,123 @@ a:             id[inow] = tc;
       free = 0;
     }
 
+// Exchange the lists with another's, so something can be read with
+// lists of its own without disturbing a read in progress
+
+    void swap(look_up& o)
+    {
+      long* i = id; id = o.id; o.id = i;
+      T* c = sv_class; sv_class = o.sv_class; o.sv_class = c;
+      sv_integer k;
+      k = length; length = o.length; o.length = k;
+      k = sorted; sorted = o.sorted; o.sorted = k;
+      k = free; free = o.free; o.free = k;
+      k = sort_interval; sort_interval = o.sort_interval; o.sort_interval = k;
+    }
+
+};
+
+
+// Hash table from record addresses (the unique() values of handles,
+// which are never 0) to T, for walks over shared records that must
+// know which ones they have seen.  Open addressing; pointers it hands
+// back last until the next add().
+
+template<class T>
+class key_table
+{
+	long* key;
+	T* val;
+	sv_integer size;	// A power of 2
+	sv_integer count;
+
+	key_table(const key_table&);
+	key_table& operator=(const key_table&);
+
+	sv_integer slot(long k) const
+	{
+		unsigned long h = ((unsigned long)k >> 4)*2654435761UL;
+		sv_integer i = (sv_integer)(h & (unsigned long)(size - 1));
+		while(key[i] && (key[i] != k)) i = (i + 1) & (size - 1);
+		return(i);
+	}
+
+	void grow()
+	{
+		long* ok = key;
+		T* ov = val;
+		sv_integer os = size;
+		sv_integer i, j;
+		size = 2*size;
+		key = new long[size];
+		val = new T[size];
+		for(i = 0; i < size; i++) key[i] = 0;
+		for(i = 0; i < os; i++)
+		{
+			if(!ok[i]) continue;
+			j = slot(ok[i]);
+			key[j] = ok[i];
+			val[j] = ov[i];
+		}
+		delete [] ok;
+		delete [] ov;
+	}
+
+public:
+
+	key_table(sv_integer s = 256)
+	{
+		size = 16;
+		while(size < s) size = 2*size;
+		count = 0;
+		key = new long[size];
+		val = new T[size];
+		for(sv_integer i = 0; i < size; i++) key[i] = 0;
+	}
+
+	~key_table() { delete [] key; delete [] val; }
+
+// How many keys
+
+	sv_integer entries() const { return(count); }
+
+// The entry for k, or 0 if there isn't one
+
+	T* find(long k) const
+	{
+		sv_integer i = slot(k);
+		return(key[i] ? &val[i] : 0);
+	}
+
+// The entry for k; if there isn't one a new one (T()) is made and
+// added is set
+
+	T* add(long k, int* added)
+	{
+		if(2*(count + 1) > size) grow();
+		sv_integer i = slot(k);
+		*added = !key[i];
+		if(*added)
+		{
+			key[i] = k;
+			val[i] = T();
+			count++;
+		}
+		return(&val[i]);
+	}
+
+// Empty the table, releasing any references the entries hold
+
+	void clean()
+	{
+		T dum = T();
+		for(sv_integer i = 0; i < size; i++)
+		{
+			if(key[i]) val[i] = dum;
+			key[i] = 0;
+		}
+		count = 0;
+	}
 };
 
 
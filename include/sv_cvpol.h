@@ -0,0 +1,136 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Convex polyhedra held as packed plane arrays
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_CVPOL
+#define SVLIS_CVPOL
+
+// An intersection of planar half-spaces (a set flagged SV_CV_POL) is
+// a convex polyhedron.  The first time such a set is tested its planes
+// are copied into separate x, y, z and d arrays, padded to a multiple of
+// SV_CV_PACK with planes that everything is inside, so that all the
+// planes can be tested against a point or a box in one straight loop
+// that the compiler can vectorise.  If the polyhedron is bounded its
+// vertices and edge directions are kept too, so that a box that
+// misses it can be found exactly by separating axes.
+
+#define SV_CV_PACK 4		// Planes are padded to a multiple of this
+#define SV_CV_MAX 32		// Sets with more planes than this aren't packed
+
+class sv_cv_pol
+{
+private:
+
+	sv_integer n;			// How many planes
+	sv_integer np;			// n rounded up to a multiple of SV_CV_PACK
+	sv_real* px;			// The planes: normal x, y, z and d
+	sv_real* py;
+	sv_real* pz;
+	sv_real* pd;
+	sv_set* leaf;			// The half-space that each plane came from
+	sv_integer nv;			// How many vertices (0 if unbounded)
+	sv_point* vert;
+	sv_integer ne;			// How many edge directions
+	sv_point* edge;
+	sv_box hull;			// The box round the vertices
+
+	void find_vertices();
+
+public:
+
+// Build from the n half-spaces in h[]; each must be a plane, or a
+// plane times a non-zero constant
+
+	sv_cv_pol(const sv_set* h, sv_integer count);
+
+	~sv_cv_pol();
+
+// Can a set leaf be packed?  (Returns 0, 1 for a plane, or -1 for a
+// plane times a negative constant.)
+
+	static int packable(const sv_set&);
+
+// Number of planes, each plane, and the half-space it came from
+
+	sv_integer planes() const { return(n); }
+	sv_plane plane(sv_integer i) const;
+	const sv_set& half_space(sv_integer i) const { return(leaf[i]); }
+
+// Is the polyhedron bounded?
+
+	int bounded() const { return(nv > 0); }
+
+// Membership test a point; the same as testing the planes in turn
+
+	mem_test member(const sv_point&) const;
+
+// Classify a box: SV_AIR if the box misses the polyhedron, SV_SOLID
+// if it's inside all the planes, and SV_SURFACE if it straddles all
+// of them.  Returns -1 if it's inside some and straddles others.
+
+	sv_integer box_test(const sv_box&) const;
+
+// Clip a line to the polyhedron, giving the parameter interval inside
+// it and the half-spaces it enters and leaves by (null at +/-LARGE).
+// Returns 0 if the line misses.
+
+	int clip(const sv_line&, sv_real big, sv_interval*, sv_set*, sv_set*) const;
+
+// Heap bytes used
+
+	long bytes() const;
+};
+
+#endif
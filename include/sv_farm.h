@@ -0,0 +1,87 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Rendering pictures with a farm of worker processes
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_FARM
+#define SVLIS_FARM
+
+// generate_picture_farm() renders a picture in tiles, shared out
+// among worker processes.  The calling process is the coordinator: it
+// forks the workers (which so get the model, the view and the lights
+// without their having to be sent) and talks to each over a local
+// socket, sending it the corners of a tile and getting back the
+// tile's pixels.  Each worker is given a new tile as soon as it
+// returns one.  If a worker dies its tile is given to another; when
+// no tiles are left to start, idle workers are given copies of tiles
+// that are still being rendered, and whichever copy comes back first
+// is used, so one slow worker can't hold up the picture.  If all the
+// workers fail the coordinator finishes the picture itself.  Where
+// there's no fork (or workers < 1) it is just generate_picture().
+
+#define SV_FARM_TILE 32		// Default tile size in pixels
+
+sv_integer generate_picture_farm(const sv_model&, const sv_view&,
+	const sv_light_list&, sv_picture&, sv_integer workers);
+
+sv_integer generate_picture_farm(const sv_model&, const sv_view&,
+	const sv_light_list&, sv_picture&, sv_integer workers, sv_real,
+	void report_procedure(sv_real));
+
+// The size of the (square) tiles
+
+void set_farm_tile(sv_integer);
+sv_integer get_farm_tile(void);
+
+#endif
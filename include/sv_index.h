@@ -0,0 +1,141 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Bounding-box index over the sets in a set list
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_INDEX
+#define SVLIS_INDEX
+
+// A bounding-volume hierarchy over the conservative bounding boxes
+// of the items (sets) in a long set list; item i is the list's i-th
+// set.  The boxes were found inside a region, and only queries inside
+// that region can be answered.  A list made by pruning an indexed list
+// gets its own index, made from the bounds of the sets it kept.
+
+#define SV_INDEX_LEAF 4		// Most items in a tree leaf
+
+class sv_box_index : public sv_refct
+{
+	friend class sv_smart_ptr<sv_box_index>;
+
+private:
+
+	struct index_node
+	{
+		sv_real lim[6];		// Bounds: x lo, x hi, y lo, y hi, z lo, z hi
+		sv_integer first;	// Leaf: first entry in order[]; interior: -1
+		sv_integer count;	// Leaf: number of items; interior: second child
+	};				// (the first child is the next node)
+
+	sv_box reg;			// The region the bounds were found in
+	sv_integer items;		// How many items
+	sv_integer filled;		// How many of them aren't empty
+	sv_real* lim;			// Item bounds, 6 per item
+	sv_integer* order;		// Items in tree-leaf order
+	index_node* node;		// The tree
+	sv_integer nodes;
+
+	sv_integer build(sv_integer first, sv_integer count);
+
+	~sv_box_index()
+	{
+		delete [] lim;
+		delete [] order;
+		delete [] node;
+	}
+
+public:
+
+// An index for n items in region r; all the items start empty
+
+	sv_box_index(const sv_box& r, sv_integer n);
+
+// Set the bounds of item i (before make_tree())
+
+	void item(sv_integer i, const sv_box& b);
+
+// Copy item j of another index to item i of this
+
+	void item(sv_integer i, const sv_box_index& from, sv_integer j);
+
+// Build the tree once all the items are in
+
+	void make_tree();
+
+// Number of items, and the region
+
+	sv_integer count() const { return(items); }
+	const sv_box& region() const { return(reg); }
+
+// Can the index answer for box b?
+
+	int covers(const sv_box& b) const { return(b.inside(reg)); }
+
+// Set hit[i] = 1 for every item whose bounds overlap box b; hit[]
+// must be count() long and zeroed.  Returns the number hit.
+
+	sv_integer query(const sv_box& b, char* hit) const;
+
+// All the items in tree-leaf order, so ones near each other are
+// together and halving the list repeatedly follows the tree; the
+// empty ones come last.  o[] must be count() long.
+
+	void spatial_order(sv_integer* o) const;
+
+// Heap bytes used
+
+	long bytes() const;
+};
+
+#endif
@@ -0,0 +1,148 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Compiling primitives and sets to native code
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_JIT
+#define SVLIS_JIT
+
+// A primitive or set can be turned into straight-line C++ for its
+// value at a point (and, for a primitive, its grad), which is compiled
+// by the system compiler into a shared object and loaded.  The shared
+// objects are kept in a cache directory, named by a hash of the code,
+// so the same shape is only compiled once.  Anything that can't be
+// compiled (user primitives, no compiler, no dlopen) falls back to the
+// ordinary tree-walking code, so the answers are always there; ranges
+// over boxes always use it.
+
+// The signatures of the generated functions.  Parts of a primitive
+// that aren't turned into code are evaluated by calling back with
+// their number.
+
+typedef double (*sv_jit_callback)(void*, long, double, double, double);
+typedef double (*sv_jit_value_fn)(double, double, double, void*, sv_jit_callback);
+typedef void (*sv_jit_grad_fn)(double, double, double, double*, void*, sv_jit_callback);
+
+// A compiled primitive
+
+class sv_jit_prim
+{
+private:
+	sv_primitive p;
+	sv_primitive* leaf;		// Parts left to the interpreter
+	sv_jit_value_fn v;
+	sv_jit_grad_fn g;
+
+	sv_jit_prim(const sv_jit_prim&);	// No copying
+	sv_jit_prim& operator=(const sv_jit_prim&);
+
+public:
+
+// Compile a primitive (this may take a while the first time)
+
+	sv_jit_prim(const sv_primitive&);
+	~sv_jit_prim() { delete [] leaf; }
+
+// Did it work?
+
+	int compiled() const { return(v != 0); }
+
+// The primitive, and its value, grad and range
+
+	sv_primitive primitive() const { return(p); }
+	sv_real value(const sv_point&) const;
+	sv_point grad(const sv_point&) const;
+	sv_interval range(const sv_box& b) const { return(p.range(b)); }
+};
+
+// A compiled set (value and membership only)
+
+class sv_jit_set
+{
+private:
+	sv_set s;
+	sv_primitive* leaf;
+	sv_jit_value_fn v;
+
+	sv_jit_set(const sv_jit_set&);
+	sv_jit_set& operator=(const sv_jit_set&);
+
+public:
+
+	sv_jit_set(const sv_set&);
+	~sv_jit_set() { delete [] leaf; }
+
+	int compiled() const { return(v != 0); }
+
+	sv_set set() const { return(s); }
+	sv_real value(const sv_point&) const;
+	mem_test member(const sv_point&) const;
+};
+
+// Turn compilation on or off (on by default; off makes everything
+// use the interpreter), set the compiler (a program, found on the
+// PATH, not a command line; default "c++") and the cache directory
+// (default $SVLIS_JIT_CACHE, or svlis_jit in $XDG_CACHE_HOME or
+// $HOME/.cache, or else a new private directory in /tmp).  The cache
+// and everything loaded from it must belong to the user and be
+// writable by no one else, or the interpreter is used instead.
+
+extern void set_jit(sv_integer);
+extern sv_integer get_jit();
+extern void set_jit_compiler(const char*);
+extern const char* get_jit_compiler();
+extern void set_jit_cache(const char*);
+extern const char* get_jit_cache();
+
+#endif
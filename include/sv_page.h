@@ -0,0 +1,103 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Out-of-core models: division trees with sub-trees on disk
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 19 October 2026
+ *
+ */
+
+#ifndef SVLIS_PAGE
+#define SVLIS_PAGE
+
+// A paged model is an ordinary divided model in which the children
+// of the boxes at a chosen depth are kept in a page file rather than
+// in memory.  child_1() and child_2() read them back when they're
+// wanted, so leaf(), member(), fire_ray(), facet() and everything
+// else work on paged models unchanged.  The sub-trees that have been
+// read are kept in memory, least recently used first out, up to a
+// memory limit; a sub-tree still in use when it's dropped lives on
+// until it's finished with.  Reading pages back isn't thread-safe, so
+// don't share paged models between threads (divide_paged() may divide
+// in several threads, as pages are written one at a time).
+//
+// A page file belongs to the process that made it (it refers to the
+// parts of the model still in memory) and is deleted when the last of
+// its pages goes.  If file is 0 a temporary file is used.  Trees of
+// instances are never paged, and nor are sub-trees holding polygons
+// from the faceter, as the polygons don't survive being written out
+// and read back.  Pages go through the ordinary model text i/o, except
+// that every use of a set keeps its own attributes (surfaces and all),
+// so a set shared under different attributes reads back as it was.
+// Pages are read with input tables of their own, so a page can be read
+// in the middle of the user reading a file.
+
+#define SV_PAGE_MEMORY 67108864L	// Default limit (bytes) for paged-in sub-trees
+
+// Page out the sub-trees below depth of a divided model (the root is
+// depth 0).  The result is a new model; the original is unchanged.
+
+extern sv_model page_model(const sv_model&, sv_integer depth, 
+	const char* file = 0);
+
+// Divide a model, paging out each sub-tree below depth as soon as it
+// has been divided, so that the whole tree is never in memory at once
+
+extern sv_model divide_paged(const sv_model&, void*, sv_decision, 
+	sv_integer depth, const char* file = 0);
+
+// The memory limit for paged-in sub-trees, and how much they are
+// taking now
+
+extern void set_page_memory(long);
+extern long get_page_memory();
+extern long paged_in_bytes();
+
+#endif
@@ -0,0 +1,128 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Pooled allocation of fixed-size nodes
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_POOL
+#define SVLIS_POOL
+
+// The reference-counted records that svLis makes in huge numbers
+// (primitives, sets) come from pools of fixed-size blocks rather
+// than from new.  Each thread keeps its own free list so getting
+// and returning a block takes no lock; blocks are carved from big
+// chunks, and a finishing thread hands its free blocks back for
+// others to use.
+//
+// The pool never returns memory to the system: chunks live until the
+// program ends, and freed blocks are only ever reused for records of
+// the same kind.  A program's footprint therefore stays at the most
+// primitives and sets it ever had at once (sv_pool_system_bytes()
+// says how much that is).
+
+enum sv_pool_id
+{
+	SV_PRIM_POOL,
+	SV_SET_POOL,
+	SV_POOLS		// Must be last
+};
+
+#define SV_POOL_CHUNK 65536	// Bytes carved at a time
+
+// Pool blocks are rounded up to this
+
+inline size_t sv_pool_bytes(size_t n) { return((n + 15) & ~((size_t)15)); }
+
+struct sv_pool_node
+{
+	sv_pool_node* next;
+};
+
+// Each thread's free lists, and whether it has any (0 not yet, 1 yes,
+// 2 it is finishing and blocks go straight back to the shared spares)
+
+extern SV_THREAD_LOCAL sv_pool_node* sv_pool_free[SV_POOLS];
+extern SV_THREAD_LOCAL int sv_pool_state;
+extern void* sv_pool_refill(sv_integer pool, size_t bytes);
+extern void sv_pool_give(sv_integer pool, void* p);
+
+// Blocks must always go back to the pool they came from, and all
+// the blocks in one pool must be the same size
+
+inline void* sv_pool_get(sv_integer pool, size_t bytes)
+{
+	sv_pool_node* n = sv_pool_free[pool];
+	if(!n) return(sv_pool_refill(pool, bytes));
+	sv_pool_free[pool] = n->next;
+	return((void*)n);
+}
+
+inline void sv_pool_put(sv_integer pool, void* p)
+{
+	sv_pool_node* n = (sv_pool_node*)p;
+	if(sv_pool_state != 1)
+	{
+		sv_pool_give(pool, p);
+		return;
+	}
+	n->next = sv_pool_free[pool];
+	sv_pool_free[pool] = n;
+}
+
+// How many blocks of each pool have been carved, and the bytes
+// taken from the system in all
+
+extern long sv_pool_blocks(sv_integer pool);
+extern long sv_pool_system_bytes();
+
+#endif
@@ -64,6 +64,18 @@ sv_integer generate_picture(const sv_model&, const sv_view&,
 sv_integer generate_picture(const sv_model&, const sv_view&, 
 	const sv_light_list&, sv_picture&, sv_real, void report_procedure(sv_real));
 
+struct sv_shade_materials;
+
+// Render the pixels [x0, x1) x [y0, y1) of a picture using a frozen
+// copy of the model and the shading materials made for the render by
+// make_shade_materials() (either may be null).  generate_picture() is
+// this for every row.
+
+sv_integer generate_picture_tile(const sv_model&, const sv_frozen_model&,
+	const sv_shade_materials*, const sv_view&, const sv_light_list&, 
+	sv_picture&, sv_integer x0,
+	sv_integer y0, sv_integer x1, sv_integer y1);
+
 // Interactive ray-tracer (retained for backwards compatibility)
 
 // Get commands from cin
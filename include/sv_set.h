@@ -70,6 +70,10 @@ extern void write(ostream&, set_op);
 
 sv_integer sv_c_flag(const sv_primitive&);
 
+// Packed planes of a convex polyhedron (see sv_cvpol.h)
+
+class sv_cv_pol;
+
 
 class sv_set
 {
@@ -85,11 +89,33 @@ private:
         set_op op;              // Operator to apply to children.
         sv_integer contents;	// EVERYTHING, NOTHING, or primitive count
         sv_primitive prim;	// If the set is a single half-space
-        sv_set *child_1;	// Children if the set is compound
-        sv_set *child_2;
-        sv_set *complement;	// The set's complement (see -set)
+        sv_smart_ptr<set_data> child_1;	// Children if the set is compound
+        sv_smart_ptr<set_data> child_2;
+        sv_smart_ptr<set_data> complement;	// The set's complement (see -set)
+        sv_attribute a_1;	// The attributes that go with those three
+        sv_attribute a_2;
+        sv_attribute a_c;
+        sv_cv_pol* cv;		// Packed planes if this is a convex polyhedron
+        int cv_state;		// Whether they've been packed yet (see cv_pol())
+        sv_box* bal;		// Box and bounds of a balanced node (see balance())
+
+        ~set_data();
 
-        ~set_data() { delete child_1; delete child_2; delete complement; }
+// Records come from a pool, not new
+
+	static void* operator new(size_t s)
+	{
+		if(s != sizeof(set_data)) return(::operator new(s));
+		return(sv_pool_get(SV_SET_POOL, s));
+	}
+
+	static void operator delete(void* p, size_t s)
+	{
+		if(s != sizeof(set_data)) 
+			::operator delete(p);
+		else
+			sv_pool_put(SV_SET_POOL, p);
+	}
 
 // Special reference count decrement to handle *complement <-> *this
 
@@ -98,20 +124,19 @@ private:
            lock.shut();
            --ref_count;
 
-           if ((ref_count == 1) && complement->exists()) // From the complement?
+           if ((ref_count == 1) && complement.exists()) // From the complement?
            {
-	      complement->set_info->lock.shut();
-	      if(complement->set_info->ref_count == 1)
+	      complement->lock.shut();
+	      if(complement->ref_count == 1)
 	      {
 		ref_count = 10; // Hack
-		complement->set_info->lock.open();
+		complement->lock.open();
 		lock.open();
-		delete complement;
-		complement = 0;
+		complement = sv_smart_ptr<set_data>();
 		delete this;
 	      } else
 	      {
-		complement->set_info->lock.open();
+		complement->lock.open();
 		lock.open();
 	      }
 
@@ -134,9 +159,9 @@ private:
 		    svlis_error("set_data(sv_integer)",
 			"sv_set neither null nor universal set",SV_WARNING);
 		contents = a;
-		child_1 = new sv_set();
-		child_2 = new sv_set();
-		complement = new sv_set();
+		cv = 0;
+		cv_state = 0;
+		bal = 0;
 	}
 
 // Constructor for set that will be a simple primitive 
@@ -154,13 +179,13 @@ private:
 	        contents = 1;
 
 	   prim = p;
+	   cv = 0;
+	   cv_state = 0;
+	   bal = 0;
 
 // A single plane is a convex polygon - sv_c_flag detects this
 
 	   set_flags(sv_c_flag(p));
-	   child_1 = new sv_set();
-	   child_2 = new sv_set();
-	   complement = new sv_set();
         }
 
 // Constructor to build a compound set
@@ -169,16 +194,21 @@ private:
 	{
 		op = optr;
 		contents = a.contents() + b.contents();
-		child_1 = new sv_set(a);
-		child_2 = new sv_set(b);
-	        complement = new sv_set();
+		child_1 = a.set_info;
+		a_1 = a.a;
+		child_2 = b.set_info;
+		a_2 = b.a;
+		cv = 0;
+		cv_state = 0;
+		bal = 0;
 	}
 
 // Set the complenment
 
         void set_complement(const sv_set& c) 
         {
-	  *complement = c;
+	  complement = c.set_info;
+	  a_c = c.a;
         }
 
    }; // set_data
@@ -190,7 +220,7 @@ private:
 
 // Deal with complementation
 
-	sv_set complement() const { return(*(set_info->complement)); }
+	sv_set complement() const { return(wrap(set_info->complement, set_info->a_c)); }
 	void complement(const sv_set& c) { set_info->set_complement(c); }
 
 // Constructor for set that is compound.
@@ -204,6 +234,27 @@ private:
 
 	friend struct set_data;
 
+// Wrap a record and its attribute in a handle
+
+	static sv_set wrap(const sv_smart_ptr<set_data>& p, const sv_attribute& at)
+	{
+		sv_set w;
+		w.set_info = p;
+		w.a = at;
+		return(w);
+	}
+
+// Pack the planes of a convex intersection the first time they're
+// wanted; prune() doesn't pack the sets it makes itself
+
+	const sv_cv_pol* cv_find(int for_prune) const;
+	const sv_cv_pol* cv_packed() const;
+
+// Balanced tree over some sets (see balance())
+
+	static sv_set balance_tree(const sv_set*, const sv_box*, sv_integer, set_op,
+		const sv_box&, sv_box*);
+
 // This is the pointer that gets ref counted
 
    sv_smart_ptr<set_data> set_info;
@@ -237,13 +288,22 @@ public:
 	sv_integer contents() const { return(set_info->contents); }
 	set_op op() const { return(set_info->op); }
 	sv_primitive primitive() const { return(set_info->prim); }
-	sv_set child_1() const { return(*(set_info->child_1)); }
-	sv_set child_2() const { return(*(set_info->child_2)); }
+	sv_set child_1() const { return(wrap(set_info->child_1, set_info->a_1)); }
+	sv_set child_2() const { return(wrap(set_info->child_2, set_info->a_2)); }
 	sv_integer flags() const { return(set_info->flags()); }
 	sv_set disjunctive_form() const;
 	sv_set_list list_products() const;
 	sv_point grad(const sv_point&, sv_real&) const;
 
+// The packed planes, if this is a convex polyhedron (else 0); they're
+// packed the first time they're asked for
+
+	const sv_cv_pol* cv_pol() const { return(cv_find(0)); }
+
+// The box a balanced node was made in and its bounds there (else 0)
+
+	const sv_box* balance_bounds() const { return(set_info->bal); }
+
 // Deep copy
 
 	sv_set deep() const;
@@ -298,6 +358,17 @@ public:
 
 	mem_test member(const sv_point&, sv_primitive []) const;
 
+// Swap the children of unions and intersections where that makes
+// member() cheaper on average, judged by sampling points in a box.
+// The geometry is unchanged.
+
+	sv_set reorder(const sv_box&, sv_integer samples) const;
+
+// The same for given points; also gives the membership and cost (in
+// primitive evaluations) at each point with the new order
+
+	sv_set reorder(const sv_point[], sv_integer, mem_test[], sv_real[]) const;
+
 // Value for a point (and winning leaf)
 
 	sv_real value(const sv_point&, sv_set*) const;
@@ -330,6 +401,14 @@ public:
 
 	sv_set mirror(const sv_plane&) const;
 
+// Any affine transform.  Only the set's own structure is copied; the
+// primitives get lazy transform nodes (see sv_primitive::transform()).
+// bake() pushes the transforms in all the primitives down to their
+// planes.
+
+	sv_set transform(const sv_xform&) const;
+	sv_set bake() const;
+
 // Are two sets the same?  (NB this completely ignores attributes
 // and is only concerned with geometry.)  This needs access to
 // the complement, and so is a friend
@@ -340,6 +419,12 @@ public:
 
 	sv_set regularize() const;
 
+// Rebuild long union or intersection chains as trees balanced
+// over a box.  The new nodes know their bounds in the box, so
+// member() and prune() skip the parts of the tree that are far away.
+
+	sv_set balance(const sv_box&) const;
+
 // Attribute stuff.
 // Colour, string, and polygons as attributes - special member functions cos 
 // they're so common, also surface
@@ -385,6 +470,10 @@ public:
 
 	friend sv_integer contents_4(const sv_model& mm, const sv_set& s, int force);
 
+// Memory accounting (memuse.cxx) needs to see inside
+
+	friend class sv_mem_walk;
+
 }; // sv_set
 
 
@@ -409,11 +498,25 @@ extern istream& operator>>(istream&, sv_set&);
 
 extern look_up<sv_set> s_write_list;
 
+// A set is written out in full once; after that it's written as a
+// reference, which reads back with the attribute it was first written
+// with.  While this is non-zero references carry their own attributes
+// too, so a set shared under different attributes keeps them all (see
+// sv_page.h).
+
+extern sv_integer s_ref_attributes;
+
 // Set flag for whether the results of pruning are
 // regularized (true forces regularization)
 
 extern void regular_prune(sv_integer);
 
+// Set lists with at least this many sets get an index of the sets'
+// bounds the first time they are pruned (0 for never)
+
+extern void set_index_min(sv_integer);
+extern sv_integer get_index_min();
+
 // ************** Inlines
 
 // Simplest way to subtract a point is to negate it and add
@@ -481,6 +584,7 @@ private:
 
 	sv_set s;			// The set
 	sv_set_list* next;		// The next one along
+	sv_smart_ptr<sv_box_index> index; // Bounds of the sets, by position (see prune())
 
         ~set_list_data() { delete next; }
 
@@ -500,7 +604,6 @@ private:
 		next = new sv_set_list(sl);
 	}
 
-
    }; // set_list_data
 
 // This is the pointer that gets ref counted
@@ -514,6 +617,10 @@ private:
 	void reset_flags_priv(sv_integer a) { set_list_info->reset_flags(a); }
 
 	
+// Prune a long list, using an index of its sets' bounds if there is one
+
+	sv_set_list index_prune(const sv_box&, const sv_smart_ptr<sv_box_index>&) const;
+
 // Directly replace a set in the list
 
 	void replace_set(const sv_set&,  const sv_set&);
@@ -574,6 +681,10 @@ public:
 
 	sv_set_list prune(const sv_box&) const;
 
+// Balance all the sets in a list over a box
+
+	sv_set_list balance(const sv_box&) const;
+
 // Operators on collections of sets... 
 
         friend sv_set_list merge(const sv_set_list&, const sv_set_list&);    // Union
@@ -633,6 +744,10 @@ public:
 	friend void read1(istream&, sv_set_list&);
 	friend sv_set_list read_sl_r(istream&);
 	friend sv_set_list read_sl_r1(istream&);
+
+// Memory accounting (memuse.cxx) needs to see inside
+
+	friend class sv_mem_walk;
 };
 
 
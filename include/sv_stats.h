@@ -0,0 +1,173 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Hot-path event counters
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_STATS
+#define SVLIS_STATS
+
+// Each thread counts into its own block, so counting costs one
+// increment and no locking; the blocks are summed when the counts
+// are read.  Compile with -DSV_NO_STATS to take the counting out
+// altogether.
+
+enum sv_stat_kind
+{
+	SV_ST_VALUE,		// sv_primitive::value() calls
+	SV_ST_RANGE,		// sv_primitive::range() calls
+	SV_ST_PRUNE,		// sv_set::prune() calls
+	SV_ST_SAME,		// same() on sets and primitives
+	SV_ST_MEMBER,		// sv_set::member() calls
+	SV_ST_DIVIDE,		// Division decisions taken
+	SV_ST_NODE,		// Model nodes created by division
+	SV_ST_RAY,		// Rays fired into models (fire_ray())
+	SV_ST_SHADOW,		// Shadow rays (occluded())
+	SV_ST_SOLVE,		// arf() and arpors() calls
+	SV_ST_ROOT,		// Ray-primitive roots found
+	SV_ST_FACET,		// Sets faceted in leaf boxes
+	SV_ST_PAGE_IN,		// Model pages read back from disk
+	SV_ST_PAGE_OUT,		// Model pages dropped from memory
+	SV_ST_COUNT		// Must be last
+};
+
+// value() and range() calls are also counted by primitive kind
+// (SV_REAL to SV_GENERAL); user-defined primitives share the last slot
+
+#define SV_ST_KINDS (SV_GENERAL + 2)
+
+inline sv_integer stat_kind_slot(sv_integer k)
+{
+	if((k < 0) || (k > SV_GENERAL)) return(SV_ST_KINDS - 1);
+	return(k);
+}
+
+struct sv_stat_block
+{
+	long count[SV_ST_COUNT];
+	long value_k[SV_ST_KINDS];
+	long range_k[SV_ST_KINDS];
+	sv_stat_block* next;
+};
+
+// Initial-exec TLS saves a call per access in the shared library
+
+#ifdef _MSC_VER
+ #define SV_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+ #define SV_THREAD_LOCAL __thread __attribute__((tls_model("initial-exec")))
+#else
+ #define SV_THREAD_LOCAL __thread
+#endif
+
+#ifdef SV_NO_STATS
+
+inline void sv_stat(sv_stat_kind) {}
+inline void sv_stat_n(sv_stat_kind, long) {}
+inline void sv_stat_value(sv_integer) {}
+inline void sv_stat_range(sv_integer) {}
+
+#else
+
+// This thread's block (0 until the thread first counts something)
+
+extern SV_THREAD_LOCAL sv_stat_block* sv_stat_here;
+extern sv_stat_block* sv_stat_attach();
+
+inline sv_stat_block* sv_stat_block_here()
+{
+	sv_stat_block* b = sv_stat_here;
+	if(!b) b = sv_stat_attach();
+	return(b);
+}
+
+inline void sv_stat(sv_stat_kind k) { sv_stat_block_here()->count[k]++; }
+inline void sv_stat_n(sv_stat_kind k, long n) { sv_stat_block_here()->count[k] += n; }
+
+inline void sv_stat_value(sv_integer k)
+{
+	sv_stat_block* b = sv_stat_block_here();
+	b->count[SV_ST_VALUE]++;
+	b->value_k[stat_kind_slot(k)]++;
+}
+
+inline void sv_stat_range(sv_integer k)
+{
+	sv_stat_block* b = sv_stat_block_here();
+	b->count[SV_ST_RANGE]++;
+	b->range_k[stat_kind_slot(k)]++;
+}
+
+#endif
+
+// Totals over all threads, living and finished
+
+extern long get_stat(sv_stat_kind k);
+
+// value() (r = 0) or range() (r != 0) calls for one primitive kind
+
+extern long get_prim_stat(sv_integer k, int r);
+
+// Set all counts to 0
+
+extern void reset_stats();
+
+// The name of a counter
+
+extern const char* stat_name(sv_stat_kind k);
+
+// Print all the non-zero counts
+
+extern void stat_report(ostream& f);
+
+#endif
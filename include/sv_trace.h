@@ -0,0 +1,104 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Timeline tracing in Chrome trace-event format
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_TRACE
+#define SVLIS_TRACE
+
+// Between trace_start() and trace_stop() every sv_trace_span that
+// goes out of scope records when it started, how long it lasted,
+// and which thread it ran in.  trace_write() then puts the lot out
+// as Chrome trace-event JSON (load it into Perfetto or
+// chrome://tracing).  When no trace is running a span costs one test.
+
+// One timed span; name must be a string constant (only the pointer
+// is kept).  arg, if not negative, is recorded with it (a tree
+// level, a picture row, and so on).
+
+class sv_trace_span
+{
+private:
+	const char* name;
+	long arg;
+	double start;
+	int live;
+
+	sv_trace_span(const sv_trace_span&);
+	sv_trace_span& operator=(const sv_trace_span&);
+
+public:
+	sv_trace_span(const char* n, long a = -1);
+	~sv_trace_span();
+};
+
+// Start recording, throwing away anything recorded before
+
+extern void trace_start();
+
+// Stop recording (what's been recorded is kept for writing)
+
+extern void trace_stop();
+
+// Is a trace being recorded?
+
+extern int tracing();
+
+// Write the recorded spans; the file version returns the number
+// of spans written, or -1 if the file couldn't be opened
+
+extern void trace_write(ostream& s);
+extern sv_integer trace_write(const char* file);
+
+#endif
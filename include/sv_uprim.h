@@ -0,0 +1,303 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Typed user primitives
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 19 October 2026
+ *
+ */
+
+#ifndef SVLIS_UPRIM
+#define SVLIS_UPRIM
+
+// Instead of adding cases to the switches in u_prim.cxx, a user
+// primitive can be written as a class.  Derive it from
+// sv_user_shape<itself> and give it at least
+//
+//	static const char* name();	 Unique name, used in files
+//	sv_real value(const sv_point&) const;
+//	sv_interval range(const sv_box&) const;
+//
+// It may also define any of the members of sv_user_shape below, which
+// hide the defaults there.  Then user_primitive(shape) makes an
+// sv_primitive of it.
+//
+// Each shape gets four kind numbers from SV_U_REG up: the value and the
+// x, y and z components of its grad.  The numbers are handed out as
+// shapes are made.  A shape is freed when the last primitive using its
+// numbers goes, and the numbers are used again, so a file stores the
+// shape's name and data rather than its kind; declare_user_primitive()
+// must be called for each shape class before reading files that use it.
+// At most a million shapes can be in use at once.
+//
+// A primitive record of one of those kinds keeps an sv_user_eval for
+// it, made when the shape was.  Its functions are instances of
+// templates in sv_user_prim<shape> for that component (and for whether
+// the shape is complemented), so evaluating the record is one call
+// through a pointer into code with the shape's members inlined; there
+// is no registry look-up or virtual call.
+//
+// Moving, turning, mirroring or scaling the primitive puts a transform
+// node over it (see sv_xform.h), so all the moved copies share the one
+// shape and its kind numbers.  Only the complement is a new shape.
+
+#define SV_U_REG 65536		// First kind number for registered shapes
+#define SV_U_ARF (-2)		// ray_roots(): use the general root finder
+#define SV_U_DELTA 1.0e-3	// Step for the default (numerical) grad
+#define SV_U_BIG 1.0e30		// Default bound on grad components
+
+// How a record evaluates its shape, or one component of its grad
+
+struct sv_user_eval
+{
+	const void* shape;
+	sv_real (*value)(const void*, const sv_point&);
+	sv_interval (*range)(const void*, const sv_box&);
+};
+
+// The interface svLis sees
+
+class sv_user_prim_base
+{
+protected:
+	sv_user_eval eval[4];
+
+public:
+	virtual ~sv_user_prim_base() {}
+
+// The evaluator for the shape (c = 0) or a component of its grad (c = 1, 2, 3)
+
+	const sv_user_eval* evaluator(sv_integer c) const { return(&eval[c]); }
+
+// Values at many points at once
+
+	virtual void values(const sv_point*, sv_real*, sv_integer) const = 0;
+
+	virtual sv_integer degree() const = 0;
+
+// The complemented copy
+
+	virtual sv_user_prim_base* complement() const = 0;
+
+// Where a ray crosses the surface in the interval t; returns the number
+// of roots, or SV_U_ARF to leave it to the general root finder
+
+	virtual sv_integer ray_roots(const sv_line&, const sv_interval&,
+		sv_real, sv_integer, double*) const = 0;
+
+// Write the name and data
+
+	virtual void write(ostream&) const = 0;
+};
+
+// Register a shape (svLis keeps it while it's used) and get its
+// primitive; look up a shape, or the evaluator for a kind, by kind
+// number (0 if there isn't one); how many shapes there are now
+
+extern sv_primitive register_user_prim(sv_user_prim_base*);
+extern sv_user_prim_base* user_prim(sv_integer);
+extern const sv_user_eval* user_prim_eval(sv_integer);
+extern sv_integer user_prim_count();
+
+// Register a shape class by name and the function that reads one
+// (after the name)
+
+typedef sv_user_prim_base* (*sv_user_reader)(istream&);
+extern void register_user_type(const char*, sv_user_reader);
+extern sv_user_reader user_type(const char*);
+
+// Defaults for the optional members of a shape
+
+template<class D> class sv_user_shape
+{
+public:
+
+	sv_integer degree() const { return(2); }
+
+// Grad by central differences
+
+	sv_point grad(const sv_point& q) const
+	{
+		const D* d = static_cast<const D*>(this);
+		sv_real h = 0.5/SV_U_DELTA;
+		return(sv_point(
+		  d->value(q + sv_point(SV_U_DELTA, 0, 0)) - d->value(q - sv_point(SV_U_DELTA, 0, 0)),
+		  d->value(q + sv_point(0, SV_U_DELTA, 0)) - d->value(q - sv_point(0, SV_U_DELTA, 0)),
+		  d->value(q + sv_point(0, 0, SV_U_DELTA)) - d->value(q - sv_point(0, 0, SV_U_DELTA)))*h);
+	}
+
+// Ranges of the grad components (the default knows nothing)
+
+	sv_box grad_range(const sv_box&) const
+	{
+		sv_interval all = sv_interval(-SV_U_BIG, SV_U_BIG);
+		return(sv_box(all, all, all));
+	}
+
+	sv_integer ray_roots(const sv_line&, const sv_interval&, sv_real,
+		sv_integer, double*) const { return(SV_U_ARF); }
+
+// No data to write or read
+
+	void write(ostream&) const {}
+	static D read(istream&) { return(D()); }
+};
+
+// The wrapper that turns a shape into something svLis can call
+
+template<class D> class sv_user_prim : public sv_user_prim_base
+{
+private:
+	D d;
+	sv_integer neg;		// Complemented?
+
+// Value and range of the shape (C = 0) or a component of its grad
+// (C = 1, 2, 3), negated if N is set
+
+	template<int C, int N> static sv_real value_of(const void* p, const sv_point& q)
+	{
+		const D* s = (const D*)p;
+		sv_real v;
+		if(C)
+		{
+			sv_point g = s->grad(q);
+			v = (C == 1) ? g.x : ((C == 2) ? g.y : g.z);
+		} else
+			v = s->value(q);
+		return(N ? -v : v);
+	}
+
+	template<int C, int N> static sv_interval range_of(const void* p, const sv_box& b)
+	{
+		const D* s = (const D*)p;
+		sv_interval r;
+		if(C)
+		{
+			sv_box g = s->grad_range(b);
+			r = (C == 1) ? g.xi : ((C == 2) ? g.yi : g.zi);
+		} else
+			r = s->range(b);
+		return(N ? -r : r);
+	}
+
+	template<int C, int N> void set_eval()
+	{
+		eval[C].shape = &d;
+		eval[C].value = &value_of<C, N>;
+		eval[C].range = &range_of<C, N>;
+	}
+
+	template<int N> void set_evals()
+	{
+		set_eval<0, N>();
+		set_eval<1, N>();
+		set_eval<2, N>();
+		set_eval<3, N>();
+	}
+
+public:
+	sv_user_prim(const D& e, sv_integer n) : d(e), neg(n)
+	{
+		if(neg)
+			set_evals<1>();
+		else
+			set_evals<0>();
+	}
+
+	const D& shape() const { return(d); }
+
+	void values(const sv_point* q, sv_real* v, sv_integer n) const
+	{
+		if(neg)
+			for(sv_integer i = 0; i < n; i++) v[i] = -d.value(q[i]);
+		else
+			for(sv_integer i = 0; i < n; i++) v[i] = d.value(q[i]);
+	}
+
+	sv_integer degree() const { return(d.degree()); }
+
+	sv_user_prim_base* complement() const { return(new sv_user_prim<D>(d, !neg)); }
+
+// Roots don't change when the shape is complemented
+
+	sv_integer ray_roots(const sv_line& l, const sv_interval& t, sv_real tol,
+		sv_integer max, double* r) const { return(d.ray_roots(l, t, tol, max, r)); }
+
+	void write(ostream& s) const
+	{
+		s << D::name() << ' ' << neg << ' ';
+		d.write(s);
+	}
+
+	static sv_user_prim_base* read(istream& s)
+	{
+		sv_integer n;
+		s >> n;
+		D e = D::read(s);
+		return(new sv_user_prim<D>(e, n));
+	}
+};
+
+// Tell svLis about a shape class (needed before reading it from a file)
+
+template<class D> void declare_user_primitive()
+{
+	register_user_type(D::name(), &sv_user_prim<D>::read);
+}
+
+// Make a primitive from a shape
+
+template<class D> sv_primitive user_primitive(const D& d)
+{
+	declare_user_primitive<D>();
+	return(register_user_prim(new sv_user_prim<D>(d, 0)));
+}
+
+#endif
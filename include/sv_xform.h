@@ -0,0 +1,140 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Affine transforms
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_XFORM
+#define SVLIS_XFORM
+
+// An affine map p -> Ap + t, held as the three rows of A and t.
+// Primitives and sets can be transformed by one lazily (see
+// sv_primitive::transform()); the map is then applied to the points,
+// boxes and rays they are evaluated for.
+
+class sv_xform
+{
+public:
+	sv_point r0, r1, r2;	// Rows of the linear part
+	sv_point t;		// Translation
+
+// The identity
+
+	sv_xform() : r0(SV_X), r1(SV_Y), r2(SV_Z) {}
+
+	sv_xform(const sv_point& a, const sv_point& b, const sv_point& c, const sv_point& d)
+		: r0(a), r1(b), r2(c), t(d) {}
+
+// Map a point, and a direction (no translation)
+
+	sv_point map(const sv_point& p) const
+	{
+		return(sv_point(r0*p + t.x, r1*p + t.y, r2*p + t.z));
+	}
+
+	sv_point vector(const sv_point& v) const
+	{
+		return(sv_point(r0*v, r1*v, r2*v));
+	}
+
+// The transpose of the linear part times a vector; this takes a
+// plane's normal back through the map
+
+	sv_point transpose(const sv_point& n) const
+	{
+		return(r0*n.x + r1*n.y + r2*n.z);
+	}
+
+// The box that encloses a mapped box
+
+	sv_box map(const sv_box&) const;
+
+// Map a line; the direction is not normalized, so parameter
+// values along the line are unchanged
+
+	sv_line map(const sv_line&) const;
+
+// The inverse (which had better exist), and a check for the identity
+
+	sv_xform inverse() const;
+	int identity() const;
+
+// Rigid, or rigid and a uniform scale?
+
+	int similar() const;
+};
+
+// Composition: (a*b).map(p) == a.map(b.map(p))
+
+extern sv_xform operator*(const sv_xform&, const sv_xform&);
+
+// Two maps the same?  (SV_PLUS if so, else SV_ZERO)
+
+extern prim_op same(const sv_xform&, const sv_xform&);
+
+// The maps that correspond to the svLis transforms
+
+extern sv_xform xf_translate(const sv_point&);
+extern sv_xform xf_spin(const sv_line&, sv_real);
+extern sv_xform xf_mirror(const sv_plane&);
+extern sv_xform xf_scale(const sv_point&, sv_real);
+extern sv_xform xf_scale(const sv_line&, sv_real);
+
+// I/O
+
+extern ostream& operator<<(ostream&, const sv_xform&);
+extern void write(ostream&, const sv_xform&, sv_integer);
+extern istream& operator>>(istream&, sv_xform&);
+extern void read(istream&, sv_xform&);
+
+#endif
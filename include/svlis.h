@@ -66,13 +66,25 @@
 #include "geometry.h"
 #include "interval.h"
 #include "sv_b_cls.h"
+#include "sv_stats.h"
+#include "sv_trace.h"
+#include "sv_pool.h"
+#include "sv_index.h"
+#include "sv_xform.h"
 #include "prim.h"
+#include "sv_uprim.h"
 #include "attrib.h"
 #include "sv_set.h"
+#include "sv_cvpol.h"
+#include "bounds.h"
 #include "decision.h"
 #include "polygon.h"
 #include "model.h"
 
+// Frozen (flattened) models for query-heavy work
+
+#include "frozen.h"
+
 // Useful extras
 
 #include "solids.h"
@@ -90,6 +102,18 @@
 
 #include "sv_util.h"
 
+// Clash detection between divided models
+
+#include "interfere.h"
+
+// Memory accounting
+
+#include "memuse.h"
+
+// Compiling primitives and sets to native code
+
+#include "sv_jit.h"
+
 // Needed for the ray-trace renderer
 
 #include "view.h"
@@ -99,6 +123,8 @@
 #include "ivallist.h"
 #include "raytrace.h"
 #include "shade.h"
+#include "sv_farm.h"
+#include "sv_page.h"
 #include "environs.h"
 
 // Rotational transformations
@@ -8,11 +8,12 @@
  *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
  *
  * First version: 12 December 1995
- * This version: 18 May 1998
+ * This version: 19 October 2026
  *
  */
 
 #include "svlis.h"
+#include <string.h>
 #if macintosh
  #pragma export on
 #endif
@@ -52,6 +53,20 @@ sv_surface road;
 sv_surface black;
 sv_surface logo;
 
+// The plant modules, kept separately for the clash check
+
+#define MODULES 7
+
+sv_set module[MODULES];
+const char* module_name[MODULES];
+sv_integer modules = 0;
+
+void plant_module(const char* name, const sv_set& s)
+{
+	module_name[modules] = name;
+	module[modules++] = s;
+}
+
 // Initialize everything
 
 void ref_init()
@@ -487,6 +502,7 @@ sv_set refinery()
 	}
 
 	temp = temp.surface(aluminium);
+	plant_module("storage tanks", temp);
 
 	result = result | temp;
 
@@ -504,6 +520,7 @@ sv_set refinery()
 	}
 
 	temp = temp.surface(aluminium);
+	plant_module("high-pressure storage", temp);
 
 	result = result | temp;
 
@@ -514,21 +531,26 @@ sv_set refinery()
 	q = sv_point(199.5, 169.5, 10);
 	temp = temp - cuboid(p, q);
 	temp = temp.surface(brick);
+	plant_module("wall", temp);
 
 	result = result | temp;
 
 // Tower sphere storage
 
 	p = sv_point(110, 110, 0);
-	result = result | con_frame(p, 5, 3.5, 20, 5).surface(black);
+	temp = con_frame(p, 5, 3.5, 20, 5).surface(black);
+	result = result | temp;
 	p = sv_point(110, 110, 22.5);
-	result = result | sphere(p, 5).surface(aluminium);
+	sv_set ball = sphere(p, 5).surface(aluminium);
+	result = result | ball;
+	plant_module("tower", temp | ball);
 
 // Low-pressure tanks + framework
 
 	p = sv_point(100, 140, 0);
 	q = sv_point(140, 165, 8);
-	result = result | rec_stand(p, q, 1).surface(black);
+	sv_set stand = rec_stand(p, q, 1).surface(black);
+	result = result | stand;
 
 	temp = sv_set(SV_NOTHING);
 	for(i=0;i<2;i++) for(j=0;j<2;j++)
@@ -538,17 +560,23 @@ sv_set refinery()
 		temp = temp | cyl_f(p, q, 4);
 	}
 
-	result = result | temp.surface(aluminium);
+	temp = temp.surface(aluminium);
+	result = result | temp;
+	plant_module("low-pressure tanks", stand | temp);
 
 // Fractionating columns
 
 	p = sv_point(60, 100, 0);
 	q = sv_point(0, 15, 0);
+	temp = sv_set(SV_NOTHING);
 	for(j=0;j<5;j++)
 	{
-		result = result | column(p, 1, 25);
+		sv_set col = column(p, 1, 25);
+		result = result | col;
+		temp = temp | col;
 		p = p + q;
 	}
+	plant_module("columns", temp);
 
 // Roadways - tricky to figure from the | & and - ....
 
@@ -596,6 +624,8 @@ sv_set refinery()
 
 // From frac columns
 
+	sv_set pipes = sv_set(SV_NOTHING);
+
 	pipe[0] = sv_point(60, 100, 25);
 	pipe[1] = sv_point(60, 100, 27);
 	pipe[2] = sv_point(61.5, 100, 27);
@@ -608,51 +638,83 @@ sv_set refinery()
 	pipe[9] = sv_point(82, 150, 1);
 	pipe[10] = sv_point(110, 150, 1);
 
-	result = result | poly_pipe(pipe, 0.3,
-		10).surface(steel);
+	temp = poly_pipe(pipe, 0.3, 10).surface(steel);
+	result = result | temp;
+	pipes = pipes | temp;
 	for(i = 0; i < 5; i++)
 		pipe[i] = pipe[i] + sv_point(0, 15, 0);
 	for(i = 4; i < 6; i++)
 		pipe[i] = pipe[i] + sv_point(-1, 0, 0);
 	for(i = 5; i < 11; i++)
 		pipe[i] = pipe[i] + sv_point(0, 1, 0);
-	result = result | poly_pipe(pipe, 0.3,
-		10).surface(steel);
+	temp = poly_pipe(pipe, 0.3, 10).surface(steel);
+	result = result | temp;
+	pipes = pipes | temp;
 	for(i = 0; i < 5; i++)
 		pipe[i] = pipe[i] + sv_point(0, 15, 0);
 	for(i = 4; i < 6; i++)
 		pipe[i] = pipe[i] + sv_point(-1, 0, 0);
 	for(i = 5; i < 11; i++)
 		pipe[i] = pipe[i] + sv_point(0, 1, 0);
-	result = result | poly_pipe(pipe, 0.3,
-		10).surface(steel);
+	temp = poly_pipe(pipe, 0.3, 10).surface(steel);
+	result = result | temp;
+	pipes = pipes | temp;
 	for(i = 0; i < 5; i++)
 		pipe[i] = pipe[i] + sv_point(0, 15, 0);
 	for(i = 4; i < 6; i++)
 		pipe[i] = pipe[i] + sv_point(-1, 0, 0);
 	for(i = 5; i < 11; i++)
 		pipe[i] = pipe[i] + sv_point(0, 1, 0);
-	result = result | poly_pipe(pipe, 0.3,
-		10).surface(steel);
+	temp = poly_pipe(pipe, 0.3, 10).surface(steel);
+	result = result | temp;
+	pipes = pipes | temp;
 	for(i = 0; i < 5; i++)
 		pipe[i] = pipe[i] + sv_point(0, 15, 0);
 	for(i = 4; i < 6; i++)
 		pipe[i] = pipe[i] + sv_point(-1, 0, 0);
 	for(i = 5; i < 11; i++)
 		pipe[i] = pipe[i] + sv_point(0, 1, 0);
-	result = result | poly_pipe(pipe, 0.3,
-		10).surface(steel);
+	temp = poly_pipe(pipe, 0.3, 10).surface(steel);
+	result = result | temp;
+	pipes = pipes | temp;
+
+	plant_module("pipework", pipes);
 
 	return(result);
 }
 
-int main()
+// Check the plant modules against each other: each is divided on its
+// own and every pair is walked together by interference()
+
+void module_clashes(const sv_box& b)
+{
+	sv_model m[MODULES];
+	sv_integer i, j;
+
+	for(i = 0; i < modules; i++)
+		m[i] = sv_model(sv_set_list(module[i]), b).divide(0, &dumb_decision);
+
+	for(i = 0; i < modules; i++)
+	   for(j = i + 1; j < modules; j++)
+	   {
+		sv_clash_list cl;
+		if(!interference(m[i], m[j], cl)) continue;
+		cout << module_name[i] << " and " << module_name[j] << ": " <<
+			cl.definite() << " definite and " << cl.count() - cl.definite() <<
+			" possible clashes" << SV_EL;
+	   }
+}
+
+// Write the model; with -clash, check the modules for clashes too
+
+int main(int argc, char** argv)
 {
 	ref_init();
 	sv_set s = refinery();
-	sv_model m = sv_model(s, sv_box(
-		sv_point(0, 0, -30),
-		sv_point(250, 200, 50)), sv_model());
+	sv_box b = sv_box(sv_point(0, 0, -30), sv_point(250, 200, 50));
+	sv_model m = sv_model(s, b, sv_model());
+
+	if( (argc > 1) && !strcmp(argv[1], "-clash") ) module_clashes(b);
 
 	ofstream of(RES_FILE);
 	if (!of)
@@ -3,58 +3,36 @@
 
 #include <svlis.h>
 #include "sv_cols.h"
+#include "engine_parts.h"
 extern "C" {int XInitThreads(void);}
 
 #if macintosh
  #pragma export on
 #endif
 
-#define CRL 8
-#define CONL 15
-#define PL 6
-#define PD 6
-#define SD 1
-
 sv_model crank()
 {
 	sv_point bl = sv_point(-SD, -SD, -SD*2);
 	sv_point tr = bl + sv_point(CRL + 2*SD, 2*SD, SD);
-	sv_set cr = cuboid(bl, tr).colour(SV_RED);
-	sv_set cyl = poly_cylinder(SV_ZL, SD*0.5);
-	cyl = cyl & sv_set(sv_plane(-SV_Z, -SV_Z*SD*1.5));
-	cyl = cyl & sv_set(sv_plane(SV_Z, SV_Z*SD));
-	cyl = cyl.colour(SV_RED);
-	sv_set_list r = sv_set_list(cr);
-	r = merge(r, cyl - SV_Z*SD*3);
-	r = merge(r, cyl + SV_X*CRL);
-
 	bl = bl - SV_DIAG;
 	tr = tr + SV_DIAG + SV_Z*3*SD;
-	return(sv_model(r, sv_box(bl,tr)));
+	return(sv_model(engine_crank(), sv_box(bl,tr)));
 }
 
 sv_model con()
 {
 	sv_point bl = sv_point(-SD, -SD, -SD*0.5);
 	sv_point tr = bl + sv_point(CONL + 2*SD, 2*SD, SD);
-	sv_set cr = cuboid(bl, tr).colour(SV_GREEN);
 	bl = bl - SV_DIAG;
 	tr = tr + SV_DIAG;
-	return(sv_model(cr, sv_box(bl,tr)));
+	return(sv_model(engine_con(), sv_box(bl,tr)));
 }
 
 sv_model piston()
 {
-	sv_set cyl = poly_cylinder(SV_XL, PD*0.5);
-	cyl = cyl & sv_set(sv_plane(SV_X, SV_X*(PD - SD)));
-	cyl = cyl & sv_set(sv_plane(-SV_X, -SV_X*SD));
-	cyl = cyl & (poly_cylinder(SV_ZL, SD*0.5)  | 
-		(-(poly_cylinder(SV_XL, (PD - SD)*0.5) & 
-		sv_set(sv_plane(SV_X, SV_X*(PD - 2*SD))))));
-	cyl = cyl.colour(SV_BLUE);
 	sv_point bl = sv_point(-SD*2, -(PD+SD), -(PD+SD));
 	sv_point tr = bl + sv_point(PD + 2*SD, 2*(PD+SD), 2*(PD+SD));
-	return(sv_model(cyl, sv_box(bl,tr)));
+	return(sv_model(engine_piston(), sv_box(bl,tr)));
 }
 
 int main(int argc, char **argv)
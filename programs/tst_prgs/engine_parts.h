@@ -0,0 +1,106 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - The parts of the engine used by the engine demonstration
+ * and by the benchmark harness, each about its own origin
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#ifndef SVLIS_ENGINE_PARTS
+#define SVLIS_ENGINE_PARTS
+
+#define CRL 8
+#define CONL 15
+#define PL 6
+#define PD 6
+#define SD 1
+
+// The crank, with its two pins
+
+static sv_set_list engine_crank()
+{
+	sv_point bl = sv_point(-SD, -SD, -SD*2);
+	sv_point tr = bl + sv_point(CRL + 2*SD, 2*SD, SD);
+	sv_set cr = cuboid(bl, tr).colour(SV_RED);
+	sv_set cyl = poly_cylinder(SV_ZL, SD*0.5);
+	cyl = cyl & sv_set(sv_plane(-SV_Z, -SV_Z*SD*1.5));
+	cyl = cyl & sv_set(sv_plane(SV_Z, SV_Z*SD));
+	cyl = cyl.colour(SV_RED);
+	sv_set_list r = sv_set_list(cr);
+	r = merge(r, cyl - SV_Z*SD*3);
+	r = merge(r, cyl + SV_X*CRL);
+	return(r);
+}
+
+// The connecting rod
+
+static sv_set engine_con()
+{
+	sv_point bl = sv_point(-SD, -SD, -SD*0.5);
+	sv_point tr = bl + sv_point(CONL + 2*SD, 2*SD, SD);
+	return(cuboid(bl, tr).colour(SV_GREEN));
+}
+
+// The piston
+
+static sv_set engine_piston()
+{
+	sv_set cyl = poly_cylinder(SV_XL, PD*0.5);
+	cyl = cyl & sv_set(sv_plane(SV_X, SV_X*(PD - SD)));
+	cyl = cyl & sv_set(sv_plane(-SV_X, -SV_X*SD));
+	cyl = cyl & (poly_cylinder(SV_ZL, SD*0.5)  | 
+		(-(poly_cylinder(SV_XL, (PD - SD)*0.5) & 
+		sv_set(sv_plane(SV_X, SV_X*(PD - 2*SD))))));
+	return(cyl.colour(SV_BLUE));
+}
+
+#endif
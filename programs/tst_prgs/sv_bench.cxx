@@ -0,0 +1,321 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Benchmark harness
+ *
+ * Runs a fixed set of workloads through division, faceting, point
+ * membership, ray-traced rendering (in one process and farmed out),
+ * integral properties and model i/o, and writes the timings,
+ * throughputs, node counts and peak memory as JSON (to standard
+ * output, or to the file named as the first argument).
+ *
+ * Run it from the svLis root directory, or use make bench, which
+ * builds it, runs it and writes results/bench.json.  The refinery
+ * workload reads results/refinery.mod, which is made by running
+ * bin/refinery (make bench does that if it's missing); if it isn't
+ * there that workload is reported as skipped.
+ *
+ * First version: 18 October 2026
+ * This version: 19 October 2026
+ *
+ */
+
+#include "svlis.h"
+#include "sv_cols.h"
+#include "engine_parts.h"
+#include <sys/time.h>
+#include <unistd.h>
+
+#define REFINERY_FILE "results/refinery.mod"
+
+// How much work each test does
+
+#define MEMBER_POINTS 100000
+#define PIC_X 160
+#define PIC_Y 120
+#define INTEGRAL_ACCY 0.05
+#define MAX_WORKERS 8
+
+// Wall-clock time in seconds
+
+static double wall_time()
+{
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return((double)tv.tv_sec + 1.0e-6*(double)tv.tv_usec);
+}
+
+// ***************************************************************
+
+// The workloads
+
+// The crank, connecting rod and piston from engine.cxx, assembled
+
+static sv_set_list engine(sv_box* b)
+{
+	sv_set_list r = engine_crank();
+	r = merge(r, engine_con() + SV_Z*SD*3);
+	r = merge(r, engine_piston() + SV_X*(CONL + 2*SD));
+	*b = sv_box(sv_point(-2*SD - 1, -(PD + SD) - 1, -(PD + SD) - 1),
+		sv_point(CONL + PD + 4*SD + 1, PD + SD + 1, PD + SD + 1));
+	return(r);
+}
+
+// A ring of tori and cyclides (degree four)
+
+static sv_set_list quartics(sv_box* b)
+{
+	sv_set s = sv_set(SV_NOTHING);
+	sv_real a;
+	sv_point c;
+	for(sv_integer i = 0; i < 12; i++)
+	{
+		a = 2*M_PI*(sv_real)i/12.0;
+		c = sv_point(10*cos(a), 10*sin(a), 0);
+		if(i%2)
+			s = s | sv_set(p_torus(sv_line(sv_point(cos(a), sin(a), 1).norm(), c), 2.0, 0.6));
+		else
+			s = s | sv_set(p_cyclide(sv_line(SV_Z, c), c + SV_X*0.3, 2.5, 0.8, 0.4));
+	}
+	*b = sv_box(sv_point(-14, -14, -5), sv_point(14, 14, 5));
+	return(sv_set_list(s));
+}
+
+// A large union of capped cylinders (a pipe rack)
+
+static sv_set_list cylinders(sv_box* b)
+{
+	sv_set s = sv_set(SV_NOTHING);
+	sv_set c;
+	sv_real x, y;
+	for(sv_integer i = 0; i < 10; i++)
+	  for(sv_integer j = 0; j < 10; j++)
+	  {
+		x = 3*(sv_real)i;
+		y = 3*(sv_real)j;
+		c = sv_set(p_cylinder(sv_line(SV_Z, sv_point(x, y, 0)), 0.5 + 0.05*(sv_real)j));
+		c = c & sv_set(sv_plane(SV_Z, sv_point(0, 0, 5 + (sv_real)i)));
+		c = c & sv_set(sv_plane(-SV_Z, sv_point(0, 0, -1)));
+		s = s | c;
+	  }
+	*b = sv_box(sv_point(-2, -2, -2), sv_point(30, 30, 16));
+	return(sv_set_list(s));
+}
+
+// ***************************************************************
+
+// Run all the tests on one model and write its JSON record
+
+static void run(ostream& js, const char* name, const sv_model& m, int first,
+	double load_time)
+{
+	double t0, t1;
+	sv_box b = m.box();
+
+	if(!first) js << "," << SV_EL;
+	js << "  {\"workload\": \"" << name << "\"";
+	if(load_time >= 0)
+		js << ", \"read_s\": " << load_time;
+
+// Division
+
+	t0 = wall_time();
+	sv_model d = m.divide(0, dumb_decision);
+	t1 = wall_time();
+	sv_frozen_model f = sv_frozen_model(d);
+	sv_mem_stats ms;
+	memory_use(d, &ms);
+	js << "," << SV_EL << "   \"divide\": {\"s\": " << (t1 - t0) <<
+		", \"nodes\": " << f.nodes() << ", \"leaves\": " << f.leaves() <<
+		", \"bytes\": " << ms.total_bytes << "}";
+
+// Faceting
+
+	t0 = wall_time();
+	sv_model fm = m.facet();
+	t1 = wall_time();
+	sv_frozen_model ff = sv_frozen_model(fm);
+	js << "," << SV_EL << "   \"facet\": {\"s\": " << (t1 - t0) <<
+		", \"nodes\": " << ff.nodes() << "}";
+
+// Point membership
+
+	sv_integer solid = 0;
+	t0 = wall_time();
+	for(sv_integer i = 0; i < MEMBER_POINTS; i++)
+		if(d.member(ran_point(b)) == SV_SOLID) solid++;
+	t1 = wall_time();
+	js << "," << SV_EL << "   \"member\": {\"s\": " << (t1 - t0) <<
+		", \"points\": " << MEMBER_POINTS << ", \"per_s\": " <<
+		(double)MEMBER_POINTS/(t1 - t0) << ", \"solid\": " << solid << "}";
+
+// Ray-traced picture
+
+	sv_view v;
+	sv_point cen = b.centroid();
+	sv_point diag = sv_point(b.xi.hi() - b.xi.lo(), b.yi.hi() - b.yi.lo(),
+		b.zi.hi() - b.zi.lo());
+	v.centre(cen);
+	v.eye_point(cen + sv_point(1.1*diag.x, -0.9*diag.y, 0.8*diag.z));
+	v.vertical_dir(SV_Z);
+	v.lens_angle(0.6);
+	sv_lightsource l;
+	l.direction(sv_point(-1, 1, -2).norm());
+	sv_light_list ll;
+	ll.source = &l;
+	ll.name = (char*)"L_0";
+	ll.next = 0;
+	sv_picture pic;
+	pic.resolution(PIC_X, PIC_Y);
+	t0 = wall_time();
+	generate_picture(d, v, ll, pic);
+	t1 = wall_time();
+	js << "," << SV_EL << "   \"render\": {\"s\": " << (t1 - t0) <<
+		", \"pixels\": " << PIC_X*PIC_Y << ", \"per_s\": " <<
+		(double)(PIC_X*PIC_Y)/(t1 - t0) << "}";
+
+// The same picture from a render farm, one worker per processor
+
+	sv_integer workers = min((sv_integer)MAX_WORKERS, 
+		(sv_integer)sysconf(_SC_NPROCESSORS_ONLN));
+	if(workers < 1) workers = 1;
+	sv_picture fpic;
+	fpic.resolution(PIC_X, PIC_Y);
+	t0 = wall_time();
+	generate_picture_farm(d, v, ll, fpic, workers);
+	t1 = wall_time();
+	sv_integer same = 1;
+	for(sv_integer y = 0; y < PIC_Y; y++)
+	   for(sv_integer x = 0; x < PIC_X; x++)
+	   {
+		sv_pixel p = pic.pixel(x, y);
+		sv_pixel q = fpic.pixel(x, y);
+		if((p.r != q.r) || (p.g != q.g) || (p.b != q.b)) same = 0;
+	   }
+	js << "," << SV_EL << "   \"render_farm\": {\"s\": " << (t1 - t0) <<
+		", \"workers\": " << workers << ", \"per_s\": " <<
+		(double)(PIC_X*PIC_Y)/(t1 - t0) << ", \"same\": " << same << "}";
+
+// Integral properties
+
+	sv_real vol;
+	sv_point centroid, mxyz, nxyz;
+	t0 = wall_time();
+	integral(d, INTEGRAL_ACCY, vol, centroid, mxyz, nxyz);
+	t1 = wall_time();
+	js << "," << SV_EL << "   \"integral\": {\"s\": " << (t1 - t0) <<
+		", \"volume\": " << vol << "}";
+
+// Text i/o of the divided model
+
+	sv_model copy = d;
+	ostringstream os;
+	t0 = wall_time();
+	os << copy;
+	t1 = wall_time();
+	string text = os.str();
+	istringstream is(text);
+	sv_model back;
+	double t2 = wall_time();
+	is >> back;
+	double t3 = wall_time();
+	js << "," << SV_EL << "   \"io_text\": {\"write_s\": " << (t1 - t0) <<
+		", \"read_s\": " << (t3 - t2) << ", \"bytes\": " << text.length() << "}";
+
+	js << "," << SV_EL << "   \"peak_rss_kb\": " << peak_rss() << "}";
+}
+
+int main(int argc, char** argv)
+{
+	svlis_init();
+
+	ofstream of;
+	if(argc > 1)
+	{
+		of.open(argv[1]);
+		if(!of)
+		{
+			cerr << "sv_bench: can't open " << argv[1] << SV_EL;
+			return(1);
+		}
+	}
+	ostream& js = (argc > 1) ? (ostream&)of : cout;
+	js.precision(6);
+
+	double start = wall_time();
+	sv_box b;
+	sv_set_list sl;
+	int first = 1;
+
+	js << "{\"benchmark\": \"svlis\"," << SV_EL << " \"results\": [" << SV_EL;
+
+	ifstream ref(REFINERY_FILE);
+	if(ref)
+	{
+		sv_model m;
+		double t0 = wall_time();
+		ref >> m;
+		double t1 = wall_time();
+		run(js, "refinery", m, first, t1 - t0);
+		first = 0;
+	} else
+	{
+		js << "  {\"workload\": \"refinery\", \"skipped\": \"no " <<
+			REFINERY_FILE << "\"}";
+		first = 0;
+	}
+
+	sl = engine(&b);
+	run(js, "engine", sv_model(sl, b), first, -1);
+
+	sl = quartics(&b);
+	run(js, "quartics", sv_model(sl, b), first, -1);
+
+	sl = cylinders(&b);
+	run(js, "cylinders", sv_model(sl, b), first, -1);
+
+	js << SV_EL << " ]," << SV_EL << " \"total_s\": " << (wall_time() - start) <<
+		"," << SV_EL << " \"peak_rss_kb\": " << peak_rss() << "}" << SV_EL;
+
+// No svlis_end(); it waits for a keystroke, and this runs unattended
+
+	return(0);
+}
@@ -0,0 +1,1090 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Equality tests
+ *
+ * Checks that the faster paths through svLis give the same answers
+ * as the simple ones they replace.  Each test prints ok or FAILED;
+ * the program exits with the number of failures, so make check
+ * stops if any fail.
+ *
+ * Run it from the svLis root directory.
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#include "sv_cols.h"
+#include "arf.h"
+
+// How many random points each membership comparison uses
+
+#define EQ_POINTS 2000
+
+static int failures = 0;
+
+static void report(const char* test, int ok)
+{
+	printf("%-40s %s\n", test, ok ? "ok" : "FAILED");
+	if(!ok) failures++;
+}
+
+// ***************************************************************
+
+// Index prune
+
+// A list of n small spheres scattered through box b, some coloured,
+// with some of them in the list more than once
+
+static sv_set_list scattered(sv_integer n, const sv_box& b)
+{
+	sv_set_list sl;
+	sv_set s, last;
+	sv_set_list dup;
+
+	for(sv_integer i = 0; i < n; i++)
+	{
+		s = sphere(ran_point(b), 0.4);
+		if(!(i%5)) s = s.colour(SV_RED);
+		if(!(i%17) && (i > 0))
+		{
+			sl = sv_set_list(last, sl);
+			sl = sv_set_list(last.colour(SV_GREEN), sl);
+		}
+		sl = sv_set_list(s, sl);
+		last = s;
+	}
+	return(sl);
+}
+
+// Two pruned lists are the same if, at every point in the box, the
+// sets that aren't air there come in the same order with the same
+// attributes and the same membership (a set that the index shows to
+// miss the box may be NOTHING in one and something that is air all
+// through the box in the other)
+
+static int same_lists(const sv_set_list& a, const sv_set_list& b, const sv_box& box)
+{
+	sv_set_list la, lb;
+	mem_test ma, mb;
+	int ok = 1;
+
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point p = ran_point(box);
+		la = a;
+		lb = b;
+		while(ok)
+		{
+			ma = mb = SV_AIR;
+			while(la.exists() && ((ma = la.set().member(p)) == SV_AIR))
+				la = la.next();
+			while(lb.exists() && ((mb = lb.set().member(p)) == SV_AIR))
+				lb = lb.next();
+			if(la.exists() != lb.exists()) ok = 0;
+			if(!la.exists() || !ok) break;
+			if(ma != mb) ok = 0;
+			if(!(la.set().attribute() == lb.set().attribute())) ok = 0;
+			la = la.next();
+			lb = lb.next();
+		}
+	}
+	return(ok);
+}
+
+// Prune a list twice with disjoint boxes (and once more inside the
+// first), with and without the index
+
+static void index_prune_test()
+{
+	sv_box all = sv_box(sv_point(0,0,0), sv_point(20,20,20));
+	sv_box left = sv_box(sv_point(0,0,0), sv_point(10,20,20));
+	sv_box right = sv_box(sv_point(10,0,0), sv_point(20,20,20));
+	sv_box inner = sv_box(sv_point(2,3,4), sv_point(7,9,11));
+	sv_integer old_min = get_index_min();
+
+	sv_set_list sl = scattered(400, all);
+
+	set_index_min(0);
+	sv_set_list ref_l = sl.prune(left);
+	sv_set_list ref_r = sl.prune(right);
+	sv_set_list ref_lr = ref_l.prune(right);
+	sv_set_list ref_li = ref_l.prune(inner);
+
+	set_index_min(32);
+	sv_set_list ix_l = sl.prune(left);
+	sv_set_list ix_r = sl.prune(right);
+	sv_set_list ix_lr = ix_l.prune(right);
+	sv_set_list ix_li = ix_l.prune(inner);
+	set_index_min(old_min);
+
+	report("index prune: first box", same_lists(ref_l, ix_l, left));
+	report("index prune: disjoint box", same_lists(ref_r, ix_r, right));
+	report("index prune: pruned twice, disjoint", 
+		same_lists(ref_lr, ix_lr, right));
+	report("index prune: pruned twice, inside", 
+		same_lists(ref_li, ix_li, inner));
+}
+
+// ***************************************************************
+
+// Balanced chains
+
+// A set built up a part at a time, as models often are: n small
+// spheres in box b, some of them coloured, united (or, if holes is
+// set, n holes cut in a block)
+
+static sv_set chain(sv_integer n, const sv_box& b, int holes)
+{
+	sv_set s, part;
+	if(holes) s = cuboid(b);
+
+	for(sv_integer i = 0; i < n; i++)
+	{
+		part = sphere(ran_point(b), 0.6);
+		if(!(i%7)) part = part.colour(SV_BLUE);
+		if(holes)
+			s = s & (-part);
+		else if(i)
+			s = s | part;
+		else
+			s = part;
+	}
+	return(s);
+}
+
+// Do two sets have the same membership throughout a box?
+
+static int same_members(const sv_set& a, const sv_set& b, const sv_box& box)
+{
+	for(sv_integer k = 0; k < EQ_POINTS; k++)
+	{
+		sv_point p = ran_point(box);
+		if(a.member(p) != b.member(p)) return(0);
+	}
+	return(1);
+}
+
+// Balance chains of unions and intersections and compare them with
+// the originals, inside the box they were balanced in and outside it,
+// pruned, and divided
+
+static void balance_test()
+{
+	sv_box all = sv_box(sv_point(0,0,0), sv_point(20,20,20));
+	sv_box big = sv_box(sv_point(-10,-10,-10), sv_point(30,30,30));
+	sv_box part = sv_box(sv_point(3,2,1), sv_point(9,8,7));
+
+	sv_set u = chain(300, all, 0);
+	sv_set bu = u.balance(all);
+	report("balance: has bounds", bu.balance_bounds() != 0);
+	report("balance: union in box", same_members(u, bu, all));
+	report("balance: union outside box", same_members(u, bu, big));
+	report("balance: union pruned", 
+		same_members(u.prune(part), bu.prune(part), part));
+
+	sv_set h = chain(300, all, 1);
+	sv_set bh = h.balance(all);
+	report("balance: intersection in box", same_members(h, bh, all));
+	report("balance: intersection outside box", same_members(h, bh, big));
+
+	sv_integer old_bal = get_balance_division();
+	sv_model m = sv_model(sv_set_list(u), all);
+	set_balance_division(0);
+	sv_model d = m.divide(0, dumb_decision);
+	set_balance_division(1);
+	sv_model bd = m.divide(0, dumb_decision);
+	set_balance_division(old_bal);
+	int ok = 1;
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point p = ran_point(all);
+		if(d.member(p) != bd.member(p)) ok = 0;
+	}
+	report("balance: divided model", ok);
+}
+
+// ***************************************************************
+
+// Interference
+
+// Two models whose sets don't meet have no clashes; where a red ball
+// pokes into a green block every clash is between those two; and the
+// early-exit test agrees with the full list
+
+static sv_model clash_model(const sv_set& s0, const sv_set& s1)
+{
+	sv_box all = sv_box(sv_point(0,0,0), sv_point(20,20,20));
+	return(sv_model(sv_set_list(s0, sv_set_list(s1)), all).divide(0, dumb_decision));
+}
+
+static int clash_agrees(const sv_model& a, const sv_model& b, const sv_clash_list& cl)
+{
+	mem_test e = interfere(a, b);
+	if(cl.definite()) return(e == SV_SOLID);
+	if(cl.count()) return(e == SV_SURFACE);
+	return(e == SV_AIR);
+}
+
+static void interference_test()
+{
+	sv_set red = sphere(sv_point(5, 5, 5), 3).colour(SV_RED);
+	sv_set blue = sphere(sv_point(15, 15, 15), 3).colour(SV_BLUE);
+	sv_set green = cuboid(sv_point(6, 2, 2), sv_point(10, 8, 8)).colour(SV_GREEN);
+	sv_set magenta = cuboid(sv_point(14, 2, 12), sv_point(18, 6, 18)).colour(SV_MAGENTA);
+	sv_set cyan = cuboid(sv_point(2, 12, 2), sv_point(8, 18, 8)).colour(SV_CYAN);
+
+	sv_model a = clash_model(red, blue);
+	sv_model apart = clash_model(magenta, cyan);
+	sv_model into = clash_model(green, magenta);
+
+	sv_clash_list cl;
+	report("interference: apart", !interference(a, apart, cl) && !cl.count() &&
+		(interfere(a, apart) == SV_AIR));
+
+	interference(a, into, cl);
+	int ok = cl.definite() > 0;
+	for(sv_clash* e = cl.entry(); e; e = e->next)
+	{
+		if( (same(e->set_a.colour(), SV_RED) != SV_PLUS) || 
+		    (same(e->set_b.colour(), SV_GREEN) != SV_PLUS) ) ok = 0;
+		if( (e->b.xi.hi() < 2) || (e->b.xi.lo() > 8) ) ok = 0;
+	}
+	report("interference: set pair", ok);
+	report("interference: early exit", clash_agrees(a, into, cl));
+
+	sv_clash_list ac;
+	interference(a, apart, ac);
+	report("interference: early exit apart", clash_agrees(a, apart, ac));
+}
+
+// ***************************************************************
+
+// Budgeted division
+
+static sv_integer model_nodes(const sv_model& m)
+{
+	if( (m.kind() == LEAF_M) || (m.kind() == INSTANCE_M) ) return(1);
+	return(1 + model_nodes(m.child_1()) + model_nodes(m.child_2()));
+}
+
+static int same_models(sv_model a, sv_model b, const sv_box& box)
+{
+	for(sv_integer k = 0; k < EQ_POINTS; k++)
+	{
+		sv_point p = ran_point(box);
+		if(a.member(p) != b.member(p)) return(0);
+	}
+	return(1);
+}
+
+// Stay inside a node budget and agree with divide(); carry on from a
+// paged tree (new nodes mustn't claim to be paged); and balance the
+// sets first when asked to
+
+static void budget_test()
+{
+	sv_box all = sv_box(sv_point(0,0,0), sv_point(20,20,20));
+	sv_model m = sv_model(sv_set_list(chain(200, all, 0)), all);
+	sv_model d = m.divide(0, dumb_decision);
+
+	sv_div_budget bud;
+	bud.nodes = 101;
+	sv_integer complete;
+	sv_model bm = m.divide_budget(0, dumb_decision, bud, &complete);
+	report("budget: nodes kept to", !complete && (model_nodes(bm) <= 101) &&
+		(model_nodes(bm) > 90));
+	report("budget: members", same_models(d, bm, all));
+
+	long old_mem = get_page_memory();
+	set_page_memory(0);
+	bud.nodes = 301;
+	sv_model pm = page_model(bm, 2).divide_budget(0, dumb_decision, bud, &complete);
+	report("budget: carried on from pages", !(pm.flags() & SV_PAGE_FLAG) &&
+		(model_nodes(pm) > 200) && same_models(d, pm, all));
+	set_page_memory(old_mem);
+
+	sv_integer old_bal = get_balance_division();
+	set_balance_division(1);
+	bud.nodes = 1;
+	sv_model lm = m.divide_budget(0, dumb_decision, bud);
+	bud.nodes = 101;
+	sv_model bb = m.divide_budget(0, dumb_decision, bud);
+	set_balance_division(old_bal);
+	report("budget: balanced", (lm.set_list().set().balance_bounds() != 0) &&
+		same_models(d, bb, all));
+}
+
+// ***************************************************************
+
+// Cost-model division
+
+// n small spheres scattered through a box, united
+
+static sv_set cluster(sv_integer n, const sv_box& b)
+{
+	sv_set s = sphere(ran_point(b), 0.6);
+	for(sv_integer i = 1; i < n; i++) s = s | sphere(ran_point(b), 0.6);
+	return(s);
+}
+
+// A sphere's surface bound holds the sphere and little more, and one
+// outside the box has none; a model divided by cost has the same
+// members as one divided by smart_decision; and two clusters of
+// spheres at either end of a box are split in the gap between them
+
+static void cost_test()
+{
+	sv_box all = sv_box(sv_point(0,0,0), sv_point(20,20,20));
+	sv_integer old_depth = get_bound_depth();
+	set_bound_depth(15);
+	sv_box sb = surface_bounds(sphere(sv_point(10,10,10), 3).primitive(), all);
+	sv_box none = surface_bounds(sphere(sv_point(30,10,10), 3).primitive(), all);
+	set_bound_depth(old_depth);
+	report("cost: surface bounds", 
+		sv_box(sv_point(7,7,7), sv_point(13,13,13)).inside(sb) &&
+		sb.inside(sv_box(sv_point(6,6,6), sv_point(14,14,14))) && box_void(none));
+
+	sv_model m = sv_model(sv_set_list(chain(200, all, 0)), all);
+	sv_model s = m.divide(0, smart_decision);
+	sv_model c = m.divide(0, cost_decision);
+	report("cost: members", (model_nodes(c) > 1) && same_models(s, c, all));
+
+	sv_set a = cluster(20, sv_box(sv_point(1,1,1), sv_point(4,19,19)));
+	sv_set b = cluster(20, sv_box(sv_point(16,1,1), sv_point(19,19,19)));
+	sv_model two = sv_model(sv_set_list(a | b), all).divide(0, cost_decision);
+	report("cost: split between clusters", (two.kind() == X_DIV) && 
+		(two.coord() > 4.6) && (two.coord() < 15.4));
+}
+
+// ***************************************************************
+
+// Reordering
+
+// Reorder deep chains of unions and intersections, and a divided
+// model, and compare them with the originals
+
+static void reorder_test()
+{
+	sv_box all = sv_box(sv_point(0,0,0), sv_point(20,20,20));
+	sv_box big = sv_box(sv_point(-10,-10,-10), sv_point(30,30,30));
+
+	sv_set u = chain(2000, all, 0);
+	sv_set ru = u.reorder(all, 64);
+	report("reorder: union", same_members(u, ru, big));
+
+	sv_set h = chain(2000, all, 1);
+	sv_set rh = h.reorder(all, 64);
+	report("reorder: intersection", same_members(h, rh, big));
+
+	sv_model d = sv_model(sv_set_list(chain(300, all, 0)), all).divide(0, dumb_decision);
+	sv_model rd = d.reorder(16);
+	int ok = 1;
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point p = ran_point(all);
+		if(d.member(p) != rd.member(p)) ok = 0;
+	}
+	report("reorder: divided model", ok);
+}
+
+// ***************************************************************
+
+// Transforms
+
+// Are two reals, or two points, close?
+
+static int near_real(sv_real a, sv_real b)
+{
+	return(fabs(a - b) <= 1.0e-3*(1 + fabs(a) + fabs(b)));
+}
+
+static int near_point(const sv_point& a, const sv_point& b)
+{
+	return(near_real(a.x, b.x) && near_real(a.y, b.y) && near_real(a.z, b.z));
+}
+
+// Does a lazy transform node agree with the same transform done at
+// once?  Its values and grads should match, and its range over a box
+// should hold the values at points in the box.
+
+static int same_lazy(const sv_primitive& lazy, const sv_primitive& eager, const sv_box& box)
+{
+	for(sv_integer k = 0; k < EQ_POINTS/10; k++)
+	{
+		sv_point p = ran_point(box);
+		if(!near_real(lazy.value(p), eager.value(p))) return(0);
+		if(!near_point(lazy.grad(p), eager.grad(p))) return(0);
+		sv_point q = ran_point(box);
+		sv_box b = sv_box(sv_point(min(p.x, q.x), min(p.y, q.y), min(p.z, q.z)),
+			sv_point(max(p.x, q.x), max(p.y, q.y), max(p.z, q.z)));
+		sv_interval r = lazy.range(b);
+		for(sv_integer j = 0; j < 10; j++)
+		{
+			sv_real v = eager.value(ran_point(b));
+			if( (v < r.lo() - 1.0e-3*(1 + fabs(v))) || 
+			    (v > r.hi() + 1.0e-3*(1 + fabs(v))) ) return(0);
+		}
+	}
+	return(1);
+}
+
+// Compare lazy translations and spins with the eager ones; check that
+// two copies of one primitive moved by different amounts aren't taken
+// to be the same by regularize(); and transform a set there and back
+
+static void transform_test()
+{
+	sv_box all = sv_box(sv_point(-10,-10,-10), sv_point(10,10,10));
+	sv_primitive p = p_sphere(sv_point(1, 2, 3), 2)*
+		sv_primitive(sv_plane(sv_point(1, 1, 0), sv_point(0, 0, 1))) - 
+		p_cylinder(sv_line(SV_Z, sv_point(-1, 0, 0)), 3);
+	sv_point d = sv_point(3, -2, 1);
+	sv_line axis = sv_line(sv_point(1, 1, 1), sv_point(0, 1, 0));
+
+	report("transform: translate", same_lazy(p.transform(xf_translate(d)), p + d, all));
+	report("transform: spin", same_lazy(p.transform(xf_spin(axis, 0.7)), 
+		p.spin(axis, 0.7), all));
+	report("transform: translate then spin", 
+		same_lazy(p.transform(xf_translate(d)).transform(xf_spin(axis, 0.7)), 
+		(p + d).spin(axis, 0.7), all));
+
+	sv_primitive ball = p_sphere(SV_OO, 1).transform(xf_scale(SV_OO, 1.5));
+	sv_set two = sv_set(ball.transform(xf_translate(sv_point(3, 0, 0)))) |
+		sv_set(ball.transform(xf_translate(sv_point(-3, 0, 0))));
+	sv_set r = two.regularize();
+	report("transform: moved copies kept apart", (r.contents() == 2) &&
+		(r.member(sv_point(3, 0, 0)) == SV_SOLID) && 
+		(r.member(sv_point(-3, 0, 0)) == SV_SOLID));
+
+	sv_set s = chain(40, sv_box(sv_point(0,0,0), sv_point(8,8,8)), 0);
+	sv_xform m = xf_spin(axis, 1.1)*xf_translate(d)*xf_scale(sv_point(1, 0, 0), 1.7);
+	sv_set back = s.transform(m).transform(m.inverse());
+	int ok = 1;
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point q = ran_point(sv_box(sv_point(-2,-2,-2), sv_point(10,10,10)));
+		mem_test a = s.member(q);
+		mem_test b = back.member(q);
+		if( (a != b) && (a != SV_SURFACE) && (b != SV_SURFACE) ) ok = 0;
+	}
+	report("transform: set there and back", ok);
+}
+
+// ***************************************************************
+
+// Convex polyhedra
+
+// Membership of a point in the intersection of n planes, worked out
+// plane by plane
+
+static mem_test planes_member(const sv_plane* f, sv_integer n, const sv_point& p)
+{
+	mem_test m = SV_SOLID;
+	for(sv_integer i = 0; i < n; i++)
+	{
+		sv_real v = f[i].value(p);
+		if(v > 0) return(SV_AIR);
+		if(v == 0) m = SV_SURFACE;
+	}
+	return(m);
+}
+
+// Intersect planes touching a sphere, then compare the packed set (and
+// pruned and divided versions of it) with the planes one by one
+
+static void convex_test()
+{
+	sv_box all = sv_box(sv_point(0,0,0), sv_point(20,20,20));
+	sv_box part = sv_box(sv_point(9,9,9), sv_point(16,16,16));
+	sv_point c = sv_point(10,10,10);
+	sv_plane f[20];
+	sv_set h = sv_set(SV_EVERYTHING);
+	sv_integer n = 20;
+
+	for(sv_integer i = 0; i < n; i++)
+	{
+		sv_point d = (ran_point(all) - c);
+		if(d.mod() < 1) d = SV_X;
+		d = d.norm();
+		f[i] = sv_plane(d, c + d*5);
+		h = h & sv_set(sv_primitive(f[i]));
+	}
+	report("convex: flagged", (h.flags() & SV_CV_POL) != 0);
+
+	int ok = 1;
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point p = ran_point(all);
+		if(h.member(p) != planes_member(f, n, p)) ok = 0;
+	}
+	report("convex: members", ok);
+	report("convex: packed when tested", h.cv_pol() != 0);
+
+	sv_set hp = h.prune(part);
+	ok = 1;
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point p = ran_point(part);
+		if(hp.member(p) != planes_member(f, n, p)) ok = 0;
+	}
+	report("convex: pruned members", ok);
+
+	sv_model d = sv_model(sv_set_list(h), all).divide(0, dumb_decision);
+	ok = 1;
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point p = ran_point(all);
+		if(d.member(p) != planes_member(f, n, p)) ok = 0;
+	}
+	report("convex: divided model", ok);
+}
+
+// ***************************************************************
+
+// Root finding
+
+// Find the root of exp(0.1x) - e^0.5 (at x = 5) along the x axis from
+// -1 to 100, marching and subdividing.  The function is steep at one
+// end and flat at the other, so false position alone creeps up on the
+// root from one side.
+
+static void arf_test()
+{
+	sv_real tol = 0.001;
+	sv_primitive x = sv_primitive(sv_plane(SV_X, SV_OO));
+	sv_primitive f = exp(x*0.1) - sv_primitive((sv_real)exp(0.5));
+	sv_line ray = sv_line(SV_X, SV_OO);
+	double r[10];
+	sv_integer old_march = get_arf_march();
+
+	set_arf_march(1);
+	sv_integer n = arf(ray, f, sv_interval(-1, 100), tol, 10, r);
+	report("arf: marched root", (n == 1) && (fabs(r[0] - 5.0) < tol));
+
+	set_arf_march(0);
+	n = arf(ray, f, sv_interval(-1, 100), tol, 10, r);
+	report("arf: subdivided root", (n == 1) && (fabs(r[0] - 5.0) < tol));
+
+	set_arf_march(old_march);
+}
+
+// ***************************************************************
+
+// User shapes
+
+// A ball as a user shape
+
+class eq_ball : public sv_user_shape<eq_ball>
+{
+public:
+	sv_point c;
+	sv_real r;
+
+	eq_ball() { c = sv_point(0,0,0); r = 1; }
+	eq_ball(const sv_point& cc, sv_real rr) { c = cc; r = rr; }
+
+	static const char* name() { return("eq_ball"); }
+
+	sv_real value(const sv_point& q) const { return((q - c)*(q - c) - r*r); }
+
+	sv_interval range(const sv_box& b) const
+	{
+		return(pow(b.xi - c.x, 2) + pow(b.yi - c.y, 2) + pow(b.zi - c.z, 2) - r*r);
+	}
+
+};
+
+// Moving and complementing a shape many times mustn't register new
+// shapes, and the copies must have the right values
+
+static void user_prim_test()
+{
+	sv_integer before = user_prim_count();
+	int ok = 1;
+	{
+		sv_primitive b = user_primitive(eq_ball(sv_point(0,0,0), 2));
+		sv_primitive t, c;
+		for(sv_integer i = 0; i < 5000; i++)
+		{
+			t = b + sv_point(i, 0, 0);
+			c = -t;
+			if(t.value(sv_point(i, 0, 0)) != -4) ok = 0;
+			if(c.value(sv_point(i, 3, 0)) != -5) ok = 0;
+			if(t.grad(sv_point(i, 1, 0)).y <= 0) ok = 0;
+		}
+		report("user shapes: copies' values", ok);
+		report("user shapes: copies share the shape", user_prim_count() == before + 1);
+		t = (b + sv_point(3, 0, 0)).spin(sv_line(SV_Z, sv_point(0, 0, 0)), 0.5*M_PI);
+		report("user shapes: turned copy", fabs(t.value(sv_point(0, 3, 0)) + 4) < 0.001);
+	}
+	report("user shapes: all freed", user_prim_count() == before);
+}
+
+// ***************************************************************
+
+// Instances
+
+// A sphere as a prototype, and the same sphere scaled by 2 and moved
+// to c, once as an instance and once made directly
+
+static sv_model eq_ball_model(const sv_point& c, sv_real r)
+{
+	sv_box b = sv_box(c - sv_point(r, r, r)*1.5, c + sv_point(r, r, r)*1.5);
+	return(sv_model(sv_set_list(sphere(c, r).colour(SV_RED)), b).divide(0, dumb_decision));
+}
+
+// Compare rays fired at, and points tested in, a scaled instance and
+// the model it should be the same as
+
+static void instance_test()
+{
+	sv_point c = sv_point(5, 1, -2);
+	sv_model proto = eq_ball_model(sv_point(0, 0, 0), 1);
+	sv_xform place = xf_translate(c)*xf_scale(sv_point(0, 0, 0), 2);
+	sv_model inst = instance_model(&proto, &place, 1);
+	sv_model ref = eq_ball_model(c, 2);
+	sv_box around = sv_box(c - sv_point(6, 6, 6), c + sv_point(6, 6, 6));
+	sv_box near = sv_box(c - sv_point(1.5, 1.5, 1.5), c + sv_point(1.5, 1.5, 1.5));
+
+	int ok = 1;
+	int hits = 0;
+	sv_real t_i, t_r;
+	for(sv_integer k = 0; k < EQ_POINTS; k++)
+	{
+		sv_point from = ran_point(around);
+		sv_line ray = sv_line(ran_point(near) - from, from);
+		sv_set h_i = inst.fire_ray(ray, &t_i);
+		sv_set h_r = ref.fire_ray(ray, &t_r);
+		if(h_i.exists() != h_r.exists())
+		{
+			ok = 0;
+			break;
+		}
+		if(!h_i.exists()) continue;
+		hits++;
+		if(fabs(t_i - t_r) > 1.0e-3*(1 + fabs(t_r))) ok = 0;
+	}
+	report("instance: scaled ray hits", ok && hits);
+
+// Two rays hitting the same prototype set get back the same world set
+
+	sv_set h_1 = inst.fire_ray(sv_line(SV_X, c - sv_point(5, 0, 0)), &t_i);
+	sv_set h_2 = inst.fire_ray(sv_line(SV_Y, c - sv_point(0, 5, 0)), &t_r);
+	report("instance: placed sets kept", h_1.exists() && (h_1 == h_2) &&
+		near_real(t_i, 3) && near_real(t_r, 3));
+
+	ok = 1;
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point p = ran_point(around);
+		if(inst.member(p) != ref.member(p)) ok = 0;
+	}
+	report("instance: scaled members", ok);
+
+	ok = 1;
+	int blocked = 0;
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point from = ran_point(around);
+		sv_line ray = sv_line(ran_point(around) - from, from);
+		sv_integer o_i = inst.occluded(ray, sv_interval(0, 1));
+		if(o_i != ref.occluded(ray, sv_interval(0, 1))) ok = 0;
+		if(o_i) blocked++;
+	}
+	report("instance: scaled occlusion", ok && blocked);
+}
+
+// ***************************************************************
+
+// Frozen models
+
+// A frozen copy must find the same leaves, members and ray hits as the
+// tree it came from, and a model's own copy must stop handing the
+// model back once the model has gone
+
+static void frozen_test()
+{
+	sv_box b = sv_box(sv_point(0, 0, 0), sv_point(10, 10, 10));
+	sv_model m = sv_model(sv_set_list(chain(60, b, 0)), b).divide(0, dumb_decision);
+	sv_frozen_model f = m.frozen();
+
+	int ok = f.exists() && (f.model() == m);
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point p = ran_point(b);
+		if(!(f.leaf(p) == m.leaf(p))) ok = 0;
+		if(f.member(p) != m.member(p)) ok = 0;
+	}
+	report("frozen: leaves and members", ok);
+
+	ok = 1;
+	int hits = 0;
+	sv_real t_f, t_m;
+	sv_box around = sv_box(sv_point(-10, -10, -10), sv_point(20, 20, 20));
+	for(sv_integer k = 0; ok && (k < EQ_POINTS); k++)
+	{
+		sv_point from = ran_point(around);
+		sv_line ray = sv_line(ran_point(b) - from, from);
+		sv_set h_f = f.fire_ray(ray, &t_f);
+		sv_set h_m = m.fire_ray(ray, &t_m);
+		if(h_f.exists() != h_m.exists())
+		{
+			ok = 0;
+			break;
+		}
+		if(!h_f.exists()) continue;
+		hits++;
+		if(!(h_f == h_m) || (t_f != t_m)) ok = 0;
+	}
+	report("frozen: ray hits", ok && hits);
+
+	m = sv_model();
+	report("frozen: model gone", !f.model().exists() && (f.leaves() > 1) &&
+		(f.member(sv_point(-1, -1, -1)) == SV_AIR));
+}
+
+// ***************************************************************
+
+// Integral properties
+
+// A cuboid has known products of inertia: for [1,4]x[2,6]x[3,8] the
+// averages of yz, xz and xy are 22, 13.75 and 10.  Some leaves are
+// solid and some are cut, so both the exact and the Monte-Carlo sums
+// are used.  A zero centroid going in gives the raw products back.
+// Swelled leaf boxes overlap and would be counted twice, so the model
+// is divided without swell, and the cut leaves are sampled at a fixed
+// density so the estimate isn't biased by stopping early.
+
+static int near_integral(const sv_point& a, const sv_point& b)
+{
+	return( (fabs(a.x - b.x) <= 0.02*fabs(b.x)) &&
+		(fabs(a.y - b.y) <= 0.02*fabs(b.y)) &&
+		(fabs(a.z - b.z) <= 0.02*fabs(b.z)) );
+}
+
+#define EQ_THREADS 4
+
+struct eq_integral
+{
+	const sv_model* m;
+	sv_real vol;
+	sv_point nxyz;
+};
+
+static void* integral_r(void* vp)
+{
+	eq_integral* ei = (eq_integral*)vp;
+	sv_point centroid = SV_OO;
+	sv_point mxyz;
+	integral(*(ei->m), 0.005, ei->vol, centroid, mxyz, ei->nxyz);
+	return(0);
+}
+
+static void integral_test()
+{
+	sv_real old_swell = get_swell_fac();
+	set_swell_fac(0);
+	sv_set c = cuboid(sv_point(1, 2, 3), sv_point(4, 6, 8));
+	sv_model m = sv_model(sv_set_list(c), sv_box(sv_point(0, 0, 0), 
+		sv_point(10, 10, 10))).divide(0, dumb_decision);
+	set_swell_fac(old_swell);
+
+	sv_real vol;
+	sv_point centroid = SV_OO;
+	sv_point mxyz, nxyz;
+	integral_points(2000);
+	integral(m, 0.005, vol, centroid, mxyz, nxyz);
+	integral_points(-1);
+
+	report("integral: volume", fabs(vol - 60) <= 0.02*60);
+	report("integral: centroid", near_integral(centroid, sv_point(2.5, 4, 5.5)));
+	report("integral: products of inertia", near_integral(nxyz, sv_point(22, 13.75, 10)));
+
+// Several threads integrating at once mustn't disturb each other
+
+	eq_integral ei[EQ_THREADS];
+	pthread_t th[EQ_THREADS];
+	sv_integer k;
+	integral_points(2000);
+	for(k = 0; k < EQ_THREADS; k++)
+	{
+		ei[k].m = &m;
+		pthread_create(&th[k], 0, integral_r, (void*)&ei[k]);
+	}
+	int ok = 1;
+	for(k = 0; k < EQ_THREADS; k++)
+	{
+		pthread_join(th[k], 0);
+		if(fabs(ei[k].vol - 60) > 0.02*60) ok = 0;
+		if(!near_integral(ei[k].nxyz, sv_point(22, 13.75, 10))) ok = 0;
+	}
+	integral_points(-1);
+	report("integral: concurrent calls", ok);
+}
+
+// ***************************************************************
+
+// Paging
+
+// A post shared by three bands, on a base.  The post is coloured
+// itself in the first band, the second band is coloured as a whole,
+// and the third isn't coloured at all, so leaves hold the same post
+// under different attributes.
+
+static sv_model post_model()
+{
+	sv_box all = sv_box(sv_point(0,0,0), sv_point(20,20,20));
+	sv_set post = cylinder(sv_line(SV_Z, sv_point(10,10,0)), 4);
+	sv_set_list sl = sv_set_list(cuboid(sv_point(2,2,0), sv_point(18,18,2)).colour(SV_BLUE));
+	sl = sv_set_list(post.colour(SV_RED) & cuboid(sv_point(0,0,2), sv_point(20,20,8)), sl);
+	sl = sv_set_list((post & cuboid(sv_point(0,0,8), sv_point(20,20,14))).colour(SV_GREEN), sl);
+	sl = sv_set_list(post & cuboid(sv_point(0,0,14), sv_point(20,20,20)), sl);
+	return(sv_model(sl, all).divide(0, dumb_decision));
+}
+
+// Ray trace a small picture of a model
+
+static void eq_picture(const sv_model& m, sv_picture& pic)
+{
+	sv_box b = m.box();
+	sv_view v;
+	sv_point cen = b.centroid();
+	v.centre(cen);
+	v.eye_point(cen + sv_point(22, -18, 16));
+	v.vertical_dir(SV_Z);
+	v.lens_angle(0.6);
+	sv_lightsource l;
+	l.direction(sv_point(-1, 1, -2).norm());
+	sv_light_list ll;
+	ll.source = &l;
+	ll.name = (char*)"L_0";
+	ll.next = 0;
+	pic.resolution(80, 60);
+	generate_picture(m, v, ll, pic);
+}
+
+static int same_pictures(sv_picture& a, sv_picture& b)
+{
+	for(sv_integer y = 0; y < 60; y++)
+	   for(sv_integer x = 0; x < 80; x++)
+	   {
+		sv_pixel pa = a.pixel(x, y);
+		sv_pixel pb = b.pixel(x, y);
+		if( (pa.r != pb.r) || (pa.g != pb.g) || (pa.b != pb.b) ) return(0);
+	   }
+	return(1);
+}
+
+// Render a model paged and divided paged, and compare the pictures
+// (colours and all) with the one from memory; then read a page in the
+// middle of reading a file
+
+static void paging_test()
+{
+	long old_mem = get_page_memory();
+	sv_model d = post_model();
+	sv_picture ref, pp, dp;
+	eq_picture(d, ref);
+
+	set_page_memory(0);
+	eq_picture(page_model(d, 1), pp);
+	report("paging: paged colours", same_pictures(ref, pp));
+
+	sv_model m = sv_model(d.set_list(), d.box());
+	eq_picture(divide_paged(m, 0, dumb_decision, 1), dp);
+	report("paging: divided paged colours", same_pictures(ref, dp));
+
+	sv_set a = sphere(sv_point(1, 2, 3), 2);
+	sv_set b = a | sphere(sv_point(2, 2, 3), 2);
+	stringstream io;
+	unwrite(a);
+	unwrite(b);
+	write_svlis_header(io);
+	write(io, a, 0);
+	write(io, b, 0);
+	sv_set ra, rb;
+	sv_clear_input_tables();
+	check_svlis_header(io);
+	read(io, ra);
+	page_model(d, 1).member(sv_point(3, 3, 1));
+	read(io, rb);
+	report("paging: fault during a read", rb.exists() && 
+		same_members(b, rb, sv_box(sv_point(-2,-1,0), sv_point(5,5,6))));
+	sv_clear_input_tables();
+
+	set_page_memory(old_mem);
+}
+
+// ***************************************************************
+
+// Rendering
+
+// Two pictures of different models rendered at once must come out as
+// they do one at a time (each render has its own shading materials)
+
+struct eq_render
+{
+	const sv_model* m;
+	sv_picture* ref;
+	int same;
+};
+
+static void* render_r(void* vp)
+{
+	eq_render* er = (eq_render*)vp;
+	er->same = 1;
+	for(sv_integer k = 0; k < 3; k++)
+	{
+		sv_picture pic;
+		eq_picture(*(er->m), pic);
+		if(!same_pictures(*(er->ref), pic)) er->same = 0;
+	}
+	return(0);
+}
+
+static void render_test()
+{
+	sv_box b = sv_box(sv_point(0, 0, 0), sv_point(20, 20, 20));
+	sv_model m[2];
+	m[0] = post_model();
+	m[1] = sv_model(sv_set_list(chain(40, b, 0).colour(SV_GREEN)), b).divide(0, dumb_decision);
+	sv_picture ref[2];
+	eq_render er[2];
+	pthread_t th[2];
+	sv_integer k;
+
+	for(k = 0; k < 2; k++)
+	{
+		eq_picture(m[k], ref[k]);
+		er[k].m = &m[k];
+		er[k].ref = &ref[k];
+		pthread_create(&th[k], 0, render_r, (void*)&er[k]);
+	}
+	for(k = 0; k < 2; k++) pthread_join(th[k], 0);
+	report("render: two at once", er[0].same && er[1].same);
+}
+
+// ***************************************************************
+
+// Memory use
+
+// A model whose nodes can be counted by hand.  The sets are u = a | b,
+// a again, c (a second set on a's plane) and -b; b and -b point at
+// each other.  So there are 5 set nodes reached 8 times (a, b and -b
+// more than once), and 3 primitives (p, q, and -q above q) reached 5
+// times (p and q twice).
+
+static void memuse_test()
+{
+	sv_primitive p = sv_primitive(sv_plane(SV_X, sv_point(1, 0, 0)));
+	sv_primitive q = sv_primitive(sv_plane(SV_Y, sv_point(0, 1, 0)));
+	sv_set a = sv_set(p);
+	sv_set b = sv_set(q);
+	sv_set c = sv_set(p);
+	sv_set_list sl = sv_set_list(a | b, sv_set_list(a, sv_set_list(c, sv_set_list(-b))));
+	sv_model m = sv_model(sl, sv_box(sv_point(0, 0, 0), sv_point(2, 2, 2)));
+
+	sv_mem_stats ms;
+	memory_use(m, &ms);
+	report("memuse: model and set lists", (ms.model.nodes == 1) && (ms.set_list.nodes == 4));
+	report("memuse: sets", (ms.set.nodes == 5) && (ms.set.refs == 8) && (ms.set.shared == 3));
+	report("memuse: primitives", (ms.prim.nodes == 3) && (ms.prim.refs == 5) && 
+		(ms.prim.shared == 2));
+}
+
+// ***************************************************************
+
+// Counters
+
+// Rays and shadow rays are each counted once, whether they go into a
+// model or its frozen copy
+
+static void stats_test()
+{
+	sv_model m = eq_ball_model(sv_point(0, 0, 0), 2);
+	sv_frozen_model f = m.frozen();
+	sv_line ray = sv_line(SV_X, sv_point(-10, 0, 0));
+	sv_interval all = sv_interval(0, 100);
+	sv_real t;
+
+	long rays = get_stat(SV_ST_RAY);
+	long shadows = get_stat(SV_ST_SHADOW);
+	m.fire_ray(ray, all, &t);
+	f.fire_ray(ray, all, &t);
+	m.occluded(ray, all);
+	f.occluded(ray, all);
+	report("stats: rays and shadow rays", (get_stat(SV_ST_RAY) == rays + 2) &&
+		(get_stat(SV_ST_SHADOW) == shadows + 2));
+}
+
+// ***************************************************************
+
+int main()
+{
+	svlis_init();
+
+	index_prune_test();
+	balance_test();
+	budget_test();
+	cost_test();
+	interference_test();
+	reorder_test();
+	transform_test();
+	convex_test();
+	arf_test();
+	user_prim_test();
+	instance_test();
+	frozen_test();
+	integral_test();
+	paging_test();
+	render_test();
+	memuse_test();
+	stats_test();
+
+	if(failures)
+		printf("%d test(s) FAILED\n", failures);
+	else
+		printf("All tests passed\n");
+	return(failures);
+}
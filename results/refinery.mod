@@ -0,0 +1,35748 @@
+SvLis(4)
+
+# SvLis created this file on Mon Oct 19 01:52:02 2026
+# See  http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+
+model
+{
+94505046198208 L 0
+box\interval\0, 250, 0/, interval\0, 200, 0/, interval\-30, 50, 0//
+set_list
+[
+94505046294496 0
+set
+(
+94505045656080 1354 0 |
+set
+(
+94505045655920 57 0 |
+set
+(
+94505045655760 3 0 &
+set
+(
+94505045655600 1 0 
+primitive
+<
+94505046136464 3 0 -
+primitive
+<
+94505046136304 8 0 +
+primitive
+<
+94505046136144 8 0 ^
+primitive
+<
+94505046119744 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505046135984 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046116864 8 0 ^
+primitive
+<
+94505046117984 1 0 
+plane\point\-0, 1, 0/, -154/
+>
+primitive
+<
+94505046117024 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046117824 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045655440 2 1073741824 &
+set
+(
+94505045655280 1 1073741824 
+primitive
+<
+94505046119904 1 0 
+plane\point\1, 0, 0/, -110/
+>
+0
+0
+)
+set
+(
+94505045655120 1 1073741824 
+primitive
+<
+94505046120064 1 0 
+plane\point\-1, -0, -0/, 82.9/
+>
+0
+1
+set
+(
+94505045653520 1 1073741824 
+primitive
+<
+94505046099104 1 0 
+plane\point\1, 0, 0/, -82.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045654960 54 0 |
+set
+(
+94505045654160 3 0 &
+set
+(
+94505045654000 1 0 
+primitive
+<
+94505046115744 3 0 -
+primitive
+<
+94505046115584 8 0 +
+primitive
+<
+94505046115424 8 0 ^
+primitive
+<
+94505046097184 1 0 
+plane\point\0, -1, 0/, 154/
+>
+primitive
+<
+94505046115264 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046115104 8 0 ^
+primitive
+<
+94505046096384 1 0 
+plane\point\1, 0, -0/, -82/
+>
+primitive
+<
+94505046114944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046096224 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045653840 2 1073741824 &
+set
+(
+94505045653200 1 1073741824 
+primitive
+<
+94505046099424 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045651600 1 1073741824 
+primitive
+<
+94505046078464 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+set
+(
+94505045653680 1 1073741824 
+primitive
+<
+94505046097344 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045653360 1 1073741824 
+primitive
+<
+94505046099264 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045654800 51 0 |
+set
+(
+94505045654640 3 0 &
+set
+(
+94505045654480 1 0 
+primitive
+<
+94505046135824 6 0 -
+primitive
+<
+94505046135664 8 0 +
+primitive
+<
+94505046135504 8 0 ^
+primitive
+<
+94505046133424 1 0 
+plane\point\0, 1, 0/, -154/
+>
+primitive
+<
+94505046135344 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046135184 8 0 ^
+primitive
+<
+94505046134704 8 0 -
+primitive
+<
+94505046134544 8 0 @
+primitive
+<
+94505046134384 8 0 +
+primitive
+<
+94505046134224 8 0 ^
+primitive
+<
+94505046133264 1 0 
+plane\point\1, -0, 0/, -82.9/
+>
+primitive
+<
+94505046134064 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046133904 8 0 ^
+primitive
+<
+94505046133104 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505046133744 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505046133584 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505046135024 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046134864 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045654320 2 1073741824 &
+set
+(
+94505045653360 )
+set
+(
+94505045653520 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045653040 48 0 |
+set
+(
+94505045652240 3 0 &
+set
+(
+94505045652080 1 0 
+primitive
+<
+94505046095104 3 0 -
+primitive
+<
+94505046094944 8 0 +
+primitive
+<
+94505046094784 8 0 ^
+primitive
+<
+94505046076544 1 0 
+plane\point\0, -0, 1/, -8/
+>
+primitive
+<
+94505046094624 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046094464 8 0 ^
+primitive
+<
+94505046075744 1 0 
+plane\point\0, 1, 0/, -154/
+>
+primitive
+<
+94505046094304 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046075584 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045651920 2 1073741824 &
+set
+(
+94505045651280 1 1073741824 
+primitive
+<
+94505046078784 1 0 
+plane\point\-1, -0, -0/, 70.9/
+>
+0
+1
+set
+(
+94505045649680 1 1073741824 
+primitive
+<
+94505046057424 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+0
+0
+)
+)
+set
+(
+94505045651760 1 1073741824 
+primitive
+<
+94505046076704 1 0 
+plane\point\1, -0, -0/, -81.1/
+>
+0
+1
+set
+(
+94505045651440 1 1073741824 
+primitive
+<
+94505046078624 1 0 
+plane\point\-1, 0, 0/, 81.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045652880 45 0 |
+set
+(
+94505045652720 3 0 &
+set
+(
+94505045652560 1 0 
+primitive
+<
+94505046114784 6 0 -
+primitive
+<
+94505046114624 8 0 +
+primitive
+<
+94505046114464 8 0 ^
+primitive
+<
+94505046112384 1 0 
+plane\point\-0, -1, -0/, 154/
+>
+primitive
+<
+94505046114304 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046114144 8 0 ^
+primitive
+<
+94505046113664 8 0 -
+primitive
+<
+94505046113504 8 0 @
+primitive
+<
+94505046113344 8 0 +
+primitive
+<
+94505046113184 8 0 ^
+primitive
+<
+94505046112224 1 0 
+plane\point\1, 0, 0/, -81.1/
+>
+primitive
+<
+94505046113024 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046112864 8 0 ^
+primitive
+<
+94505046112064 1 0 
+plane\point\0, 0, 1/, -7.1/
+>
+primitive
+<
+94505046112704 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505046112544 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505046113984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046113824 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045652400 2 1073741824 &
+set
+(
+94505045651440 )
+set
+(
+94505045651600 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045651120 42 0 |
+set
+(
+94505045650320 3 0 &
+set
+(
+94505045650160 1 0 
+primitive
+<
+94505046074464 3 0 -
+primitive
+<
+94505046074304 8 0 +
+primitive
+<
+94505046074144 8 0 ^
+primitive
+<
+94505046055504 1 0 
+plane\point\-0, 1, 0/, -154/
+>
+primitive
+<
+94505046073984 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046073824 8 0 ^
+primitive
+<
+94505046054704 1 0 
+plane\point\1, 0, 0/, -70/
+>
+primitive
+<
+94505046073664 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046054544 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045650000 2 1073741824 &
+set
+(
+94505045649360 1 1073741824 
+primitive
+<
+94505046057744 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045647760 1 1073741824 
+primitive
+<
+94505046036784 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+set
+(
+94505045649840 1 1073741824 
+primitive
+<
+94505046055664 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045649520 1 1073741824 
+primitive
+<
+94505046057584 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045650960 39 0 |
+set
+(
+94505045650800 3 0 &
+set
+(
+94505045650640 1 0 
+primitive
+<
+94505046094144 6 0 -
+primitive
+<
+94505046093984 8 0 +
+primitive
+<
+94505046093824 8 0 ^
+primitive
+<
+94505046091744 1 0 
+plane\point\0, -1, 0/, 154/
+>
+primitive
+<
+94505046093664 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046093504 8 0 ^
+primitive
+<
+94505046093024 8 0 -
+primitive
+<
+94505046092864 8 0 @
+primitive
+<
+94505046092704 8 0 +
+primitive
+<
+94505046092544 8 0 ^
+primitive
+<
+94505046091584 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+primitive
+<
+94505046092384 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046092224 8 0 ^
+primitive
+<
+94505046091424 1 0 
+plane\point\-0, 0, 1/, -7.1/
+>
+primitive
+<
+94505046092064 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505046091904 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505046093344 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046093184 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045650480 2 1073741824 &
+set
+(
+94505045649520 )
+set
+(
+94505045649680 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045649200 36 0 |
+set
+(
+94505045648400 3 0 &
+set
+(
+94505045648240 1 0 
+primitive
+<
+94505046053424 3 0 -
+primitive
+<
+94505046053264 8 0 +
+primitive
+<
+94505046053104 8 0 ^
+primitive
+<
+94505046034864 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505046052944 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046052784 8 0 ^
+primitive
+<
+94505046034064 1 0 
+plane\point\0, 1, 0/, -154/
+>
+primitive
+<
+94505046052624 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046033904 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045648080 2 1073741824 &
+set
+(
+94505045647440 1 1073741824 
+primitive
+<
+94505046037104 1 0 
+plane\point\-1, -0, -0/, 63.9/
+>
+0
+1
+set
+(
+94505045645840 1 1073741824 
+primitive
+<
+94505046016144 1 0 
+plane\point\1, 0, 0/, -63.9/
+>
+0
+0
+)
+)
+set
+(
+94505045647920 1 1073741824 
+primitive
+<
+94505046035024 1 0 
+plane\point\1, -0, -0/, -69.1/
+>
+0
+1
+set
+(
+94505045647600 1 1073741824 
+primitive
+<
+94505046036944 1 0 
+plane\point\-1, 0, 0/, 69.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045649040 33 0 |
+set
+(
+94505045648880 3 0 &
+set
+(
+94505045648720 1 0 
+primitive
+<
+94505046073504 6 0 -
+primitive
+<
+94505046073344 8 0 +
+primitive
+<
+94505046073184 8 0 ^
+primitive
+<
+94505046071104 1 0 
+plane\point\0, 1, -0/, -154/
+>
+primitive
+<
+94505046073024 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046072864 8 0 ^
+primitive
+<
+94505046072384 8 0 -
+primitive
+<
+94505046072224 8 0 @
+primitive
+<
+94505046072064 8 0 +
+primitive
+<
+94505046071904 8 0 ^
+primitive
+<
+94505046070944 1 0 
+plane\point\1, 0, 0/, -69.1/
+>
+primitive
+<
+94505046071744 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046071584 8 0 ^
+primitive
+<
+94505046070784 1 0 
+plane\point\0, -0, -1/, 1.9/
+>
+primitive
+<
+94505046071424 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505046071264 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505046072704 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046072544 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045648560 2 1073741824 &
+set
+(
+94505045647600 )
+set
+(
+94505045647760 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045647280 30 0 |
+set
+(
+94505045646480 3 0 &
+set
+(
+94505045646320 1 0 
+primitive
+<
+94505046032784 3 0 -
+primitive
+<
+94505046032624 8 0 +
+primitive
+<
+94505046032464 8 0 ^
+primitive
+<
+94505046014224 1 0 
+plane\point\0, 0, 1/, -1/
+>
+primitive
+<
+94505046032304 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046032144 8 0 ^
+primitive
+<
+94505046013424 1 0 
+plane\point\1, 0, 0/, -63/
+>
+primitive
+<
+94505046031984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046013264 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045646160 2 1073741824 &
+set
+(
+94505045645520 1 1073741824 
+primitive
+<
+94505046016464 1 0 
+plane\point\-0, 1, -0/, -159.1/
+>
+0
+1
+set
+(
+94505045643920 1 1073741824 
+primitive
+<
+94505045994704 1 0 
+plane\point\0, -1, 0/, 159.1/
+>
+0
+0
+)
+)
+set
+(
+94505045646000 1 1073741824 
+primitive
+<
+94505046014384 1 0 
+plane\point\-0, -1, -0/, 154.9/
+>
+0
+1
+set
+(
+94505045645680 1 1073741824 
+primitive
+<
+94505046016304 1 0 
+plane\point\0, 1, 0/, -154.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045647120 27 0 |
+set
+(
+94505045646960 3 0 &
+set
+(
+94505045646800 1 0 
+primitive
+<
+94505046052464 6 0 -
+primitive
+<
+94505046052304 8 0 +
+primitive
+<
+94505046052144 8 0 ^
+primitive
+<
+94505046050064 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505046051984 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046051824 8 0 ^
+primitive
+<
+94505046051344 8 0 -
+primitive
+<
+94505046051184 8 0 @
+primitive
+<
+94505046051024 8 0 +
+primitive
+<
+94505046050864 8 0 ^
+primitive
+<
+94505046049904 1 0 
+plane\point\1, 0, 0/, -63.9/
+>
+primitive
+<
+94505046050704 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046050544 8 0 ^
+primitive
+<
+94505046049744 1 0 
+plane\point\0, -1, 0/, 154.9/
+>
+primitive
+<
+94505046050384 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505046050224 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505046051664 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046051504 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045646640 2 1073741824 &
+set
+(
+94505045645680 )
+set
+(
+94505045645840 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045645360 24 0 |
+set
+(
+94505045644560 3 0 &
+set
+(
+94505045644400 1 0 
+primitive
+<
+94505046012144 3 0 -
+primitive
+<
+94505046011984 8 0 +
+primitive
+<
+94505046011824 8 0 ^
+primitive
+<
+94505045992784 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505046011664 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046011504 8 0 ^
+primitive
+<
+94505045991984 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505046011344 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045991824 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045644240 2 1073741824 &
+set
+(
+94505045643600 1 1073741824 
+primitive
+<
+94505045995024 1 0 
+plane\point\-1, -0, -0/, 62.4/
+>
+0
+1
+set
+(
+94505045642000 1 1073741824 
+primitive
+<
+94505045974064 1 0 
+plane\point\1, 0, 0/, -62.4/
+>
+0
+0
+)
+)
+set
+(
+94505045644080 1 1073741824 
+primitive
+<
+94505045992944 1 0 
+plane\point\1, -0, -0/, -62.1/
+>
+0
+1
+set
+(
+94505045643760 1 1073741824 
+primitive
+<
+94505045994864 1 0 
+plane\point\-1, 0, 0/, 62.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045645200 21 0 |
+set
+(
+94505045645040 3 0 &
+set
+(
+94505045644880 1 0 
+primitive
+<
+94505046031824 6 0 -
+primitive
+<
+94505046031664 8 0 +
+primitive
+<
+94505046031504 8 0 ^
+primitive
+<
+94505046029424 1 0 
+plane\point\0, 0, 1/, -1/
+>
+primitive
+<
+94505046031344 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046031184 8 0 ^
+primitive
+<
+94505046030704 8 0 -
+primitive
+<
+94505046030544 8 0 @
+primitive
+<
+94505046030384 8 0 +
+primitive
+<
+94505046030224 8 0 ^
+primitive
+<
+94505046029264 1 0 
+plane\point\1, 0, 0/, -62.1/
+>
+primitive
+<
+94505046030064 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046029904 8 0 ^
+primitive
+<
+94505046029104 1 0 
+plane\point\0, 1, 0/, -159.1/
+>
+primitive
+<
+94505046029744 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505046029584 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505046031024 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046030864 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045644720 2 1073741824 &
+set
+(
+94505045643760 )
+set
+(
+94505045643920 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045643440 18 0 |
+set
+(
+94505045642640 3 0 &
+set
+(
+94505045642480 1 0 
+primitive
+<
+94505045990704 3 0 -
+primitive
+<
+94505045990544 8 0 +
+primitive
+<
+94505045990384 8 0 ^
+primitive
+<
+94505045972144 1 0 
+plane\point\0, -1, 0/, 160/
+>
+primitive
+<
+94505045990224 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045990064 8 0 ^
+primitive
+<
+94505045971344 1 0 
+plane\point\1, 0, -0/, -61.5/
+>
+primitive
+<
+94505045989904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045971184 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045642320 2 1073741824 &
+set
+(
+94505045641680 1 1073741824 
+primitive
+<
+94505045974384 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+1
+set
+(
+94505045640080 1 1073741824 
+primitive
+<
+94505045953424 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045642160 1 1073741824 
+primitive
+<
+94505045972304 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045641840 1 1073741824 
+primitive
+<
+94505045974224 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045643280 15 0 |
+set
+(
+94505045643120 3 0 &
+set
+(
+94505045642960 1 0 
+primitive
+<
+94505046011184 6 0 -
+primitive
+<
+94505046011024 8 0 +
+primitive
+<
+94505046010864 8 0 ^
+primitive
+<
+94505046008784 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505046010704 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046010544 8 0 ^
+primitive
+<
+94505046010064 8 0 -
+primitive
+<
+94505046009904 8 0 @
+primitive
+<
+94505046009744 8 0 +
+primitive
+<
+94505046009584 8 0 ^
+primitive
+<
+94505046008624 1 0 
+plane\point\1, -0, 0/, -62.4/
+>
+primitive
+<
+94505046009424 0 0 
+2
+>
+0
+>
+primitive
+<
+94505046009264 8 0 ^
+primitive
+<
+94505046008464 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505046009104 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505046008944 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505046010384 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505046010224 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045642800 2 1073741824 &
+set
+(
+94505045641840 )
+set
+(
+94505045642000 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045641520 12 0 |
+set
+(
+94505045640720 3 0 &
+set
+(
+94505045640560 1 0 
+primitive
+<
+94505045970064 3 0 -
+primitive
+<
+94505045969904 8 0 +
+primitive
+<
+94505045969744 8 0 ^
+primitive
+<
+94505045951504 1 0 
+plane\point\0, -0, 1/, -27/
+>
+primitive
+<
+94505045969584 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045969424 8 0 ^
+primitive
+<
+94505045950704 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505045969264 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045950544 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045640400 2 1073741824 &
+set
+(
+94505045638000 1 1073741824 
+primitive
+<
+94505045953744 1 0 
+plane\point\-1, -0, -0/, 60.9/
+>
+0
+1
+set
+(
+94505045638480 1 1073741824 
+primitive
+<
+94505045947824 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+0
+0
+)
+)
+set
+(
+94505045640240 1 1073741824 
+primitive
+<
+94505045951664 1 0 
+plane\point\1, -0, -0/, -60.6/
+>
+0
+1
+set
+(
+94505045639920 1 1073741824 
+primitive
+<
+94505045953584 1 0 
+plane\point\-1, 0, 0/, 60.6/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045641360 9 0 |
+set
+(
+94505045641200 3 0 &
+set
+(
+94505045641040 1 0 
+primitive
+<
+94505045989744 6 0 -
+primitive
+<
+94505045989584 8 0 +
+primitive
+<
+94505045989424 8 0 ^
+primitive
+<
+94505045987344 1 0 
+plane\point\-0, -1, -0/, 160/
+>
+primitive
+<
+94505045989264 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045989104 8 0 ^
+primitive
+<
+94505045988624 8 0 -
+primitive
+<
+94505045988464 8 0 @
+primitive
+<
+94505045988304 8 0 +
+primitive
+<
+94505045988144 8 0 ^
+primitive
+<
+94505045987184 1 0 
+plane\point\1, 0, 0/, -60.6/
+>
+primitive
+<
+94505045987984 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045987824 8 0 ^
+primitive
+<
+94505045987024 1 0 
+plane\point\0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045987664 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045987504 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045988944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045988784 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045640880 2 1073741824 &
+set
+(
+94505045639920 )
+set
+(
+94505045640080 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045639760 6 0 |
+set
+(
+94505045639600 3 0 &
+set
+(
+94505045639440 1 0 
+primitive
+<
+94505045969104 6 0 -
+primitive
+<
+94505045968944 8 0 +
+primitive
+<
+94505045968784 8 0 ^
+primitive
+<
+94505045966704 1 0 
+plane\point\0, -1, 0/, 160/
+>
+primitive
+<
+94505045968624 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045968464 8 0 ^
+primitive
+<
+94505045967984 8 0 -
+primitive
+<
+94505045967824 8 0 @
+primitive
+<
+94505045967664 8 0 +
+primitive
+<
+94505045967504 8 0 ^
+primitive
+<
+94505045966544 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+primitive
+<
+94505045967344 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045967184 8 0 ^
+primitive
+<
+94505045966384 1 0 
+plane\point\-0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045967024 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045966864 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045968304 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045968144 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045639280 2 1073741824 &
+set
+(
+94505045638320 1 1073741824 
+primitive
+<
+94505045947664 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+1
+set
+(
+94505045638640 1 1073741824 
+primitive
+<
+94505045947984 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045638480 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045639120 3 0 &
+set
+(
+94505045638960 1 0 
+primitive
+<
+94505045949424 3 0 -
+primitive
+<
+94505045949264 8 0 +
+primitive
+<
+94505045949104 8 0 ^
+primitive
+<
+94505045948144 1 0 
+plane\point\-0, 1, 0/, -160/
+>
+primitive
+<
+94505045948944 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045948784 8 0 ^
+primitive
+<
+94505045948304 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045948624 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045948464 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045638800 2 1073741824 &
+set
+(
+94505045638160 1 1073741824 
+primitive
+<
+94505045947504 1 0 
+plane\point\0, 0, -1/, 25/
+>
+0
+0
+)
+set
+(
+94505045638640 )
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505046197936 -32
+user_attribute
+\
+94505046197728 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505045637680 1297 0 |
+set
+(
+94505045637520 57 0 |
+set
+(
+94505045637360 3 0 &
+set
+(
+94505045637200 1 0 
+primitive
+<
+94505045947344 3 0 -
+primitive
+<
+94505045947184 8 0 +
+primitive
+<
+94505045947024 8 0 ^
+primitive
+<
+94505045930624 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045946864 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045927744 8 0 ^
+primitive
+<
+94505045928864 1 0 
+plane\point\-0, 1, 0/, -153/
+>
+primitive
+<
+94505045927904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045928704 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045637040 2 1073741824 &
+set
+(
+94505045636880 1 1073741824 
+primitive
+<
+94505045930784 1 0 
+plane\point\1, 0, 0/, -110/
+>
+0
+0
+)
+set
+(
+94505045636720 1 1073741824 
+primitive
+<
+94505045930944 1 0 
+plane\point\-1, -0, -0/, 82.9/
+>
+0
+1
+set
+(
+94505045635120 1 1073741824 
+primitive
+<
+94505045909984 1 0 
+plane\point\1, 0, 0/, -82.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045636560 54 0 |
+set
+(
+94505045635760 3 0 &
+set
+(
+94505045635600 1 0 
+primitive
+<
+94505045926624 3 0 -
+primitive
+<
+94505045926464 8 0 +
+primitive
+<
+94505045926304 8 0 ^
+primitive
+<
+94505045908064 1 0 
+plane\point\0, -1, 0/, 153/
+>
+primitive
+<
+94505045926144 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045925984 8 0 ^
+primitive
+<
+94505045907264 1 0 
+plane\point\1, 0, -0/, -82/
+>
+primitive
+<
+94505045925824 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045907104 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045635440 2 1073741824 &
+set
+(
+94505045634800 1 1073741824 
+primitive
+<
+94505045910304 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045633200 1 1073741824 
+primitive
+<
+94505045889344 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+set
+(
+94505045635280 1 1073741824 
+primitive
+<
+94505045908224 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045634960 1 1073741824 
+primitive
+<
+94505045910144 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045636400 51 0 |
+set
+(
+94505045636240 3 0 &
+set
+(
+94505045636080 1 0 
+primitive
+<
+94505045946704 6 0 -
+primitive
+<
+94505045946544 8 0 +
+primitive
+<
+94505045946384 8 0 ^
+primitive
+<
+94505045944304 1 0 
+plane\point\0, 1, 0/, -153/
+>
+primitive
+<
+94505045946224 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045946064 8 0 ^
+primitive
+<
+94505045945584 8 0 -
+primitive
+<
+94505045945424 8 0 @
+primitive
+<
+94505045945264 8 0 +
+primitive
+<
+94505045945104 8 0 ^
+primitive
+<
+94505045944144 1 0 
+plane\point\1, -0, 0/, -82.9/
+>
+primitive
+<
+94505045944944 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045944784 8 0 ^
+primitive
+<
+94505045943984 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505045944624 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045944464 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045945904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045945744 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045635920 2 1073741824 &
+set
+(
+94505045634960 )
+set
+(
+94505045635120 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045634640 48 0 |
+set
+(
+94505045633840 3 0 &
+set
+(
+94505045633680 1 0 
+primitive
+<
+94505045905984 3 0 -
+primitive
+<
+94505045905824 8 0 +
+primitive
+<
+94505045905664 8 0 ^
+primitive
+<
+94505045887424 1 0 
+plane\point\0, -0, 1/, -8/
+>
+primitive
+<
+94505045905504 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045905344 8 0 ^
+primitive
+<
+94505045886624 1 0 
+plane\point\0, 1, 0/, -153/
+>
+primitive
+<
+94505045905184 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045886464 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045633520 2 1073741824 &
+set
+(
+94505045632880 1 1073741824 
+primitive
+<
+94505045889664 1 0 
+plane\point\-1, -0, -0/, 70.9/
+>
+0
+1
+set
+(
+94505045631280 1 1073741824 
+primitive
+<
+94505045868704 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+0
+0
+)
+)
+set
+(
+94505045633360 1 1073741824 
+primitive
+<
+94505045887584 1 0 
+plane\point\1, -0, -0/, -81.1/
+>
+0
+1
+set
+(
+94505045633040 1 1073741824 
+primitive
+<
+94505045889504 1 0 
+plane\point\-1, 0, 0/, 81.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045634480 45 0 |
+set
+(
+94505045634320 3 0 &
+set
+(
+94505045634160 1 0 
+primitive
+<
+94505045925664 6 0 -
+primitive
+<
+94505045925504 8 0 +
+primitive
+<
+94505045925344 8 0 ^
+primitive
+<
+94505045923264 1 0 
+plane\point\-0, -1, -0/, 153/
+>
+primitive
+<
+94505045925184 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045925024 8 0 ^
+primitive
+<
+94505045924544 8 0 -
+primitive
+<
+94505045924384 8 0 @
+primitive
+<
+94505045924224 8 0 +
+primitive
+<
+94505045924064 8 0 ^
+primitive
+<
+94505045923104 1 0 
+plane\point\1, 0, 0/, -81.1/
+>
+primitive
+<
+94505045923904 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045923744 8 0 ^
+primitive
+<
+94505045922944 1 0 
+plane\point\0, 0, 1/, -7.1/
+>
+primitive
+<
+94505045923584 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045923424 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045924864 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045924704 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045634000 2 1073741824 &
+set
+(
+94505045633040 )
+set
+(
+94505045633200 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045632720 42 0 |
+set
+(
+94505045631920 3 0 &
+set
+(
+94505045631760 1 0 
+primitive
+<
+94505045885344 3 0 -
+primitive
+<
+94505045885184 8 0 +
+primitive
+<
+94505045885024 8 0 ^
+primitive
+<
+94505045866384 1 0 
+plane\point\-0, 1, 0/, -153/
+>
+primitive
+<
+94505045884864 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045884704 8 0 ^
+primitive
+<
+94505045865584 1 0 
+plane\point\1, 0, 0/, -70/
+>
+primitive
+<
+94505045884544 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045865424 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045631600 2 1073741824 &
+set
+(
+94505045630960 1 1073741824 
+primitive
+<
+94505045869024 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045629360 1 1073741824 
+primitive
+<
+94505045847664 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+set
+(
+94505045631440 1 1073741824 
+primitive
+<
+94505045866544 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045631120 1 1073741824 
+primitive
+<
+94505045868864 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045632560 39 0 |
+set
+(
+94505045632400 3 0 &
+set
+(
+94505045632240 1 0 
+primitive
+<
+94505045905024 6 0 -
+primitive
+<
+94505045904864 8 0 +
+primitive
+<
+94505045904704 8 0 ^
+primitive
+<
+94505045902624 1 0 
+plane\point\0, -1, 0/, 153/
+>
+primitive
+<
+94505045904544 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045904384 8 0 ^
+primitive
+<
+94505045903904 8 0 -
+primitive
+<
+94505045903744 8 0 @
+primitive
+<
+94505045903584 8 0 +
+primitive
+<
+94505045903424 8 0 ^
+primitive
+<
+94505045902464 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+primitive
+<
+94505045903264 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045903104 8 0 ^
+primitive
+<
+94505045902304 1 0 
+plane\point\-0, 0, 1/, -7.1/
+>
+primitive
+<
+94505045902944 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045902784 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045904224 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045904064 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045632080 2 1073741824 &
+set
+(
+94505045631120 )
+set
+(
+94505045631280 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045630800 36 0 |
+set
+(
+94505045630000 3 0 &
+set
+(
+94505045629840 1 0 
+primitive
+<
+94505045864304 3 0 -
+primitive
+<
+94505045864144 8 0 +
+primitive
+<
+94505045863984 8 0 ^
+primitive
+<
+94505045845744 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505045863824 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045863664 8 0 ^
+primitive
+<
+94505045844944 1 0 
+plane\point\0, 1, 0/, -153/
+>
+primitive
+<
+94505045863504 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045844784 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045629680 2 1073741824 &
+set
+(
+94505045629040 1 1073741824 
+primitive
+<
+94505045847984 1 0 
+plane\point\-1, -0, -0/, 64.9/
+>
+0
+1
+set
+(
+94505045627440 1 1073741824 
+primitive
+<
+94505045827024 1 0 
+plane\point\1, 0, 0/, -64.9/
+>
+0
+0
+)
+)
+set
+(
+94505045629520 1 1073741824 
+primitive
+<
+94505045845904 1 0 
+plane\point\1, -0, -0/, -69.1/
+>
+0
+1
+set
+(
+94505045629200 1 1073741824 
+primitive
+<
+94505045847824 1 0 
+plane\point\-1, 0, 0/, 69.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045630640 33 0 |
+set
+(
+94505045630480 3 0 &
+set
+(
+94505045630320 1 0 
+primitive
+<
+94505045884384 6 0 -
+primitive
+<
+94505045884224 8 0 +
+primitive
+<
+94505045884064 8 0 ^
+primitive
+<
+94505045881984 1 0 
+plane\point\0, 1, -0/, -153/
+>
+primitive
+<
+94505045883904 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045883744 8 0 ^
+primitive
+<
+94505045883264 8 0 -
+primitive
+<
+94505045883104 8 0 @
+primitive
+<
+94505045882944 8 0 +
+primitive
+<
+94505045882784 8 0 ^
+primitive
+<
+94505045881824 1 0 
+plane\point\1, 0, 0/, -69.1/
+>
+primitive
+<
+94505045882624 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045882464 8 0 ^
+primitive
+<
+94505045881664 1 0 
+plane\point\0, -0, -1/, 1.9/
+>
+primitive
+<
+94505045882304 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045882144 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045883584 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045883424 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045630160 2 1073741824 &
+set
+(
+94505045629200 )
+set
+(
+94505045629360 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045628880 30 0 |
+set
+(
+94505045628080 3 0 &
+set
+(
+94505045627920 1 0 
+primitive
+<
+94505045843664 3 0 -
+primitive
+<
+94505045843504 8 0 +
+primitive
+<
+94505045843344 8 0 ^
+primitive
+<
+94505045825104 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045843184 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045843024 8 0 ^
+primitive
+<
+94505045824304 1 0 
+plane\point\1, 0, 0/, -64/
+>
+primitive
+<
+94505045842864 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045824144 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045627760 2 1073741824 &
+set
+(
+94505045627120 1 1073741824 
+primitive
+<
+94505045827344 1 0 
+plane\point\-0, -1, -0/, 145.9/
+>
+0
+1
+set
+(
+94505045625520 1 1073741824 
+primitive
+<
+94505045806384 1 0 
+plane\point\0, 1, 0/, -145.9/
+>
+0
+0
+)
+)
+set
+(
+94505045627600 1 1073741824 
+primitive
+<
+94505045825264 1 0 
+plane\point\-0, 1, -0/, -152.1/
+>
+0
+1
+set
+(
+94505045627280 1 1073741824 
+primitive
+<
+94505045827184 1 0 
+plane\point\0, -1, 0/, 152.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045628720 27 0 |
+set
+(
+94505045628560 3 0 &
+set
+(
+94505045628400 1 0 
+primitive
+<
+94505045863344 6 0 -
+primitive
+<
+94505045863184 8 0 +
+primitive
+<
+94505045863024 8 0 ^
+primitive
+<
+94505045860944 1 0 
+plane\point\-0, 0, 1/, -1/
+>
+primitive
+<
+94505045862864 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045862704 8 0 ^
+primitive
+<
+94505045862224 8 0 -
+primitive
+<
+94505045862064 8 0 @
+primitive
+<
+94505045861904 8 0 +
+primitive
+<
+94505045861744 8 0 ^
+primitive
+<
+94505045860784 1 0 
+plane\point\1, 0, 0/, -64.9/
+>
+primitive
+<
+94505045861584 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045861424 8 0 ^
+primitive
+<
+94505045860624 1 0 
+plane\point\0, 1, -0/, -152.1/
+>
+primitive
+<
+94505045861264 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045861104 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045862544 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045862384 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045628240 2 1073741824 &
+set
+(
+94505045627280 )
+set
+(
+94505045627440 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045626960 24 0 |
+set
+(
+94505045626160 3 0 &
+set
+(
+94505045626000 1 0 
+primitive
+<
+94505045823024 3 0 -
+primitive
+<
+94505045822864 8 0 +
+primitive
+<
+94505045822704 8 0 ^
+primitive
+<
+94505045804464 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505045822544 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045822384 8 0 ^
+primitive
+<
+94505045803664 1 0 
+plane\point\0, 1, 0/, -145/
+>
+primitive
+<
+94505045822224 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045803504 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045625840 2 1073741824 &
+set
+(
+94505045625200 1 1073741824 
+primitive
+<
+94505045806704 1 0 
+plane\point\-1, -0, -0/, 62.4/
+>
+0
+1
+set
+(
+94505045623600 1 1073741824 
+primitive
+<
+94505045784816 1 0 
+plane\point\1, 0, 0/, -62.4/
+>
+0
+0
+)
+)
+set
+(
+94505045625680 1 1073741824 
+primitive
+<
+94505045804624 1 0 
+plane\point\1, -0, -0/, -63.1/
+>
+0
+1
+set
+(
+94505045625360 1 1073741824 
+primitive
+<
+94505045806544 1 0 
+plane\point\-1, 0, 0/, 63.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045626800 21 0 |
+set
+(
+94505045626640 3 0 &
+set
+(
+94505045626480 1 0 
+primitive
+<
+94505045842704 6 0 -
+primitive
+<
+94505045842544 8 0 +
+primitive
+<
+94505045842384 8 0 ^
+primitive
+<
+94505045840304 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045842224 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045842064 8 0 ^
+primitive
+<
+94505045841584 8 0 -
+primitive
+<
+94505045841424 8 0 @
+primitive
+<
+94505045841264 8 0 +
+primitive
+<
+94505045841104 8 0 ^
+primitive
+<
+94505045840144 1 0 
+plane\point\1, 0, 0/, -63.1/
+>
+primitive
+<
+94505045840944 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045840784 8 0 ^
+primitive
+<
+94505045839984 1 0 
+plane\point\0, -1, 0/, 145.9/
+>
+primitive
+<
+94505045840624 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045840464 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045841904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045841744 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045626320 2 1073741824 &
+set
+(
+94505045625360 )
+set
+(
+94505045625520 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045625040 18 0 |
+set
+(
+94505045624240 3 0 &
+set
+(
+94505045624080 1 0 
+primitive
+<
+94505045801456 3 0 -
+primitive
+<
+94505045801296 8 0 +
+primitive
+<
+94505045801136 8 0 ^
+primitive
+<
+94505045782896 1 0 
+plane\point\0, -1, 0/, 145/
+>
+primitive
+<
+94505045800976 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045800816 8 0 ^
+primitive
+<
+94505045782096 1 0 
+plane\point\1, 0, -0/, -61.5/
+>
+primitive
+<
+94505045800656 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045781936 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045623920 2 1073741824 &
+set
+(
+94505045623280 1 1073741824 
+primitive
+<
+94505045785136 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+1
+set
+(
+94505045621680 1 1073741824 
+primitive
+<
+94505045764176 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045623760 1 1073741824 
+primitive
+<
+94505045783056 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045623440 1 1073741824 
+primitive
+<
+94505045784976 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045624880 15 0 |
+set
+(
+94505045624720 3 0 &
+set
+(
+94505045624560 1 0 
+primitive
+<
+94505045822064 6 0 -
+primitive
+<
+94505045821904 8 0 +
+primitive
+<
+94505045821744 8 0 ^
+primitive
+<
+94505045819664 1 0 
+plane\point\0, 1, 0/, -145/
+>
+primitive
+<
+94505045821584 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045821424 8 0 ^
+primitive
+<
+94505045820944 8 0 -
+primitive
+<
+94505045820784 8 0 @
+primitive
+<
+94505045820624 8 0 +
+primitive
+<
+94505045820464 8 0 ^
+primitive
+<
+94505045819504 1 0 
+plane\point\1, -0, 0/, -62.4/
+>
+primitive
+<
+94505045820304 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045820144 8 0 ^
+primitive
+<
+94505045819344 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505045819984 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045819824 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045821264 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045821104 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045624400 2 1073741824 &
+set
+(
+94505045623440 )
+set
+(
+94505045623600 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045623120 12 0 |
+set
+(
+94505045622320 3 0 &
+set
+(
+94505045622160 1 0 
+primitive
+<
+94505045780816 3 0 -
+primitive
+<
+94505045780656 8 0 +
+primitive
+<
+94505045780496 8 0 ^
+primitive
+<
+94505045762256 1 0 
+plane\point\0, -0, 1/, -27/
+>
+primitive
+<
+94505045780336 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045780176 8 0 ^
+primitive
+<
+94505045761456 1 0 
+plane\point\0, 1, 0/, -145/
+>
+primitive
+<
+94505045780016 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045761296 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045622000 2 1073741824 &
+set
+(
+94505045619600 1 1073741824 
+primitive
+<
+94505045764496 1 0 
+plane\point\-1, -0, -0/, 60.9/
+>
+0
+1
+set
+(
+94505045620080 1 1073741824 
+primitive
+<
+94505045758576 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+0
+0
+)
+)
+set
+(
+94505045621840 1 1073741824 
+primitive
+<
+94505045762416 1 0 
+plane\point\1, -0, -0/, -60.6/
+>
+0
+1
+set
+(
+94505045621520 1 1073741824 
+primitive
+<
+94505045764336 1 0 
+plane\point\-1, 0, 0/, 60.6/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045622960 9 0 |
+set
+(
+94505045622800 3 0 &
+set
+(
+94505045622640 1 0 
+primitive
+<
+94505045800496 6 0 -
+primitive
+<
+94505045800336 8 0 +
+primitive
+<
+94505045800176 8 0 ^
+primitive
+<
+94505045798096 1 0 
+plane\point\-0, -1, -0/, 145/
+>
+primitive
+<
+94505045800016 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045799856 8 0 ^
+primitive
+<
+94505045799376 8 0 -
+primitive
+<
+94505045799216 8 0 @
+primitive
+<
+94505045799056 8 0 +
+primitive
+<
+94505045798896 8 0 ^
+primitive
+<
+94505045797936 1 0 
+plane\point\1, 0, 0/, -60.6/
+>
+primitive
+<
+94505045798736 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045798576 8 0 ^
+primitive
+<
+94505045797776 1 0 
+plane\point\0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045798416 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045798256 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045799696 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045799536 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045622480 2 1073741824 &
+set
+(
+94505045621520 )
+set
+(
+94505045621680 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045621360 6 0 |
+set
+(
+94505045621200 3 0 &
+set
+(
+94505045621040 1 0 
+primitive
+<
+94505045779856 6 0 -
+primitive
+<
+94505045779696 8 0 +
+primitive
+<
+94505045779536 8 0 ^
+primitive
+<
+94505045777456 1 0 
+plane\point\0, -1, 0/, 145/
+>
+primitive
+<
+94505045779376 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045779216 8 0 ^
+primitive
+<
+94505045778736 8 0 -
+primitive
+<
+94505045778576 8 0 @
+primitive
+<
+94505045778416 8 0 +
+primitive
+<
+94505045778256 8 0 ^
+primitive
+<
+94505045777296 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+primitive
+<
+94505045778096 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045777936 8 0 ^
+primitive
+<
+94505045777136 1 0 
+plane\point\-0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045777776 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045777616 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045779056 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045778896 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045620880 2 1073741824 &
+set
+(
+94505045619920 1 1073741824 
+primitive
+<
+94505045758416 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+1
+set
+(
+94505045620240 1 1073741824 
+primitive
+<
+94505045758736 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045620080 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045620720 3 0 &
+set
+(
+94505045620560 1 0 
+primitive
+<
+94505045760176 3 0 -
+primitive
+<
+94505045760016 8 0 +
+primitive
+<
+94505045759856 8 0 ^
+primitive
+<
+94505045758896 1 0 
+plane\point\-0, 1, 0/, -145/
+>
+primitive
+<
+94505045759696 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045759536 8 0 ^
+primitive
+<
+94505045759056 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045759376 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045759216 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045620400 2 1073741824 &
+set
+(
+94505045619760 1 1073741824 
+primitive
+<
+94505045758256 1 0 
+plane\point\0, 0, -1/, 25/
+>
+0
+0
+)
+set
+(
+94505045620240 )
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505046000016 -32
+user_attribute
+\
+94505045999808 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505045619280 1240 0 |
+set
+(
+94505045619120 57 0 |
+set
+(
+94505045618960 3 0 &
+set
+(
+94505045618800 1 0 
+primitive
+<
+94505045758096 3 0 -
+primitive
+<
+94505045757936 8 0 +
+primitive
+<
+94505045757776 8 0 ^
+primitive
+<
+94505045741776 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045757616 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045738896 8 0 ^
+primitive
+<
+94505045740016 1 0 
+plane\point\-0, 1, 0/, -152/
+>
+primitive
+<
+94505045739056 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045739856 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045618640 2 1073741824 &
+set
+(
+94505045618480 1 1073741824 
+primitive
+<
+94505045741936 1 0 
+plane\point\1, 0, 0/, -110/
+>
+0
+0
+)
+set
+(
+94505045618320 1 1073741824 
+primitive
+<
+94505045742096 1 0 
+plane\point\-1, -0, -0/, 82.9/
+>
+0
+1
+set
+(
+94505045616720 1 1073741824 
+primitive
+<
+94505045720736 1 0 
+plane\point\1, 0, 0/, -82.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045618160 54 0 |
+set
+(
+94505045617360 3 0 &
+set
+(
+94505045617200 1 0 
+primitive
+<
+94505045737776 3 0 -
+primitive
+<
+94505045737616 8 0 +
+primitive
+<
+94505045737456 8 0 ^
+primitive
+<
+94505045718816 1 0 
+plane\point\0, -1, 0/, 152/
+>
+primitive
+<
+94505045737296 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045737136 8 0 ^
+primitive
+<
+94505045718016 1 0 
+plane\point\1, 0, -0/, -82/
+>
+primitive
+<
+94505045736976 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045717856 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045617040 2 1073741824 &
+set
+(
+94505045616400 1 1073741824 
+primitive
+<
+94505045721056 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045614800 1 1073741824 
+primitive
+<
+94505045700096 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+set
+(
+94505045616880 1 1073741824 
+primitive
+<
+94505045718976 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045616560 1 1073741824 
+primitive
+<
+94505045720896 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045618000 51 0 |
+set
+(
+94505045617840 3 0 &
+set
+(
+94505045617680 1 0 
+primitive
+<
+94505045757456 6 0 -
+primitive
+<
+94505045757296 8 0 +
+primitive
+<
+94505045757136 8 0 ^
+primitive
+<
+94505045755056 1 0 
+plane\point\0, 1, 0/, -152/
+>
+primitive
+<
+94505045756976 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045756816 8 0 ^
+primitive
+<
+94505045756336 8 0 -
+primitive
+<
+94505045756176 8 0 @
+primitive
+<
+94505045756016 8 0 +
+primitive
+<
+94505045755856 8 0 ^
+primitive
+<
+94505045754896 1 0 
+plane\point\1, -0, 0/, -82.9/
+>
+primitive
+<
+94505045755696 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045755536 8 0 ^
+primitive
+<
+94505045754736 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505045755376 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045755216 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045756656 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045756496 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045617520 2 1073741824 &
+set
+(
+94505045616560 )
+set
+(
+94505045616720 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045616240 48 0 |
+set
+(
+94505045615440 3 0 &
+set
+(
+94505045615280 1 0 
+primitive
+<
+94505045716736 3 0 -
+primitive
+<
+94505045716576 8 0 +
+primitive
+<
+94505045716416 8 0 ^
+primitive
+<
+94505045698176 1 0 
+plane\point\0, -0, 1/, -8/
+>
+primitive
+<
+94505045716256 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045716096 8 0 ^
+primitive
+<
+94505045697376 1 0 
+plane\point\0, 1, 0/, -152/
+>
+primitive
+<
+94505045715936 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045697216 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045615120 2 1073741824 &
+set
+(
+94505045614480 1 1073741824 
+primitive
+<
+94505045700416 1 0 
+plane\point\-1, -0, -0/, 70.9/
+>
+0
+1
+set
+(
+94505045612880 1 1073741824 
+primitive
+<
+94505045679456 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+0
+0
+)
+)
+set
+(
+94505045614960 1 1073741824 
+primitive
+<
+94505045698336 1 0 
+plane\point\1, -0, -0/, -81.1/
+>
+0
+1
+set
+(
+94505045614640 1 1073741824 
+primitive
+<
+94505045700256 1 0 
+plane\point\-1, 0, 0/, 81.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045616080 45 0 |
+set
+(
+94505045615920 3 0 &
+set
+(
+94505045615760 1 0 
+primitive
+<
+94505045736816 6 0 -
+primitive
+<
+94505045736656 8 0 +
+primitive
+<
+94505045736496 8 0 ^
+primitive
+<
+94505045734016 1 0 
+plane\point\-0, -1, -0/, 152/
+>
+primitive
+<
+94505045736336 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045736176 8 0 ^
+primitive
+<
+94505045735296 8 0 -
+primitive
+<
+94505045735136 8 0 @
+primitive
+<
+94505045734976 8 0 +
+primitive
+<
+94505045734816 8 0 ^
+primitive
+<
+94505045733856 1 0 
+plane\point\1, 0, 0/, -81.1/
+>
+primitive
+<
+94505045734656 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045734496 8 0 ^
+primitive
+<
+94505045733696 1 0 
+plane\point\0, 0, 1/, -7.1/
+>
+primitive
+<
+94505045734336 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045734176 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045735616 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045735456 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045615600 2 1073741824 &
+set
+(
+94505045614640 )
+set
+(
+94505045614800 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045614320 42 0 |
+set
+(
+94505045613520 3 0 &
+set
+(
+94505045613360 1 0 
+primitive
+<
+94505045696096 3 0 -
+primitive
+<
+94505045695936 8 0 +
+primitive
+<
+94505045695776 8 0 ^
+primitive
+<
+94505045677536 1 0 
+plane\point\-0, 1, 0/, -152/
+>
+primitive
+<
+94505045695616 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045695456 8 0 ^
+primitive
+<
+94505045676736 1 0 
+plane\point\1, 0, 0/, -70/
+>
+primitive
+<
+94505045695296 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045676576 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045613200 2 1073741824 &
+set
+(
+94505045612560 1 1073741824 
+primitive
+<
+94505045679776 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045610960 1 1073741824 
+primitive
+<
+94505045592960 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+set
+(
+94505045613040 1 1073741824 
+primitive
+<
+94505045677696 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045612720 1 1073741824 
+primitive
+<
+94505045679616 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045614160 39 0 |
+set
+(
+94505045614000 3 0 &
+set
+(
+94505045613840 1 0 
+primitive
+<
+94505045715776 6 0 -
+primitive
+<
+94505045715616 8 0 +
+primitive
+<
+94505045715456 8 0 ^
+primitive
+<
+94505045713376 1 0 
+plane\point\0, -1, 0/, 152/
+>
+primitive
+<
+94505045715296 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045715136 8 0 ^
+primitive
+<
+94505045714656 8 0 -
+primitive
+<
+94505045714496 8 0 @
+primitive
+<
+94505045714336 8 0 +
+primitive
+<
+94505045714176 8 0 ^
+primitive
+<
+94505045713216 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+primitive
+<
+94505045714016 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045713856 8 0 ^
+primitive
+<
+94505045713056 1 0 
+plane\point\-0, 0, 1/, -7.1/
+>
+primitive
+<
+94505045713696 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045713536 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045714976 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045714816 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045613680 2 1073741824 &
+set
+(
+94505045612720 )
+set
+(
+94505045612880 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045612400 36 0 |
+set
+(
+94505045611600 3 0 &
+set
+(
+94505045611440 1 0 
+primitive
+<
+94505045675456 3 0 -
+primitive
+<
+94505045675296 8 0 +
+primitive
+<
+94505045675136 8 0 ^
+primitive
+<
+94505045591040 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505045674976 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045674816 8 0 ^
+primitive
+<
+94505045590240 1 0 
+plane\point\0, 1, 0/, -152/
+>
+primitive
+<
+94505045674656 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045590080 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045611280 2 1073741824 &
+set
+(
+94505045610640 1 1073741824 
+primitive
+<
+94505045593280 1 0 
+plane\point\-1, -0, -0/, 65.9/
+>
+0
+1
+set
+(
+94505045609040 1 1073741824 
+primitive
+<
+94505045572320 1 0 
+plane\point\1, 0, 0/, -65.9/
+>
+0
+0
+)
+)
+set
+(
+94505045611120 1 1073741824 
+primitive
+<
+94505045591200 1 0 
+plane\point\1, -0, -0/, -69.1/
+>
+0
+1
+set
+(
+94505045610800 1 1073741824 
+primitive
+<
+94505045593120 1 0 
+plane\point\-1, 0, 0/, 69.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045612240 33 0 |
+set
+(
+94505045612080 3 0 &
+set
+(
+94505045611920 1 0 
+primitive
+<
+94505045695136 6 0 -
+primitive
+<
+94505045694976 8 0 +
+primitive
+<
+94505045694816 8 0 ^
+primitive
+<
+94505045692736 1 0 
+plane\point\0, 1, -0/, -152/
+>
+primitive
+<
+94505045694656 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045694496 8 0 ^
+primitive
+<
+94505045694016 8 0 -
+primitive
+<
+94505045693856 8 0 @
+primitive
+<
+94505045693696 8 0 +
+primitive
+<
+94505045693536 8 0 ^
+primitive
+<
+94505045692576 1 0 
+plane\point\1, 0, 0/, -69.1/
+>
+primitive
+<
+94505045693376 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045693216 8 0 ^
+primitive
+<
+94505045692416 1 0 
+plane\point\0, -0, -1/, 1.9/
+>
+primitive
+<
+94505045693056 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045692896 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045694336 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045694176 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045611760 2 1073741824 &
+set
+(
+94505045610800 )
+set
+(
+94505045610960 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045610480 30 0 |
+set
+(
+94505045609680 3 0 &
+set
+(
+94505045609520 1 0 
+primitive
+<
+94505045588960 3 0 -
+primitive
+<
+94505045588800 8 0 +
+primitive
+<
+94505045588640 8 0 ^
+primitive
+<
+94505045570400 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045588480 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045588320 8 0 ^
+primitive
+<
+94505045569600 1 0 
+plane\point\1, 0, 0/, -65/
+>
+primitive
+<
+94505045588160 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045569440 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045609360 2 1073741824 &
+set
+(
+94505045608720 1 1073741824 
+primitive
+<
+94505045572640 1 0 
+plane\point\-0, -1, -0/, 130.9/
+>
+0
+1
+set
+(
+94505045607120 1 1073741824 
+primitive
+<
+94505045551680 1 0 
+plane\point\0, 1, 0/, -130.9/
+>
+0
+0
+)
+)
+set
+(
+94505045609200 1 1073741824 
+primitive
+<
+94505045570560 1 0 
+plane\point\-0, 1, -0/, -151.1/
+>
+0
+1
+set
+(
+94505045608880 1 1073741824 
+primitive
+<
+94505045572480 1 0 
+plane\point\0, -1, 0/, 151.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045610320 27 0 |
+set
+(
+94505045610160 3 0 &
+set
+(
+94505045610000 1 0 
+primitive
+<
+94505045674496 6 0 -
+primitive
+<
+94505045674336 8 0 +
+primitive
+<
+94505045674176 8 0 ^
+primitive
+<
+94505045672096 1 0 
+plane\point\-0, 0, 1/, -1/
+>
+primitive
+<
+94505045674016 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045673856 8 0 ^
+primitive
+<
+94505045673376 8 0 -
+primitive
+<
+94505045673216 8 0 @
+primitive
+<
+94505045673056 8 0 +
+primitive
+<
+94505045672896 8 0 ^
+primitive
+<
+94505045671936 1 0 
+plane\point\1, 0, 0/, -65.9/
+>
+primitive
+<
+94505045672736 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045672576 8 0 ^
+primitive
+<
+94505045671776 1 0 
+plane\point\0, 1, -0/, -151.1/
+>
+primitive
+<
+94505045672416 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045672256 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045673696 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045673536 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045609840 2 1073741824 &
+set
+(
+94505045608880 )
+set
+(
+94505045609040 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045608560 24 0 |
+set
+(
+94505045607760 3 0 &
+set
+(
+94505045607600 1 0 
+primitive
+<
+94505045568320 3 0 -
+primitive
+<
+94505045568160 8 0 +
+primitive
+<
+94505045568000 8 0 ^
+primitive
+<
+94505045549760 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505045567840 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045567680 8 0 ^
+primitive
+<
+94505045548960 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505045567520 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045548800 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045607440 2 1073741824 &
+set
+(
+94505045606800 1 1073741824 
+primitive
+<
+94505045552000 1 0 
+plane\point\-1, -0, -0/, 62.4/
+>
+0
+1
+set
+(
+94505045605200 1 1073741824 
+primitive
+<
+94505045530240 1 0 
+plane\point\1, 0, 0/, -62.4/
+>
+0
+0
+)
+)
+set
+(
+94505045607280 1 1073741824 
+primitive
+<
+94505045549920 1 0 
+plane\point\1, -0, -0/, -64.1/
+>
+0
+1
+set
+(
+94505045606960 1 1073741824 
+primitive
+<
+94505045551840 1 0 
+plane\point\-1, 0, 0/, 64.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045608400 21 0 |
+set
+(
+94505045608240 3 0 &
+set
+(
+94505045608080 1 0 
+primitive
+<
+94505045588000 6 0 -
+primitive
+<
+94505045587840 8 0 +
+primitive
+<
+94505045587680 8 0 ^
+primitive
+<
+94505045585600 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045587520 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045587360 8 0 ^
+primitive
+<
+94505045586880 8 0 -
+primitive
+<
+94505045586720 8 0 @
+primitive
+<
+94505045586560 8 0 +
+primitive
+<
+94505045586400 8 0 ^
+primitive
+<
+94505045585440 1 0 
+plane\point\1, 0, 0/, -64.1/
+>
+primitive
+<
+94505045586240 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045586080 8 0 ^
+primitive
+<
+94505045585280 1 0 
+plane\point\0, -1, 0/, 130.9/
+>
+primitive
+<
+94505045585920 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045585760 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045587200 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045587040 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045607920 2 1073741824 &
+set
+(
+94505045606960 )
+set
+(
+94505045607120 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045606640 18 0 |
+set
+(
+94505045605840 3 0 &
+set
+(
+94505045605680 1 0 
+primitive
+<
+94505045547680 3 0 -
+primitive
+<
+94505045547520 8 0 +
+primitive
+<
+94505045547360 8 0 ^
+primitive
+<
+94505045528320 1 0 
+plane\point\0, -1, 0/, 130/
+>
+primitive
+<
+94505045547200 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045547040 8 0 ^
+primitive
+<
+94505045527520 1 0 
+plane\point\1, 0, -0/, -61.5/
+>
+primitive
+<
+94505045546880 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045527360 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045605520 2 1073741824 &
+set
+(
+94505045604880 1 1073741824 
+primitive
+<
+94505045530560 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+1
+set
+(
+94505045139120 1 1073741824 
+primitive
+<
+94505045509600 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045605360 1 1073741824 
+primitive
+<
+94505045528480 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045605040 1 1073741824 
+primitive
+<
+94505045530400 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045606480 15 0 |
+set
+(
+94505045606320 3 0 &
+set
+(
+94505045606160 1 0 
+primitive
+<
+94505045567360 6 0 -
+primitive
+<
+94505045567200 8 0 +
+primitive
+<
+94505045567040 8 0 ^
+primitive
+<
+94505045564960 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505045566880 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045566720 8 0 ^
+primitive
+<
+94505045566240 8 0 -
+primitive
+<
+94505045566080 8 0 @
+primitive
+<
+94505045565920 8 0 +
+primitive
+<
+94505045565760 8 0 ^
+primitive
+<
+94505045564800 1 0 
+plane\point\1, -0, 0/, -62.4/
+>
+primitive
+<
+94505045565600 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045565440 8 0 ^
+primitive
+<
+94505045564640 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505045565280 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045565120 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045566560 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045566400 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045606000 2 1073741824 &
+set
+(
+94505045605040 )
+set
+(
+94505045605200 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045604720 12 0 |
+set
+(
+94505045139760 3 0 &
+set
+(
+94505045139600 1 0 
+primitive
+<
+94505045526240 3 0 -
+primitive
+<
+94505045526080 8 0 +
+primitive
+<
+94505045525920 8 0 ^
+primitive
+<
+94505045507680 1 0 
+plane\point\0, -0, 1/, -27/
+>
+primitive
+<
+94505045525760 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045525600 8 0 ^
+primitive
+<
+94505045506880 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505045525440 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045506720 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045139440 2 1073741824 &
+set
+(
+94505045137040 1 1073741824 
+primitive
+<
+94505045509920 1 0 
+plane\point\-1, -0, -0/, 60.9/
+>
+0
+1
+set
+(
+94505045137520 1 1073741824 
+primitive
+<
+94505045504000 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+0
+0
+)
+)
+set
+(
+94505045139280 1 1073741824 
+primitive
+<
+94505045507840 1 0 
+plane\point\1, -0, -0/, -60.6/
+>
+0
+1
+set
+(
+94505045138960 1 1073741824 
+primitive
+<
+94505045509760 1 0 
+plane\point\-1, 0, 0/, 60.6/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045604560 9 0 |
+set
+(
+94505045140240 3 0 &
+set
+(
+94505045140080 1 0 
+primitive
+<
+94505045546720 6 0 -
+primitive
+<
+94505045546560 8 0 +
+primitive
+<
+94505045546400 8 0 ^
+primitive
+<
+94505045544320 1 0 
+plane\point\-0, -1, -0/, 130/
+>
+primitive
+<
+94505045546240 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045546080 8 0 ^
+primitive
+<
+94505045545600 8 0 -
+primitive
+<
+94505045545440 8 0 @
+primitive
+<
+94505045545280 8 0 +
+primitive
+<
+94505045545120 8 0 ^
+primitive
+<
+94505045544160 1 0 
+plane\point\1, 0, 0/, -60.6/
+>
+primitive
+<
+94505045544960 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045544800 8 0 ^
+primitive
+<
+94505045544000 1 0 
+plane\point\0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045544640 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045544480 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045545920 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045545760 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045139920 2 1073741824 &
+set
+(
+94505045138960 )
+set
+(
+94505045139120 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045138800 6 0 |
+set
+(
+94505045138640 3 0 &
+set
+(
+94505045138480 1 0 
+primitive
+<
+94505045525280 6 0 -
+primitive
+<
+94505045525120 8 0 +
+primitive
+<
+94505045524960 8 0 ^
+primitive
+<
+94505045522880 1 0 
+plane\point\0, -1, 0/, 130/
+>
+primitive
+<
+94505045524800 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045524640 8 0 ^
+primitive
+<
+94505045524160 8 0 -
+primitive
+<
+94505045524000 8 0 @
+primitive
+<
+94505045523840 8 0 +
+primitive
+<
+94505045523680 8 0 ^
+primitive
+<
+94505045522720 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+primitive
+<
+94505045523520 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045523360 8 0 ^
+primitive
+<
+94505045522560 1 0 
+plane\point\-0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045523200 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045523040 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045524480 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045524320 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045138320 2 1073741824 &
+set
+(
+94505045137360 1 1073741824 
+primitive
+<
+94505045503840 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+1
+set
+(
+94505045137680 1 1073741824 
+primitive
+<
+94505045504160 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045137520 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045138160 3 0 &
+set
+(
+94505045138000 1 0 
+primitive
+<
+94505045505600 3 0 -
+primitive
+<
+94505045505440 8 0 +
+primitive
+<
+94505045505280 8 0 ^
+primitive
+<
+94505045504320 1 0 
+plane\point\-0, 1, 0/, -130/
+>
+primitive
+<
+94505045505120 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045504960 8 0 ^
+primitive
+<
+94505045504480 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045504800 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045504640 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045137840 2 1073741824 &
+set
+(
+94505045137200 1 1073741824 
+primitive
+<
+94505045503680 1 0 
+plane\point\0, 0, -1/, 25/
+>
+0
+0
+)
+set
+(
+94505045137680 )
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045802096 -32
+user_attribute
+\
+94505045801888 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505045136720 1183 0 |
+set
+(
+94505045136560 57 0 |
+set
+(
+94505045136400 3 0 &
+set
+(
+94505045136240 1 0 
+primitive
+<
+94505045503520 3 0 -
+primitive
+<
+94505045503360 8 0 +
+primitive
+<
+94505045503200 8 0 ^
+primitive
+<
+94505045487200 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045503040 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045484320 8 0 ^
+primitive
+<
+94505045485440 1 0 
+plane\point\-0, 1, 0/, -151/
+>
+primitive
+<
+94505045484480 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045485280 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045136080 2 1073741824 &
+set
+(
+94505045135920 1 1073741824 
+primitive
+<
+94505045487360 1 0 
+plane\point\1, 0, 0/, -110/
+>
+0
+0
+)
+set
+(
+94505045135760 1 1073741824 
+primitive
+<
+94505045487520 1 0 
+plane\point\-1, -0, -0/, 82.9/
+>
+0
+1
+set
+(
+94505045134160 1 1073741824 
+primitive
+<
+94505045466160 1 0 
+plane\point\1, 0, 0/, -82.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045135600 54 0 |
+set
+(
+94505045134800 3 0 &
+set
+(
+94505045134640 1 0 
+primitive
+<
+94505045483200 3 0 -
+primitive
+<
+94505045483040 8 0 +
+primitive
+<
+94505045482880 8 0 ^
+primitive
+<
+94505045464240 1 0 
+plane\point\0, -1, 0/, 151/
+>
+primitive
+<
+94505045482720 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045482560 8 0 ^
+primitive
+<
+94505045463440 1 0 
+plane\point\1, 0, -0/, -82/
+>
+primitive
+<
+94505045482400 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045463280 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045134480 2 1073741824 &
+set
+(
+94505045133840 1 1073741824 
+primitive
+<
+94505045466480 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045132240 1 1073741824 
+primitive
+<
+94505045445520 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+set
+(
+94505045134320 1 1073741824 
+primitive
+<
+94505045464400 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045134000 1 1073741824 
+primitive
+<
+94505045466320 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045135440 51 0 |
+set
+(
+94505045135280 3 0 &
+set
+(
+94505045135120 1 0 
+primitive
+<
+94505045502880 6 0 -
+primitive
+<
+94505045502720 8 0 +
+primitive
+<
+94505045502560 8 0 ^
+primitive
+<
+94505045500480 1 0 
+plane\point\0, 1, 0/, -151/
+>
+primitive
+<
+94505045502400 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045502240 8 0 ^
+primitive
+<
+94505045501760 8 0 -
+primitive
+<
+94505045501600 8 0 @
+primitive
+<
+94505045501440 8 0 +
+primitive
+<
+94505045501280 8 0 ^
+primitive
+<
+94505045500320 1 0 
+plane\point\1, -0, 0/, -82.9/
+>
+primitive
+<
+94505045501120 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045500960 8 0 ^
+primitive
+<
+94505045500160 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505045500800 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045500640 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045502080 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045501920 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045134960 2 1073741824 &
+set
+(
+94505045134000 )
+set
+(
+94505045134160 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045133680 48 0 |
+set
+(
+94505045132880 3 0 &
+set
+(
+94505045132720 1 0 
+primitive
+<
+94505045462160 3 0 -
+primitive
+<
+94505045462000 8 0 +
+primitive
+<
+94505045461840 8 0 ^
+primitive
+<
+94505045443600 1 0 
+plane\point\0, -0, 1/, -8/
+>
+primitive
+<
+94505045461680 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045461520 8 0 ^
+primitive
+<
+94505045442800 1 0 
+plane\point\0, 1, 0/, -151/
+>
+primitive
+<
+94505045461360 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045442640 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045132560 2 1073741824 &
+set
+(
+94505045131920 1 1073741824 
+primitive
+<
+94505045445840 1 0 
+plane\point\-1, -0, -0/, 70.9/
+>
+0
+1
+set
+(
+94505045130320 1 1073741824 
+primitive
+<
+94505045424880 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+0
+0
+)
+)
+set
+(
+94505045132400 1 1073741824 
+primitive
+<
+94505045443760 1 0 
+plane\point\1, -0, -0/, -81.1/
+>
+0
+1
+set
+(
+94505045132080 1 1073741824 
+primitive
+<
+94505045445680 1 0 
+plane\point\-1, 0, 0/, 81.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045133520 45 0 |
+set
+(
+94505045133360 3 0 &
+set
+(
+94505045133200 1 0 
+primitive
+<
+94505045482240 6 0 -
+primitive
+<
+94505045482080 8 0 +
+primitive
+<
+94505045481920 8 0 ^
+primitive
+<
+94505045479840 1 0 
+plane\point\-0, -1, -0/, 151/
+>
+primitive
+<
+94505045481760 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045481600 8 0 ^
+primitive
+<
+94505045481120 8 0 -
+primitive
+<
+94505045480960 8 0 @
+primitive
+<
+94505045480800 8 0 +
+primitive
+<
+94505045480640 8 0 ^
+primitive
+<
+94505045479680 1 0 
+plane\point\1, 0, 0/, -81.1/
+>
+primitive
+<
+94505045480480 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045480320 8 0 ^
+primitive
+<
+94505045479520 1 0 
+plane\point\0, 0, 1/, -7.1/
+>
+primitive
+<
+94505045480160 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045480000 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045481440 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045481280 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045133040 2 1073741824 &
+set
+(
+94505045132080 )
+set
+(
+94505045132240 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045131760 42 0 |
+set
+(
+94505045130960 3 0 &
+set
+(
+94505045130800 1 0 
+primitive
+<
+94505045441520 3 0 -
+primitive
+<
+94505045441360 8 0 +
+primitive
+<
+94505045441200 8 0 ^
+primitive
+<
+94505045422960 1 0 
+plane\point\-0, 1, 0/, -151/
+>
+primitive
+<
+94505045441040 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045440880 8 0 ^
+primitive
+<
+94505045422160 1 0 
+plane\point\1, 0, 0/, -70/
+>
+primitive
+<
+94505045440720 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045422000 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045130640 2 1073741824 &
+set
+(
+94505045130000 1 1073741824 
+primitive
+<
+94505045425200 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045128400 1 1073741824 
+primitive
+<
+94505045403840 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+set
+(
+94505045130480 1 1073741824 
+primitive
+<
+94505045423120 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045130160 1 1073741824 
+primitive
+<
+94505045425040 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045131600 39 0 |
+set
+(
+94505045131440 3 0 &
+set
+(
+94505045131280 1 0 
+primitive
+<
+94505045461200 6 0 -
+primitive
+<
+94505045461040 8 0 +
+primitive
+<
+94505045460880 8 0 ^
+primitive
+<
+94505045458800 1 0 
+plane\point\0, -1, 0/, 151/
+>
+primitive
+<
+94505045460720 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045460560 8 0 ^
+primitive
+<
+94505045460080 8 0 -
+primitive
+<
+94505045459920 8 0 @
+primitive
+<
+94505045459760 8 0 +
+primitive
+<
+94505045459600 8 0 ^
+primitive
+<
+94505045458640 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+primitive
+<
+94505045459440 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045459280 8 0 ^
+primitive
+<
+94505045458480 1 0 
+plane\point\-0, 0, 1/, -7.1/
+>
+primitive
+<
+94505045459120 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045458960 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045460400 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045460240 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045131120 2 1073741824 &
+set
+(
+94505045130160 )
+set
+(
+94505045130320 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045129840 36 0 |
+set
+(
+94505045129040 3 0 &
+set
+(
+94505045128880 1 0 
+primitive
+<
+94505045420880 3 0 -
+primitive
+<
+94505045420720 8 0 +
+primitive
+<
+94505045420560 8 0 ^
+primitive
+<
+94505045401920 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505045420400 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045420240 8 0 ^
+primitive
+<
+94505045401120 1 0 
+plane\point\0, 1, 0/, -151/
+>
+primitive
+<
+94505045420080 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045400960 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045128720 2 1073741824 &
+set
+(
+94505045128080 1 1073741824 
+primitive
+<
+94505045404160 1 0 
+plane\point\-1, -0, -0/, 66.9/
+>
+0
+1
+set
+(
+94505045126480 1 1073741824 
+primitive
+<
+94505045383200 1 0 
+plane\point\1, 0, 0/, -66.9/
+>
+0
+0
+)
+)
+set
+(
+94505045128560 1 1073741824 
+primitive
+<
+94505045402080 1 0 
+plane\point\1, -0, -0/, -69.1/
+>
+0
+1
+set
+(
+94505045128240 1 1073741824 
+primitive
+<
+94505045404000 1 0 
+plane\point\-1, 0, 0/, 69.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045129680 33 0 |
+set
+(
+94505045129520 3 0 &
+set
+(
+94505045129360 1 0 
+primitive
+<
+94505045440560 6 0 -
+primitive
+<
+94505045440400 8 0 +
+primitive
+<
+94505045440240 8 0 ^
+primitive
+<
+94505045438160 1 0 
+plane\point\0, 1, -0/, -151/
+>
+primitive
+<
+94505045440080 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045439920 8 0 ^
+primitive
+<
+94505045439440 8 0 -
+primitive
+<
+94505045439280 8 0 @
+primitive
+<
+94505045439120 8 0 +
+primitive
+<
+94505045438960 8 0 ^
+primitive
+<
+94505045438000 1 0 
+plane\point\1, 0, 0/, -69.1/
+>
+primitive
+<
+94505045438800 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045438640 8 0 ^
+primitive
+<
+94505045437840 1 0 
+plane\point\0, -0, -1/, 1.9/
+>
+primitive
+<
+94505045438480 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045438320 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045439760 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045439600 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045129200 2 1073741824 &
+set
+(
+94505045128240 )
+set
+(
+94505045128400 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045127920 30 0 |
+set
+(
+94505045127120 3 0 &
+set
+(
+94505045126960 1 0 
+primitive
+<
+94505045399840 3 0 -
+primitive
+<
+94505045399680 8 0 +
+primitive
+<
+94505045399520 8 0 ^
+primitive
+<
+94505045381280 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045399360 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045399200 8 0 ^
+primitive
+<
+94505045380480 1 0 
+plane\point\1, 0, 0/, -66/
+>
+primitive
+<
+94505045399040 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045380320 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045126800 2 1073741824 &
+set
+(
+94505045126160 1 1073741824 
+primitive
+<
+94505045383520 1 0 
+plane\point\-0, -1, -0/, 115.9/
+>
+0
+1
+set
+(
+94505045124560 1 1073741824 
+primitive
+<
+94505045362560 1 0 
+plane\point\0, 1, 0/, -115.9/
+>
+0
+0
+)
+)
+set
+(
+94505045126640 1 1073741824 
+primitive
+<
+94505045381440 1 0 
+plane\point\-0, 1, -0/, -150.1/
+>
+0
+1
+set
+(
+94505045126320 1 1073741824 
+primitive
+<
+94505045383360 1 0 
+plane\point\0, -1, 0/, 150.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045127760 27 0 |
+set
+(
+94505045127600 3 0 &
+set
+(
+94505045127440 1 0 
+primitive
+<
+94505045419920 6 0 -
+primitive
+<
+94505045419760 8 0 +
+primitive
+<
+94505045419600 8 0 ^
+primitive
+<
+94505045417520 1 0 
+plane\point\-0, 0, 1/, -1/
+>
+primitive
+<
+94505045419440 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045419280 8 0 ^
+primitive
+<
+94505045418800 8 0 -
+primitive
+<
+94505045418640 8 0 @
+primitive
+<
+94505045418480 8 0 +
+primitive
+<
+94505045418320 8 0 ^
+primitive
+<
+94505045417360 1 0 
+plane\point\1, 0, 0/, -66.9/
+>
+primitive
+<
+94505045418160 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045418000 8 0 ^
+primitive
+<
+94505045417200 1 0 
+plane\point\0, 1, -0/, -150.1/
+>
+primitive
+<
+94505045417840 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045417680 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045419120 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045418960 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045127280 2 1073741824 &
+set
+(
+94505045126320 )
+set
+(
+94505045126480 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045126000 24 0 |
+set
+(
+94505045125200 3 0 &
+set
+(
+94505045125040 1 0 
+primitive
+<
+94505045379200 3 0 -
+primitive
+<
+94505045379040 8 0 +
+primitive
+<
+94505045378880 8 0 ^
+primitive
+<
+94505045360640 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505045378720 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045378560 8 0 ^
+primitive
+<
+94505045359840 1 0 
+plane\point\0, 1, 0/, -115/
+>
+primitive
+<
+94505045378400 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045359680 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045124880 2 1073741824 &
+set
+(
+94505045124240 1 1073741824 
+primitive
+<
+94505045362880 1 0 
+plane\point\-1, -0, -0/, 62.4/
+>
+0
+1
+set
+(
+94505045122640 1 1073741824 
+primitive
+<
+94505045341920 1 0 
+plane\point\1, 0, 0/, -62.4/
+>
+0
+0
+)
+)
+set
+(
+94505045124720 1 1073741824 
+primitive
+<
+94505045360800 1 0 
+plane\point\1, -0, -0/, -65.1/
+>
+0
+1
+set
+(
+94505045124400 1 1073741824 
+primitive
+<
+94505045362720 1 0 
+plane\point\-1, 0, 0/, 65.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045125840 21 0 |
+set
+(
+94505045125680 3 0 &
+set
+(
+94505045125520 1 0 
+primitive
+<
+94505045398880 6 0 -
+primitive
+<
+94505045398720 8 0 +
+primitive
+<
+94505045398560 8 0 ^
+primitive
+<
+94505045396480 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045398400 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045398240 8 0 ^
+primitive
+<
+94505045397760 8 0 -
+primitive
+<
+94505045397600 8 0 @
+primitive
+<
+94505045397440 8 0 +
+primitive
+<
+94505045397280 8 0 ^
+primitive
+<
+94505045396320 1 0 
+plane\point\1, 0, 0/, -65.1/
+>
+primitive
+<
+94505045397120 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045396960 8 0 ^
+primitive
+<
+94505045396160 1 0 
+plane\point\0, -1, 0/, 115.9/
+>
+primitive
+<
+94505045396800 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045396640 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045398080 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045397920 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045125360 2 1073741824 &
+set
+(
+94505045124400 )
+set
+(
+94505045124560 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045124080 18 0 |
+set
+(
+94505045123280 3 0 &
+set
+(
+94505045123120 1 0 
+primitive
+<
+94505045358560 3 0 -
+primitive
+<
+94505045358400 8 0 +
+primitive
+<
+94505045358240 8 0 ^
+primitive
+<
+94505045339200 1 0 
+plane\point\0, -1, 0/, 115/
+>
+primitive
+<
+94505045358080 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045357920 8 0 ^
+primitive
+<
+94505045338400 1 0 
+plane\point\1, 0, -0/, -61.5/
+>
+primitive
+<
+94505045357760 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045338240 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045122960 2 1073741824 &
+set
+(
+94505045122320 1 1073741824 
+primitive
+<
+94505045342240 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+1
+set
+(
+94505045120720 1 1073741824 
+primitive
+<
+94505045320480 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045122800 1 1073741824 
+primitive
+<
+94505045339360 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045122480 1 1073741824 
+primitive
+<
+94505045342080 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045123920 15 0 |
+set
+(
+94505045123760 3 0 &
+set
+(
+94505045123600 1 0 
+primitive
+<
+94505045378240 6 0 -
+primitive
+<
+94505045378080 8 0 +
+primitive
+<
+94505045377920 8 0 ^
+primitive
+<
+94505045375840 1 0 
+plane\point\0, 1, 0/, -115/
+>
+primitive
+<
+94505045377760 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045377600 8 0 ^
+primitive
+<
+94505045377120 8 0 -
+primitive
+<
+94505045376960 8 0 @
+primitive
+<
+94505045376800 8 0 +
+primitive
+<
+94505045376640 8 0 ^
+primitive
+<
+94505045375680 1 0 
+plane\point\1, -0, 0/, -62.4/
+>
+primitive
+<
+94505045376480 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045376320 8 0 ^
+primitive
+<
+94505045375520 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505045376160 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045376000 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045377440 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045377280 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045123440 2 1073741824 &
+set
+(
+94505045122480 )
+set
+(
+94505045122640 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045122160 12 0 |
+set
+(
+94505045121360 3 0 &
+set
+(
+94505045121200 1 0 
+primitive
+<
+94505045337120 3 0 -
+primitive
+<
+94505045336960 8 0 +
+primitive
+<
+94505045336800 8 0 ^
+primitive
+<
+94505045318560 1 0 
+plane\point\0, -0, 1/, -27/
+>
+primitive
+<
+94505045336640 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045336480 8 0 ^
+primitive
+<
+94505045317760 1 0 
+plane\point\0, 1, 0/, -115/
+>
+primitive
+<
+94505045336320 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045317600 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045121040 2 1073741824 &
+set
+(
+94505045100400 1 1073741824 
+primitive
+<
+94505045320800 1 0 
+plane\point\-1, -0, -0/, 60.9/
+>
+0
+1
+set
+(
+94505045119120 1 1073741824 
+primitive
+<
+94505045314880 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+0
+0
+)
+)
+set
+(
+94505045120880 1 1073741824 
+primitive
+<
+94505045318720 1 0 
+plane\point\1, -0, -0/, -60.6/
+>
+0
+1
+set
+(
+94505045120560 1 1073741824 
+primitive
+<
+94505045320640 1 0 
+plane\point\-1, 0, 0/, 60.6/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045122000 9 0 |
+set
+(
+94505045121840 3 0 &
+set
+(
+94505045121680 1 0 
+primitive
+<
+94505045357600 6 0 -
+primitive
+<
+94505045357440 8 0 +
+primitive
+<
+94505045357280 8 0 ^
+primitive
+<
+94505045355200 1 0 
+plane\point\-0, -1, -0/, 115/
+>
+primitive
+<
+94505045357120 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045356960 8 0 ^
+primitive
+<
+94505045356480 8 0 -
+primitive
+<
+94505045356320 8 0 @
+primitive
+<
+94505045356160 8 0 +
+primitive
+<
+94505045356000 8 0 ^
+primitive
+<
+94505045355040 1 0 
+plane\point\1, 0, 0/, -60.6/
+>
+primitive
+<
+94505045355840 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045355680 8 0 ^
+primitive
+<
+94505045354880 1 0 
+plane\point\0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045355520 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045355360 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045356800 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045356640 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045121520 2 1073741824 &
+set
+(
+94505045120560 )
+set
+(
+94505045120720 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045120400 6 0 |
+set
+(
+94505045120240 3 0 &
+set
+(
+94505045120080 1 0 
+primitive
+<
+94505045336160 6 0 -
+primitive
+<
+94505045336000 8 0 +
+primitive
+<
+94505045335840 8 0 ^
+primitive
+<
+94505045333760 1 0 
+plane\point\0, -1, 0/, 115/
+>
+primitive
+<
+94505045335680 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045335520 8 0 ^
+primitive
+<
+94505045335040 8 0 -
+primitive
+<
+94505045334880 8 0 @
+primitive
+<
+94505045334720 8 0 +
+primitive
+<
+94505045334560 8 0 ^
+primitive
+<
+94505045333600 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+primitive
+<
+94505045334400 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045334240 8 0 ^
+primitive
+<
+94505045333440 1 0 
+plane\point\-0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045334080 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045333920 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045335360 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045335200 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045119920 2 1073741824 &
+set
+(
+94505045118960 1 1073741824 
+primitive
+<
+94505045314720 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+1
+set
+(
+94505045119280 1 1073741824 
+primitive
+<
+94505045315040 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045119120 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045119760 3 0 &
+set
+(
+94505045119600 1 0 
+primitive
+<
+94505045316480 3 0 -
+primitive
+<
+94505045316320 8 0 +
+primitive
+<
+94505045316160 8 0 ^
+primitive
+<
+94505045315200 1 0 
+plane\point\-0, 1, 0/, -115/
+>
+primitive
+<
+94505045316000 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045315840 8 0 ^
+primitive
+<
+94505045315360 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045315680 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045315520 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045119440 2 1073741824 &
+set
+(
+94505045118800 1 1073741824 
+primitive
+<
+94505045314560 1 0 
+plane\point\0, 0, -1/, 25/
+>
+0
+0
+)
+set
+(
+94505045119280 )
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045538720 -32
+user_attribute
+\
+94505045538512 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505045118640 1126 0 |
+set
+(
+94505045118480 57 0 |
+set
+(
+94505045118320 3 0 &
+set
+(
+94505045118160 1 0 
+primitive
+<
+94505045314400 3 0 -
+primitive
+<
+94505045314240 8 0 +
+primitive
+<
+94505045314080 8 0 ^
+primitive
+<
+94505045298080 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045313920 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045295200 8 0 ^
+primitive
+<
+94505045296320 1 0 
+plane\point\-0, 1, 0/, -150/
+>
+primitive
+<
+94505045295360 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045296160 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045118000 2 1073741824 &
+set
+(
+94505045117840 1 1073741824 
+primitive
+<
+94505045298240 1 0 
+plane\point\1, 0, 0/, -110/
+>
+0
+0
+)
+set
+(
+94505045117680 1 1073741824 
+primitive
+<
+94505045298400 1 0 
+plane\point\-1, -0, -0/, 82.9/
+>
+0
+1
+set
+(
+94505045116080 1 1073741824 
+primitive
+<
+94505045277440 1 0 
+plane\point\1, 0, 0/, -82.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045117520 54 0 |
+set
+(
+94505045116720 3 0 &
+set
+(
+94505045116560 1 0 
+primitive
+<
+94505045294080 3 0 -
+primitive
+<
+94505045293920 8 0 +
+primitive
+<
+94505045293760 8 0 ^
+primitive
+<
+94505045275520 1 0 
+plane\point\0, -1, 0/, 150/
+>
+primitive
+<
+94505045293600 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045293440 8 0 ^
+primitive
+<
+94505045274192 1 0 
+plane\point\1, 0, -0/, -82/
+>
+primitive
+<
+94505045293280 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045274032 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045116400 2 1073741824 &
+set
+(
+94505045115760 1 1073741824 
+primitive
+<
+94505045277760 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045114160 1 1073741824 
+primitive
+<
+94505045256272 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+set
+(
+94505045116240 1 1073741824 
+primitive
+<
+94505045275680 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045115920 1 1073741824 
+primitive
+<
+94505045277600 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045117360 51 0 |
+set
+(
+94505045117200 3 0 &
+set
+(
+94505045117040 1 0 
+primitive
+<
+94505045313760 6 0 -
+primitive
+<
+94505045313600 8 0 +
+primitive
+<
+94505045313440 8 0 ^
+primitive
+<
+94505045311360 1 0 
+plane\point\0, 1, 0/, -150/
+>
+primitive
+<
+94505045313280 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045313120 8 0 ^
+primitive
+<
+94505045312640 8 0 -
+primitive
+<
+94505045312480 8 0 @
+primitive
+<
+94505045312320 8 0 +
+primitive
+<
+94505045312160 8 0 ^
+primitive
+<
+94505045311200 1 0 
+plane\point\1, -0, 0/, -82.9/
+>
+primitive
+<
+94505045312000 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045311840 8 0 ^
+primitive
+<
+94505045311040 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505045311680 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045311520 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045312960 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045312800 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045116880 2 1073741824 &
+set
+(
+94505045115920 )
+set
+(
+94505045116080 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045115600 48 0 |
+set
+(
+94505045114800 3 0 &
+set
+(
+94505045114640 1 0 
+primitive
+<
+94505045272912 3 0 -
+primitive
+<
+94505045272752 8 0 +
+primitive
+<
+94505045272592 8 0 ^
+primitive
+<
+94505045254352 1 0 
+plane\point\0, -0, 1/, -8/
+>
+primitive
+<
+94505045272432 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045272272 8 0 ^
+primitive
+<
+94505045253552 1 0 
+plane\point\0, 1, 0/, -150/
+>
+primitive
+<
+94505045272112 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045253392 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045114480 2 1073741824 &
+set
+(
+94505045113840 1 1073741824 
+primitive
+<
+94505045256592 1 0 
+plane\point\-1, -0, -0/, 70.9/
+>
+0
+1
+set
+(
+94505045112240 1 1073741824 
+primitive
+<
+94505045235632 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+0
+0
+)
+)
+set
+(
+94505045114320 1 1073741824 
+primitive
+<
+94505045254512 1 0 
+plane\point\1, -0, -0/, -81.1/
+>
+0
+1
+set
+(
+94505045114000 1 1073741824 
+primitive
+<
+94505045256432 1 0 
+plane\point\-1, 0, 0/, 81.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045115440 45 0 |
+set
+(
+94505045115280 3 0 &
+set
+(
+94505045115120 1 0 
+primitive
+<
+94505045293120 6 0 -
+primitive
+<
+94505045292960 8 0 +
+primitive
+<
+94505045292800 8 0 ^
+primitive
+<
+94505045290720 1 0 
+plane\point\-0, -1, -0/, 150/
+>
+primitive
+<
+94505045292640 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045292480 8 0 ^
+primitive
+<
+94505045292000 8 0 -
+primitive
+<
+94505045291840 8 0 @
+primitive
+<
+94505045291680 8 0 +
+primitive
+<
+94505045291520 8 0 ^
+primitive
+<
+94505045290560 1 0 
+plane\point\1, 0, 0/, -81.1/
+>
+primitive
+<
+94505045291360 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045291200 8 0 ^
+primitive
+<
+94505045290400 1 0 
+plane\point\0, 0, 1/, -7.1/
+>
+primitive
+<
+94505045291040 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045290880 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045292320 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045292160 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045114960 2 1073741824 &
+set
+(
+94505045114000 )
+set
+(
+94505045114160 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045113680 42 0 |
+set
+(
+94505045112880 3 0 &
+set
+(
+94505045112720 1 0 
+primitive
+<
+94505045252272 3 0 -
+primitive
+<
+94505045252112 8 0 +
+primitive
+<
+94505045251952 8 0 ^
+primitive
+<
+94505045233712 1 0 
+plane\point\-0, 1, 0/, -150/
+>
+primitive
+<
+94505045251792 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045251632 8 0 ^
+primitive
+<
+94505045232912 1 0 
+plane\point\1, 0, 0/, -70/
+>
+primitive
+<
+94505045251472 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045232752 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045112560 2 1073741824 &
+set
+(
+94505045111920 1 1073741824 
+primitive
+<
+94505045235952 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045110320 1 1073741824 
+primitive
+<
+94505045214992 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+set
+(
+94505045112400 1 1073741824 
+primitive
+<
+94505045233872 1 0 
+plane\point\-0, -0, 1/, -7.1/
+>
+0
+1
+set
+(
+94505045112080 1 1073741824 
+primitive
+<
+94505045235792 1 0 
+plane\point\0, 0, -1/, 7.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045113520 39 0 |
+set
+(
+94505045113360 3 0 &
+set
+(
+94505045113200 1 0 
+primitive
+<
+94505045271952 6 0 -
+primitive
+<
+94505045271792 8 0 +
+primitive
+<
+94505045271632 8 0 ^
+primitive
+<
+94505045269552 1 0 
+plane\point\0, -1, 0/, 150/
+>
+primitive
+<
+94505045271472 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045271312 8 0 ^
+primitive
+<
+94505045270832 8 0 -
+primitive
+<
+94505045270672 8 0 @
+primitive
+<
+94505045270512 8 0 +
+primitive
+<
+94505045270352 8 0 ^
+primitive
+<
+94505045269392 1 0 
+plane\point\1, 0, 0/, -70.9/
+>
+primitive
+<
+94505045270192 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045270032 8 0 ^
+primitive
+<
+94505045269232 1 0 
+plane\point\-0, 0, 1/, -7.1/
+>
+primitive
+<
+94505045269872 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045269712 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045271152 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045270992 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045113040 2 1073741824 &
+set
+(
+94505045112080 )
+set
+(
+94505045112240 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045111760 36 0 |
+set
+(
+94505045110960 3 0 &
+set
+(
+94505045110800 1 0 
+primitive
+<
+94505045231632 3 0 -
+primitive
+<
+94505045231472 8 0 +
+primitive
+<
+94505045231312 8 0 ^
+primitive
+<
+94505045213072 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505045231152 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045230992 8 0 ^
+primitive
+<
+94505045212272 1 0 
+plane\point\0, 1, 0/, -150/
+>
+primitive
+<
+94505045230832 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045212112 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045110640 2 1073741824 &
+set
+(
+94505045110000 1 1073741824 
+primitive
+<
+94505045215312 1 0 
+plane\point\-1, -0, -0/, 67.9/
+>
+0
+1
+set
+(
+94505045108400 1 1073741824 
+primitive
+<
+94505045193952 1 0 
+plane\point\1, 0, 0/, -67.9/
+>
+0
+0
+)
+)
+set
+(
+94505045110480 1 1073741824 
+primitive
+<
+94505045213232 1 0 
+plane\point\1, -0, -0/, -69.1/
+>
+0
+1
+set
+(
+94505045110160 1 1073741824 
+primitive
+<
+94505045215152 1 0 
+plane\point\-1, 0, 0/, 69.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045111600 33 0 |
+set
+(
+94505045111440 3 0 &
+set
+(
+94505045111280 1 0 
+primitive
+<
+94505045251312 6 0 -
+primitive
+<
+94505045251152 8 0 +
+primitive
+<
+94505045250992 8 0 ^
+primitive
+<
+94505045248912 1 0 
+plane\point\0, 1, -0/, -150/
+>
+primitive
+<
+94505045250832 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045250672 8 0 ^
+primitive
+<
+94505045250192 8 0 -
+primitive
+<
+94505045250032 8 0 @
+primitive
+<
+94505045249872 8 0 +
+primitive
+<
+94505045249712 8 0 ^
+primitive
+<
+94505045248752 1 0 
+plane\point\1, 0, 0/, -69.1/
+>
+primitive
+<
+94505045249552 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045249392 8 0 ^
+primitive
+<
+94505045248592 1 0 
+plane\point\0, -0, -1/, 1.9/
+>
+primitive
+<
+94505045249232 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045249072 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045250512 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045250352 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045111120 2 1073741824 &
+set
+(
+94505045110160 )
+set
+(
+94505045110320 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045109840 30 0 |
+set
+(
+94505045109040 3 0 &
+set
+(
+94505045108880 1 0 
+primitive
+<
+94505045210992 3 0 -
+primitive
+<
+94505045210832 8 0 +
+primitive
+<
+94505045210672 8 0 ^
+primitive
+<
+94505045192032 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045210512 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045210352 8 0 ^
+primitive
+<
+94505045191232 1 0 
+plane\point\1, 0, 0/, -67/
+>
+primitive
+<
+94505045210192 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045191072 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045108720 2 1073741824 &
+set
+(
+94505045108080 1 1073741824 
+primitive
+<
+94505045194272 1 0 
+plane\point\-0, -1, -0/, 100.9/
+>
+0
+1
+set
+(
+94505045106480 1 1073741824 
+primitive
+<
+94505045173312 1 0 
+plane\point\0, 1, 0/, -100.9/
+>
+0
+0
+)
+)
+set
+(
+94505045108560 1 1073741824 
+primitive
+<
+94505045192192 1 0 
+plane\point\-0, 1, -0/, -149.1/
+>
+0
+1
+set
+(
+94505045108240 1 1073741824 
+primitive
+<
+94505045194112 1 0 
+plane\point\0, -1, 0/, 149.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045109680 27 0 |
+set
+(
+94505045109520 3 0 &
+set
+(
+94505045109360 1 0 
+primitive
+<
+94505045230672 6 0 -
+primitive
+<
+94505045230512 8 0 +
+primitive
+<
+94505045230352 8 0 ^
+primitive
+<
+94505045228272 1 0 
+plane\point\-0, 0, 1/, -1/
+>
+primitive
+<
+94505045230192 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045230032 8 0 ^
+primitive
+<
+94505045229552 8 0 -
+primitive
+<
+94505045229392 8 0 @
+primitive
+<
+94505045229232 8 0 +
+primitive
+<
+94505045229072 8 0 ^
+primitive
+<
+94505045228112 1 0 
+plane\point\1, 0, 0/, -67.9/
+>
+primitive
+<
+94505045228912 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045228752 8 0 ^
+primitive
+<
+94505045227952 1 0 
+plane\point\0, 1, -0/, -149.1/
+>
+primitive
+<
+94505045228592 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045228432 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045229872 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045229712 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045109200 2 1073741824 &
+set
+(
+94505045108240 )
+set
+(
+94505045108400 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045107920 24 0 |
+set
+(
+94505045107120 3 0 &
+set
+(
+94505045106960 1 0 
+primitive
+<
+94505045189952 3 0 -
+primitive
+<
+94505045189792 8 0 +
+primitive
+<
+94505045189632 8 0 ^
+primitive
+<
+94505045171392 1 0 
+plane\point\0, -0, 1/, -1/
+>
+primitive
+<
+94505045189472 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045189312 8 0 ^
+primitive
+<
+94505045170592 1 0 
+plane\point\0, 1, 0/, -100/
+>
+primitive
+<
+94505045189152 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045170432 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045106800 2 1073741824 &
+set
+(
+94505045106160 1 1073741824 
+primitive
+<
+94505045173632 1 0 
+plane\point\-1, -0, -0/, 62.4/
+>
+0
+1
+set
+(
+94505045104560 1 1073741824 
+primitive
+<
+94505045152672 1 0 
+plane\point\1, 0, 0/, -62.4/
+>
+0
+0
+)
+)
+set
+(
+94505045106640 1 1073741824 
+primitive
+<
+94505045171552 1 0 
+plane\point\1, -0, -0/, -66.1/
+>
+0
+1
+set
+(
+94505045106320 1 1073741824 
+primitive
+<
+94505045173472 1 0 
+plane\point\-1, 0, 0/, 66.1/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045107760 21 0 |
+set
+(
+94505045107600 3 0 &
+set
+(
+94505045107440 1 0 
+primitive
+<
+94505045210032 6 0 -
+primitive
+<
+94505045209872 8 0 +
+primitive
+<
+94505045209712 8 0 ^
+primitive
+<
+94505045207232 1 0 
+plane\point\0, 0, -1/, 1/
+>
+primitive
+<
+94505045209552 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045209392 8 0 ^
+primitive
+<
+94505045208912 8 0 -
+primitive
+<
+94505045208352 8 0 @
+primitive
+<
+94505045208192 8 0 +
+primitive
+<
+94505045208032 8 0 ^
+primitive
+<
+94505045207072 1 0 
+plane\point\1, 0, 0/, -66.1/
+>
+primitive
+<
+94505045207872 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045207712 8 0 ^
+primitive
+<
+94505045206912 1 0 
+plane\point\0, -1, 0/, 100.9/
+>
+primitive
+<
+94505045207552 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045207392 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045209232 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045209072 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045107280 2 1073741824 &
+set
+(
+94505045106320 )
+set
+(
+94505045106480 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045106000 18 0 |
+set
+(
+94505045105200 3 0 &
+set
+(
+94505045105040 1 0 
+primitive
+<
+94505045169312 3 0 -
+primitive
+<
+94505045169152 8 0 +
+primitive
+<
+94505045168992 8 0 ^
+primitive
+<
+94505045150752 1 0 
+plane\point\0, -1, 0/, 100/
+>
+primitive
+<
+94505045168832 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045168672 8 0 ^
+primitive
+<
+94505045149952 1 0 
+plane\point\1, 0, -0/, -61.5/
+>
+primitive
+<
+94505045168512 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045149792 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045104880 2 1073741824 &
+set
+(
+94505045104240 1 1073741824 
+primitive
+<
+94505045152992 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+1
+set
+(
+94505045102640 1 1073741824 
+primitive
+<
+94505045062048 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045104720 1 1073741824 
+primitive
+<
+94505045150912 1 0 
+plane\point\-0, -0, -1/, 1.9/
+>
+0
+1
+set
+(
+94505045104400 1 1073741824 
+primitive
+<
+94505045152832 1 0 
+plane\point\0, 0, 1/, -1.9/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045105840 15 0 |
+set
+(
+94505045105680 3 0 &
+set
+(
+94505045105520 1 0 
+primitive
+<
+94505045188992 6 0 -
+primitive
+<
+94505045188832 8 0 +
+primitive
+<
+94505045188672 8 0 ^
+primitive
+<
+94505045186592 1 0 
+plane\point\0, 1, 0/, -100/
+>
+primitive
+<
+94505045188512 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045188352 8 0 ^
+primitive
+<
+94505045187872 8 0 -
+primitive
+<
+94505045187712 8 0 @
+primitive
+<
+94505045187552 8 0 +
+primitive
+<
+94505045187392 8 0 ^
+primitive
+<
+94505045186432 1 0 
+plane\point\1, -0, 0/, -62.4/
+>
+primitive
+<
+94505045187232 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045187072 8 0 ^
+primitive
+<
+94505045186272 1 0 
+plane\point\0, 0, -1/, 1.9/
+>
+primitive
+<
+94505045186912 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045186752 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045188192 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045188032 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045105360 2 1073741824 &
+set
+(
+94505045104400 )
+set
+(
+94505045104560 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045104080 12 0 |
+set
+(
+94505045103280 3 0 &
+set
+(
+94505045103120 1 0 
+primitive
+<
+94505045148672 3 0 -
+primitive
+<
+94505045148512 8 0 +
+primitive
+<
+94505045148352 8 0 ^
+primitive
+<
+94505045060128 1 0 
+plane\point\0, -0, 1/, -27/
+>
+primitive
+<
+94505045148192 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045148032 8 0 ^
+primitive
+<
+94505045059328 1 0 
+plane\point\0, 1, 0/, -100/
+>
+primitive
+<
+94505045147872 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045059168 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045102960 2 1073741824 &
+set
+(
+94505045100560 1 1073741824 
+primitive
+<
+94505045062368 1 0 
+plane\point\-1, -0, -0/, 60.9/
+>
+0
+1
+set
+(
+94505045101040 1 1073741824 
+primitive
+<
+94505045056448 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+0
+0
+)
+)
+set
+(
+94505045102800 1 1073741824 
+primitive
+<
+94505045060288 1 0 
+plane\point\1, -0, -0/, -60.6/
+>
+0
+1
+set
+(
+94505045102480 1 1073741824 
+primitive
+<
+94505045062208 1 0 
+plane\point\-1, 0, 0/, 60.6/
+>
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045103920 9 0 |
+set
+(
+94505045103760 3 0 &
+set
+(
+94505045103600 1 0 
+primitive
+<
+94505045168352 6 0 -
+primitive
+<
+94505045168192 8 0 +
+primitive
+<
+94505045168032 8 0 ^
+primitive
+<
+94505045165952 1 0 
+plane\point\-0, -1, -0/, 100/
+>
+primitive
+<
+94505045167872 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045167712 8 0 ^
+primitive
+<
+94505045167232 8 0 -
+primitive
+<
+94505045167072 8 0 @
+primitive
+<
+94505045166912 8 0 +
+primitive
+<
+94505045166752 8 0 ^
+primitive
+<
+94505045165792 1 0 
+plane\point\1, 0, 0/, -60.6/
+>
+primitive
+<
+94505045166592 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045166432 8 0 ^
+primitive
+<
+94505045165632 1 0 
+plane\point\0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045166272 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045166112 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045167552 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045167392 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045103440 2 1073741824 &
+set
+(
+94505045102480 )
+set
+(
+94505045102640 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045102320 6 0 |
+set
+(
+94505045102160 3 0 &
+set
+(
+94505045102000 1 0 
+primitive
+<
+94505045147712 6 0 -
+primitive
+<
+94505045147552 8 0 +
+primitive
+<
+94505045147392 8 0 ^
+primitive
+<
+94505045145312 1 0 
+plane\point\0, -1, 0/, 100/
+>
+primitive
+<
+94505045147232 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045147072 8 0 ^
+primitive
+<
+94505045146592 8 0 -
+primitive
+<
+94505045146432 8 0 @
+primitive
+<
+94505045146272 8 0 +
+primitive
+<
+94505045146112 8 0 ^
+primitive
+<
+94505045145152 1 0 
+plane\point\1, 0, 0/, -60.9/
+>
+primitive
+<
+94505045145952 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045145792 8 0 ^
+primitive
+<
+94505045144992 1 0 
+plane\point\-0, 0, 1/, -26.1/
+>
+primitive
+<
+94505045145632 0 0 
+2
+>
+0
+>
+0
+>
+0
+>
+primitive
+<
+94505045145472 0 0 
+0.9
+>
+0
+>
+primitive
+<
+94505045146912 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045146752 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045101840 2 1073741824 &
+set
+(
+94505045100880 1 1073741824 
+primitive
+<
+94505045056288 1 0 
+plane\point\0, 0, -1/, 26.1/
+>
+0
+1
+set
+(
+94505045101200 1 1073741824 
+primitive
+<
+94505045056608 1 0 
+plane\point\-0, -0, 1/, -26.1/
+>
+0
+0
+)
+)
+set
+(
+94505045101040 )
+0
+0
+)
+0
+0
+)
+set
+(
+94505045101680 3 0 &
+set
+(
+94505045101520 1 0 
+primitive
+<
+94505045058048 3 0 -
+primitive
+<
+94505045057888 8 0 +
+primitive
+<
+94505045057728 8 0 ^
+primitive
+<
+94505045056768 1 0 
+plane\point\-0, 1, 0/, -100/
+>
+primitive
+<
+94505045057568 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045057408 8 0 ^
+primitive
+<
+94505045056928 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045057248 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045057088 0 0 
+0.09
+>
+0
+>
+0
+0
+)
+set
+(
+94505045101360 2 1073741824 &
+set
+(
+94505045100720 1 1073741824 
+primitive
+<
+94505045056128 1 0 
+plane\point\0, 0, -1/, 25/
+>
+0
+0
+)
+set
+(
+94505045101200 )
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045340800 -32
+user_attribute
+\
+94505045340592 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505045100240 1069 0 |
+set
+(
+94505045100080 7 1073741824 &
+set
+(
+94505045098160 1 1073741824 
+primitive
+<
+94505045055008 1 0 
+plane\point\-0, -1, -0/, 33/
+>
+1
+attribute
+<
+94505045142544 -32
+user_attribute
+\
+94505045142336 32
+surface
+\
+1
+point\0.8, 0.4, 0.2/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\95, 33, 1/
+point\-1, -0, -0/
+point\10, 5, 0/
+0
+0
+1
+P6
+#svLis surface texture
+128 64
+255
+ | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |   | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |       | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |           | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |               | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |                   | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |     |           |     | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |     | |           | |     | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | |   | | |           | | |   | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |   | | | | |           | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |     | | | | |           | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |     | | | | | |           | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |       | | | | | |           | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |         | | | | | |           | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |           | | | | | |           | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | |   |       | | | | | |           | | | | | | | | | | |   | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | |       | | | | | |           | | | | | | | | | | |     | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | |     | | | | | | |           | | | | | | | | | | |       | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | |     | | | | | | |           | | | | | | | | | | | |       | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | |       | | | | | | |           | | | | | | | | | | | | |       | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |   | | | | | |       | | | | | | |           | | | | | | | | | | | | |         | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |     | | | | | |       | | | | | | |           | | | | | | | | | | | | |           | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |     | | | | | | |       | | | | | | |           | | | | | | | | | | | | |             | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |     | | | | | | | |       | | | | | | |           | | | | | | | | | | | | |               | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |       | | | | | | | |       | | | | | | |           | | | | | | | | | | | | |         |     | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |         | | | | | | | |       | | | | | | |           | | | | | | | | | | | | |         | |   | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |           | | | | | | | |       | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |               | | | | | | |     | | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | |   | |         | | | | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | |         | | | | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | |         | | | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | |         | | | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | |         | | | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |               |   | |         | | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | | | |               |   | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |                     | |         | | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | | |                     | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |         | | |         | |         | | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | |         | | |         | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | |       | | | | |       | | |         | | |       | | | | | | | |           | | | | | | | | | | | | |         | | | | |       | | | | |       | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | |       | | | | | |     | | |         | | |     | | | | | | | | |           | | | | | | | | | | | | |         | | | | |       | | | | | |     | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | |       | | | | | | |   | | |         | |       | | | | | | | | |           | | | | | | | | | | | | |         | | | | |       | | | | | | |   | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | |         | | | | | |   | | | |         |       | | | | | | | | |           | | | | | | | | | | | | |         | | | | |         | | | | | |   | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | |           | | | | | | | | | |         |       | | | | | | | | |           | | | | | | | | | | | | |         | | | | |           | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | |             | | | | | | | |         |       | | | | | | | | |           | | | | | | | | | | | | |         | | | | | |             | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | |             | | | | | | | |               | | | | | | | | |           | | | | | | | | | | | | |         | | | | | | |             | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | |             | | | | | |               | | | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | |             | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | |           | | | | |               | | | | | | | | |           | | | | | | | | | | | | |         | | | | | | | | | | |           | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | |   | | | | | | |       | | | | | |             | | | | | | | | |           | | | | | | | | | | | | |         | | | | |   | | | | | | |       | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | |   | | | | | | |       | | | | | |             | | | | | | | | |           | | | | | |     | | | | |         | | | | |   | | | | | | |       | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | |     | | | | | |       | | | | | |           | | | | | | | | | |           | | | | | |     | | | | |         | | | | |     | | | | | |       | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | |       | | | | |       | | | | | | |         | | | | | | | | | |           | | | | | |     | | | | |         | | | | |       | | | | |       | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | |         | | |         | | | | | | |         | | | | | | | | | |           | | | | |       | | | | |         | | | | |         | | |         | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | |                     | | | | | | | | |       | | | | | | |                                 | |                     | |                     | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | |   |               | | | | | | | | | |       | | | | | | |                                 | |                     | |   |               | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | | | |   | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |   | | | |                                                                                                                                                                                                                                                           | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | |
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505045099920 6 1073741824 &
+set
+(
+94505045098960 3 1073741824 &
+set
+(
+94505045098320 1 1073741824 
+primitive
+<
+94505045055168 1 0 
+plane\point\-0, -0, -1/, -5/
+>
+0
+0
+)
+set
+(
+94505045098800 2 1073741824 &
+set
+(
+94505045098640 1 1073741824 
+primitive
+<
+94505045055488 1 0 
+plane\point\-1, -0, -0/, 84/
+>
+0
+0
+)
+set
+(
+94505045098480 1 1073741824 
+primitive
+<
+94505045055328 1 0 
+plane\point\-0, -1, -0/, 30/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045099760 3 1073741824 &
+set
+(
+94505045099120 1 1073741824 
+primitive
+<
+94505045055648 1 0 
+plane\point\0, 0, 1/, -7/
+>
+0
+0
+)
+set
+(
+94505045099600 2 1073741824 &
+set
+(
+94505045099440 1 1073741824 
+primitive
+<
+94505045055968 1 0 
+plane\point\1, 0, 0/, -96/
+>
+0
+0
+)
+set
+(
+94505045099280 1 1073741824 
+primitive
+<
+94505045055808 1 0 
+plane\point\0, 1, 0/, -35/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045142880 -32
+user_attribute
+\
+94505045142672 32
+surface
+\
+1
+point\0.8, 0.4, 0.2/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+set
+(
+94505045098000 1062 0 &
+set
+(
+94505045097840 23 0 |
+set
+(
+94505045097680 1 1073741824 
+primitive
+<
+94505045054848 1 0 
+plane\point\0, 0, 1/, 0.25/
+>
+0
+1
+set
+(
+94505045092080 1 1073741824 
+primitive
+<
+94505045052128 1 0 
+plane\point\-0, -0, -1/, -0.25/
+>
+0
+0
+)
+)
+set
+(
+94505045097520 22 0 &
+set
+(
+94505045097360 1 0 
+primitive
+<
+94505045054688 3 0 ~
+primitive
+<
+94505045050528 3 0 -
+primitive
+<
+94505045050368 8 0 +
+primitive
+<
+94505045050208 8 0 ^
+primitive
+<
+94505045049248 1 0 
+plane\point\0, 1, 0/, -115/
+>
+primitive
+<
+94505045050048 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045049888 8 0 ^
+primitive
+<
+94505045049408 1 0 
+plane\point\1, 0, 0/, -226/
+>
+primitive
+<
+94505045049728 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045049568 0 0 
+256
+>
+0
+>
+0
+>
+0
+1
+set
+(
+94505045091440 1 0 
+primitive
+<
+94505045050528 
+>
+0
+0
+)
+)
+set
+(
+94505045097200 21 0 &
+set
+(
+94505045097040 1 0 
+primitive
+<
+94505045054528 3 0 ~
+primitive
+<
+94505045051968 3 0 -
+primitive
+<
+94505045051808 8 0 +
+primitive
+<
+94505045051648 8 0 ^
+primitive
+<
+94505045050688 1 0 
+plane\point\0, 1, 0/, -119/
+>
+primitive
+<
+94505045051488 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045051328 8 0 ^
+primitive
+<
+94505045050848 1 0 
+plane\point\1, 0, 0/, -140/
+>
+primitive
+<
+94505045051168 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045051008 0 0 
+256
+>
+0
+>
+0
+>
+0
+1
+set
+(
+94505045091600 1 0 
+primitive
+<
+94505045051968 
+>
+0
+0
+)
+)
+set
+(
+94505045096880 20 0 |
+set
+(
+94505045096720 8 0 &
+set
+(
+94505045096560 1 0 
+primitive
+<
+94505045054368 3 0 ~
+primitive
+<
+94505045042048 3 0 -
+primitive
+<
+94505045041888 8 0 +
+primitive
+<
+94505045041728 8 0 ^
+primitive
+<
+94505045040768 1 0 
+plane\point\0, 1, 0/, -180/
+>
+primitive
+<
+94505045041568 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045041408 8 0 ^
+primitive
+<
+94505045040928 1 0 
+plane\point\1, 0, 0/, -210/
+>
+primitive
+<
+94505045041248 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045041088 0 0 
+256
+>
+0
+>
+0
+>
+0
+1
+set
+(
+94505045086000 1 0 
+primitive
+<
+94505045042048 
+>
+0
+0
+)
+)
+set
+(
+94505045096400 7 0 &
+set
+(
+94505045096240 1 0 
+primitive
+<
+94505045054208 3 0 ~
+primitive
+<
+94505045043488 3 0 -
+primitive
+<
+94505045043328 8 0 +
+primitive
+<
+94505045043168 8 0 ^
+primitive
+<
+94505045042208 1 0 
+plane\point\0, 1, 0/, -180/
+>
+primitive
+<
+94505045043008 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045042848 8 0 ^
+primitive
+<
+94505045042368 1 0 
+plane\point\1, 0, 0/, -88/
+>
+primitive
+<
+94505045042688 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045042528 0 0 
+256
+>
+0
+>
+0
+>
+0
+1
+set
+(
+94505045086160 1 0 
+primitive
+<
+94505045043488 
+>
+0
+0
+)
+)
+set
+(
+94505045096080 6 0 |
+set
+(
+94505045095920 3 0 |
+set
+(
+94505045095760 1 1073741824 
+primitive
+<
+94505045054048 1 0 
+plane\point\-1, -0, -0/, 226/
+>
+0
+1
+set
+(
+94505045086320 1 1073741824 
+primitive
+<
+94505045043648 1 0 
+plane\point\1, 0, 0/, -226/
+>
+0
+0
+)
+)
+set
+(
+94505045095600 2 0 |
+set
+(
+94505045095440 1 1073741824 
+primitive
+<
+94505045053888 1 0 
+plane\point\1, 0, 0/, -72/
+>
+0
+1
+set
+(
+94505045086640 1 1073741824 
+primitive
+<
+94505045043968 1 0 
+plane\point\-1, -0, -0/, 72/
+>
+0
+0
+)
+)
+set
+(
+94505045095280 1 1073741824 
+primitive
+<
+94505045053728 1 0 
+plane\point\-0, -1, -0/, 196/
+>
+0
+1
+set
+(
+94505045086480 1 1073741824 
+primitive
+<
+94505045043808 1 0 
+plane\point\0, 1, 0/, -196/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505045086800 2 1073741824 &
+set
+(
+94505045086640 )
+set
+(
+94505045086480 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045086960 3 1073741824 &
+set
+(
+94505045086320 )
+set
+(
+94505045086800 )
+0
+0
+)
+)
+set
+(
+94505045088240 3 0 &
+set
+(
+94505045088080 1 1073741824 
+primitive
+<
+94505045044448 1 0 
+plane\point\-0, -1, -0/, 180/
+>
+0
+1
+set
+(
+94505045085520 1 1073741824 
+primitive
+<
+94505045040608 1 0 
+plane\point\0, 1, 0/, -180/
+>
+0
+0
+)
+)
+set
+(
+94505045087920 2 0 |
+set
+(
+94505045087760 1 1073741824 
+primitive
+<
+94505045044288 1 0 
+plane\point\1, 0, 0/, -88/
+>
+0
+1
+set
+(
+94505045085200 1 1073741824 
+primitive
+<
+94505045040288 1 0 
+plane\point\-1, -0, -0/, 88/
+>
+0
+0
+)
+)
+set
+(
+94505045087600 1 1073741824 
+primitive
+<
+94505045044128 1 0 
+plane\point\-1, -0, -0/, 210/
+>
+0
+1
+set
+(
+94505045085360 1 1073741824 
+primitive
+<
+94505045040448 1 0 
+plane\point\1, 0, 0/, -210/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505045085680 2 1073741824 &
+set
+(
+94505045085200 )
+set
+(
+94505045085360 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045085840 3 0 |
+set
+(
+94505045085520 )
+set
+(
+94505045085680 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045087120 6 0 &
+set
+(
+94505045086960 )
+set
+(
+94505045085840 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045087280 7 0 |
+set
+(
+94505045086160 )
+set
+(
+94505045087120 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045087440 8 0 |
+set
+(
+94505045086000 )
+set
+(
+94505045087280 )
+0
+0
+)
+)
+set
+(
+94505045095120 12 0 &
+set
+(
+94505045094960 3 0 |
+set
+(
+94505045094800 1 1073741824 
+primitive
+<
+94505045053568 1 0 
+plane\point\0, 1, 0/, -127/
+>
+0
+1
+set
+(
+94505045088720 1 1073741824 
+primitive
+<
+94505045048128 1 0 
+plane\point\-0, -1, -0/, 127/
+>
+0
+0
+)
+)
+set
+(
+94505045094640 2 0 |
+set
+(
+94505045094480 1 1073741824 
+primitive
+<
+94505045053408 1 0 
+plane\point\-0, -1, -0/, 135/
+>
+0
+1
+set
+(
+94505045089040 1 1073741824 
+primitive
+<
+94505045048448 1 0 
+plane\point\0, 1, 0/, -135/
+>
+0
+0
+)
+)
+set
+(
+94505045094320 1 1073741824 
+primitive
+<
+94505045053248 1 0 
+plane\point\-1, -0, -0/, 140/
+>
+0
+1
+set
+(
+94505045088880 1 1073741824 
+primitive
+<
+94505045048288 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505045089200 2 1073741824 &
+set
+(
+94505045089040 )
+set
+(
+94505045088880 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045089360 3 1073741824 &
+set
+(
+94505045088720 )
+set
+(
+94505045089200 )
+0
+0
+)
+)
+set
+(
+94505045094160 9 0 &
+set
+(
+94505045094000 4 0 &
+set
+(
+94505045093840 2 1073741824 &
+set
+(
+94505045093680 1 1073741824 
+primitive
+<
+94505045053088 1 0 
+plane\point\-1, -0, -0/, 80/
+>
+0
+1
+set
+(
+94505045090480 1 1073741824 
+primitive
+<
+94505045049088 1 0 
+plane\point\1, 0, 0/, -80/
+>
+0
+0
+)
+)
+set
+(
+94505045093520 1 1073741824 
+primitive
+<
+94505045052928 1 0 
+plane\point\0, 1, 0/, -188/
+>
+0
+1
+set
+(
+94505045090320 1 1073741824 
+primitive
+<
+94505045048928 1 0 
+plane\point\-0, -1, -0/, 188/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505045090640 2 0 |
+set
+(
+94505045090480 )
+set
+(
+94505045090320 )
+0
+0
+)
+)
+set
+(
+94505045093360 2 0 |
+set
+(
+94505045093200 1 1073741824 
+primitive
+<
+94505045052768 1 0 
+plane\point\1, 0, 0/, -218/
+>
+0
+1
+set
+(
+94505045090000 1 1073741824 
+primitive
+<
+94505045048768 1 0 
+plane\point\-1, -0, -0/, 218/
+>
+0
+0
+)
+)
+set
+(
+94505045093040 1 1073741824 
+primitive
+<
+94505045052608 1 0 
+plane\point\0, 1, 0/, -115/
+>
+0
+1
+set
+(
+94505045089840 1 1073741824 
+primitive
+<
+94505045048608 1 0 
+plane\point\-0, -1, -0/, 115/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505045090160 2 1073741824 &
+set
+(
+94505045090000 )
+set
+(
+94505045089840 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045090800 4 0 |
+set
+(
+94505045090640 )
+set
+(
+94505045090160 )
+0
+0
+)
+)
+set
+(
+94505045092880 5 0 |
+set
+(
+94505045092720 2 0 |
+set
+(
+94505045092560 1 0 
+primitive
+<
+94505045052448 8 0 ~
+primitive
+<
+94505045046208 8 0 *
+primitive
+<
+94505045046048 0 0 
+-1
+>
+primitive
+<
+94505045045888 3 0 -
+primitive
+<
+94505045045728 8 0 +
+primitive
+<
+94505045045568 8 0 ^
+primitive
+<
+94505045044608 1 0 
+plane\point\0, 1, 0/, -180/
+>
+primitive
+<
+94505045045408 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045045248 8 0 ^
+primitive
+<
+94505045044768 1 0 
+plane\point\1, 0, 0/, -88/
+>
+primitive
+<
+94505045045088 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045044928 0 0 
+64
+>
+0
+>
+0
+>
+0
+>
+0
+1
+set
+(
+94505045088400 1 0 
+primitive
+<
+94505045046208 
+>
+0
+0
+)
+)
+set
+(
+94505045092400 1 0 
+primitive
+<
+94505045052288 8 0 ~
+primitive
+<
+94505045047968 8 0 *
+primitive
+<
+94505045047808 0 0 
+-1
+>
+primitive
+<
+94505045047648 3 0 -
+primitive
+<
+94505045047488 8 0 +
+primitive
+<
+94505045047328 8 0 ^
+primitive
+<
+94505045046368 1 0 
+plane\point\0, 1, 0/, -180/
+>
+primitive
+<
+94505045047168 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045047008 8 0 ^
+primitive
+<
+94505045046528 1 0 
+plane\point\1, 0, 0/, -210/
+>
+primitive
+<
+94505045046848 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045046688 0 0 
+64
+>
+0
+>
+0
+>
+0
+>
+0
+1
+set
+(
+94505045088560 1 0 
+primitive
+<
+94505045047968 
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505045089520 2 0 &
+set
+(
+94505045088400 )
+set
+(
+94505045088560 )
+0
+0
+)
+)
+set
+(
+94505045085840 )
+0
+1
+set
+(
+94505045089680 5 0 &
+set
+(
+94505045089520 )
+set
+(
+94505045088240 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045090960 9 0 |
+set
+(
+94505045090800 )
+set
+(
+94505045089680 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045091120 12 0 |
+set
+(
+94505045089360 )
+set
+(
+94505045090960 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045091280 20 0 &
+set
+(
+94505045087440 )
+set
+(
+94505045091120 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045091760 21 0 |
+set
+(
+94505045091600 )
+set
+(
+94505045091280 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045091920 22 0 |
+set
+(
+94505045091440 )
+set
+(
+94505045091760 )
+0
+0
+)
+)
+1
+attribute
+<
+94505045142208 -32
+user_attribute
+\
+94505045142000 32
+surface
+\
+1
+point\0.3, 0.3, 0.3/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+1
+set
+(
+94505045092240 23 0 &
+set
+(
+94505045092080 )
+set
+(
+94505045091920 )
+1
+attribute
+<
+94505045142208
+>
+attribute
+<
+0
+>
+0
+)
+)
+set
+(
+94505045084880 1039 0 |
+set
+(
+94505045084720 28 0 |
+set
+(
+94505045084560 5 0 |
+set
+(
+94505045083280 1 0 
+primitive
+<
+94505045036288 4 0 -
+primitive
+<
+94505045036128 8 0 +
+primitive
+<
+94505045035968 8 0 +
+primitive
+<
+94505045035808 8 0 ^
+primitive
+<
+94505045034368 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045035648 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045035488 8 0 ^
+primitive
+<
+94505045034528 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505045035328 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045035168 8 0 ^
+primitive
+<
+94505045034688 1 0 
+plane\point\0, 0, 1/, -25/
+>
+primitive
+<
+94505045035008 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045034848 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505045084400 4 0 |
+set
+(
+94505045083440 1 0 
+primitive
+<
+94505045038368 4 0 -
+primitive
+<
+94505045038208 8 0 +
+primitive
+<
+94505045038048 8 0 +
+primitive
+<
+94505045037888 8 0 ^
+primitive
+<
+94505045036448 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045037728 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045037568 8 0 ^
+primitive
+<
+94505045036608 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505045037408 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045037248 8 0 ^
+primitive
+<
+94505045036768 1 0 
+plane\point\0, 0, 1/, -0/
+>
+primitive
+<
+94505045037088 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045036928 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505045084240 3 0 &
+set
+(
+94505045083760 1 1073741824 
+primitive
+<
+94505045039968 1 0 
+plane\point\0, 0, 1/, -25/
+>
+0
+0
+)
+set
+(
+94505045084080 2 0 &
+set
+(
+94505045083920 1 1073741824 
+primitive
+<
+94505045040128 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505045083600 1 0 
+primitive
+<
+94505045039808 3 0 -
+primitive
+<
+94505045039648 8 0 +
+primitive
+<
+94505045039488 8 0 ^
+primitive
+<
+94505045038528 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505045039328 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045039168 8 0 ^
+primitive
+<
+94505045038688 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045039008 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045038848 0 0 
+1
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045141488 -32
+user_attribute
+\
+94505045141280 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505045083120 23 0 |
+set
+(
+94505045077360 9 0 &
+set
+(
+94505045077040 4 0 |
+set
+(
+94505045076560 2 1073741824 &
+set
+(
+94505045076400 1 1073741824 
+primitive
+<
+94505045030848 1 0 
+plane\point\-0, -0, -1/, 10/
+>
+0
+0
+)
+set
+(
+94505045076240 1 1073741824 
+primitive
+<
+94505045030688 1 0 
+plane\point\0, 0, 1/, -10.2/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505045076880 2 1073741824 &
+set
+(
+94505045076720 1 1073741824 
+primitive
+<
+94505045031168 1 0 
+plane\point\-0, -0, -1/, 20/
+>
+0
+0
+)
+set
+(
+94505045076080 1 1073741824 
+primitive
+<
+94505045031008 1 0 
+plane\point\0, 0, 1/, -20.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045078640 5 1073741824 &
+set
+(
+94505045078480 1 1073741824 
+primitive
+<
+94505045032128 1 0 
+plane\point\0.309017, -0.951056, 0/, 131.628/
+>
+0
+0
+)
+set
+(
+94505045078320 4 1073741824 &
+set
+(
+94505045078160 1 1073741824 
+primitive
+<
+94505045031968 1 0 
+plane\point\-0.809017, -0.587785, 0/, 140.587/
+>
+0
+0
+)
+set
+(
+94505045078000 3 1073741824 &
+set
+(
+94505045077840 1 1073741824 
+primitive
+<
+94505045031808 1 0 
+plane\point\-0.809017, 0.587785, 0/, -47.5046/
+>
+0
+0
+)
+set
+(
+94505045077680 2 1073741824 &
+set
+(
+94505045077520 1 1073741824 
+primitive
+<
+94505045031488 1 0 
+plane\point\1, 0, 0/, -62/
+>
+0
+0
+)
+set
+(
+94505045077200 1 1073741824 
+primitive
+<
+94505045031648 1 0 
+plane\point\0.309017, 0.951057, 0/, -172.71/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045082960 14 0 &
+set
+(
+94505045082800 4 0 |
+set
+(
+94505045082320 2 1073741824 &
+set
+(
+94505045082160 1 1073741824 
+primitive
+<
+94505045033888 1 0 
+plane\point\-0, -0, -1/, 10.5/
+>
+0
+0
+)
+set
+(
+94505045082000 1 1073741824 
+primitive
+<
+94505045033728 1 0 
+plane\point\0, 0, 1/, -10.7/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505045082640 2 1073741824 &
+set
+(
+94505045082480 1 1073741824 
+primitive
+<
+94505045034208 1 0 
+plane\point\-0, -0, -1/, 20.5/
+>
+0
+0
+)
+set
+(
+94505045081840 1 1073741824 
+primitive
+<
+94505045034048 1 0 
+plane\point\0, 0, 1/, -20.7/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045081680 10 0 &
+set
+(
+94505045078640 )
+set
+(
+94505045081520 5 0 |
+set
+(
+94505045081360 1 1073741824 
+primitive
+<
+94505045033568 1 0 
+plane\point\-0.309017, 0.951056, -0/, -131.828/
+>
+0
+1
+set
+(
+94505045080080 1 1073741824 
+primitive
+<
+94505045032928 1 0 
+plane\point\0.309017, -0.951056, 0/, 131.828/
+>
+0
+0
+)
+)
+set
+(
+94505045081200 4 0 |
+set
+(
+94505045081040 1 1073741824 
+primitive
+<
+94505045033408 1 0 
+plane\point\0.809017, 0.587785, -0/, -140.787/
+>
+0
+1
+set
+(
+94505045079760 1 1073741824 
+primitive
+<
+94505045032768 1 0 
+plane\point\-0.809017, -0.587785, 0/, 140.787/
+>
+0
+0
+)
+)
+set
+(
+94505045080880 3 0 |
+set
+(
+94505045080720 1 1073741824 
+primitive
+<
+94505045033248 1 0 
+plane\point\0.809017, -0.587785, -0/, 47.3046/
+>
+0
+1
+set
+(
+94505045079440 1 1073741824 
+primitive
+<
+94505045032608 1 0 
+plane\point\-0.809017, 0.587785, 0/, -47.3046/
+>
+0
+0
+)
+)
+set
+(
+94505045080560 2 0 |
+set
+(
+94505045080400 1 1073741824 
+primitive
+<
+94505045033088 1 0 
+plane\point\-1, -0, -0/, 61.8/
+>
+0
+1
+set
+(
+94505045079120 1 1073741824 
+primitive
+<
+94505045032288 1 0 
+plane\point\1, 0, 0/, -61.8/
+>
+0
+0
+)
+)
+set
+(
+94505045078960 1 1073741824 
+primitive
+<
+94505045031328 1 0 
+plane\point\-0.309017, -0.951057, -0/, 172.51/
+>
+0
+1
+set
+(
+94505045078800 1 1073741824 
+primitive
+<
+94505045032448 1 0 
+plane\point\0.309017, 0.951057, 0/, -172.51/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505045079280 2 1073741824 &
+set
+(
+94505045079120 )
+set
+(
+94505045078800 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045079600 3 1073741824 &
+set
+(
+94505045079440 )
+set
+(
+94505045079280 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045079920 4 1073741824 &
+set
+(
+94505045079760 )
+set
+(
+94505045079600 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045080240 5 1073741824 &
+set
+(
+94505045080080 )
+set
+(
+94505045079920 )
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045140960 -32
+user_attribute
+\
+94505045140752 32
+surface
+\
+1
+point\0.1, 0.1, 0.1/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+set
+(
+94505045075760 1011 0 |
+set
+(
+94505045075600 28 0 |
+set
+(
+94505045075440 5 0 |
+set
+(
+94505045004640 1 0 
+primitive
+<
+94505045026688 4 0 -
+primitive
+<
+94505045026528 8 0 +
+primitive
+<
+94505045026368 8 0 +
+primitive
+<
+94505045026208 8 0 ^
+primitive
+<
+94505045024768 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045026048 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045025888 8 0 ^
+primitive
+<
+94505045024928 1 0 
+plane\point\0, 1, 0/, -145/
+>
+primitive
+<
+94505045025728 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045025568 8 0 ^
+primitive
+<
+94505045025088 1 0 
+plane\point\0, 0, 1/, -25/
+>
+primitive
+<
+94505045025408 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045025248 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505045075280 4 0 |
+set
+(
+94505045004800 1 0 
+primitive
+<
+94505045028768 4 0 -
+primitive
+<
+94505045028608 8 0 +
+primitive
+<
+94505045028448 8 0 +
+primitive
+<
+94505045028288 8 0 ^
+primitive
+<
+94505045026848 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045028128 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045027968 8 0 ^
+primitive
+<
+94505045027008 1 0 
+plane\point\0, 1, 0/, -145/
+>
+primitive
+<
+94505045027808 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045027648 8 0 ^
+primitive
+<
+94505045027168 1 0 
+plane\point\0, 0, 1/, -0/
+>
+primitive
+<
+94505045027488 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045027328 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505045075120 3 0 &
+set
+(
+94505045005120 1 1073741824 
+primitive
+<
+94505045030368 1 0 
+plane\point\0, 0, 1/, -25/
+>
+0
+0
+)
+set
+(
+94505045074960 2 0 &
+set
+(
+94505045005280 1 1073741824 
+primitive
+<
+94505045030528 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505045004960 1 0 
+primitive
+<
+94505045030208 3 0 -
+primitive
+<
+94505045030048 8 0 +
+primitive
+<
+94505045029888 8 0 ^
+primitive
+<
+94505045028928 1 0 
+plane\point\0, 1, 0/, -145/
+>
+primitive
+<
+94505045029728 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045029568 8 0 ^
+primitive
+<
+94505045029088 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045029408 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045029248 0 0 
+1
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045140624 -32
+user_attribute
+\
+94505045140416 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505045004480 23 0 |
+set
+(
+94505044998720 9 0 &
+set
+(
+94505044998400 4 0 |
+set
+(
+94505044997920 2 1073741824 &
+set
+(
+94505044997760 1 1073741824 
+primitive
+<
+94505045021248 1 0 
+plane\point\-0, -0, -1/, 10/
+>
+0
+0
+)
+set
+(
+94505044997600 1 1073741824 
+primitive
+<
+94505045021088 1 0 
+plane\point\0, 0, 1/, -10.2/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505044998240 2 1073741824 &
+set
+(
+94505044998080 1 1073741824 
+primitive
+<
+94505045021568 1 0 
+plane\point\-0, -0, -1/, 20/
+>
+0
+0
+)
+set
+(
+94505044997440 1 1073741824 
+primitive
+<
+94505045021408 1 0 
+plane\point\0, 0, 1/, -20.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045000000 5 1073741824 &
+set
+(
+94505044999840 1 1073741824 
+primitive
+<
+94505045022528 1 0 
+plane\point\0.309017, -0.951056, 0/, 117.362/
+>
+0
+0
+)
+set
+(
+94505044999680 4 1073741824 &
+set
+(
+94505044999520 1 1073741824 
+primitive
+<
+94505045022368 1 0 
+plane\point\-0.809017, -0.587785, 0/, 131.77/
+>
+0
+0
+)
+set
+(
+94505044999360 3 1073741824 &
+set
+(
+94505044999200 1 1073741824 
+primitive
+<
+94505045022208 1 0 
+plane\point\-0.809017, 0.587785, 0/, -38.6878/
+>
+0
+0
+)
+set
+(
+94505044999040 2 1073741824 &
+set
+(
+94505044998880 1 1073741824 
+primitive
+<
+94505045021888 1 0 
+plane\point\1, 0, 0/, -62/
+>
+0
+0
+)
+set
+(
+94505044998560 1 1073741824 
+primitive
+<
+94505045022048 1 0 
+plane\point\0.309017, 0.951057, 0/, -158.444/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045004320 14 0 &
+set
+(
+94505045004160 4 0 |
+set
+(
+94505045003680 2 1073741824 &
+set
+(
+94505045003520 1 1073741824 
+primitive
+<
+94505045024288 1 0 
+plane\point\-0, -0, -1/, 10.5/
+>
+0
+0
+)
+set
+(
+94505045003360 1 1073741824 
+primitive
+<
+94505045024128 1 0 
+plane\point\0, 0, 1/, -10.7/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505045004000 2 1073741824 &
+set
+(
+94505045003840 1 1073741824 
+primitive
+<
+94505045024608 1 0 
+plane\point\-0, -0, -1/, 20.5/
+>
+0
+0
+)
+set
+(
+94505045003200 1 1073741824 
+primitive
+<
+94505045024448 1 0 
+plane\point\0, 0, 1/, -20.7/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505045003040 10 0 &
+set
+(
+94505045000000 )
+set
+(
+94505045002880 5 0 |
+set
+(
+94505045002720 1 1073741824 
+primitive
+<
+94505045023968 1 0 
+plane\point\-0.309017, 0.951056, -0/, -117.562/
+>
+0
+1
+set
+(
+94505045001440 1 1073741824 
+primitive
+<
+94505045023328 1 0 
+plane\point\0.309017, -0.951056, 0/, 117.562/
+>
+0
+0
+)
+)
+set
+(
+94505045002560 4 0 |
+set
+(
+94505045002400 1 1073741824 
+primitive
+<
+94505045023808 1 0 
+plane\point\0.809017, 0.587785, -0/, -131.97/
+>
+0
+1
+set
+(
+94505045001120 1 1073741824 
+primitive
+<
+94505045023168 1 0 
+plane\point\-0.809017, -0.587785, 0/, 131.97/
+>
+0
+0
+)
+)
+set
+(
+94505045002240 3 0 |
+set
+(
+94505045002080 1 1073741824 
+primitive
+<
+94505045023648 1 0 
+plane\point\0.809017, -0.587785, -0/, 38.4878/
+>
+0
+1
+set
+(
+94505045000800 1 1073741824 
+primitive
+<
+94505045023008 1 0 
+plane\point\-0.809017, 0.587785, 0/, -38.4878/
+>
+0
+0
+)
+)
+set
+(
+94505045001920 2 0 |
+set
+(
+94505045001760 1 1073741824 
+primitive
+<
+94505045023488 1 0 
+plane\point\-1, -0, -0/, 61.8/
+>
+0
+1
+set
+(
+94505045000480 1 1073741824 
+primitive
+<
+94505045022688 1 0 
+plane\point\1, 0, 0/, -61.8/
+>
+0
+0
+)
+)
+set
+(
+94505045000320 1 1073741824 
+primitive
+<
+94505045021728 1 0 
+plane\point\-0.309017, -0.951057, -0/, 158.244/
+>
+0
+1
+set
+(
+94505045000160 1 1073741824 
+primitive
+<
+94505045022848 1 0 
+plane\point\0.309017, 0.951057, 0/, -158.244/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505045000640 2 1073741824 &
+set
+(
+94505045000480 )
+set
+(
+94505045000160 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045000960 3 1073741824 &
+set
+(
+94505045000800 )
+set
+(
+94505045000640 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045001280 4 1073741824 &
+set
+(
+94505045001120 )
+set
+(
+94505045000960 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505045001600 5 1073741824 &
+set
+(
+94505045001440 )
+set
+(
+94505045001280 )
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045074640 -32
+user_attribute
+\
+94505045074432 32
+surface
+\
+1
+point\0.1, 0.1, 0.1/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+set
+(
+94505044997120 983 0 |
+set
+(
+94505044996960 28 0 |
+set
+(
+94505044996800 5 0 |
+set
+(
+94505044995520 1 0 
+primitive
+<
+94505045017088 4 0 -
+primitive
+<
+94505045016928 8 0 +
+primitive
+<
+94505045016768 8 0 +
+primitive
+<
+94505045016608 8 0 ^
+primitive
+<
+94505045015168 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045016448 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045016288 8 0 ^
+primitive
+<
+94505045015328 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505045016128 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045015968 8 0 ^
+primitive
+<
+94505045015488 1 0 
+plane\point\0, 0, 1/, -25/
+>
+primitive
+<
+94505045015808 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045015648 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505044996640 4 0 |
+set
+(
+94505044995680 1 0 
+primitive
+<
+94505045019168 4 0 -
+primitive
+<
+94505045019008 8 0 +
+primitive
+<
+94505045018848 8 0 +
+primitive
+<
+94505045018688 8 0 ^
+primitive
+<
+94505045017248 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045018528 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045018368 8 0 ^
+primitive
+<
+94505045017408 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505045018208 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045018048 8 0 ^
+primitive
+<
+94505045017568 1 0 
+plane\point\0, 0, 1/, -0/
+>
+primitive
+<
+94505045017888 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045017728 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505044996480 3 0 &
+set
+(
+94505044996000 1 1073741824 
+primitive
+<
+94505045020768 1 0 
+plane\point\0, 0, 1/, -25/
+>
+0
+0
+)
+set
+(
+94505044996320 2 0 &
+set
+(
+94505044996160 1 1073741824 
+primitive
+<
+94505045020928 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044995840 1 0 
+primitive
+<
+94505045020608 3 0 -
+primitive
+<
+94505045020448 8 0 +
+primitive
+<
+94505045020288 8 0 ^
+primitive
+<
+94505045019328 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505045020128 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045019968 8 0 ^
+primitive
+<
+94505045019488 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045019808 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045019648 0 0 
+1
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045074304 -32
+user_attribute
+\
+94505045074096 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044995360 23 0 |
+set
+(
+94505044989600 9 0 &
+set
+(
+94505044989280 4 0 |
+set
+(
+94505044988800 2 1073741824 &
+set
+(
+94505044988640 1 1073741824 
+primitive
+<
+94505045011648 1 0 
+plane\point\-0, -0, -1/, 10/
+>
+0
+0
+)
+set
+(
+94505044988480 1 1073741824 
+primitive
+<
+94505045011488 1 0 
+plane\point\0, 0, 1/, -10.2/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505044989120 2 1073741824 &
+set
+(
+94505044988960 1 1073741824 
+primitive
+<
+94505045011968 1 0 
+plane\point\-0, -0, -1/, 20/
+>
+0
+0
+)
+set
+(
+94505044988320 1 1073741824 
+primitive
+<
+94505045011808 1 0 
+plane\point\0, 0, 1/, -20.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044990880 5 1073741824 &
+set
+(
+94505044990720 1 1073741824 
+primitive
+<
+94505045012928 1 0 
+plane\point\0.309017, -0.951056, 0/, 103.096/
+>
+0
+0
+)
+set
+(
+94505044990560 4 1073741824 &
+set
+(
+94505044990400 1 1073741824 
+primitive
+<
+94505045012768 1 0 
+plane\point\-0.809017, -0.587785, 0/, 122.953/
+>
+0
+0
+)
+set
+(
+94505044990240 3 1073741824 &
+set
+(
+94505044990080 1 1073741824 
+primitive
+<
+94505045012608 1 0 
+plane\point\-0.809017, 0.587785, 0/, -29.8711/
+>
+0
+0
+)
+set
+(
+94505044989920 2 1073741824 &
+set
+(
+94505044989760 1 1073741824 
+primitive
+<
+94505045012288 1 0 
+plane\point\1, 0, 0/, -62/
+>
+0
+0
+)
+set
+(
+94505044989440 1 1073741824 
+primitive
+<
+94505045012448 1 0 
+plane\point\0.309017, 0.951057, 0/, -144.178/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044995200 14 0 &
+set
+(
+94505044995040 4 0 |
+set
+(
+94505044994560 2 1073741824 &
+set
+(
+94505044994400 1 1073741824 
+primitive
+<
+94505045014688 1 0 
+plane\point\-0, -0, -1/, 10.5/
+>
+0
+0
+)
+set
+(
+94505044994240 1 1073741824 
+primitive
+<
+94505045014528 1 0 
+plane\point\0, 0, 1/, -10.7/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505044994880 2 1073741824 &
+set
+(
+94505044994720 1 1073741824 
+primitive
+<
+94505045015008 1 0 
+plane\point\-0, -0, -1/, 20.5/
+>
+0
+0
+)
+set
+(
+94505044994080 1 1073741824 
+primitive
+<
+94505045014848 1 0 
+plane\point\0, 0, 1/, -20.7/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044993920 10 0 &
+set
+(
+94505044990880 )
+set
+(
+94505044993760 5 0 |
+set
+(
+94505044993600 1 1073741824 
+primitive
+<
+94505045014368 1 0 
+plane\point\-0.309017, 0.951056, -0/, -103.296/
+>
+0
+1
+set
+(
+94505044992320 1 1073741824 
+primitive
+<
+94505045013728 1 0 
+plane\point\0.309017, -0.951056, 0/, 103.296/
+>
+0
+0
+)
+)
+set
+(
+94505044993440 4 0 |
+set
+(
+94505044993280 1 1073741824 
+primitive
+<
+94505045014208 1 0 
+plane\point\0.809017, 0.587785, -0/, -123.153/
+>
+0
+1
+set
+(
+94505044992000 1 1073741824 
+primitive
+<
+94505045013568 1 0 
+plane\point\-0.809017, -0.587785, 0/, 123.153/
+>
+0
+0
+)
+)
+set
+(
+94505044993120 3 0 |
+set
+(
+94505044992960 1 1073741824 
+primitive
+<
+94505045014048 1 0 
+plane\point\0.809017, -0.587785, -0/, 29.6711/
+>
+0
+1
+set
+(
+94505044991680 1 1073741824 
+primitive
+<
+94505045013408 1 0 
+plane\point\-0.809017, 0.587785, 0/, -29.6711/
+>
+0
+0
+)
+)
+set
+(
+94505044992800 2 0 |
+set
+(
+94505044992640 1 1073741824 
+primitive
+<
+94505045013888 1 0 
+plane\point\-1, -0, -0/, 61.8/
+>
+0
+1
+set
+(
+94505044991360 1 1073741824 
+primitive
+<
+94505045013088 1 0 
+plane\point\1, 0, 0/, -61.8/
+>
+0
+0
+)
+)
+set
+(
+94505044991200 1 1073741824 
+primitive
+<
+94505045012128 1 0 
+plane\point\-0.309017, -0.951057, -0/, 143.978/
+>
+0
+1
+set
+(
+94505044991040 1 1073741824 
+primitive
+<
+94505045013248 1 0 
+plane\point\0.309017, 0.951057, 0/, -143.978/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044991520 2 1073741824 &
+set
+(
+94505044991360 )
+set
+(
+94505044991040 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044991840 3 1073741824 &
+set
+(
+94505044991680 )
+set
+(
+94505044991520 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044992160 4 1073741824 &
+set
+(
+94505044992000 )
+set
+(
+94505044991840 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044992480 5 1073741824 &
+set
+(
+94505044992320 )
+set
+(
+94505044992160 )
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045073776 -32
+user_attribute
+\
+94505045073568 32
+surface
+\
+1
+point\0.1, 0.1, 0.1/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+set
+(
+94505044988000 955 0 |
+set
+(
+94505044987840 28 0 |
+set
+(
+94505044987680 5 0 |
+set
+(
+94505044986400 1 0 
+primitive
+<
+94505044939824 4 0 -
+primitive
+<
+94505044939664 8 0 +
+primitive
+<
+94505044939504 8 0 +
+primitive
+<
+94505044939344 8 0 ^
+primitive
+<
+94505044937904 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505044939184 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044939024 8 0 ^
+primitive
+<
+94505044938064 1 0 
+plane\point\0, 1, 0/, -115/
+>
+primitive
+<
+94505044938864 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044938704 8 0 ^
+primitive
+<
+94505044938224 1 0 
+plane\point\0, 0, 1/, -25/
+>
+primitive
+<
+94505044938544 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044938384 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505044987520 4 0 |
+set
+(
+94505044986560 1 0 
+primitive
+<
+94505045009568 4 0 -
+primitive
+<
+94505045009408 8 0 +
+primitive
+<
+94505045009248 8 0 +
+primitive
+<
+94505045009088 8 0 ^
+primitive
+<
+94505045007648 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045008928 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045008768 8 0 ^
+primitive
+<
+94505045007808 1 0 
+plane\point\0, 1, 0/, -115/
+>
+primitive
+<
+94505045008608 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045008448 8 0 ^
+primitive
+<
+94505045007968 1 0 
+plane\point\0, 0, 1/, -0/
+>
+primitive
+<
+94505045008288 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045008128 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505044987360 3 0 &
+set
+(
+94505044986880 1 1073741824 
+primitive
+<
+94505045011168 1 0 
+plane\point\0, 0, 1/, -25/
+>
+0
+0
+)
+set
+(
+94505044987200 2 0 &
+set
+(
+94505044987040 1 1073741824 
+primitive
+<
+94505045011328 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044986720 1 0 
+primitive
+<
+94505045011008 3 0 -
+primitive
+<
+94505045010848 8 0 +
+primitive
+<
+94505045010688 8 0 ^
+primitive
+<
+94505045009728 1 0 
+plane\point\0, 1, 0/, -115/
+>
+primitive
+<
+94505045010528 0 0 
+2
+>
+0
+>
+primitive
+<
+94505045010368 8 0 ^
+primitive
+<
+94505045009888 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505045010208 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505045010048 0 0 
+1
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045073440 -32
+user_attribute
+\
+94505045073232 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044986240 23 0 |
+set
+(
+94505044980480 9 0 &
+set
+(
+94505044980160 4 0 |
+set
+(
+94505044979680 2 1073741824 &
+set
+(
+94505044979520 1 1073741824 
+primitive
+<
+94505044934384 1 0 
+plane\point\-0, -0, -1/, 10/
+>
+0
+0
+)
+set
+(
+94505044979360 1 1073741824 
+primitive
+<
+94505044934224 1 0 
+plane\point\0, 0, 1/, -10.2/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505044980000 2 1073741824 &
+set
+(
+94505044979840 1 1073741824 
+primitive
+<
+94505044934704 1 0 
+plane\point\-0, -0, -1/, 20/
+>
+0
+0
+)
+set
+(
+94505044970240 1 1073741824 
+primitive
+<
+94505044934544 1 0 
+plane\point\0, 0, 1/, -20.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044981760 5 1073741824 &
+set
+(
+94505044981600 1 1073741824 
+primitive
+<
+94505044935664 1 0 
+plane\point\0.309017, -0.951056, 0/, 88.8305/
+>
+0
+0
+)
+set
+(
+94505044981440 4 1073741824 &
+set
+(
+94505044981280 1 1073741824 
+primitive
+<
+94505044935504 1 0 
+plane\point\-0.809017, -0.587785, 0/, 114.136/
+>
+0
+0
+)
+set
+(
+94505044981120 3 1073741824 &
+set
+(
+94505044980960 1 1073741824 
+primitive
+<
+94505044935344 1 0 
+plane\point\-0.809017, 0.587785, 0/, -21.0543/
+>
+0
+0
+)
+set
+(
+94505044980800 2 1073741824 &
+set
+(
+94505044980640 1 1073741824 
+primitive
+<
+94505044935024 1 0 
+plane\point\1, 0, 0/, -62/
+>
+0
+0
+)
+set
+(
+94505044980320 1 1073741824 
+primitive
+<
+94505044935184 1 0 
+plane\point\0.309017, 0.951057, 0/, -129.913/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044986080 14 0 &
+set
+(
+94505044985920 4 0 |
+set
+(
+94505044985440 2 1073741824 &
+set
+(
+94505044985280 1 1073741824 
+primitive
+<
+94505044937424 1 0 
+plane\point\-0, -0, -1/, 10.5/
+>
+0
+0
+)
+set
+(
+94505044985120 1 1073741824 
+primitive
+<
+94505044937264 1 0 
+plane\point\0, 0, 1/, -10.7/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505044985760 2 1073741824 &
+set
+(
+94505044985600 1 1073741824 
+primitive
+<
+94505044937744 1 0 
+plane\point\-0, -0, -1/, 20.5/
+>
+0
+0
+)
+set
+(
+94505044984960 1 1073741824 
+primitive
+<
+94505044937584 1 0 
+plane\point\0, 0, 1/, -20.7/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044984800 10 0 &
+set
+(
+94505044981760 )
+set
+(
+94505044984640 5 0 |
+set
+(
+94505044984480 1 1073741824 
+primitive
+<
+94505044937104 1 0 
+plane\point\-0.309017, 0.951056, -0/, -89.0305/
+>
+0
+1
+set
+(
+94505044983200 1 1073741824 
+primitive
+<
+94505044936464 1 0 
+plane\point\0.309017, -0.951056, 0/, 89.0305/
+>
+0
+0
+)
+)
+set
+(
+94505044984320 4 0 |
+set
+(
+94505044984160 1 1073741824 
+primitive
+<
+94505044936944 1 0 
+plane\point\0.809017, 0.587785, -0/, -114.336/
+>
+0
+1
+set
+(
+94505044982880 1 1073741824 
+primitive
+<
+94505044936304 1 0 
+plane\point\-0.809017, -0.587785, 0/, 114.336/
+>
+0
+0
+)
+)
+set
+(
+94505044984000 3 0 |
+set
+(
+94505044983840 1 1073741824 
+primitive
+<
+94505044936784 1 0 
+plane\point\0.809017, -0.587785, -0/, 20.8543/
+>
+0
+1
+set
+(
+94505044982560 1 1073741824 
+primitive
+<
+94505044936144 1 0 
+plane\point\-0.809017, 0.587785, 0/, -20.8543/
+>
+0
+0
+)
+)
+set
+(
+94505044983680 2 0 |
+set
+(
+94505044983520 1 1073741824 
+primitive
+<
+94505044936624 1 0 
+plane\point\-1, -0, -0/, 61.8/
+>
+0
+1
+set
+(
+94505044982240 1 1073741824 
+primitive
+<
+94505044935824 1 0 
+plane\point\1, 0, 0/, -61.8/
+>
+0
+0
+)
+)
+set
+(
+94505044982080 1 1073741824 
+primitive
+<
+94505044934864 1 0 
+plane\point\-0.309017, -0.951057, -0/, 129.713/
+>
+0
+1
+set
+(
+94505044981920 1 1073741824 
+primitive
+<
+94505044935984 1 0 
+plane\point\0.309017, 0.951057, 0/, -129.713/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044982400 2 1073741824 &
+set
+(
+94505044982240 )
+set
+(
+94505044981920 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044982720 3 1073741824 &
+set
+(
+94505044982560 )
+set
+(
+94505044982400 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044983040 4 1073741824 &
+set
+(
+94505044982880 )
+set
+(
+94505044982720 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044983360 5 1073741824 &
+set
+(
+94505044983200 )
+set
+(
+94505044983040 )
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045007456 -32
+user_attribute
+\
+94505045007248 32
+surface
+\
+1
+point\0.1, 0.1, 0.1/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+set
+(
+94505044979200 927 0 |
+set
+(
+94505044979040 28 0 |
+set
+(
+94505044978880 5 0 |
+set
+(
+94505044977600 1 0 
+primitive
+<
+94505044930224 4 0 -
+primitive
+<
+94505044930064 8 0 +
+primitive
+<
+94505044929904 8 0 +
+primitive
+<
+94505044929744 8 0 ^
+primitive
+<
+94505044928304 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505044929584 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044929424 8 0 ^
+primitive
+<
+94505044928464 1 0 
+plane\point\0, 1, 0/, -100/
+>
+primitive
+<
+94505044929264 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044929104 8 0 ^
+primitive
+<
+94505044928624 1 0 
+plane\point\0, 0, 1/, -25/
+>
+primitive
+<
+94505044928944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044928784 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505044978720 4 0 |
+set
+(
+94505044977760 1 0 
+primitive
+<
+94505044932304 4 0 -
+primitive
+<
+94505044932144 8 0 +
+primitive
+<
+94505044931984 8 0 +
+primitive
+<
+94505044931824 8 0 ^
+primitive
+<
+94505044930384 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505044931664 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044931504 8 0 ^
+primitive
+<
+94505044930544 1 0 
+plane\point\0, 1, 0/, -100/
+>
+primitive
+<
+94505044931344 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044931184 8 0 ^
+primitive
+<
+94505044930704 1 0 
+plane\point\0, 0, 1/, -0/
+>
+primitive
+<
+94505044931024 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044930864 0 0 
+1
+>
+0
+>
+0
+0
+)
+set
+(
+94505044978560 3 0 &
+set
+(
+94505044978080 1 1073741824 
+primitive
+<
+94505044933904 1 0 
+plane\point\0, 0, 1/, -25/
+>
+0
+0
+)
+set
+(
+94505044978400 2 0 &
+set
+(
+94505044978240 1 1073741824 
+primitive
+<
+94505044934064 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044977920 1 0 
+primitive
+<
+94505044933744 3 0 -
+primitive
+<
+94505044933584 8 0 +
+primitive
+<
+94505044933424 8 0 ^
+primitive
+<
+94505044932464 1 0 
+plane\point\0, 1, 0/, -100/
+>
+primitive
+<
+94505044933264 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044933104 8 0 ^
+primitive
+<
+94505044932624 1 0 
+plane\point\1, 0, 0/, -60/
+>
+primitive
+<
+94505044932944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044932784 0 0 
+1
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045007120 -32
+user_attribute
+\
+94505045006912 32
+surface
+\
+1
+point\0.4, 0.4, 0.5/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044977440 23 0 |
+set
+(
+94505044971680 9 0 &
+set
+(
+94505044971360 4 0 |
+set
+(
+94505044970880 2 1073741824 &
+set
+(
+94505044970720 1 1073741824 
+primitive
+<
+94505044924784 1 0 
+plane\point\-0, -0, -1/, 10/
+>
+0
+0
+)
+set
+(
+94505044970560 1 1073741824 
+primitive
+<
+94505044924624 1 0 
+plane\point\0, 0, 1/, -10.2/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505044971200 2 1073741824 &
+set
+(
+94505044971040 1 1073741824 
+primitive
+<
+94505044925104 1 0 
+plane\point\-0, -0, -1/, 20/
+>
+0
+0
+)
+set
+(
+94505044970400 1 1073741824 
+primitive
+<
+94505044924944 1 0 
+plane\point\0, 0, 1/, -20.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044972960 5 1073741824 &
+set
+(
+94505044972800 1 1073741824 
+primitive
+<
+94505044926064 1 0 
+plane\point\0.309017, -0.951056, 0/, 74.5646/
+>
+0
+0
+)
+set
+(
+94505044972640 4 1073741824 &
+set
+(
+94505044972480 1 1073741824 
+primitive
+<
+94505044925904 1 0 
+plane\point\-0.809017, -0.587785, 0/, 105.32/
+>
+0
+0
+)
+set
+(
+94505044972320 3 1073741824 &
+set
+(
+94505044972160 1 1073741824 
+primitive
+<
+94505044925744 1 0 
+plane\point\-0.809017, 0.587785, 0/, -12.2375/
+>
+0
+0
+)
+set
+(
+94505044972000 2 1073741824 &
+set
+(
+94505044971840 1 1073741824 
+primitive
+<
+94505044925424 1 0 
+plane\point\1, 0, 0/, -62/
+>
+0
+0
+)
+set
+(
+94505044971520 1 1073741824 
+primitive
+<
+94505044925584 1 0 
+plane\point\0.309017, 0.951057, 0/, -115.647/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044977280 14 0 &
+set
+(
+94505044977120 4 0 |
+set
+(
+94505044976640 2 1073741824 &
+set
+(
+94505044976480 1 1073741824 
+primitive
+<
+94505044927824 1 0 
+plane\point\-0, -0, -1/, 10.5/
+>
+0
+0
+)
+set
+(
+94505044976320 1 1073741824 
+primitive
+<
+94505044927664 1 0 
+plane\point\0, 0, 1/, -10.7/
+>
+0
+0
+)
+0
+0
+)
+set
+(
+94505044976960 2 1073741824 &
+set
+(
+94505044976800 1 1073741824 
+primitive
+<
+94505044928144 1 0 
+plane\point\-0, -0, -1/, 20.5/
+>
+0
+0
+)
+set
+(
+94505044976160 1 1073741824 
+primitive
+<
+94505044927984 1 0 
+plane\point\0, 0, 1/, -20.7/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044976000 10 0 &
+set
+(
+94505044972960 )
+set
+(
+94505044975840 5 0 |
+set
+(
+94505044975680 1 1073741824 
+primitive
+<
+94505044927504 1 0 
+plane\point\-0.309017, 0.951056, -0/, -74.7646/
+>
+0
+1
+set
+(
+94505044974400 1 1073741824 
+primitive
+<
+94505044926864 1 0 
+plane\point\0.309017, -0.951056, 0/, 74.7646/
+>
+0
+0
+)
+)
+set
+(
+94505044975520 4 0 |
+set
+(
+94505044975360 1 1073741824 
+primitive
+<
+94505044927344 1 0 
+plane\point\0.809017, 0.587785, -0/, -105.52/
+>
+0
+1
+set
+(
+94505044974080 1 1073741824 
+primitive
+<
+94505044926704 1 0 
+plane\point\-0.809017, -0.587785, 0/, 105.52/
+>
+0
+0
+)
+)
+set
+(
+94505044975200 3 0 |
+set
+(
+94505044975040 1 1073741824 
+primitive
+<
+94505044927184 1 0 
+plane\point\0.809017, -0.587785, -0/, 12.0375/
+>
+0
+1
+set
+(
+94505044973760 1 1073741824 
+primitive
+<
+94505044926544 1 0 
+plane\point\-0.809017, 0.587785, 0/, -12.0375/
+>
+0
+0
+)
+)
+set
+(
+94505044974880 2 0 |
+set
+(
+94505044974720 1 1073741824 
+primitive
+<
+94505044927024 1 0 
+plane\point\-1, -0, -0/, 61.8/
+>
+0
+1
+set
+(
+94505044973440 1 1073741824 
+primitive
+<
+94505044926224 1 0 
+plane\point\1, 0, 0/, -61.8/
+>
+0
+0
+)
+)
+set
+(
+94505044973280 1 1073741824 
+primitive
+<
+94505044925264 1 0 
+plane\point\-0.309017, -0.951057, -0/, 115.447/
+>
+0
+1
+set
+(
+94505044973120 1 1073741824 
+primitive
+<
+94505044926384 1 0 
+plane\point\0.309017, 0.951057, 0/, -115.447/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044973600 2 1073741824 &
+set
+(
+94505044973440 )
+set
+(
+94505044973120 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044973920 3 1073741824 &
+set
+(
+94505044973760 )
+set
+(
+94505044973600 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044974240 4 1073741824 &
+set
+(
+94505044974080 )
+set
+(
+94505044973920 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044974560 5 1073741824 &
+set
+(
+94505044974400 )
+set
+(
+94505044974240 )
+0
+0
+)
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045006592 -32
+user_attribute
+\
+94505045006384 32
+surface
+\
+1
+point\0.1, 0.1, 0.1/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+set
+(
+94505044969920 899 0 |
+set
+(
+94505044969760 12 0 |
+set
+(
+94505044969600 3 0 &
+set
+(
+94505044969120 1 1073741824 
+primitive
+<
+94505044924304 1 0 
+plane\point\1, 0, 0/, -138/
+>
+0
+0
+)
+set
+(
+94505044969440 2 0 &
+set
+(
+94505044969280 1 1073741824 
+primitive
+<
+94505044924464 1 0 
+plane\point\-1, -0, -0/, 122/
+>
+0
+0
+)
+set
+(
+94505044968960 1 0 
+primitive
+<
+94505044924144 3 0 -
+primitive
+<
+94505044923984 8 0 +
+primitive
+<
+94505044923824 8 0 ^
+primitive
+<
+94505044922864 1 0 
+plane\point\0, 0, 1/, -5/
+>
+primitive
+<
+94505044923664 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044923504 8 0 ^
+primitive
+<
+94505044923024 1 0 
+plane\point\0, 1, 0/, -158.75/
+>
+primitive
+<
+94505044923344 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044923184 0 0 
+16
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044968800 9 0 |
+set
+(
+94505044968640 3 0 &
+set
+(
+94505044968160 1 1073741824 
+primitive
+<
+94505044922544 1 0 
+plane\point\1, 0, 0/, -138/
+>
+0
+0
+)
+set
+(
+94505044968480 2 0 &
+set
+(
+94505044968320 1 1073741824 
+primitive
+<
+94505044922704 1 0 
+plane\point\-1, -0, -0/, 122/
+>
+0
+0
+)
+set
+(
+94505044968000 1 0 
+primitive
+<
+94505044922384 3 0 -
+primitive
+<
+94505044922224 8 0 +
+primitive
+<
+94505044922064 8 0 ^
+primitive
+<
+94505044921104 1 0 
+plane\point\0, 0, 1/, -5/
+>
+primitive
+<
+94505044921904 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044921744 8 0 ^
+primitive
+<
+94505044921264 1 0 
+plane\point\0, 1, 0/, -146.25/
+>
+primitive
+<
+94505044921584 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044921424 0 0 
+16
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044967840 6 0 |
+set
+(
+94505044967040 3 0 &
+set
+(
+94505044966560 1 1073741824 
+primitive
+<
+94505044919024 1 0 
+plane\point\1, 0, 0/, -118/
+>
+0
+0
+)
+set
+(
+94505044966880 2 0 &
+set
+(
+94505044966720 1 1073741824 
+primitive
+<
+94505044919184 1 0 
+plane\point\-1, -0, -0/, 102/
+>
+0
+0
+)
+set
+(
+94505044966400 1 0 
+primitive
+<
+94505044918864 3 0 -
+primitive
+<
+94505044918704 8 0 +
+primitive
+<
+94505044918544 8 0 ^
+primitive
+<
+94505044917584 1 0 
+plane\point\0, 0, 1/, -5/
+>
+primitive
+<
+94505044918384 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044918224 8 0 ^
+primitive
+<
+94505044917744 1 0 
+plane\point\0, 1, 0/, -146.25/
+>
+primitive
+<
+94505044918064 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044917904 0 0 
+16
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044967680 3 0 &
+set
+(
+94505044967200 1 1073741824 
+primitive
+<
+94505044920784 1 0 
+plane\point\1, 0, 0/, -118/
+>
+0
+0
+)
+set
+(
+94505044967520 2 0 &
+set
+(
+94505044967360 1 1073741824 
+primitive
+<
+94505044920944 1 0 
+plane\point\-1, -0, -0/, 102/
+>
+0
+0
+)
+set
+(
+94505044966240 1 0 
+primitive
+<
+94505044920624 3 0 -
+primitive
+<
+94505044920464 8 0 +
+primitive
+<
+94505044920304 8 0 ^
+primitive
+<
+94505044919344 1 0 
+plane\point\0, 0, 1/, -5/
+>
+primitive
+<
+94505044920144 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044919984 8 0 ^
+primitive
+<
+94505044919504 1 0 
+plane\point\0, 1, 0/, -158.75/
+>
+primitive
+<
+94505044919824 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044919664 0 0 
+16
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045006256 -32
+user_attribute
+\
+94505045006048 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044966080 887 0 |
+set
+(
+94505044965920 414 0 &
+set
+(
+94505044965440 1 1073741824 
+primitive
+<
+94505044917264 1 0 
+plane\point\0, 0, 1/, -9/
+>
+0
+0
+)
+set
+(
+94505044965760 413 0 &
+set
+(
+94505044965600 1 1073741824 
+primitive
+<
+94505044917424 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044965280 412 0 |
+set
+(
+94505044965120 6 1073741824 &
+set
+(
+94505044964160 3 1073741824 &
+set
+(
+94505044963520 1 1073741824 
+primitive
+<
+94505044916304 1 0 
+plane\point\-0, -0, -1/, -5/
+>
+0
+0
+)
+set
+(
+94505044964000 2 1073741824 &
+set
+(
+94505044963840 1 1073741824 
+primitive
+<
+94505044916624 1 0 
+plane\point\-1, -0, -0/, 100/
+>
+0
+0
+)
+set
+(
+94505044963680 1 1073741824 
+primitive
+<
+94505044916464 1 0 
+plane\point\-0, -1, -0/, 140/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044964960 3 1073741824 &
+set
+(
+94505044964320 1 1073741824 
+primitive
+<
+94505044916784 1 0 
+plane\point\0, 0, 1/, -0.0999999/
+>
+0
+0
+)
+set
+(
+94505044964800 2 1073741824 &
+set
+(
+94505044964640 1 1073741824 
+primitive
+<
+94505044917104 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044964480 1 1073741824 
+primitive
+<
+94505044916944 1 0 
+plane\point\0, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044963360 406 0 |
+set
+(
+94505044963200 6 1073741824 &
+set
+(
+94505044962240 3 1073741824 &
+set
+(
+94505044961600 1 1073741824 
+primitive
+<
+94505044603584 1 0 
+plane\point\-0, -0, -1/, 8/
+>
+0
+0
+)
+set
+(
+94505044962080 2 1073741824 &
+set
+(
+94505044961920 1 1073741824 
+primitive
+<
+94505044915664 1 0 
+plane\point\-1, -0, -0/, 100/
+>
+0
+0
+)
+set
+(
+94505044961760 1 1073741824 
+primitive
+<
+94505044915504 1 0 
+plane\point\-0, -1, -0/, 140/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044963040 3 1073741824 &
+set
+(
+94505044962400 1 1073741824 
+primitive
+<
+94505044915824 1 0 
+plane\point\0, 0, 1/, -8.1/
+>
+0
+0
+)
+set
+(
+94505044962880 2 1073741824 &
+set
+(
+94505044962720 1 1073741824 
+primitive
+<
+94505044916144 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044962560 1 1073741824 
+primitive
+<
+94505044915984 1 0 
+plane\point\0, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044960480 400 0 |
+set
+(
+94505044961440 4 1073741824 &
+set
+(
+94505044961280 1 1073741824 
+primitive
+<
+94505044915344 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044961120 3 1073741824 &
+set
+(
+94505044960960 1 1073741824 
+primitive
+<
+94505044915184 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044960800 2 1073741824 &
+set
+(
+94505044960640 1 1073741824 
+primitive
+<
+94505044914864 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044960320 1 1073741824 
+primitive
+<
+94505044915024 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044959200 396 0 |
+set
+(
+94505044960160 4 1073741824 &
+set
+(
+94505044960000 1 1073741824 
+primitive
+<
+94505044914704 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044959840 3 1073741824 &
+set
+(
+94505044959680 1 1073741824 
+primitive
+<
+94505044914544 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044959520 2 1073741824 &
+set
+(
+94505044959360 1 1073741824 
+primitive
+<
+94505044914224 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044959040 1 1073741824 
+primitive
+<
+94505044914384 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044957920 392 0 |
+set
+(
+94505044958880 4 1073741824 &
+set
+(
+94505044958720 1 1073741824 
+primitive
+<
+94505044914064 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044958560 3 1073741824 &
+set
+(
+94505044958400 1 1073741824 
+primitive
+<
+94505044913904 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044958240 2 1073741824 &
+set
+(
+94505044958080 1 1073741824 
+primitive
+<
+94505044913584 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044957760 1 1073741824 
+primitive
+<
+94505044913744 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044956640 388 0 |
+set
+(
+94505044957600 4 1073741824 &
+set
+(
+94505044957440 1 1073741824 
+primitive
+<
+94505044913424 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044957280 3 1073741824 &
+set
+(
+94505044957120 1 1073741824 
+primitive
+<
+94505044913264 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044956960 2 1073741824 &
+set
+(
+94505044956800 1 1073741824 
+primitive
+<
+94505044912944 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044956480 1 1073741824 
+primitive
+<
+94505044913104 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044955360 384 0 |
+set
+(
+94505044956320 4 1073741824 &
+set
+(
+94505044956160 1 1073741824 
+primitive
+<
+94505044912784 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044956000 3 1073741824 &
+set
+(
+94505044955840 1 1073741824 
+primitive
+<
+94505044912624 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044955680 2 1073741824 &
+set
+(
+94505044955520 1 1073741824 
+primitive
+<
+94505044912304 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044955200 1 1073741824 
+primitive
+<
+94505044912464 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044954080 380 0 |
+set
+(
+94505044955040 4 1073741824 &
+set
+(
+94505044954880 1 1073741824 
+primitive
+<
+94505044912144 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044954720 3 1073741824 &
+set
+(
+94505044954560 1 1073741824 
+primitive
+<
+94505044911984 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044954400 2 1073741824 &
+set
+(
+94505044954240 1 1073741824 
+primitive
+<
+94505044911664 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044953920 1 1073741824 
+primitive
+<
+94505044911824 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044952800 376 0 |
+set
+(
+94505044953760 4 1073741824 &
+set
+(
+94505044953600 1 1073741824 
+primitive
+<
+94505044911504 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044953440 3 1073741824 &
+set
+(
+94505044953280 1 1073741824 
+primitive
+<
+94505044911344 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044953120 2 1073741824 &
+set
+(
+94505044952960 1 1073741824 
+primitive
+<
+94505044911024 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044952640 1 1073741824 
+primitive
+<
+94505044911184 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044951520 372 0 |
+set
+(
+94505044952480 4 1073741824 &
+set
+(
+94505044952320 1 1073741824 
+primitive
+<
+94505044910864 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044952160 3 1073741824 &
+set
+(
+94505044952000 1 1073741824 
+primitive
+<
+94505044910704 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044951840 2 1073741824 &
+set
+(
+94505044951680 1 1073741824 
+primitive
+<
+94505044910384 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044951360 1 1073741824 
+primitive
+<
+94505044910544 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044950240 368 0 |
+set
+(
+94505044951200 4 1073741824 &
+set
+(
+94505044951040 1 1073741824 
+primitive
+<
+94505044910224 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044950880 3 1073741824 &
+set
+(
+94505044950720 1 1073741824 
+primitive
+<
+94505044910064 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044950560 2 1073741824 &
+set
+(
+94505044950400 1 1073741824 
+primitive
+<
+94505044909744 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044950080 1 1073741824 
+primitive
+<
+94505044909904 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044948960 364 0 |
+set
+(
+94505044949920 4 1073741824 &
+set
+(
+94505044949760 1 1073741824 
+primitive
+<
+94505044909584 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044949600 3 1073741824 &
+set
+(
+94505044949440 1 1073741824 
+primitive
+<
+94505044909424 1 0 
+plane\point\-1, -8.74228e-08, 0/, 139.8/
+>
+0
+0
+)
+set
+(
+94505044949280 2 1073741824 &
+set
+(
+94505044949120 1 1073741824 
+primitive
+<
+94505044909104 1 0 
+plane\point\1, 0, 0/, -140/
+>
+0
+0
+)
+set
+(
+94505044948800 1 1073741824 
+primitive
+<
+94505044909264 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044947680 360 0 |
+set
+(
+94505044948640 4 1073741824 &
+set
+(
+94505044948480 1 1073741824 
+primitive
+<
+94505044908944 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044948320 3 1073741824 &
+set
+(
+94505044948160 1 1073741824 
+primitive
+<
+94505044908784 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044948000 2 1073741824 &
+set
+(
+94505044947840 1 1073741824 
+primitive
+<
+94505044908464 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044947520 1 1073741824 
+primitive
+<
+94505044908624 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044946400 356 0 |
+set
+(
+94505044947360 4 1073741824 &
+set
+(
+94505044947200 1 1073741824 
+primitive
+<
+94505044908304 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044947040 3 1073741824 &
+set
+(
+94505044946880 1 1073741824 
+primitive
+<
+94505044908144 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044946720 2 1073741824 &
+set
+(
+94505044946560 1 1073741824 
+primitive
+<
+94505044907824 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044946240 1 1073741824 
+primitive
+<
+94505044907984 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044945120 352 0 |
+set
+(
+94505044946080 4 1073741824 &
+set
+(
+94505044945920 1 1073741824 
+primitive
+<
+94505044907664 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044945760 3 1073741824 &
+set
+(
+94505044945600 1 1073741824 
+primitive
+<
+94505044907504 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044945440 2 1073741824 &
+set
+(
+94505044945280 1 1073741824 
+primitive
+<
+94505044907184 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044944960 1 1073741824 
+primitive
+<
+94505044907344 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044943840 348 0 |
+set
+(
+94505044944800 4 1073741824 &
+set
+(
+94505044944640 1 1073741824 
+primitive
+<
+94505044907024 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044944480 3 1073741824 &
+set
+(
+94505044944320 1 1073741824 
+primitive
+<
+94505044906864 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044944160 2 1073741824 &
+set
+(
+94505044944000 1 1073741824 
+primitive
+<
+94505044906544 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044943680 1 1073741824 
+primitive
+<
+94505044906704 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044942560 344 0 |
+set
+(
+94505044943520 4 1073741824 &
+set
+(
+94505044943360 1 1073741824 
+primitive
+<
+94505044906384 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044943200 3 1073741824 &
+set
+(
+94505044943040 1 1073741824 
+primitive
+<
+94505044906224 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044942880 2 1073741824 &
+set
+(
+94505044942720 1 1073741824 
+primitive
+<
+94505044905904 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044942400 1 1073741824 
+primitive
+<
+94505044906064 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044941280 340 0 |
+set
+(
+94505044942240 4 1073741824 &
+set
+(
+94505044942080 1 1073741824 
+primitive
+<
+94505044905744 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044941920 3 1073741824 &
+set
+(
+94505044941760 1 1073741824 
+primitive
+<
+94505044905584 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044941600 2 1073741824 &
+set
+(
+94505044941440 1 1073741824 
+primitive
+<
+94505044905264 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044941120 1 1073741824 
+primitive
+<
+94505044905424 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044940000 336 0 |
+set
+(
+94505044940960 4 1073741824 &
+set
+(
+94505044940800 1 1073741824 
+primitive
+<
+94505044905104 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044940640 3 1073741824 &
+set
+(
+94505044940480 1 1073741824 
+primitive
+<
+94505044904944 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044940320 2 1073741824 &
+set
+(
+94505044940160 1 1073741824 
+primitive
+<
+94505044904624 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044874368 1 1073741824 
+primitive
+<
+94505044904784 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044873248 332 0 |
+set
+(
+94505044874208 4 1073741824 &
+set
+(
+94505044874048 1 1073741824 
+primitive
+<
+94505044904464 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044873888 3 1073741824 &
+set
+(
+94505044873728 1 1073741824 
+primitive
+<
+94505044904304 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044873568 2 1073741824 &
+set
+(
+94505044873408 1 1073741824 
+primitive
+<
+94505044903984 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044873088 1 1073741824 
+primitive
+<
+94505044904144 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044871968 328 0 |
+set
+(
+94505044872928 4 1073741824 &
+set
+(
+94505044872768 1 1073741824 
+primitive
+<
+94505044903824 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044872608 3 1073741824 &
+set
+(
+94505044872448 1 1073741824 
+primitive
+<
+94505044903664 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044872288 2 1073741824 &
+set
+(
+94505044872128 1 1073741824 
+primitive
+<
+94505044903344 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044871808 1 1073741824 
+primitive
+<
+94505044903504 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044870688 324 0 |
+set
+(
+94505044871648 4 1073741824 &
+set
+(
+94505044871488 1 1073741824 
+primitive
+<
+94505044903184 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044871328 3 1073741824 &
+set
+(
+94505044871168 1 1073741824 
+primitive
+<
+94505044903024 1 0 
+plane\point\-1, -8.74228e-08, 0/, 135.378/
+>
+0
+0
+)
+set
+(
+94505044871008 2 1073741824 &
+set
+(
+94505044870848 1 1073741824 
+primitive
+<
+94505044902704 1 0 
+plane\point\1, 0, 0/, -135.578/
+>
+0
+0
+)
+set
+(
+94505044870528 1 1073741824 
+primitive
+<
+94505044902864 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044869408 320 0 |
+set
+(
+94505044870368 4 1073741824 &
+set
+(
+94505044870208 1 1073741824 
+primitive
+<
+94505044902544 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044870048 3 1073741824 &
+set
+(
+94505044869888 1 1073741824 
+primitive
+<
+94505044902384 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044869728 2 1073741824 &
+set
+(
+94505044869568 1 1073741824 
+primitive
+<
+94505044902064 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044869248 1 1073741824 
+primitive
+<
+94505044902224 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044868128 316 0 |
+set
+(
+94505044869088 4 1073741824 &
+set
+(
+94505044868928 1 1073741824 
+primitive
+<
+94505044901904 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044868768 3 1073741824 &
+set
+(
+94505044868608 1 1073741824 
+primitive
+<
+94505044901744 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044868448 2 1073741824 &
+set
+(
+94505044868288 1 1073741824 
+primitive
+<
+94505044901424 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044867968 1 1073741824 
+primitive
+<
+94505044901584 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044866848 312 0 |
+set
+(
+94505044867808 4 1073741824 &
+set
+(
+94505044867648 1 1073741824 
+primitive
+<
+94505044901264 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044867488 3 1073741824 &
+set
+(
+94505044867328 1 1073741824 
+primitive
+<
+94505044901104 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044867168 2 1073741824 &
+set
+(
+94505044867008 1 1073741824 
+primitive
+<
+94505044900784 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044866688 1 1073741824 
+primitive
+<
+94505044900944 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044865568 308 0 |
+set
+(
+94505044866528 4 1073741824 &
+set
+(
+94505044866368 1 1073741824 
+primitive
+<
+94505044900624 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044866208 3 1073741824 &
+set
+(
+94505044866048 1 1073741824 
+primitive
+<
+94505044900464 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044865888 2 1073741824 &
+set
+(
+94505044865728 1 1073741824 
+primitive
+<
+94505044900144 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044865408 1 1073741824 
+primitive
+<
+94505044900304 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044864288 304 0 |
+set
+(
+94505044865248 4 1073741824 &
+set
+(
+94505044865088 1 1073741824 
+primitive
+<
+94505044899984 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044864928 3 1073741824 &
+set
+(
+94505044864768 1 1073741824 
+primitive
+<
+94505044899824 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044864608 2 1073741824 &
+set
+(
+94505044864448 1 1073741824 
+primitive
+<
+94505044899504 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044864128 1 1073741824 
+primitive
+<
+94505044899664 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044863008 300 0 |
+set
+(
+94505044863968 4 1073741824 &
+set
+(
+94505044863808 1 1073741824 
+primitive
+<
+94505044899344 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044863648 3 1073741824 &
+set
+(
+94505044863488 1 1073741824 
+primitive
+<
+94505044899184 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044863328 2 1073741824 &
+set
+(
+94505044863168 1 1073741824 
+primitive
+<
+94505044898864 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044862848 1 1073741824 
+primitive
+<
+94505044899024 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044861728 296 0 |
+set
+(
+94505044862688 4 1073741824 &
+set
+(
+94505044862528 1 1073741824 
+primitive
+<
+94505044898704 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044862368 3 1073741824 &
+set
+(
+94505044862208 1 1073741824 
+primitive
+<
+94505044898544 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044862048 2 1073741824 &
+set
+(
+94505044861888 1 1073741824 
+primitive
+<
+94505044898224 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044861568 1 1073741824 
+primitive
+<
+94505044898384 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044860448 292 0 |
+set
+(
+94505044861408 4 1073741824 &
+set
+(
+94505044861248 1 1073741824 
+primitive
+<
+94505044898064 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044861088 3 1073741824 &
+set
+(
+94505044860928 1 1073741824 
+primitive
+<
+94505044897904 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044860768 2 1073741824 &
+set
+(
+94505044860608 1 1073741824 
+primitive
+<
+94505044897584 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044860288 1 1073741824 
+primitive
+<
+94505044897744 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044859168 288 0 |
+set
+(
+94505044860128 4 1073741824 &
+set
+(
+94505044859968 1 1073741824 
+primitive
+<
+94505044897424 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044859808 3 1073741824 &
+set
+(
+94505044859648 1 1073741824 
+primitive
+<
+94505044897264 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044859488 2 1073741824 &
+set
+(
+94505044859328 1 1073741824 
+primitive
+<
+94505044896944 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044859008 1 1073741824 
+primitive
+<
+94505044897104 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044857888 284 0 |
+set
+(
+94505044858848 4 1073741824 &
+set
+(
+94505044858688 1 1073741824 
+primitive
+<
+94505044896784 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044858528 3 1073741824 &
+set
+(
+94505044858368 1 1073741824 
+primitive
+<
+94505044896624 1 0 
+plane\point\-1, -8.74228e-08, 0/, 130.956/
+>
+0
+0
+)
+set
+(
+94505044858208 2 1073741824 &
+set
+(
+94505044858048 1 1073741824 
+primitive
+<
+94505044896304 1 0 
+plane\point\1, 0, 0/, -131.156/
+>
+0
+0
+)
+set
+(
+94505044857728 1 1073741824 
+primitive
+<
+94505044896464 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044856608 280 0 |
+set
+(
+94505044857568 4 1073741824 &
+set
+(
+94505044857408 1 1073741824 
+primitive
+<
+94505044896144 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044857248 3 1073741824 &
+set
+(
+94505044857088 1 1073741824 
+primitive
+<
+94505044895984 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044856928 2 1073741824 &
+set
+(
+94505044856768 1 1073741824 
+primitive
+<
+94505044895664 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044856448 1 1073741824 
+primitive
+<
+94505044895824 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044855328 276 0 |
+set
+(
+94505044856288 4 1073741824 &
+set
+(
+94505044856128 1 1073741824 
+primitive
+<
+94505044895504 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044855968 3 1073741824 &
+set
+(
+94505044855808 1 1073741824 
+primitive
+<
+94505044895344 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044855648 2 1073741824 &
+set
+(
+94505044855488 1 1073741824 
+primitive
+<
+94505044895024 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044855168 1 1073741824 
+primitive
+<
+94505044895184 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044854048 272 0 |
+set
+(
+94505044855008 4 1073741824 &
+set
+(
+94505044854848 1 1073741824 
+primitive
+<
+94505044894864 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044854688 3 1073741824 &
+set
+(
+94505044854528 1 1073741824 
+primitive
+<
+94505044894704 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044854368 2 1073741824 &
+set
+(
+94505044854208 1 1073741824 
+primitive
+<
+94505044894384 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044853888 1 1073741824 
+primitive
+<
+94505044894544 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044852768 268 0 |
+set
+(
+94505044853728 4 1073741824 &
+set
+(
+94505044853568 1 1073741824 
+primitive
+<
+94505044894224 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044853408 3 1073741824 &
+set
+(
+94505044853248 1 1073741824 
+primitive
+<
+94505044894064 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044853088 2 1073741824 &
+set
+(
+94505044852928 1 1073741824 
+primitive
+<
+94505044893744 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044852608 1 1073741824 
+primitive
+<
+94505044893904 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044851488 264 0 |
+set
+(
+94505044852448 4 1073741824 &
+set
+(
+94505044852288 1 1073741824 
+primitive
+<
+94505044893584 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044852128 3 1073741824 &
+set
+(
+94505044851968 1 1073741824 
+primitive
+<
+94505044893424 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044851808 2 1073741824 &
+set
+(
+94505044851648 1 1073741824 
+primitive
+<
+94505044893104 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044851328 1 1073741824 
+primitive
+<
+94505044893264 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044850208 260 0 |
+set
+(
+94505044851168 4 1073741824 &
+set
+(
+94505044851008 1 1073741824 
+primitive
+<
+94505044892944 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044850848 3 1073741824 &
+set
+(
+94505044850688 1 1073741824 
+primitive
+<
+94505044892784 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044850528 2 1073741824 &
+set
+(
+94505044850368 1 1073741824 
+primitive
+<
+94505044892464 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044850048 1 1073741824 
+primitive
+<
+94505044892624 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044848928 256 0 |
+set
+(
+94505044849888 4 1073741824 &
+set
+(
+94505044849728 1 1073741824 
+primitive
+<
+94505044892304 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044849568 3 1073741824 &
+set
+(
+94505044849408 1 1073741824 
+primitive
+<
+94505044892144 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044849248 2 1073741824 &
+set
+(
+94505044849088 1 1073741824 
+primitive
+<
+94505044891824 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044848768 1 1073741824 
+primitive
+<
+94505044891984 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044847648 252 0 |
+set
+(
+94505044848608 4 1073741824 &
+set
+(
+94505044848448 1 1073741824 
+primitive
+<
+94505044891664 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044848288 3 1073741824 &
+set
+(
+94505044848128 1 1073741824 
+primitive
+<
+94505044891504 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044847968 2 1073741824 &
+set
+(
+94505044847808 1 1073741824 
+primitive
+<
+94505044891184 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044847488 1 1073741824 
+primitive
+<
+94505044891344 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044846368 248 0 |
+set
+(
+94505044847328 4 1073741824 &
+set
+(
+94505044847168 1 1073741824 
+primitive
+<
+94505044891024 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044847008 3 1073741824 &
+set
+(
+94505044846848 1 1073741824 
+primitive
+<
+94505044890864 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044846688 2 1073741824 &
+set
+(
+94505044846528 1 1073741824 
+primitive
+<
+94505044890544 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044846208 1 1073741824 
+primitive
+<
+94505044890704 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044845088 244 0 |
+set
+(
+94505044846048 4 1073741824 &
+set
+(
+94505044845888 1 1073741824 
+primitive
+<
+94505044890384 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044845728 3 1073741824 &
+set
+(
+94505044845568 1 1073741824 
+primitive
+<
+94505044890224 1 0 
+plane\point\-1, -8.74228e-08, 0/, 126.533/
+>
+0
+0
+)
+set
+(
+94505044845408 2 1073741824 &
+set
+(
+94505044845248 1 1073741824 
+primitive
+<
+94505044889904 1 0 
+plane\point\1, 0, 0/, -126.733/
+>
+0
+0
+)
+set
+(
+94505044844928 1 1073741824 
+primitive
+<
+94505044890064 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044843808 240 0 |
+set
+(
+94505044844768 4 1073741824 &
+set
+(
+94505044844608 1 1073741824 
+primitive
+<
+94505044889744 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044844448 3 1073741824 &
+set
+(
+94505044844288 1 1073741824 
+primitive
+<
+94505044889584 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044844128 2 1073741824 &
+set
+(
+94505044843968 1 1073741824 
+primitive
+<
+94505044889264 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044843648 1 1073741824 
+primitive
+<
+94505044889424 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044842528 236 0 |
+set
+(
+94505044843488 4 1073741824 &
+set
+(
+94505044843328 1 1073741824 
+primitive
+<
+94505044889104 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044843168 3 1073741824 &
+set
+(
+94505044843008 1 1073741824 
+primitive
+<
+94505044888944 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044842848 2 1073741824 &
+set
+(
+94505044842688 1 1073741824 
+primitive
+<
+94505044888624 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044842368 1 1073741824 
+primitive
+<
+94505044888784 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044841248 232 0 |
+set
+(
+94505044842208 4 1073741824 &
+set
+(
+94505044842048 1 1073741824 
+primitive
+<
+94505044888464 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044841888 3 1073741824 &
+set
+(
+94505044841728 1 1073741824 
+primitive
+<
+94505044888304 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044841568 2 1073741824 &
+set
+(
+94505044841408 1 1073741824 
+primitive
+<
+94505044887984 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044841088 1 1073741824 
+primitive
+<
+94505044888144 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044839968 228 0 |
+set
+(
+94505044840928 4 1073741824 &
+set
+(
+94505044840768 1 1073741824 
+primitive
+<
+94505044887824 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044840608 3 1073741824 &
+set
+(
+94505044840448 1 1073741824 
+primitive
+<
+94505044887664 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044840288 2 1073741824 &
+set
+(
+94505044840128 1 1073741824 
+primitive
+<
+94505044887344 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044839808 1 1073741824 
+primitive
+<
+94505044887504 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044838688 224 0 |
+set
+(
+94505044839648 4 1073741824 &
+set
+(
+94505044839488 1 1073741824 
+primitive
+<
+94505044887184 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044839328 3 1073741824 &
+set
+(
+94505044839168 1 1073741824 
+primitive
+<
+94505044887024 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044839008 2 1073741824 &
+set
+(
+94505044838848 1 1073741824 
+primitive
+<
+94505044886704 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044838528 1 1073741824 
+primitive
+<
+94505044886864 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044837408 220 0 |
+set
+(
+94505044838368 4 1073741824 &
+set
+(
+94505044838208 1 1073741824 
+primitive
+<
+94505044886544 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044838048 3 1073741824 &
+set
+(
+94505044837888 1 1073741824 
+primitive
+<
+94505044886384 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044837728 2 1073741824 &
+set
+(
+94505044837568 1 1073741824 
+primitive
+<
+94505044886064 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044837248 1 1073741824 
+primitive
+<
+94505044886224 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044836128 216 0 |
+set
+(
+94505044837088 4 1073741824 &
+set
+(
+94505044836928 1 1073741824 
+primitive
+<
+94505044885904 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044836768 3 1073741824 &
+set
+(
+94505044836608 1 1073741824 
+primitive
+<
+94505044885744 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044836448 2 1073741824 &
+set
+(
+94505044836288 1 1073741824 
+primitive
+<
+94505044885424 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044835968 1 1073741824 
+primitive
+<
+94505044885584 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044834848 212 0 |
+set
+(
+94505044835808 4 1073741824 &
+set
+(
+94505044835648 1 1073741824 
+primitive
+<
+94505044885264 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044835488 3 1073741824 &
+set
+(
+94505044835328 1 1073741824 
+primitive
+<
+94505044885104 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044835168 2 1073741824 &
+set
+(
+94505044835008 1 1073741824 
+primitive
+<
+94505044884784 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044834688 1 1073741824 
+primitive
+<
+94505044884944 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044833568 208 0 |
+set
+(
+94505044834528 4 1073741824 &
+set
+(
+94505044834368 1 1073741824 
+primitive
+<
+94505044884624 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044834208 3 1073741824 &
+set
+(
+94505044834048 1 1073741824 
+primitive
+<
+94505044884464 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044833888 2 1073741824 &
+set
+(
+94505044833728 1 1073741824 
+primitive
+<
+94505044884144 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044833408 1 1073741824 
+primitive
+<
+94505044884304 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044832288 204 0 |
+set
+(
+94505044833248 4 1073741824 &
+set
+(
+94505044833088 1 1073741824 
+primitive
+<
+94505044883984 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044832928 3 1073741824 &
+set
+(
+94505044832768 1 1073741824 
+primitive
+<
+94505044883824 1 0 
+plane\point\-1, -8.74228e-08, 0/, 122.111/
+>
+0
+0
+)
+set
+(
+94505044832608 2 1073741824 &
+set
+(
+94505044832448 1 1073741824 
+primitive
+<
+94505044883504 1 0 
+plane\point\1, 0, 0/, -122.311/
+>
+0
+0
+)
+set
+(
+94505044832128 1 1073741824 
+primitive
+<
+94505044883664 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044831008 200 0 |
+set
+(
+94505044831968 4 1073741824 &
+set
+(
+94505044831808 1 1073741824 
+primitive
+<
+94505044883344 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044831648 3 1073741824 &
+set
+(
+94505044831488 1 1073741824 
+primitive
+<
+94505044883184 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044831328 2 1073741824 &
+set
+(
+94505044831168 1 1073741824 
+primitive
+<
+94505044882864 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044830848 1 1073741824 
+primitive
+<
+94505044883024 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044829728 196 0 |
+set
+(
+94505044830688 4 1073741824 &
+set
+(
+94505044830528 1 1073741824 
+primitive
+<
+94505044882704 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044830368 3 1073741824 &
+set
+(
+94505044830208 1 1073741824 
+primitive
+<
+94505044882544 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044830048 2 1073741824 &
+set
+(
+94505044829888 1 1073741824 
+primitive
+<
+94505044882224 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044829568 1 1073741824 
+primitive
+<
+94505044882384 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044828448 192 0 |
+set
+(
+94505044829408 4 1073741824 &
+set
+(
+94505044829248 1 1073741824 
+primitive
+<
+94505044882064 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044829088 3 1073741824 &
+set
+(
+94505044828928 1 1073741824 
+primitive
+<
+94505044881904 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044828768 2 1073741824 &
+set
+(
+94505044828608 1 1073741824 
+primitive
+<
+94505044881584 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044828288 1 1073741824 
+primitive
+<
+94505044881744 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044827168 188 0 |
+set
+(
+94505044828128 4 1073741824 &
+set
+(
+94505044827968 1 1073741824 
+primitive
+<
+94505044881424 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044827808 3 1073741824 &
+set
+(
+94505044827648 1 1073741824 
+primitive
+<
+94505044881264 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044827488 2 1073741824 &
+set
+(
+94505044827328 1 1073741824 
+primitive
+<
+94505044880944 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044827008 1 1073741824 
+primitive
+<
+94505044881104 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044825888 184 0 |
+set
+(
+94505044826848 4 1073741824 &
+set
+(
+94505044826688 1 1073741824 
+primitive
+<
+94505044880784 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044826528 3 1073741824 &
+set
+(
+94505044826368 1 1073741824 
+primitive
+<
+94505044880624 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044826208 2 1073741824 &
+set
+(
+94505044826048 1 1073741824 
+primitive
+<
+94505044880304 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044825728 1 1073741824 
+primitive
+<
+94505044880464 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044824608 180 0 |
+set
+(
+94505044825568 4 1073741824 &
+set
+(
+94505044825408 1 1073741824 
+primitive
+<
+94505044880144 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044825248 3 1073741824 &
+set
+(
+94505044825088 1 1073741824 
+primitive
+<
+94505044879984 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044824928 2 1073741824 &
+set
+(
+94505044824768 1 1073741824 
+primitive
+<
+94505044879664 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044824448 1 1073741824 
+primitive
+<
+94505044879824 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044823328 176 0 |
+set
+(
+94505044824288 4 1073741824 &
+set
+(
+94505044824128 1 1073741824 
+primitive
+<
+94505044879504 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044823968 3 1073741824 &
+set
+(
+94505044823808 1 1073741824 
+primitive
+<
+94505044879344 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044823648 2 1073741824 &
+set
+(
+94505044823488 1 1073741824 
+primitive
+<
+94505044879024 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044823168 1 1073741824 
+primitive
+<
+94505044879184 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044822048 172 0 |
+set
+(
+94505044823008 4 1073741824 &
+set
+(
+94505044822848 1 1073741824 
+primitive
+<
+94505044878864 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044822688 3 1073741824 &
+set
+(
+94505044822528 1 1073741824 
+primitive
+<
+94505044878704 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044822368 2 1073741824 &
+set
+(
+94505044822208 1 1073741824 
+primitive
+<
+94505044878384 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044821888 1 1073741824 
+primitive
+<
+94505044878544 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044820768 168 0 |
+set
+(
+94505044821728 4 1073741824 &
+set
+(
+94505044821568 1 1073741824 
+primitive
+<
+94505044878224 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044821408 3 1073741824 &
+set
+(
+94505044821248 1 1073741824 
+primitive
+<
+94505044878064 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044821088 2 1073741824 &
+set
+(
+94505044820928 1 1073741824 
+primitive
+<
+94505044877744 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044820608 1 1073741824 
+primitive
+<
+94505044877904 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044819488 164 0 |
+set
+(
+94505044820448 4 1073741824 &
+set
+(
+94505044820288 1 1073741824 
+primitive
+<
+94505044877584 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044820128 3 1073741824 &
+set
+(
+94505044819968 1 1073741824 
+primitive
+<
+94505044877424 1 0 
+plane\point\-1, -8.74228e-08, 0/, 117.689/
+>
+0
+0
+)
+set
+(
+94505044819808 2 1073741824 &
+set
+(
+94505044819648 1 1073741824 
+primitive
+<
+94505044877104 1 0 
+plane\point\1, 0, 0/, -117.889/
+>
+0
+0
+)
+set
+(
+94505044819328 1 1073741824 
+primitive
+<
+94505044877264 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044818208 160 0 |
+set
+(
+94505044819168 4 1073741824 &
+set
+(
+94505044819008 1 1073741824 
+primitive
+<
+94505044876944 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044818848 3 1073741824 &
+set
+(
+94505044818688 1 1073741824 
+primitive
+<
+94505044876784 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044818528 2 1073741824 &
+set
+(
+94505044818368 1 1073741824 
+primitive
+<
+94505044876464 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044818048 1 1073741824 
+primitive
+<
+94505044876624 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044816928 156 0 |
+set
+(
+94505044817888 4 1073741824 &
+set
+(
+94505044817728 1 1073741824 
+primitive
+<
+94505044876304 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044817568 3 1073741824 &
+set
+(
+94505044817408 1 1073741824 
+primitive
+<
+94505044876144 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044817248 2 1073741824 &
+set
+(
+94505044817088 1 1073741824 
+primitive
+<
+94505044875824 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044816768 1 1073741824 
+primitive
+<
+94505044875984 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044815648 152 0 |
+set
+(
+94505044816608 4 1073741824 &
+set
+(
+94505044816448 1 1073741824 
+primitive
+<
+94505044875664 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044816288 3 1073741824 &
+set
+(
+94505044816128 1 1073741824 
+primitive
+<
+94505044875504 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044815968 2 1073741824 &
+set
+(
+94505044815808 1 1073741824 
+primitive
+<
+94505044875184 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044815488 1 1073741824 
+primitive
+<
+94505044875344 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044814368 148 0 |
+set
+(
+94505044815328 4 1073741824 &
+set
+(
+94505044815168 1 1073741824 
+primitive
+<
+94505044875024 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044815008 3 1073741824 &
+set
+(
+94505044814848 1 1073741824 
+primitive
+<
+94505044874864 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044814688 2 1073741824 &
+set
+(
+94505044814528 1 1073741824 
+primitive
+<
+94505044874544 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044814208 1 1073741824 
+primitive
+<
+94505044874704 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044813088 144 0 |
+set
+(
+94505044814048 4 1073741824 &
+set
+(
+94505044813888 1 1073741824 
+primitive
+<
+94505044742720 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044813728 3 1073741824 &
+set
+(
+94505044813568 1 1073741824 
+primitive
+<
+94505044742560 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044813408 2 1073741824 &
+set
+(
+94505044813248 1 1073741824 
+primitive
+<
+94505044742240 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044812928 1 1073741824 
+primitive
+<
+94505044742400 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044811808 140 0 |
+set
+(
+94505044812768 4 1073741824 &
+set
+(
+94505044812608 1 1073741824 
+primitive
+<
+94505044742080 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044812448 3 1073741824 &
+set
+(
+94505044812288 1 1073741824 
+primitive
+<
+94505044741920 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044812128 2 1073741824 &
+set
+(
+94505044811968 1 1073741824 
+primitive
+<
+94505044741600 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044811648 1 1073741824 
+primitive
+<
+94505044741760 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044810528 136 0 |
+set
+(
+94505044811488 4 1073741824 &
+set
+(
+94505044811328 1 1073741824 
+primitive
+<
+94505044741440 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044811168 3 1073741824 &
+set
+(
+94505044811008 1 1073741824 
+primitive
+<
+94505044741280 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044810848 2 1073741824 &
+set
+(
+94505044810688 1 1073741824 
+primitive
+<
+94505044740960 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044810368 1 1073741824 
+primitive
+<
+94505044741120 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044809248 132 0 |
+set
+(
+94505044810208 4 1073741824 &
+set
+(
+94505044810048 1 1073741824 
+primitive
+<
+94505044740800 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044809888 3 1073741824 &
+set
+(
+94505044809728 1 1073741824 
+primitive
+<
+94505044740640 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044809568 2 1073741824 &
+set
+(
+94505044809408 1 1073741824 
+primitive
+<
+94505044740320 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044809088 1 1073741824 
+primitive
+<
+94505044740480 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044807216 128 0 |
+set
+(
+94505044808176 4 1073741824 &
+set
+(
+94505044808016 1 1073741824 
+primitive
+<
+94505044740160 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044807856 3 1073741824 &
+set
+(
+94505044807696 1 1073741824 
+primitive
+<
+94505044740000 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044807536 2 1073741824 &
+set
+(
+94505044807376 1 1073741824 
+primitive
+<
+94505044739680 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044807056 1 1073741824 
+primitive
+<
+94505044739840 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044805936 124 0 |
+set
+(
+94505044806896 4 1073741824 &
+set
+(
+94505044806736 1 1073741824 
+primitive
+<
+94505044739520 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044806576 3 1073741824 &
+set
+(
+94505044806416 1 1073741824 
+primitive
+<
+94505044739360 1 0 
+plane\point\-1, -8.74228e-08, 0/, 113.267/
+>
+0
+0
+)
+set
+(
+94505044806256 2 1073741824 &
+set
+(
+94505044806096 1 1073741824 
+primitive
+<
+94505044739040 1 0 
+plane\point\1, 0, 0/, -113.467/
+>
+0
+0
+)
+set
+(
+94505044805776 1 1073741824 
+primitive
+<
+94505044739200 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044804656 120 0 |
+set
+(
+94505044805616 4 1073741824 &
+set
+(
+94505044805456 1 1073741824 
+primitive
+<
+94505044738880 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044805296 3 1073741824 &
+set
+(
+94505044805136 1 1073741824 
+primitive
+<
+94505044738720 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044804976 2 1073741824 &
+set
+(
+94505044804816 1 1073741824 
+primitive
+<
+94505044738400 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044804496 1 1073741824 
+primitive
+<
+94505044738560 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044803376 116 0 |
+set
+(
+94505044804336 4 1073741824 &
+set
+(
+94505044804176 1 1073741824 
+primitive
+<
+94505044738240 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044804016 3 1073741824 &
+set
+(
+94505044803856 1 1073741824 
+primitive
+<
+94505044738080 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044803696 2 1073741824 &
+set
+(
+94505044803536 1 1073741824 
+primitive
+<
+94505044737760 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044803216 1 1073741824 
+primitive
+<
+94505044737920 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044802096 112 0 |
+set
+(
+94505044803056 4 1073741824 &
+set
+(
+94505044802896 1 1073741824 
+primitive
+<
+94505044737600 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044802736 3 1073741824 &
+set
+(
+94505044802576 1 1073741824 
+primitive
+<
+94505044737440 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044802416 2 1073741824 &
+set
+(
+94505044802256 1 1073741824 
+primitive
+<
+94505044737120 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044801936 1 1073741824 
+primitive
+<
+94505044737280 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044800816 108 0 |
+set
+(
+94505044801776 4 1073741824 &
+set
+(
+94505044801616 1 1073741824 
+primitive
+<
+94505044736960 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044801456 3 1073741824 &
+set
+(
+94505044801296 1 1073741824 
+primitive
+<
+94505044736800 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044801136 2 1073741824 &
+set
+(
+94505044800976 1 1073741824 
+primitive
+<
+94505044736480 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044800656 1 1073741824 
+primitive
+<
+94505044736640 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044799536 104 0 |
+set
+(
+94505044800496 4 1073741824 &
+set
+(
+94505044800336 1 1073741824 
+primitive
+<
+94505044736320 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044800176 3 1073741824 &
+set
+(
+94505044800016 1 1073741824 
+primitive
+<
+94505044736160 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044799856 2 1073741824 &
+set
+(
+94505044799696 1 1073741824 
+primitive
+<
+94505044735840 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044799376 1 1073741824 
+primitive
+<
+94505044736000 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044798256 100 0 |
+set
+(
+94505044799216 4 1073741824 &
+set
+(
+94505044799056 1 1073741824 
+primitive
+<
+94505044735680 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044798896 3 1073741824 &
+set
+(
+94505044798736 1 1073741824 
+primitive
+<
+94505044735520 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044798576 2 1073741824 &
+set
+(
+94505044798416 1 1073741824 
+primitive
+<
+94505044735200 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044798096 1 1073741824 
+primitive
+<
+94505044735360 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044796976 96 0 |
+set
+(
+94505044797936 4 1073741824 &
+set
+(
+94505044797776 1 1073741824 
+primitive
+<
+94505044735040 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044797616 3 1073741824 &
+set
+(
+94505044797456 1 1073741824 
+primitive
+<
+94505044734880 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044797296 2 1073741824 &
+set
+(
+94505044797136 1 1073741824 
+primitive
+<
+94505044734560 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044796816 1 1073741824 
+primitive
+<
+94505044734720 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044795696 92 0 |
+set
+(
+94505044796656 4 1073741824 &
+set
+(
+94505044796496 1 1073741824 
+primitive
+<
+94505044734400 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044796336 3 1073741824 &
+set
+(
+94505044796176 1 1073741824 
+primitive
+<
+94505044734240 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044796016 2 1073741824 &
+set
+(
+94505044795856 1 1073741824 
+primitive
+<
+94505044733920 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044795536 1 1073741824 
+primitive
+<
+94505044734080 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044794416 88 0 |
+set
+(
+94505044795376 4 1073741824 &
+set
+(
+94505044795216 1 1073741824 
+primitive
+<
+94505044733760 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044795056 3 1073741824 &
+set
+(
+94505044794896 1 1073741824 
+primitive
+<
+94505044733600 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044794736 2 1073741824 &
+set
+(
+94505044794576 1 1073741824 
+primitive
+<
+94505044733280 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044794256 1 1073741824 
+primitive
+<
+94505044733440 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044793136 84 0 |
+set
+(
+94505044794096 4 1073741824 &
+set
+(
+94505044793936 1 1073741824 
+primitive
+<
+94505044733120 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044793776 3 1073741824 &
+set
+(
+94505044793616 1 1073741824 
+primitive
+<
+94505044732960 1 0 
+plane\point\-1, -8.74228e-08, 0/, 108.844/
+>
+0
+0
+)
+set
+(
+94505044793456 2 1073741824 &
+set
+(
+94505044793296 1 1073741824 
+primitive
+<
+94505044732640 1 0 
+plane\point\1, 0, 0/, -109.044/
+>
+0
+0
+)
+set
+(
+94505044792976 1 1073741824 
+primitive
+<
+94505044732800 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044791856 80 0 |
+set
+(
+94505044792816 4 1073741824 &
+set
+(
+94505044792656 1 1073741824 
+primitive
+<
+94505044732480 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044792496 3 1073741824 &
+set
+(
+94505044792336 1 1073741824 
+primitive
+<
+94505044732320 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044792176 2 1073741824 &
+set
+(
+94505044792016 1 1073741824 
+primitive
+<
+94505044732000 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044791696 1 1073741824 
+primitive
+<
+94505044732160 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044790576 76 0 |
+set
+(
+94505044791536 4 1073741824 &
+set
+(
+94505044791376 1 1073741824 
+primitive
+<
+94505044731840 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044791216 3 1073741824 &
+set
+(
+94505044791056 1 1073741824 
+primitive
+<
+94505044731680 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044790896 2 1073741824 &
+set
+(
+94505044790736 1 1073741824 
+primitive
+<
+94505044731360 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044790416 1 1073741824 
+primitive
+<
+94505044731520 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044789296 72 0 |
+set
+(
+94505044790256 4 1073741824 &
+set
+(
+94505044790096 1 1073741824 
+primitive
+<
+94505044731200 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044789936 3 1073741824 &
+set
+(
+94505044789776 1 1073741824 
+primitive
+<
+94505044731040 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044789616 2 1073741824 &
+set
+(
+94505044789456 1 1073741824 
+primitive
+<
+94505044730720 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044789136 1 1073741824 
+primitive
+<
+94505044730880 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044788016 68 0 |
+set
+(
+94505044788976 4 1073741824 &
+set
+(
+94505044788816 1 1073741824 
+primitive
+<
+94505044730560 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044788656 3 1073741824 &
+set
+(
+94505044788496 1 1073741824 
+primitive
+<
+94505044730400 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044788336 2 1073741824 &
+set
+(
+94505044788176 1 1073741824 
+primitive
+<
+94505044730080 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044787856 1 1073741824 
+primitive
+<
+94505044730240 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044532080 64 0 |
+set
+(
+94505044533040 4 1073741824 &
+set
+(
+94505044532880 1 1073741824 
+primitive
+<
+94505044729920 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044532720 3 1073741824 &
+set
+(
+94505044532560 1 1073741824 
+primitive
+<
+94505044729760 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044532400 2 1073741824 &
+set
+(
+94505044532240 1 1073741824 
+primitive
+<
+94505044729440 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044531920 1 1073741824 
+primitive
+<
+94505044729600 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044529040 60 0 |
+set
+(
+94505044531760 4 1073741824 &
+set
+(
+94505044531600 1 1073741824 
+primitive
+<
+94505044729280 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044531440 3 1073741824 &
+set
+(
+94505044529520 1 1073741824 
+primitive
+<
+94505044729120 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044529360 2 1073741824 &
+set
+(
+94505044529200 1 1073741824 
+primitive
+<
+94505044728800 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044528880 1 1073741824 
+primitive
+<
+94505044728960 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044527440 56 0 |
+set
+(
+94505044528720 4 1073741824 &
+set
+(
+94505044528560 1 1073741824 
+primitive
+<
+94505044728640 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044528400 3 1073741824 &
+set
+(
+94505044528240 1 1073741824 
+primitive
+<
+94505044728480 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044528080 2 1073741824 &
+set
+(
+94505044527920 1 1073741824 
+primitive
+<
+94505044728160 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044531280 1 1073741824 
+primitive
+<
+94505044728320 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044530160 52 0 |
+set
+(
+94505044531120 4 1073741824 &
+set
+(
+94505044530960 1 1073741824 
+primitive
+<
+94505044599424 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044530800 3 1073741824 &
+set
+(
+94505044530640 1 1073741824 
+primitive
+<
+94505044599264 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044530480 2 1073741824 &
+set
+(
+94505044530320 1 1073741824 
+primitive
+<
+94505044598944 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044530000 1 1073741824 
+primitive
+<
+94505044599104 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044536400 48 0 |
+set
+(
+94505044529840 4 1073741824 &
+set
+(
+94505044529680 1 1073741824 
+primitive
+<
+94505044598784 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044526960 3 1073741824 &
+set
+(
+94505044536880 1 1073741824 
+primitive
+<
+94505044598624 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044536720 2 1073741824 &
+set
+(
+94505044536560 1 1073741824 
+primitive
+<
+94505044597344 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044536240 1 1073741824 
+primitive
+<
+94505044597504 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044527600 44 0 |
+set
+(
+94505044536080 4 1073741824 &
+set
+(
+94505044535920 1 1073741824 
+primitive
+<
+94505044597184 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044535760 3 1073741824 &
+set
+(
+94505044535600 1 1073741824 
+primitive
+<
+94505044597024 1 0 
+plane\point\-1, -8.74228e-08, 0/, 104.422/
+>
+0
+0
+)
+set
+(
+94505044535440 2 1073741824 &
+set
+(
+94505044535280 1 1073741824 
+primitive
+<
+94505044596704 1 0 
+plane\point\1, 0, 0/, -104.622/
+>
+0
+0
+)
+set
+(
+94505044535120 1 1073741824 
+primitive
+<
+94505044596864 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044534000 40 0 |
+set
+(
+94505044534960 4 1073741824 &
+set
+(
+94505044534800 1 1073741824 
+primitive
+<
+94505044598464 1 0 
+plane\point\1.19249e-08, -1, 0/, 164.8/
+>
+0
+0
+)
+set
+(
+94505044534640 3 1073741824 &
+set
+(
+94505044534480 1 1073741824 
+primitive
+<
+94505044598304 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044534320 2 1073741824 &
+set
+(
+94505044534160 1 1073741824 
+primitive
+<
+94505044597984 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044533840 1 1073741824 
+primitive
+<
+94505044598144 1 0 
+plane\point\-4.37114e-08, 1, 0/, -165/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044540240 36 0 |
+set
+(
+94505044533680 4 1073741824 &
+set
+(
+94505044533520 1 1073741824 
+primitive
+<
+94505044597824 1 0 
+plane\point\1.19249e-08, -1, 0/, 162.044/
+>
+0
+0
+)
+set
+(
+94505044526640 3 1073741824 &
+set
+(
+94505044540720 1 1073741824 
+primitive
+<
+94505044597664 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044540560 2 1073741824 &
+set
+(
+94505044540400 1 1073741824 
+primitive
+<
+94505044601184 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044540080 1 1073741824 
+primitive
+<
+94505044601344 1 0 
+plane\point\-4.37114e-08, 1, 0/, -162.244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044526160 32 0 |
+set
+(
+94505044539920 4 1073741824 &
+set
+(
+94505044539760 1 1073741824 
+primitive
+<
+94505044601024 1 0 
+plane\point\1.19249e-08, -1, 0/, 159.289/
+>
+0
+0
+)
+set
+(
+94505044539600 3 1073741824 &
+set
+(
+94505044539440 1 1073741824 
+primitive
+<
+94505044600864 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044539280 2 1073741824 &
+set
+(
+94505044539120 1 1073741824 
+primitive
+<
+94505044600544 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044538960 1 1073741824 
+primitive
+<
+94505044600704 1 0 
+plane\point\-4.37114e-08, 1, 0/, -159.489/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044537840 28 0 |
+set
+(
+94505044538800 4 1073741824 &
+set
+(
+94505044538640 1 1073741824 
+primitive
+<
+94505044600384 1 0 
+plane\point\1.19249e-08, -1, 0/, 156.533/
+>
+0
+0
+)
+set
+(
+94505044538480 3 1073741824 &
+set
+(
+94505044538320 1 1073741824 
+primitive
+<
+94505044600224 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044538160 2 1073741824 &
+set
+(
+94505044538000 1 1073741824 
+primitive
+<
+94505044599904 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044537680 1 1073741824 
+primitive
+<
+94505044600064 1 0 
+plane\point\-4.37114e-08, 1, 0/, -156.733/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044613744 24 0 |
+set
+(
+94505044537520 4 1073741824 &
+set
+(
+94505044537360 1 1073741824 
+primitive
+<
+94505044599744 1 0 
+plane\point\1.19249e-08, -1, 0/, 153.778/
+>
+0
+0
+)
+set
+(
+94505044526800 3 1073741824 &
+set
+(
+94505044614224 1 1073741824 
+primitive
+<
+94505044599584 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044614064 2 1073741824 &
+set
+(
+94505044613904 1 1073741824 
+primitive
+<
+94505044603104 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044613584 1 1073741824 
+primitive
+<
+94505044603264 1 0 
+plane\point\-4.37114e-08, 1, 0/, -153.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044527760 20 0 |
+set
+(
+94505044613424 4 1073741824 &
+set
+(
+94505044613264 1 1073741824 
+primitive
+<
+94505044602944 1 0 
+plane\point\1.19249e-08, -1, 0/, 151.022/
+>
+0
+0
+)
+set
+(
+94505044613104 3 1073741824 &
+set
+(
+94505044612944 1 1073741824 
+primitive
+<
+94505044602784 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044612784 2 1073741824 &
+set
+(
+94505044612624 1 1073741824 
+primitive
+<
+94505044602464 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044612464 1 1073741824 
+primitive
+<
+94505044602624 1 0 
+plane\point\-4.37114e-08, 1, 0/, -151.222/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044541680 16 0 |
+set
+(
+94505044612304 4 1073741824 &
+set
+(
+94505044612144 1 1073741824 
+primitive
+<
+94505044602304 1 0 
+plane\point\1.19249e-08, -1, 0/, 148.267/
+>
+0
+0
+)
+set
+(
+94505044611984 3 1073741824 &
+set
+(
+94505044542160 1 1073741824 
+primitive
+<
+94505044602144 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044542000 2 1073741824 &
+set
+(
+94505044541840 1 1073741824 
+primitive
+<
+94505044601824 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044541520 1 1073741824 
+primitive
+<
+94505044601984 1 0 
+plane\point\-4.37114e-08, 1, 0/, -148.467/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044617584 12 0 |
+set
+(
+94505044541360 4 1073741824 &
+set
+(
+94505044541200 1 1073741824 
+primitive
+<
+94505044601664 1 0 
+plane\point\1.19249e-08, -1, 0/, 145.511/
+>
+0
+0
+)
+set
+(
+94505044533200 3 1073741824 &
+set
+(
+94505044618064 1 1073741824 
+primitive
+<
+94505044601504 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044617904 2 1073741824 &
+set
+(
+94505044617744 1 1073741824 
+primitive
+<
+94505044605024 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044617424 1 1073741824 
+primitive
+<
+94505044605184 1 0 
+plane\point\-4.37114e-08, 1, 0/, -145.711/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044615504 8 0 |
+set
+(
+94505044533360 4 1073741824 &
+set
+(
+94505044616304 1 1073741824 
+primitive
+<
+94505044604224 1 0 
+plane\point\1.19249e-08, -1, 0/, 140/
+>
+0
+0
+)
+set
+(
+94505044616144 3 1073741824 &
+set
+(
+94505044615984 1 1073741824 
+primitive
+<
+94505044604064 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044615824 2 1073741824 &
+set
+(
+94505044615664 1 1073741824 
+primitive
+<
+94505044603744 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044615344 1 1073741824 
+primitive
+<
+94505044603904 1 0 
+plane\point\-4.37114e-08, 1, 0/, -140.2/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044617264 4 1073741824 &
+set
+(
+94505044617104 1 1073741824 
+primitive
+<
+94505044604864 1 0 
+plane\point\1.19249e-08, -1, 0/, 142.756/
+>
+0
+0
+)
+set
+(
+94505044616944 3 1073741824 &
+set
+(
+94505044616784 1 1073741824 
+primitive
+<
+94505044604704 1 0 
+plane\point\-1, -8.74228e-08, 0/, 100/
+>
+0
+0
+)
+set
+(
+94505044616624 2 1073741824 &
+set
+(
+94505044616464 1 1073741824 
+primitive
+<
+94505044604384 1 0 
+plane\point\1, 0, 0/, -100.2/
+>
+0
+0
+)
+set
+(
+94505044615184 1 1073741824 
+primitive
+<
+94505044604544 1 0 
+plane\point\-4.37114e-08, 1, 0/, -142.956/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505045005664 -32
+user_attribute
+\
+94505045005456 32
+surface
+\
+1
+point\0.1, 0.1, 0.1/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044614864 473 0 |
+set
+(
+94505044614704 1 0 
+primitive
+<
+94505044603424 4 0 -
+primitive
+<
+94505044607104 8 0 +
+primitive
+<
+94505044606944 8 0 +
+primitive
+<
+94505044606784 8 0 ^
+primitive
+<
+94505044605344 1 0 
+plane\point\1, 0, 0/, -110/
+>
+primitive
+<
+94505044606624 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044606464 8 0 ^
+primitive
+<
+94505044605504 1 0 
+plane\point\0, 1, 0/, -110/
+>
+primitive
+<
+94505044606304 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044606144 8 0 ^
+primitive
+<
+94505044605664 1 0 
+plane\point\0, 0, 1/, -22.5/
+>
+primitive
+<
+94505044605984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044605824 0 0 
+25
+>
+0
+>
+1
+attribute
+<
+94505044808960 -32
+user_attribute
+\
+94505044808752 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044537040 472 0 |
+set
+(
+94505044525840 141 0 |
+set
+(
+94505044525680 12 0 &
+set
+(
+94505044522000 6 1073741824 &
+set
+(
+94505044521040 3 1073741824 &
+set
+(
+94505044520400 1 1073741824 
+primitive
+<
+94505044592864 1 0 
+plane\point\-0, -0, -1/, -10/
+>
+0
+0
+)
+set
+(
+94505044520880 2 1073741824 &
+set
+(
+94505044520720 1 1073741824 
+primitive
+<
+94505044593184 1 0 
+plane\point\-1, -0, -0/, 160/
+>
+0
+0
+)
+set
+(
+94505044520560 1 1073741824 
+primitive
+<
+94505044593024 1 0 
+plane\point\-0, -1, -0/, 110/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044521840 3 1073741824 &
+set
+(
+94505044521200 1 1073741824 
+primitive
+<
+94505044593344 1 0 
+plane\point\0, 0, 1/, -3.5/
+>
+0
+0
+)
+set
+(
+94505044521680 2 1073741824 &
+set
+(
+94505044521520 1 1073741824 
+primitive
+<
+94505044593664 1 0 
+plane\point\1, 0, 0/, -200/
+>
+0
+0
+)
+set
+(
+94505044521360 1 1073741824 
+primitive
+<
+94505044593504 1 0 
+plane\point\0, 1, 0/, -170/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044525520 6 0 |
+set
+(
+94505044525360 3 0 |
+set
+(
+94505044525200 1 1073741824 
+primitive
+<
+94505044595584 1 0 
+plane\point\0, 0, 1/, 20/
+>
+0
+1
+set
+(
+94505044522160 1 1073741824 
+primitive
+<
+94505044593824 1 0 
+plane\point\-0, -0, -1/, -20/
+>
+0
+0
+)
+)
+set
+(
+94505044525040 2 0 |
+set
+(
+94505044524880 1 1073741824 
+primitive
+<
+94505044595424 1 0 
+plane\point\1, 0, 0/, -160.5/
+>
+0
+1
+set
+(
+94505044522480 1 1073741824 
+primitive
+<
+94505044594144 1 0 
+plane\point\-1, -0, -0/, 160.5/
+>
+0
+0
+)
+)
+set
+(
+94505044524720 1 1073741824 
+primitive
+<
+94505044595264 1 0 
+plane\point\0, 1, 0/, -110.5/
+>
+0
+1
+set
+(
+94505044522320 1 1073741824 
+primitive
+<
+94505044593984 1 0 
+plane\point\-0, -1, -0/, 110.5/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044522640 2 1073741824 &
+set
+(
+94505044522480 )
+set
+(
+94505044522320 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044522800 3 1073741824 &
+set
+(
+94505044522160 )
+set
+(
+94505044522640 )
+0
+0
+)
+)
+set
+(
+94505044524560 3 0 |
+set
+(
+94505044524400 1 1073741824 
+primitive
+<
+94505044595104 1 0 
+plane\point\-0, -0, -1/, 10/
+>
+0
+1
+set
+(
+94505044522960 1 1073741824 
+primitive
+<
+94505044594304 1 0 
+plane\point\0, 0, 1/, -10/
+>
+0
+0
+)
+)
+set
+(
+94505044524240 2 0 |
+set
+(
+94505044524080 1 1073741824 
+primitive
+<
+94505044594944 1 0 
+plane\point\-1, -0, -0/, 199.5/
+>
+0
+1
+set
+(
+94505044523280 1 1073741824 
+primitive
+<
+94505044594624 1 0 
+plane\point\1, 0, 0/, -199.5/
+>
+0
+0
+)
+)
+set
+(
+94505044523920 1 1073741824 
+primitive
+<
+94505044594784 1 0 
+plane\point\-0, -1, -0/, 169.5/
+>
+0
+1
+set
+(
+94505044523120 1 1073741824 
+primitive
+<
+94505044594464 1 0 
+plane\point\0, 1, 0/, -169.5/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044523440 2 1073741824 &
+set
+(
+94505044523280 )
+set
+(
+94505044523120 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044523600 3 1073741824 &
+set
+(
+94505044522960 )
+set
+(
+94505044523440 )
+0
+0
+)
+)
+0
+1
+set
+(
+94505044523760 6 1073741824 &
+set
+(
+94505044522800 )
+set
+(
+94505044523600 )
+0
+0
+)
+)
+1
+attribute
+<
+94505044611856 -32
+user_attribute
+\
+94505044611648 32
+surface
+\
+1
+point\0.8, 0.4, 0.2/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044520240 129 0 |
+set
+(
+94505044497040 64 0 |
+set
+(
+94505044477040 1 1073741824 
+primitive
+<
+94505043963104 1 0 
+plane\point\0, 0, 1/, -0/
+>
+1
+attribute
+<
+94505044431312 -32
+user_attribute
+\
+94505044431104 32
+surface
+\
+1
+point\0.95, 0.93, 0.8/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\-1, -0, -0/
+point\30, 30, 0/
+1
+0
+1
+P6
+#svLis surface texture
+67 64
+255
+[[[[{ [{ [[{ [{ { { [{ { { { { [{ { { { [{ { { { [[[{ [[{ { [{ [{ [{ { [[{ { { { { [[[{ [[{ { [{ { [{ { [{ [{ [[{ [[{ [[{ [{ [[[[{ [{ [[[{ [[[{ { { { { { [{ [[[[{ { { [{ [{ { [[{ { [[[{ { { { { [{ [{ [{ [[[[[{ [{ [{ [{ [[{ [[[[{ { { { [{ { { { [[{ { { [{ [{ [{ [{ [{ [[[{ { { { [[[{ { [{ [[{ { { { { [[{ [[[[{ { [{ [[{ { { { { [[{ [{ { { { [[[{ { { { { { { { { { [[{ [[{ { { [[{ { { { [{ [[[[[{ { [{ [[{ { [[{ [[{ [[[{ { { [[[{ [[[{ { [{ [[[[[[[{ [{ { { { { [{ [[{ [{ [[[[[[[{ [[{ [[[{ [{ [[[[{ { { [[{ { [[{ [{ { { [{ { { [{ { { { [{ [{ [{ { { [[[{ [{ [{ { [[{ [{ [{ [{ { { { { { { { [{ [[[[[{ [[{ [{ [[{ { [[[[[{ [[{ { { [{ [{ { [[{ { { { [[[{ { [[[{ { { { [[[{ { { { [{ { [[[{ { { [[{ { { [{ [{ [[[[[[[{ [[{ { { [[[[{ { [[[[[[[{ { { [[[[{ { [{ [{ { [[[[[{ { { { { { { [{ { { { { { { { [{ [{ { [{ { { { [{ [[{ [{ [{ { { [[{ { { [[[{ [[{ [{ { [{ [{ [{ [[{ [{ [[{ { [{ [{ { { { [{ [[[{ { [{ { [{ [{ [[[{ { { { { [[{ { [{ { { { [{ { [{ { [[{ [[{ { { [[[[[{ [[{ { [[[{ { [{ { { { { { [{ { { { { { { [{ [{ { { [[[[[[[[[[{ [[[{ { { [[{ { { { [{ { { { [[[[{ [{ { [[[{ [[[[{ [[[{ { { [{ { { [[[[{ [{ { { { { { { [[{ { { [{ { [{ [{ { { [{ { [[{ { [[[{ { [{ [[{ { { [{ [{ [[{ { { { { [{ { { [{ [{ { [[[{ { [[{ [{ [[[[[{ [{ { { [[{ [[{ [{ { { { { { [{ { [{ [[{ [[{ [{ [[[[[{ { { [[{ { [{ { [[{ { [[[{ [{ [{ [[{ { [{ { [[[{ { { { { { { [{ { { { [[[{ [[[[[[{ [{ { [{ { { { { [{ { { { { { [{ [[{ [{ [[{ [[[{ { [[{ [[{ { { { [[{ { [[[{ { [[[[{ { [[[[{ { [[[[[{ [[[{ { [[[{ { [{ [{ [{ { [{ { { [[[[[{ [[{ { { [[[{ { [[{ [[{ { { { [{ [[{ [[[[{ { { { [{ { [[{ [{ [{ { { [[[[{ { [{ { [[[{ [[[{ { { { { { [[[[{ { [{ { [[{ { [{ { [{ [[{ [[{ { [[[{ [[{ { [{ [{ { [{ { { { { { { [{ [[[{ [[{ [{ [[[[[[{ { [[[{ [{ [{ [[[[[{ [{ { { [[[[[[{ [[[{ { { [{ [[{ { [[{ { [{ { { { [{ { [{ [[[[{ { { [[{ { [{ { [[{ [{ { [{ [[[{ { { { { [{ { { [{ [[{ [[[[[[[[[[{ { [{ { { [{ [{ { { [[{ [{ [{ [{ { [[{ [[{ [[[{ [[{ { [{ { [[[{ [[{ { [[[{ [{ { [[[[{ [{ [[[{ { { { [{ { [[[{ [[[[{ [[[{ { { [{ { [{ { { [{ [[{ { [[[{ { { [[{ { { { { [[{ [{ [{ [[{ { [[[[[[{ { { { { { { [{ [{ { [[{ { { [[{ [{ { [[{ [[{ { { { { { [[[{ [{ [[{ { { [{ [[[[{ [{ { { { [{ [{ { { [{ [{ { [[[{ [[[{ [{ [{ [[{ { [[[{ { [{ [{ { [{ { [{ { [{ [[[[{ { [[[{ { { { { [[[[{ [[{ [{ { { [[[[[[{ { { { [{ [{ { [[{ { { { { { { [{ [{ [[[[[{ [{ [{ [{ { [{ [{ { [{ [{ [[{ { [{ [{ { { { [{ { [[{ [[[{ { { { [[[[{ [[[[[{ [[{ [{ { [{ { { { { [{ { [{ { { [{ [{ [{ [[{ [[[[{ { [[[{ { [[{ { [{ [[[{ [[{ [{ [[[{ { { { { { { [[{ { [{ [{ [[[{ { [[{ [[{ [{ { [[[[{ [{ { { [{ [[{ [{ [[{ { [[[[{ [{ { { [{ { [[[{ { [{ [{ [{ [{ { [{ [{ [{ { { { { [{ [{ [[[{ { [{ { [[[[{ { { [[{ { [{ [[{ [[[[[{ [{ { [{ [{ [{ { { [[[[{ { { { { { [[{ [{ [{ { { { { [{ { [{ [[[{ { { { [[[[[[[[[[[[[[{ [[{ [[{ { { { [{ { [[{ { { [{ [{ [[{ { { { [[{ [[[[{ { { { { [{ { { { [{ [{ { { { [{ [[{ [[{ [[[[[{ { { { [[[{ [{ [[[[[[[[{ { [[[{ { [[{ [{ { [[[[{ { { [[{ [{ { { [{ { { [[{ [[[[[[{ [{ { [[{ [[[{ [[{ { [[{ [[[[[{ { { [{ { { [{ { { [[[{ [[[{ [[{ [{ [[{ [[[{ { [[[[[[[{ [[[[[{ { { { { { [{ { [[[[[[[[{ [[{ { [{ [{ [{ [[{ { [{ [{ { [[{ { { [{ [{ [{ [[[{ [[{ { { { { [{ [{ [{ { { [[[[{ [[[{ [[[{ { { [[{ { [[[[{ [[[{ { [{ [{ [[{ [{ { [{ { { { [[{ { { { { [[[[[[{ { { { [[[{ [[[{ { { { [[{ { [[[{ { { { { [[{ [[[{ { [[{ { [{ { [{ { [{ [{ { { [{ [{ [{ [{ [[[{ [{ { [{ [{ { [[[[{ { [{ { [[{ { { { [{ { [{ { [{ [[{ [{ { { [{ [[{ { [{ { { { [[{ { { { { { [{ { [[[[{ { [{ { { { { { [[{ { [{ [{ { { { [{ { [[{ [{ { { { [{ [[{ { { [{ [{ [[[{ { { [[{ { { { [[[{ [{ [{ [[{ { [{ [{ [{ { { [[{ [{ [[[[{ [[[{ { { [[[{ [{ { [[{ [[{ { [[{ [[{ [[{ { { { { [[{ [{ { [[{ { [[[[{ { [[[[{ [{ [[{ { { [[[[[{ [{ { [[[[[[{ { { { { { [[{ [[{ [{ { [[[[{ [{ { [{ { [[[{ { { [[{ { { { { { { [[[{ [[{ [[[[{ [{ { { { [[[{ [{ { [[{ { { [[{ [[[{ [[{ { { { { [[[{ { { [{ { [[[[[{ { { [[[{ { [[[[[[{ { { { [{ { { { { [{ [[[[[[[[[[{ { [[[{ { [{ [[[[[[[[{ { [[[{ { [{ { [{ [{ { { [{ [{ { { [{ { [[{ [{ [[{ [{ [[{ { { [{ { { { [{ [[[[{ { [{ { { [{ [[{ { { [[[{ [[[[{ { { { { { [[{ [[{ [{ { [{ [{ [{ { { [{ [[[[{ { [[[[[[{ { [{ { [{ [{ { [[[{ [[[{ [{ [{ { { { [{ [{ [{ [[{ { { [{ [[{ { [[[{ { { [[{ [{ { [{ { { { { { { [[[{ [{ [[{ [{ [[{ [{ { { { { { { [{ [{ [[{ [{ [[{ [{ [[[{ [{ [{ { { [{ [{ { { [{ [[[{ [[{ [{ [[{ [[{ [[[[[[{ [[[{ [{ [[{ { { { [{ { [[[[{ { [[{ { [[{ [[[{ { [{ { { [{ { [[[{ [{ [{ [[{ { [[[{ { [{ { { [[{ [{ { [[[[[{ { [{ { { [[{ [[[{ { { [{ { { [{ { [{ { [{ [{ [{ { { { [{ { [{ { { { [{ { { [[[[[[[[{ [{ [[[[{ [[[[{ [{ { [{ { { { { [{ { [{ { { { { { [{ { { [{ [{ { [{ [[[[{ { [{ { [[[[{ [{ { { { { [[{ { [{ { [{ { { [{ { { { [[{ { [{ { { [[[{ [{ [{ { [[[{ [[[[{ { [[[[[[{ { { [[[[{ { { [{ [{ { { { { [{ { [[[{ { [{ [{ [{ { { { { { { { [[[[[{ { [{ { { [{ [[{ [[{ [{ { { { { { [{ { [[{ { [{ { [[[[{ { { { { [{ { [[{ { { [[{ [{ { [{ { [[[[[[{ [[[[{ [[{ { { [[{ [{ [[[[[[[[{ [{ { { [[{ { { { [{ [[{ { [{ [[{ [[[{ { { [{ [{ [{ [[[{ [[{ [{ { { { [[[[[[[{ [{ { { { [{ [[{ { { [{ { { { [{ { [{ [{ [[[{ [[[[{ { { { { { [{ { [{ { { { { { [[{ { [{ { [[{ { { { [{ { [[[[{ { [[[[{ { { [[[[[[{ { [[[{ [{ [[[[{ { [[{ [[{ { [[{ [[{ { { { { [{ { [{ { { { [{ { [[{ { [{ { [{ [{ { { [{ [[[[[[{ { { { [{ { [[[[{ { { { [{ [{ { [{ { { { { [[{ { { [[{ { { { [{ { [{ [[[[[{ [[[{ { [[[[{ { { { { { [[[[{ { [{ { [[{ { { [[[[[{ { [[[{ [[{ { [[{ [{ { [[[{ { { [[{ { { [[[{ { { [{ [[{ { [[{ { [[{ { { [[{ { [[{ { { [[[{ [[[{ { { { { [[[{ { [{ [[[[{ [[{ [{ [[[[[{ { [[{ [{ [[[[[{ [[[{ { { [{ [{ [{ { [{ [[[{ { { [[[[{ [[[{ { [{ [[[{ [{ [{ [[{ { { { [[{ [{ { [{ [{ { [{ [[{ [{ { { { { { [[{ { [[{ { [[[{ [[[[[{ { [[[{ [{ [[[[[{ [{ [[[{ [{ [[[[{ [[[[{ [[[[[{ [{ [[[[[[{ [{ [[{ [[[{ { { { { [{ { [[[{ [[[[[{ { [[{ [{ { { { [[[{ { [{ { { { { [{ [{ [{ { [[{ [{ { [[[[[[[{ [[{ [{ [{ [[{ [[[{ [[{ { [{ [[{ [{ [[{ [{ [[[[{ { { { { [{ { { { { { [[[[[{ [{ [[[{ [{ { { { [{ [[[{ [[[[[{ [[[[[{ { { { [{ { [[[[{ { { { [{ { { [[{ { [[[{ [{ [{ [[[{ { [[{ { { { [{ [[{ { { { [[{ { { [[[{ { [[[[{ { { { { [[[{ { [[[{ { { [{ { { [{ { [{ [{ [{ { [{ [{ [{ [{ { { { [{ { { [{ { { { [{ { [[[[[{ [[[[{ [[{ [[[[[{ [{ [[[{ [[{ { [{ { [{ [{ [{ { [{ [[{ [[{ [[{ [{ { [[[{ { { { { [[[{ [{ { [[[{ [{ { { { { [[[[{ { [[{ { { [{ { [{ [[{ [[[[{ { { { [[[{ [[{ [[[[{ { [[[[[{ { { { [{ [{ { { { [{ [{ [{ [[[[{ [[[[[{ { [[[{ { [[{ [{ { { { { [[{ { { { { { [[{ [[{ [[{ [{ { [{ { { { [{ [[[[{ [[{ { [[{ [{ [{ { { { [[[{ { { [[[{ { [{ { [[[{ [[{ { { [[{ { [[[[[{ { { { [[[{ [{ [{ { [{ { [[[{ { [[[[[{ { { [[[[[[{ [[[[{ [{ { [[{ [{ { [[[[[{ { { { { { { { { [{ [{ { { { [{ { { [{ [[{ [[{ { { [[{ [[{ [{ [[{ [{ [{ 
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044496880 63 0 |
+set
+(
+94505044496720 3 0 &
+set
+(
+94505044496560 1 1073741824 
+primitive
+<
+94505044555104 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044496400 2 0 &
+set
+(
+94505044496080 1 0 
+primitive
+<
+94505044553504 4 0 -
+primitive
+<
+94505044553344 8 0 +
+primitive
+<
+94505044553184 8 0 +
+primitive
+<
+94505044553024 8 0 ^
+primitive
+<
+94505044551584 1 0 
+plane\point\1, 0, 0/, -230/
+>
+primitive
+<
+94505044552864 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044552704 8 0 ^
+primitive
+<
+94505044551744 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505044552544 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044552384 8 0 ^
+primitive
+<
+94505044551904 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044552224 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044552064 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044609824 -32
+user_attribute
+\
+94505044609616 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044496240 1 0 
+primitive
+<
+94505044554944 3 0 -
+primitive
+<
+94505044554784 8 0 +
+primitive
+<
+94505044554624 8 0 ^
+primitive
+<
+94505044553664 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505044554464 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044554304 8 0 ^
+primitive
+<
+94505044553824 1 0 
+plane\point\1, 0, 0/, -230/
+>
+primitive
+<
+94505044554144 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044553984 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044495920 60 0 |
+set
+(
+94505044495760 3 0 &
+set
+(
+94505044495600 1 1073741824 
+primitive
+<
+94505044551424 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044495440 2 0 &
+set
+(
+94505044495120 1 0 
+primitive
+<
+94505044549824 4 0 -
+primitive
+<
+94505044549664 8 0 +
+primitive
+<
+94505044549504 8 0 +
+primitive
+<
+94505044549344 8 0 ^
+primitive
+<
+94505044547904 1 0 
+plane\point\1, 0, 0/, -220/
+>
+primitive
+<
+94505044549184 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044549024 8 0 ^
+primitive
+<
+94505044548064 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505044548864 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044548704 8 0 ^
+primitive
+<
+94505044548224 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044548544 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044548384 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044609360 -32
+user_attribute
+\
+94505044609152 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044495280 1 0 
+primitive
+<
+94505044551264 3 0 -
+primitive
+<
+94505044551104 8 0 +
+primitive
+<
+94505044550944 8 0 ^
+primitive
+<
+94505044549984 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505044550784 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044550624 8 0 ^
+primitive
+<
+94505044550144 1 0 
+plane\point\1, 0, 0/, -220/
+>
+primitive
+<
+94505044550464 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044550304 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044494960 57 0 |
+set
+(
+94505044494800 3 0 &
+set
+(
+94505044494640 1 1073741824 
+primitive
+<
+94505044547744 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044494480 2 0 &
+set
+(
+94505044494160 1 0 
+primitive
+<
+94505044546144 4 0 -
+primitive
+<
+94505044545984 8 0 +
+primitive
+<
+94505044545824 8 0 +
+primitive
+<
+94505044545664 8 0 ^
+primitive
+<
+94505044544224 1 0 
+plane\point\1, 0, 0/, -230/
+>
+primitive
+<
+94505044545504 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044545344 8 0 ^
+primitive
+<
+94505044544384 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505044545184 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044545024 8 0 ^
+primitive
+<
+94505044544544 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044544864 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044544704 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044608896 -32
+user_attribute
+\
+94505044608688 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044494320 1 0 
+primitive
+<
+94505044547584 3 0 -
+primitive
+<
+94505044547424 8 0 +
+primitive
+<
+94505044547264 8 0 ^
+primitive
+<
+94505044546304 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505044547104 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044546944 8 0 ^
+primitive
+<
+94505044546464 1 0 
+plane\point\1, 0, 0/, -230/
+>
+primitive
+<
+94505044546784 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044546624 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044494000 54 0 |
+set
+(
+94505044493840 3 0 &
+set
+(
+94505044493680 1 1073741824 
+primitive
+<
+94505044544064 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044493520 2 0 &
+set
+(
+94505044493200 1 0 
+primitive
+<
+94505044027744 4 0 -
+primitive
+<
+94505044027584 8 0 +
+primitive
+<
+94505044027424 8 0 +
+primitive
+<
+94505044027264 8 0 ^
+primitive
+<
+94505044025824 1 0 
+plane\point\1, 0, 0/, -210/
+>
+primitive
+<
+94505044027104 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044026944 8 0 ^
+primitive
+<
+94505044025984 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505044026784 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044026624 8 0 ^
+primitive
+<
+94505044026144 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044026464 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044026304 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044542976 -32
+user_attribute
+\
+94505044542768 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044493360 1 0 
+primitive
+<
+94505044543904 3 0 -
+primitive
+<
+94505044543744 8 0 +
+primitive
+<
+94505044543584 8 0 ^
+primitive
+<
+94505044027904 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505044543424 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044543264 8 0 ^
+primitive
+<
+94505044028064 1 0 
+plane\point\1, 0, 0/, -210/
+>
+primitive
+<
+94505044543104 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044028224 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044493040 51 0 |
+set
+(
+94505044492880 3 0 &
+set
+(
+94505044492720 1 1073741824 
+primitive
+<
+94505044025664 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044492560 2 0 &
+set
+(
+94505044492240 1 0 
+primitive
+<
+94505044024064 4 0 -
+primitive
+<
+94505044023904 8 0 +
+primitive
+<
+94505044023744 8 0 +
+primitive
+<
+94505044023584 8 0 ^
+primitive
+<
+94505044022144 1 0 
+plane\point\1, 0, 0/, -200/
+>
+primitive
+<
+94505044023424 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044023264 8 0 ^
+primitive
+<
+94505044022304 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505044023104 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044022944 8 0 ^
+primitive
+<
+94505044022464 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044022784 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044022624 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044542544 -32
+user_attribute
+\
+94505044542336 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044492400 1 0 
+primitive
+<
+94505044025504 3 0 -
+primitive
+<
+94505044025344 8 0 +
+primitive
+<
+94505044025184 8 0 ^
+primitive
+<
+94505044024224 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505044025024 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044024864 8 0 ^
+primitive
+<
+94505044024384 1 0 
+plane\point\1, 0, 0/, -200/
+>
+primitive
+<
+94505044024704 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044024544 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044492080 48 0 |
+set
+(
+94505044491920 3 0 &
+set
+(
+94505044491760 1 1073741824 
+primitive
+<
+94505044021984 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044491600 2 0 &
+set
+(
+94505044491280 1 0 
+primitive
+<
+94505044020384 4 0 -
+primitive
+<
+94505044020224 8 0 +
+primitive
+<
+94505044020064 8 0 +
+primitive
+<
+94505044019904 8 0 ^
+primitive
+<
+94505044018464 1 0 
+plane\point\1, 0, 0/, -210/
+>
+primitive
+<
+94505044019744 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044019584 8 0 ^
+primitive
+<
+94505044018624 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505044019424 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044019264 8 0 ^
+primitive
+<
+94505044018784 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044019104 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044018944 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044439008 -32
+user_attribute
+\
+94505044438800 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044491440 1 0 
+primitive
+<
+94505044021824 3 0 -
+primitive
+<
+94505044021664 8 0 +
+primitive
+<
+94505044021504 8 0 ^
+primitive
+<
+94505044020544 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505044021344 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044021184 8 0 ^
+primitive
+<
+94505044020704 1 0 
+plane\point\1, 0, 0/, -210/
+>
+primitive
+<
+94505044021024 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044020864 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044491120 45 0 |
+set
+(
+94505044490960 3 0 &
+set
+(
+94505044490800 1 1073741824 
+primitive
+<
+94505044018304 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044490640 2 0 &
+set
+(
+94505044490320 1 0 
+primitive
+<
+94505044016704 4 0 -
+primitive
+<
+94505044016544 8 0 +
+primitive
+<
+94505044016384 8 0 +
+primitive
+<
+94505044016224 8 0 ^
+primitive
+<
+94505044014784 1 0 
+plane\point\1, 0, 0/, -190/
+>
+primitive
+<
+94505044016064 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044015904 8 0 ^
+primitive
+<
+94505044014944 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505044015744 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044015584 8 0 ^
+primitive
+<
+94505044015104 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044015424 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044015264 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044438544 -32
+user_attribute
+\
+94505044438336 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044490480 1 0 
+primitive
+<
+94505044018144 3 0 -
+primitive
+<
+94505044017984 8 0 +
+primitive
+<
+94505044017824 8 0 ^
+primitive
+<
+94505044016864 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505044017664 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044017504 8 0 ^
+primitive
+<
+94505044017024 1 0 
+plane\point\1, 0, 0/, -190/
+>
+primitive
+<
+94505044017344 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044017184 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044490160 42 0 |
+set
+(
+94505044490000 3 0 &
+set
+(
+94505044489840 1 1073741824 
+primitive
+<
+94505044014624 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044489680 2 0 &
+set
+(
+94505044489360 1 0 
+primitive
+<
+94505044013024 4 0 -
+primitive
+<
+94505044012864 8 0 +
+primitive
+<
+94505044012704 8 0 +
+primitive
+<
+94505044012544 8 0 ^
+primitive
+<
+94505044011104 1 0 
+plane\point\1, 0, 0/, -180/
+>
+primitive
+<
+94505044012384 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044012224 8 0 ^
+primitive
+<
+94505044011264 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505044012064 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044011904 8 0 ^
+primitive
+<
+94505044011424 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044011744 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044011584 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044438080 -32
+user_attribute
+\
+94505044437872 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044489520 1 0 
+primitive
+<
+94505044014464 3 0 -
+primitive
+<
+94505044014304 8 0 +
+primitive
+<
+94505044014144 8 0 ^
+primitive
+<
+94505044013184 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505044013984 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044013824 8 0 ^
+primitive
+<
+94505044013344 1 0 
+plane\point\1, 0, 0/, -180/
+>
+primitive
+<
+94505044013664 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044013504 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044489200 39 0 |
+set
+(
+94505044489040 3 0 &
+set
+(
+94505044488880 1 1073741824 
+primitive
+<
+94505044010944 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044488720 2 0 &
+set
+(
+94505044488400 1 0 
+primitive
+<
+94505044009344 4 0 -
+primitive
+<
+94505044009184 8 0 +
+primitive
+<
+94505044009024 8 0 +
+primitive
+<
+94505044008864 8 0 ^
+primitive
+<
+94505044007424 1 0 
+plane\point\1, 0, 0/, -190/
+>
+primitive
+<
+94505044008704 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044008544 8 0 ^
+primitive
+<
+94505044007584 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505044008384 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044008224 8 0 ^
+primitive
+<
+94505044007744 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044008064 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044007904 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044437616 -32
+user_attribute
+\
+94505044437408 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044488560 1 0 
+primitive
+<
+94505044010784 3 0 -
+primitive
+<
+94505044010624 8 0 +
+primitive
+<
+94505044010464 8 0 ^
+primitive
+<
+94505044009504 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505044010304 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044010144 8 0 ^
+primitive
+<
+94505044009664 1 0 
+plane\point\1, 0, 0/, -190/
+>
+primitive
+<
+94505044009984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044009824 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044488240 36 0 |
+set
+(
+94505044488080 3 0 &
+set
+(
+94505044487920 1 1073741824 
+primitive
+<
+94505044007264 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044487760 2 0 &
+set
+(
+94505044487440 1 0 
+primitive
+<
+94505044005664 4 0 -
+primitive
+<
+94505044005504 8 0 +
+primitive
+<
+94505044005344 8 0 +
+primitive
+<
+94505044005184 8 0 ^
+primitive
+<
+94505044003744 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505044005024 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044004864 8 0 ^
+primitive
+<
+94505044003904 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505044004704 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044004544 8 0 ^
+primitive
+<
+94505044004064 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044004384 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044004224 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044437152 -32
+user_attribute
+\
+94505044436944 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044487600 1 0 
+primitive
+<
+94505044007104 3 0 -
+primitive
+<
+94505044006944 8 0 +
+primitive
+<
+94505044006784 8 0 ^
+primitive
+<
+94505044005824 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505044006624 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044006464 8 0 ^
+primitive
+<
+94505044005984 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505044006304 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044006144 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044487280 33 0 |
+set
+(
+94505044487120 3 0 &
+set
+(
+94505044486960 1 1073741824 
+primitive
+<
+94505044003584 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044486800 2 0 &
+set
+(
+94505044486480 1 0 
+primitive
+<
+94505044001984 4 0 -
+primitive
+<
+94505044001824 8 0 +
+primitive
+<
+94505044001664 8 0 +
+primitive
+<
+94505044001504 8 0 ^
+primitive
+<
+94505044000064 1 0 
+plane\point\1, 0, 0/, -160/
+>
+primitive
+<
+94505044001344 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044001184 8 0 ^
+primitive
+<
+94505044000224 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505044001024 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044000864 8 0 ^
+primitive
+<
+94505044000384 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505044000704 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044000544 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044436688 -32
+user_attribute
+\
+94505044436480 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044486640 1 0 
+primitive
+<
+94505044003424 3 0 -
+primitive
+<
+94505044003264 8 0 +
+primitive
+<
+94505044003104 8 0 ^
+primitive
+<
+94505044002144 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505044002944 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044002784 8 0 ^
+primitive
+<
+94505044002304 1 0 
+plane\point\1, 0, 0/, -160/
+>
+primitive
+<
+94505044002624 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044002464 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044486320 30 0 |
+set
+(
+94505044486160 3 0 &
+set
+(
+94505044486000 1 1073741824 
+primitive
+<
+94505043999904 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044485840 2 0 &
+set
+(
+94505044485520 1 0 
+primitive
+<
+94505043998304 4 0 -
+primitive
+<
+94505043998144 8 0 +
+primitive
+<
+94505043997984 8 0 +
+primitive
+<
+94505043997824 8 0 ^
+primitive
+<
+94505043996384 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505043997664 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043997504 8 0 ^
+primitive
+<
+94505043996544 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505043997344 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043997184 8 0 ^
+primitive
+<
+94505043996704 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043997024 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043996864 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044436224 -32
+user_attribute
+\
+94505044436016 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044485680 1 0 
+primitive
+<
+94505043999744 3 0 -
+primitive
+<
+94505043999584 8 0 +
+primitive
+<
+94505043999424 8 0 ^
+primitive
+<
+94505043998464 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505043999264 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043999104 8 0 ^
+primitive
+<
+94505043998624 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505043998944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043998784 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044485360 27 0 |
+set
+(
+94505044485200 3 0 &
+set
+(
+94505044485040 1 1073741824 
+primitive
+<
+94505043996224 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044484880 2 0 &
+set
+(
+94505044484560 1 0 
+primitive
+<
+94505043994624 4 0 -
+primitive
+<
+94505043994464 8 0 +
+primitive
+<
+94505043994304 8 0 +
+primitive
+<
+94505043994144 8 0 ^
+primitive
+<
+94505043992704 1 0 
+plane\point\1, 0, 0/, -160/
+>
+primitive
+<
+94505043993984 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043993824 8 0 ^
+primitive
+<
+94505043992864 1 0 
+plane\point\0, 1, 0/, -40/
+>
+primitive
+<
+94505043993664 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043993504 8 0 ^
+primitive
+<
+94505043993024 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043993344 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043993184 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044435760 -32
+user_attribute
+\
+94505044435552 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044484720 1 0 
+primitive
+<
+94505043996064 3 0 -
+primitive
+<
+94505043995904 8 0 +
+primitive
+<
+94505043995744 8 0 ^
+primitive
+<
+94505043994784 1 0 
+plane\point\0, 1, 0/, -40/
+>
+primitive
+<
+94505043995584 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043995424 8 0 ^
+primitive
+<
+94505043994944 1 0 
+plane\point\1, 0, 0/, -160/
+>
+primitive
+<
+94505043995264 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043995104 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044484400 24 0 |
+set
+(
+94505044484240 3 0 &
+set
+(
+94505044484080 1 1073741824 
+primitive
+<
+94505043992544 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044483920 2 0 &
+set
+(
+94505044483600 1 0 
+primitive
+<
+94505043990944 4 0 -
+primitive
+<
+94505043990784 8 0 +
+primitive
+<
+94505043990624 8 0 +
+primitive
+<
+94505043990464 8 0 ^
+primitive
+<
+94505043989024 1 0 
+plane\point\1, 0, 0/, -150/
+>
+primitive
+<
+94505043990304 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043990144 8 0 ^
+primitive
+<
+94505043989184 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505043989984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043989824 8 0 ^
+primitive
+<
+94505043989344 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043989664 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043989504 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044435296 -32
+user_attribute
+\
+94505044435088 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044483760 1 0 
+primitive
+<
+94505043992384 3 0 -
+primitive
+<
+94505043992224 8 0 +
+primitive
+<
+94505043992064 8 0 ^
+primitive
+<
+94505043991104 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505043991904 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043991744 8 0 ^
+primitive
+<
+94505043991264 1 0 
+plane\point\1, 0, 0/, -150/
+>
+primitive
+<
+94505043991584 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043991424 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044483440 21 0 |
+set
+(
+94505044483280 3 0 &
+set
+(
+94505044483120 1 1073741824 
+primitive
+<
+94505043988864 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044482960 2 0 &
+set
+(
+94505044482640 1 0 
+primitive
+<
+94505043987264 4 0 -
+primitive
+<
+94505043987104 8 0 +
+primitive
+<
+94505043986944 8 0 +
+primitive
+<
+94505043986784 8 0 ^
+primitive
+<
+94505043985344 1 0 
+plane\point\1, 0, 0/, -140/
+>
+primitive
+<
+94505043986624 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043986464 8 0 ^
+primitive
+<
+94505043985504 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505043986304 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043986144 8 0 ^
+primitive
+<
+94505043985664 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043985984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043985824 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044434832 -32
+user_attribute
+\
+94505044434624 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044482800 1 0 
+primitive
+<
+94505043988704 3 0 -
+primitive
+<
+94505043988544 8 0 +
+primitive
+<
+94505043988384 8 0 ^
+primitive
+<
+94505043987424 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505043988224 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043988064 8 0 ^
+primitive
+<
+94505043987584 1 0 
+plane\point\1, 0, 0/, -140/
+>
+primitive
+<
+94505043987904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043987744 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044482480 18 0 |
+set
+(
+94505044482320 3 0 &
+set
+(
+94505044482160 1 1073741824 
+primitive
+<
+94505043985184 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044482000 2 0 &
+set
+(
+94505044481680 1 0 
+primitive
+<
+94505043983584 4 0 -
+primitive
+<
+94505043983424 8 0 +
+primitive
+<
+94505043983264 8 0 +
+primitive
+<
+94505043983104 8 0 ^
+primitive
+<
+94505043981664 1 0 
+plane\point\1, 0, 0/, -150/
+>
+primitive
+<
+94505043982944 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043982784 8 0 ^
+primitive
+<
+94505043981824 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505043982624 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043982464 8 0 ^
+primitive
+<
+94505043981984 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043982304 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043982144 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044434368 -32
+user_attribute
+\
+94505044434160 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044481840 1 0 
+primitive
+<
+94505043985024 3 0 -
+primitive
+<
+94505043984864 8 0 +
+primitive
+<
+94505043984704 8 0 ^
+primitive
+<
+94505043983744 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505043984544 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043984384 8 0 ^
+primitive
+<
+94505043983904 1 0 
+plane\point\1, 0, 0/, -150/
+>
+primitive
+<
+94505043984224 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043984064 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044481520 15 0 |
+set
+(
+94505044481360 3 0 &
+set
+(
+94505044481200 1 1073741824 
+primitive
+<
+94505043981504 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044481040 2 0 &
+set
+(
+94505044480720 1 0 
+primitive
+<
+94505043979904 4 0 -
+primitive
+<
+94505043979744 8 0 +
+primitive
+<
+94505043979584 8 0 +
+primitive
+<
+94505043979424 8 0 ^
+primitive
+<
+94505043977984 1 0 
+plane\point\1, 0, 0/, -140/
+>
+primitive
+<
+94505043979264 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043979104 8 0 ^
+primitive
+<
+94505043978144 1 0 
+plane\point\0, 1, 0/, -40/
+>
+primitive
+<
+94505043978944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043978784 8 0 ^
+primitive
+<
+94505043978304 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043978624 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043978464 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044433904 -32
+user_attribute
+\
+94505044433696 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044480880 1 0 
+primitive
+<
+94505043981344 3 0 -
+primitive
+<
+94505043981184 8 0 +
+primitive
+<
+94505043981024 8 0 ^
+primitive
+<
+94505043980064 1 0 
+plane\point\0, 1, 0/, -40/
+>
+primitive
+<
+94505043980864 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043980704 8 0 ^
+primitive
+<
+94505043980224 1 0 
+plane\point\1, 0, 0/, -140/
+>
+primitive
+<
+94505043980544 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043980384 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044480560 12 0 |
+set
+(
+94505044480400 3 0 &
+set
+(
+94505044480240 1 1073741824 
+primitive
+<
+94505043977824 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044480080 2 0 &
+set
+(
+94505044479760 1 0 
+primitive
+<
+94505043976224 4 0 -
+primitive
+<
+94505043976064 8 0 +
+primitive
+<
+94505043975904 8 0 +
+primitive
+<
+94505043975744 8 0 ^
+primitive
+<
+94505043974304 1 0 
+plane\point\1, 0, 0/, -130/
+>
+primitive
+<
+94505043975584 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043975424 8 0 ^
+primitive
+<
+94505043974464 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505043975264 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043975104 8 0 ^
+primitive
+<
+94505043974624 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043974944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043974784 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044433440 -32
+user_attribute
+\
+94505044433232 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044479920 1 0 
+primitive
+<
+94505043977664 3 0 -
+primitive
+<
+94505043977504 8 0 +
+primitive
+<
+94505043977344 8 0 ^
+primitive
+<
+94505043976384 1 0 
+plane\point\0, 1, 0/, -91.9615/
+>
+primitive
+<
+94505043977184 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043977024 8 0 ^
+primitive
+<
+94505043976544 1 0 
+plane\point\1, 0, 0/, -130/
+>
+primitive
+<
+94505043976864 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043976704 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044479600 9 0 |
+set
+(
+94505044479440 3 0 &
+set
+(
+94505044479280 1 1073741824 
+primitive
+<
+94505043974144 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044479120 2 0 &
+set
+(
+94505044478800 1 0 
+primitive
+<
+94505043972544 4 0 -
+primitive
+<
+94505043972384 8 0 +
+primitive
+<
+94505043972224 8 0 +
+primitive
+<
+94505043972064 8 0 ^
+primitive
+<
+94505043970624 1 0 
+plane\point\1, 0, 0/, -120/
+>
+primitive
+<
+94505043971904 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043971744 8 0 ^
+primitive
+<
+94505043970784 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505043971584 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043971424 8 0 ^
+primitive
+<
+94505043970944 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043971264 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043971104 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044432976 -32
+user_attribute
+\
+94505044432768 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044478960 1 0 
+primitive
+<
+94505043973984 3 0 -
+primitive
+<
+94505043973824 8 0 +
+primitive
+<
+94505043973664 8 0 ^
+primitive
+<
+94505043972704 1 0 
+plane\point\0, 1, 0/, -74.641/
+>
+primitive
+<
+94505043973504 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043973344 8 0 ^
+primitive
+<
+94505043972864 1 0 
+plane\point\1, 0, 0/, -120/
+>
+primitive
+<
+94505043973184 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043973024 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044478640 6 0 |
+set
+(
+94505044477840 3 0 &
+set
+(
+94505044477680 1 1073741824 
+primitive
+<
+94505043966784 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044477520 2 0 &
+set
+(
+94505044477200 1 0 
+primitive
+<
+94505043965184 4 0 -
+primitive
+<
+94505043965024 8 0 +
+primitive
+<
+94505043964864 8 0 +
+primitive
+<
+94505043964704 8 0 ^
+primitive
+<
+94505043963264 1 0 
+plane\point\1, 0, 0/, -120/
+>
+primitive
+<
+94505043964544 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043964384 8 0 ^
+primitive
+<
+94505043963424 1 0 
+plane\point\0, 1, 0/, -40/
+>
+primitive
+<
+94505043964224 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043964064 8 0 ^
+primitive
+<
+94505043963584 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043963904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043963744 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044432048 -32
+user_attribute
+\
+94505044431840 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044477360 1 0 
+primitive
+<
+94505043966624 3 0 -
+primitive
+<
+94505043966464 8 0 +
+primitive
+<
+94505043966304 8 0 ^
+primitive
+<
+94505043965344 1 0 
+plane\point\0, 1, 0/, -40/
+>
+primitive
+<
+94505043966144 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043965984 8 0 ^
+primitive
+<
+94505043965504 1 0 
+plane\point\1, 0, 0/, -120/
+>
+primitive
+<
+94505043965824 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043965664 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044478480 3 0 &
+set
+(
+94505044478320 1 1073741824 
+primitive
+<
+94505043970464 1 0 
+plane\point\-0, -0, -1/, 0/
+>
+0
+0
+)
+set
+(
+94505044478160 2 0 &
+set
+(
+94505044476880 1 0 
+primitive
+<
+94505043968864 4 0 -
+primitive
+<
+94505043968704 8 0 +
+primitive
+<
+94505043968544 8 0 +
+primitive
+<
+94505043968384 8 0 ^
+primitive
+<
+94505043966944 1 0 
+plane\point\1, 0, 0/, -130/
+>
+primitive
+<
+94505043968224 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043968064 8 0 ^
+primitive
+<
+94505043967104 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505043967904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043967744 8 0 ^
+primitive
+<
+94505043967264 1 0 
+plane\point\0, 0, 1/, 24/
+>
+primitive
+<
+94505043967584 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043967424 0 0 
+1024
+>
+0
+>
+1
+attribute
+<
+94505044432512 -32
+user_attribute
+\
+94505044432304 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+set
+(
+94505044478000 1 0 
+primitive
+<
+94505043970304 3 0 -
+primitive
+<
+94505043970144 8 0 +
+primitive
+<
+94505043969984 8 0 ^
+primitive
+<
+94505043969024 1 0 
+plane\point\0, 1, 0/, -57.3205/
+>
+primitive
+<
+94505043969824 0 0 
+2
+>
+0
+>
+primitive
+<
+94505043969664 8 0 ^
+primitive
+<
+94505043969184 1 0 
+plane\point\1, 0, 0/, -130/
+>
+primitive
+<
+94505043969504 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505043969344 0 0 
+64
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505044610224 -32
+user_attribute
+\
+94505044610016 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+set
+(
+94505044520080 65 0 |
+set
+(
+94505044519920 13 0 |
+set
+(
+94505044516880 5 0 |
+set
+(
+94505044515600 1 0 
+primitive
+<
+94505044587264 4 0 -
+primitive
+<
+94505044587104 8 0 +
+primitive
+<
+94505044586944 8 0 +
+primitive
+<
+94505044586784 8 0 ^
+primitive
+<
+94505044585344 1 0 
+plane\point\1, 0, 0/, -193/
+>
+primitive
+<
+94505044586624 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044586464 8 0 ^
+primitive
+<
+94505044585504 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505044586304 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044586144 8 0 ^
+primitive
+<
+94505044585664 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044585984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044585824 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044516720 4 0 |
+set
+(
+94505044515760 1 0 
+primitive
+<
+94505044589344 4 0 -
+primitive
+<
+94505044589184 8 0 +
+primitive
+<
+94505044589024 8 0 +
+primitive
+<
+94505044588864 8 0 ^
+primitive
+<
+94505044587424 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505044588704 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044588544 8 0 ^
+primitive
+<
+94505044587584 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505044588384 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044588224 8 0 ^
+primitive
+<
+94505044587744 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044588064 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044587904 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044516560 3 0 &
+set
+(
+94505044516080 1 1073741824 
+primitive
+<
+94505044590944 1 0 
+plane\point\1, 0, 0/, -193/
+>
+0
+0
+)
+set
+(
+94505044516400 2 0 &
+set
+(
+94505044516240 1 1073741824 
+primitive
+<
+94505044591104 1 0 
+plane\point\-1, -0, -0/, 170/
+>
+0
+0
+)
+set
+(
+94505044515920 1 0 
+primitive
+<
+94505044590784 3 0 -
+primitive
+<
+94505044590624 8 0 +
+primitive
+<
+94505044590464 8 0 ^
+primitive
+<
+94505044589504 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044590304 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044590144 8 0 ^
+primitive
+<
+94505044589664 1 0 
+plane\point\0, 1, 0/, -160/
+>
+primitive
+<
+94505044589984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044589824 0 0 
+9
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044519760 8 0 &
+set
+(
+94505044519600 2 0 |
+set
+(
+94505044519440 1 1073741824 
+primitive
+<
+94505044592704 1 0 
+plane\point\1, 0, 0/, -171.8/
+>
+0
+1
+set
+(
+94505044518960 1 1073741824 
+primitive
+<
+94505044592384 1 0 
+plane\point\-1, -0, -0/, 171.8/
+>
+0
+0
+)
+)
+set
+(
+94505044519280 1 1073741824 
+primitive
+<
+94505044592544 1 0 
+plane\point\-1, -0, -0/, 191.2/
+>
+0
+1
+set
+(
+94505044518800 1 1073741824 
+primitive
+<
+94505044592224 1 0 
+plane\point\1, 0, 0/, -191.2/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044519120 2 1073741824 &
+set
+(
+94505044518960 )
+set
+(
+94505044518800 )
+0
+0
+)
+)
+set
+(
+94505044518640 6 1073741824 &
+set
+(
+94505044518160 1 1073741824 
+primitive
+<
+94505044591904 1 0 
+plane\point\1, 0, 0/, -191.5/
+>
+0
+0
+)
+set
+(
+94505044518480 5 1073741824 &
+set
+(
+94505044518320 1 1073741824 
+primitive
+<
+94505044592064 1 0 
+plane\point\-1, -0, -0/, 171.5/
+>
+0
+0
+)
+set
+(
+94505044518000 4 1073741824 &
+set
+(
+94505044517520 1 1073741824 
+primitive
+<
+94505044591744 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+0
+0
+)
+set
+(
+94505044517840 3 1073741824 &
+set
+(
+94505044517360 1 1073741824 
+primitive
+<
+94505044591584 1 0 
+plane\point\-0, -0.955337, 0.29552/, 149.919/
+>
+0
+0
+)
+set
+(
+94505044517680 2 1073741824 &
+set
+(
+94505044517040 1 1073741824 
+primitive
+<
+94505044591264 1 0 
+plane\point\-0, -0, -1/, -0.0599999/
+>
+0
+0
+)
+set
+(
+94505044517200 1 1073741824 
+primitive
+<
+94505044591424 1 0 
+plane\point\0, 0.955337, 0.29552/, -155.789/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044515440 52 0 |
+set
+(
+94505044515280 13 0 |
+set
+(
+94505044512240 5 0 |
+set
+(
+94505044510960 1 0 
+primitive
+<
+94505044579744 4 0 -
+primitive
+<
+94505044579584 8 0 +
+primitive
+<
+94505044579424 8 0 +
+primitive
+<
+94505044579264 8 0 ^
+primitive
+<
+94505044577824 1 0 
+plane\point\1, 0, 0/, -193/
+>
+primitive
+<
+94505044579104 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044578944 8 0 ^
+primitive
+<
+94505044577984 1 0 
+plane\point\0, 1, 0/, -150/
+>
+primitive
+<
+94505044578784 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044578624 8 0 ^
+primitive
+<
+94505044578144 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044578464 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044578304 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044512080 4 0 |
+set
+(
+94505044511120 1 0 
+primitive
+<
+94505044581824 4 0 -
+primitive
+<
+94505044581664 8 0 +
+primitive
+<
+94505044581504 8 0 +
+primitive
+<
+94505044581344 8 0 ^
+primitive
+<
+94505044579904 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505044581184 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044581024 8 0 ^
+primitive
+<
+94505044580064 1 0 
+plane\point\0, 1, 0/, -150/
+>
+primitive
+<
+94505044580864 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044580704 8 0 ^
+primitive
+<
+94505044580224 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044580544 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044580384 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044511920 3 0 &
+set
+(
+94505044511440 1 1073741824 
+primitive
+<
+94505044583424 1 0 
+plane\point\1, 0, 0/, -193/
+>
+0
+0
+)
+set
+(
+94505044511760 2 0 &
+set
+(
+94505044511600 1 1073741824 
+primitive
+<
+94505044583584 1 0 
+plane\point\-1, -0, -0/, 170/
+>
+0
+0
+)
+set
+(
+94505044511280 1 0 
+primitive
+<
+94505044583264 3 0 -
+primitive
+<
+94505044583104 8 0 +
+primitive
+<
+94505044582944 8 0 ^
+primitive
+<
+94505044581984 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044582784 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044582624 8 0 ^
+primitive
+<
+94505044582144 1 0 
+plane\point\0, 1, 0/, -150/
+>
+primitive
+<
+94505044582464 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044582304 0 0 
+9
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044515120 8 0 &
+set
+(
+94505044514960 2 0 |
+set
+(
+94505044514800 1 1073741824 
+primitive
+<
+94505044585184 1 0 
+plane\point\1, 0, 0/, -171.8/
+>
+0
+1
+set
+(
+94505044514320 1 1073741824 
+primitive
+<
+94505044584864 1 0 
+plane\point\-1, -0, -0/, 171.8/
+>
+0
+0
+)
+)
+set
+(
+94505044514640 1 1073741824 
+primitive
+<
+94505044585024 1 0 
+plane\point\-1, -0, -0/, 191.2/
+>
+0
+1
+set
+(
+94505044514160 1 1073741824 
+primitive
+<
+94505044584704 1 0 
+plane\point\1, 0, 0/, -191.2/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044514480 2 1073741824 &
+set
+(
+94505044514320 )
+set
+(
+94505044514160 )
+0
+0
+)
+)
+set
+(
+94505044514000 6 1073741824 &
+set
+(
+94505044513520 1 1073741824 
+primitive
+<
+94505044584384 1 0 
+plane\point\1, 0, 0/, -191.5/
+>
+0
+0
+)
+set
+(
+94505044513840 5 1073741824 &
+set
+(
+94505044513680 1 1073741824 
+primitive
+<
+94505044584544 1 0 
+plane\point\-1, -0, -0/, 171.5/
+>
+0
+0
+)
+set
+(
+94505044513360 4 1073741824 &
+set
+(
+94505044512880 1 1073741824 
+primitive
+<
+94505044584224 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+0
+0
+)
+set
+(
+94505044513200 3 1073741824 &
+set
+(
+94505044512720 1 1073741824 
+primitive
+<
+94505044584064 1 0 
+plane\point\-0, -0.955337, 0.29552/, 140.366/
+>
+0
+0
+)
+set
+(
+94505044513040 2 1073741824 &
+set
+(
+94505044512400 1 1073741824 
+primitive
+<
+94505044583744 1 0 
+plane\point\-0, -0, -1/, -0.0599999/
+>
+0
+0
+)
+set
+(
+94505044512560 1 1073741824 
+primitive
+<
+94505044583904 1 0 
+plane\point\0, 0.955337, 0.29552/, -146.235/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044510800 39 0 |
+set
+(
+94505044510640 13 0 |
+set
+(
+94505044507600 5 0 |
+set
+(
+94505044506320 1 0 
+primitive
+<
+94505044572224 4 0 -
+primitive
+<
+94505044572064 8 0 +
+primitive
+<
+94505044571904 8 0 +
+primitive
+<
+94505044571744 8 0 ^
+primitive
+<
+94505044570304 1 0 
+plane\point\1, 0, 0/, -193/
+>
+primitive
+<
+94505044571584 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044571424 8 0 ^
+primitive
+<
+94505044570464 1 0 
+plane\point\0, 1, 0/, -140/
+>
+primitive
+<
+94505044571264 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044571104 8 0 ^
+primitive
+<
+94505044570624 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044570944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044570784 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044507440 4 0 |
+set
+(
+94505044506480 1 0 
+primitive
+<
+94505044574304 4 0 -
+primitive
+<
+94505044574144 8 0 +
+primitive
+<
+94505044573984 8 0 +
+primitive
+<
+94505044573824 8 0 ^
+primitive
+<
+94505044572384 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505044573664 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044573504 8 0 ^
+primitive
+<
+94505044572544 1 0 
+plane\point\0, 1, 0/, -140/
+>
+primitive
+<
+94505044573344 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044573184 8 0 ^
+primitive
+<
+94505044572704 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044573024 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044572864 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044507280 3 0 &
+set
+(
+94505044506800 1 1073741824 
+primitive
+<
+94505044575904 1 0 
+plane\point\1, 0, 0/, -193/
+>
+0
+0
+)
+set
+(
+94505044507120 2 0 &
+set
+(
+94505044506960 1 1073741824 
+primitive
+<
+94505044576064 1 0 
+plane\point\-1, -0, -0/, 170/
+>
+0
+0
+)
+set
+(
+94505044506640 1 0 
+primitive
+<
+94505044575744 3 0 -
+primitive
+<
+94505044575584 8 0 +
+primitive
+<
+94505044575424 8 0 ^
+primitive
+<
+94505044574464 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044575264 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044575104 8 0 ^
+primitive
+<
+94505044574624 1 0 
+plane\point\0, 1, 0/, -140/
+>
+primitive
+<
+94505044574944 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044574784 0 0 
+9
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044510480 8 0 &
+set
+(
+94505044510320 2 0 |
+set
+(
+94505044510160 1 1073741824 
+primitive
+<
+94505044577664 1 0 
+plane\point\1, 0, 0/, -171.8/
+>
+0
+1
+set
+(
+94505044509680 1 1073741824 
+primitive
+<
+94505044577344 1 0 
+plane\point\-1, -0, -0/, 171.8/
+>
+0
+0
+)
+)
+set
+(
+94505044510000 1 1073741824 
+primitive
+<
+94505044577504 1 0 
+plane\point\-1, -0, -0/, 191.2/
+>
+0
+1
+set
+(
+94505044509520 1 1073741824 
+primitive
+<
+94505044577184 1 0 
+plane\point\1, 0, 0/, -191.2/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044509840 2 1073741824 &
+set
+(
+94505044509680 )
+set
+(
+94505044509520 )
+0
+0
+)
+)
+set
+(
+94505044509360 6 1073741824 &
+set
+(
+94505044508880 1 1073741824 
+primitive
+<
+94505044576864 1 0 
+plane\point\1, 0, 0/, -191.5/
+>
+0
+0
+)
+set
+(
+94505044509200 5 1073741824 &
+set
+(
+94505044509040 1 1073741824 
+primitive
+<
+94505044577024 1 0 
+plane\point\-1, -0, -0/, 171.5/
+>
+0
+0
+)
+set
+(
+94505044508720 4 1073741824 &
+set
+(
+94505044508240 1 1073741824 
+primitive
+<
+94505044576704 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+0
+0
+)
+set
+(
+94505044508560 3 1073741824 &
+set
+(
+94505044508080 1 1073741824 
+primitive
+<
+94505044576544 1 0 
+plane\point\-0, -0.955337, 0.29552/, 130.812/
+>
+0
+0
+)
+set
+(
+94505044508400 2 1073741824 &
+set
+(
+94505044507760 1 1073741824 
+primitive
+<
+94505044576224 1 0 
+plane\point\-0, -0, -1/, -0.0599999/
+>
+0
+0
+)
+set
+(
+94505044507920 1 1073741824 
+primitive
+<
+94505044576384 1 0 
+plane\point\0, 0.955337, 0.29552/, -136.682/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044506160 26 0 |
+set
+(
+94505044501680 13 0 |
+set
+(
+94505044498640 5 0 |
+set
+(
+94505044497360 1 0 
+primitive
+<
+94505044557184 4 0 -
+primitive
+<
+94505044557024 8 0 +
+primitive
+<
+94505044556864 8 0 +
+primitive
+<
+94505044556704 8 0 ^
+primitive
+<
+94505044555264 1 0 
+plane\point\1, 0, 0/, -193/
+>
+primitive
+<
+94505044556544 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044556384 8 0 ^
+primitive
+<
+94505044555424 1 0 
+plane\point\0, 1, 0/, -120/
+>
+primitive
+<
+94505044556224 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044556064 8 0 ^
+primitive
+<
+94505044555584 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044555904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044555744 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044498480 4 0 |
+set
+(
+94505044497520 1 0 
+primitive
+<
+94505044559264 4 0 -
+primitive
+<
+94505044559104 8 0 +
+primitive
+<
+94505044558944 8 0 +
+primitive
+<
+94505044558784 8 0 ^
+primitive
+<
+94505044557344 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505044558624 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044558464 8 0 ^
+primitive
+<
+94505044557504 1 0 
+plane\point\0, 1, 0/, -120/
+>
+primitive
+<
+94505044558304 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044558144 8 0 ^
+primitive
+<
+94505044557664 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044557984 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044557824 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044498320 3 0 &
+set
+(
+94505044497840 1 1073741824 
+primitive
+<
+94505044560864 1 0 
+plane\point\1, 0, 0/, -193/
+>
+0
+0
+)
+set
+(
+94505044498160 2 0 &
+set
+(
+94505044498000 1 1073741824 
+primitive
+<
+94505044561024 1 0 
+plane\point\-1, -0, -0/, 170/
+>
+0
+0
+)
+set
+(
+94505044497680 1 0 
+primitive
+<
+94505044560704 3 0 -
+primitive
+<
+94505044560544 8 0 +
+primitive
+<
+94505044560384 8 0 ^
+primitive
+<
+94505044559424 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044560224 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044560064 8 0 ^
+primitive
+<
+94505044559584 1 0 
+plane\point\0, 1, 0/, -120/
+>
+primitive
+<
+94505044559904 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044559744 0 0 
+9
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044501520 8 0 &
+set
+(
+94505044501360 2 0 |
+set
+(
+94505044501200 1 1073741824 
+primitive
+<
+94505044562624 1 0 
+plane\point\1, 0, 0/, -171.8/
+>
+0
+1
+set
+(
+94505044500720 1 1073741824 
+primitive
+<
+94505044562304 1 0 
+plane\point\-1, -0, -0/, 171.8/
+>
+0
+0
+)
+)
+set
+(
+94505044501040 1 1073741824 
+primitive
+<
+94505044562464 1 0 
+plane\point\-1, -0, -0/, 191.2/
+>
+0
+1
+set
+(
+94505044500560 1 1073741824 
+primitive
+<
+94505044562144 1 0 
+plane\point\1, 0, 0/, -191.2/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044500880 2 1073741824 &
+set
+(
+94505044500720 )
+set
+(
+94505044500560 )
+0
+0
+)
+)
+set
+(
+94505044500400 6 1073741824 &
+set
+(
+94505044499920 1 1073741824 
+primitive
+<
+94505044561824 1 0 
+plane\point\1, 0, 0/, -191.5/
+>
+0
+0
+)
+set
+(
+94505044500240 5 1073741824 &
+set
+(
+94505044500080 1 1073741824 
+primitive
+<
+94505044561984 1 0 
+plane\point\-1, -0, -0/, 171.5/
+>
+0
+0
+)
+set
+(
+94505044499760 4 1073741824 &
+set
+(
+94505044499280 1 1073741824 
+primitive
+<
+94505044561664 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+0
+0
+)
+set
+(
+94505044499600 3 1073741824 &
+set
+(
+94505044499120 1 1073741824 
+primitive
+<
+94505044561504 1 0 
+plane\point\-0, -0.955337, 0.29552/, 111.706/
+>
+0
+0
+)
+set
+(
+94505044499440 2 1073741824 &
+set
+(
+94505044498800 1 1073741824 
+primitive
+<
+94505044561184 1 0 
+plane\point\-0, -0, -1/, -0.0599999/
+>
+0
+0
+)
+set
+(
+94505044498960 1 1073741824 
+primitive
+<
+94505044561344 1 0 
+plane\point\0, 0.955337, 0.29552/, -117.575/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044506000 13 0 |
+set
+(
+94505044502960 5 0 |
+set
+(
+94505044497200 1 0 
+primitive
+<
+94505044564704 4 0 -
+primitive
+<
+94505044564544 8 0 +
+primitive
+<
+94505044564384 8 0 +
+primitive
+<
+94505044564224 8 0 ^
+primitive
+<
+94505044562784 1 0 
+plane\point\1, 0, 0/, -193/
+>
+primitive
+<
+94505044564064 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044563904 8 0 ^
+primitive
+<
+94505044562944 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505044563744 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044563584 8 0 ^
+primitive
+<
+94505044563104 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044563424 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044563264 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044502800 4 0 |
+set
+(
+94505044501840 1 0 
+primitive
+<
+94505044566784 4 0 -
+primitive
+<
+94505044566624 8 0 +
+primitive
+<
+94505044566464 8 0 +
+primitive
+<
+94505044566304 8 0 ^
+primitive
+<
+94505044564864 1 0 
+plane\point\1, 0, 0/, -170/
+>
+primitive
+<
+94505044566144 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044565984 8 0 ^
+primitive
+<
+94505044565024 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505044565824 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044565664 8 0 ^
+primitive
+<
+94505044565184 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044565504 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044565344 0 0 
+9
+>
+0
+>
+0
+0
+)
+set
+(
+94505044502640 3 0 &
+set
+(
+94505044502160 1 1073741824 
+primitive
+<
+94505044568384 1 0 
+plane\point\1, 0, 0/, -193/
+>
+0
+0
+)
+set
+(
+94505044502480 2 0 &
+set
+(
+94505044502320 1 1073741824 
+primitive
+<
+94505044568544 1 0 
+plane\point\-1, -0, -0/, 170/
+>
+0
+0
+)
+set
+(
+94505044502000 1 0 
+primitive
+<
+94505044568224 3 0 -
+primitive
+<
+94505044568064 8 0 +
+primitive
+<
+94505044567904 8 0 ^
+primitive
+<
+94505044566944 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+primitive
+<
+94505044567744 0 0 
+2
+>
+0
+>
+primitive
+<
+94505044567584 8 0 ^
+primitive
+<
+94505044567104 1 0 
+plane\point\0, 1, 0/, -130/
+>
+primitive
+<
+94505044567424 0 0 
+2
+>
+0
+>
+0
+>
+primitive
+<
+94505044567264 0 0 
+9
+>
+0
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044505840 8 0 &
+set
+(
+94505044505680 2 0 |
+set
+(
+94505044505520 1 1073741824 
+primitive
+<
+94505044570144 1 0 
+plane\point\1, 0, 0/, -171.8/
+>
+0
+1
+set
+(
+94505044505040 1 1073741824 
+primitive
+<
+94505044569824 1 0 
+plane\point\-1, -0, -0/, 171.8/
+>
+0
+0
+)
+)
+set
+(
+94505044505360 1 1073741824 
+primitive
+<
+94505044569984 1 0 
+plane\point\-1, -0, -0/, 191.2/
+>
+0
+1
+set
+(
+94505044504880 1 1073741824 
+primitive
+<
+94505044569664 1 0 
+plane\point\1, 0, 0/, -191.2/
+>
+0
+0
+)
+)
+0
+1
+set
+(
+94505044505200 2 1073741824 &
+set
+(
+94505044505040 )
+set
+(
+94505044504880 )
+0
+0
+)
+)
+set
+(
+94505044504720 6 1073741824 &
+set
+(
+94505044504240 1 1073741824 
+primitive
+<
+94505044569344 1 0 
+plane\point\1, 0, 0/, -191.5/
+>
+0
+0
+)
+set
+(
+94505044504560 5 1073741824 &
+set
+(
+94505044504400 1 1073741824 
+primitive
+<
+94505044569504 1 0 
+plane\point\-1, -0, -0/, 171.5/
+>
+0
+0
+)
+set
+(
+94505044504080 4 1073741824 &
+set
+(
+94505044503600 1 1073741824 
+primitive
+<
+94505044569184 1 0 
+plane\point\0, 0, 1/, -3.84/
+>
+0
+0
+)
+set
+(
+94505044503920 3 1073741824 &
+set
+(
+94505044503440 1 1073741824 
+primitive
+<
+94505044569024 1 0 
+plane\point\-0, -0.955337, 0.29552/, 121.259/
+>
+0
+0
+)
+set
+(
+94505044503760 2 1073741824 &
+set
+(
+94505044503120 1 1073741824 
+primitive
+<
+94505044568704 1 0 
+plane\point\-0, -0, -1/, -0.0599999/
+>
+0
+0
+)
+set
+(
+94505044503280 1 1073741824 
+primitive
+<
+94505044568864 1 0 
+plane\point\0, 0.955337, 0.29552/, -127.129/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505044611520 -32
+user_attribute
+\
+94505044611312 32
+surface
+\
+1
+point\0.6, 0.6, 0.7/
+0.4
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044787696 331 0 &
+set
+(
+94505044787536 1 1073741824 
+primitive
+<
+94505044728000 1 0 
+plane\point\0, 0, 1/, -20/
+>
+0
+0
+)
+set
+(
+94505044787376 330 0 |
+set
+(
+94505044787216 66 0 |
+set
+(
+94505044787056 6 1073741824 &
+set
+(
+94505044786896 3 1073741824 &
+set
+(
+94505044786736 1 1073741824 
+primitive
+<
+94505044727840 1 0 
+plane\point\0, 0, -1/, 19.9/
+>
+0
+0
+)
+set
+(
+94505044786576 2 1073741824 &
+set
+(
+94505044786416 1 1073741824 
+primitive
+<
+94505044727680 1 0 
+plane\point\-0.587785, -0.809017, 0/, 151.591/
+>
+0
+0
+)
+set
+(
+94505044786256 1 1073741824 
+primitive
+<
+94505044727520 1 0 
+plane\point\0.809017, -0.587785, 0/, -27.2671/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044786096 3 1073741824 &
+set
+(
+94505044785936 1 1073741824 
+primitive
+<
+94505044727360 1 0 
+plane\point\0, 0, 1/, -20.1/
+>
+0
+0
+)
+set
+(
+94505044785776 2 1073741824 &
+set
+(
+94505044785616 1 1073741824 
+primitive
+<
+94505044727200 1 0 
+plane\point\0.587785, 0.809017, 0/, -155.705/
+>
+0
+0
+)
+set
+(
+94505044785456 1 1073741824 
+primitive
+<
+94505044727040 1 0 
+plane\point\-0.809017, 0.587785, 0/, 27.0671/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044785296 60 0 |
+set
+(
+94505044785136 6 1073741824 &
+set
+(
+94505044784976 3 1073741824 &
+set
+(
+94505044784816 1 1073741824 
+primitive
+<
+94505044726880 1 0 
+plane\point\0.368691, 0.572919, -0.732004/, -90.3275/
+>
+0
+0
+)
+set
+(
+94505044784656 2 1073741824 &
+set
+(
+94505044784496 1 1073741824 
+primitive
+<
+94505044726720 1 0 
+plane\point\-0.396131, -0.615558, -0.6813/, 120.427/
+>
+0
+0
+)
+set
+(
+94505044784336 1 1073741824 
+primitive
+<
+94505044726560 1 0 
+plane\point\0.840921, -0.541159, -8.12173e-08/, -36.0171/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044784176 3 1073741824 &
+set
+(
+94505044784016 1 1073741824 
+primitive
+<
+94505044726400 1 0 
+plane\point\-0.368691, -0.572919, 0.732004/, 90.1275/
+>
+0
+0
+)
+set
+(
+94505044783856 2 1073741824 &
+set
+(
+94505044783696 1 1073741824 
+primitive
+<
+94505044726240 1 0 
+plane\point\0.396131, 0.615558, 0.6813/, -126.298/
+>
+0
+0
+)
+set
+(
+94505044783536 1 1073741824 
+primitive
+<
+94505044726080 1 0 
+plane\point\-0.840921, 0.541159, 8.12173e-08/, 35.8171/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044783376 54 0 |
+set
+(
+94505044783216 6 1073741824 &
+set
+(
+94505044783056 3 1073741824 &
+set
+(
+94505044782896 1 1073741824 
+primitive
+<
+94505044725920 1 0 
+plane\point\0, 0, -1/, 15.9/
+>
+0
+0
+)
+set
+(
+94505044782736 2 1073741824 &
+set
+(
+94505044782576 1 1073741824 
+primitive
+<
+94505044725760 1 0 
+plane\point\-0.587785, -0.809017, 0/, 151.415/
+>
+0
+0
+)
+set
+(
+94505044782416 1 1073741824 
+primitive
+<
+94505044725600 1 0 
+plane\point\0.809017, -0.587785, 0/, -27.5098/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044782256 3 1073741824 &
+set
+(
+94505044782096 1 1073741824 
+primitive
+<
+94505044725440 1 0 
+plane\point\0, 0, 1/, -16.1/
+>
+0
+0
+)
+set
+(
+94505044781936 2 1073741824 &
+set
+(
+94505044781776 1 1073741824 
+primitive
+<
+94505044725280 1 0 
+plane\point\0.587785, 0.809017, 0/, -155.882/
+>
+0
+0
+)
+set
+(
+94505044781616 1 1073741824 
+primitive
+<
+94505044725120 1 0 
+plane\point\-0.809017, 0.587785, 0/, 27.3098/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044781456 48 0 |
+set
+(
+94505044781296 6 1073741824 &
+set
+(
+94505044781136 3 1073741824 &
+set
+(
+94505044780976 1 1073741824 
+primitive
+<
+94505044724960 1 0 
+plane\point\0.355261, 0.546885, -0.758094/, -88.5565/
+>
+0
+0
+)
+set
+(
+94505044780816 2 1073741824 &
+set
+(
+94505044780656 1 1073741824 
+primitive
+<
+94505044724800 1 0 
+plane\point\-0.412977, -0.635733, -0.652145/, 121.228/
+>
+0
+0
+)
+set
+(
+94505044780496 1 1073741824 
+primitive
+<
+94505044724640 1 0 
+plane\point\0.838594, -0.544757, 5.83063e-08/, -35.6088/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044780336 3 1073741824 &
+set
+(
+94505044780176 1 1073741824 
+primitive
+<
+94505044724480 1 0 
+plane\point\-0.355261, -0.546885, 0.758094/, 88.3565/
+>
+0
+0
+)
+set
+(
+94505044780016 2 1073741824 &
+set
+(
+94505044779856 1 1073741824 
+primitive
+<
+94505044724320 1 0 
+plane\point\0.412977, 0.635733, 0.652145/, -127.362/
+>
+0
+0
+)
+set
+(
+94505044779696 1 1073741824 
+primitive
+<
+94505044724160 1 0 
+plane\point\-0.838594, 0.544757, -5.83063e-08/, 35.4088/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044779536 42 0 |
+set
+(
+94505044779376 6 1073741824 &
+set
+(
+94505044779216 3 1073741824 &
+set
+(
+94505044779056 1 1073741824 
+primitive
+<
+94505044724000 1 0 
+plane\point\0, 0, -1/, 11.9/
+>
+0
+0
+)
+set
+(
+94505044778896 2 1073741824 &
+set
+(
+94505044778736 1 1073741824 
+primitive
+<
+94505044723840 1 0 
+plane\point\-0.587785, -0.809017, 0/, 151.238/
+>
+0
+0
+)
+set
+(
+94505044778576 1 1073741824 
+primitive
+<
+94505044723680 1 0 
+plane\point\0.809017, -0.587785, 0/, -27.7525/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044778416 3 1073741824 &
+set
+(
+94505044778256 1 1073741824 
+primitive
+<
+94505044723520 1 0 
+plane\point\0, 0, 1/, -12.1/
+>
+0
+0
+)
+set
+(
+94505044778096 2 1073741824 &
+set
+(
+94505044777936 1 1073741824 
+primitive
+<
+94505044723360 1 0 
+plane\point\0.587785, 0.809017, 0/, -156.058/
+>
+0
+0
+)
+set
+(
+94505044777776 1 1073741824 
+primitive
+<
+94505044723200 1 0 
+plane\point\-0.809017, 0.587785, 0/, 27.5525/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044777616 36 0 |
+set
+(
+94505044777456 6 1073741824 &
+set
+(
+94505044777296 3 1073741824 &
+set
+(
+94505044777136 1 1073741824 
+primitive
+<
+94505044723040 1 0 
+plane\point\0.342145, 0.522479, -0.780995/, -87.2395/
+>
+0
+0
+)
+set
+(
+94505044776976 2 1073741824 &
+set
+(
+94505044776816 1 1073741824 
+primitive
+<
+94505044722880 1 0 
+plane\point\-0.427859, -0.653368, -0.624538/, 121.779/
+>
+0
+0
+)
+set
+(
+94505044776656 1 1073741824 
+primitive
+<
+94505044722720 1 0 
+plane\point\0.836584, -0.547838, 0/, -35.2921/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044776496 3 1073741824 &
+set
+(
+94505044776336 1 1073741824 
+primitive
+<
+94505044722560 1 0 
+plane\point\-0.342145, -0.522479, 0.780995/, 87.0395/
+>
+0
+0
+)
+set
+(
+94505044776176 2 1073741824 &
+set
+(
+94505044776016 1 1073741824 
+primitive
+<
+94505044722400 1 0 
+plane\point\0.427859, 0.653368, 0.624538/, -128.184/
+>
+0
+0
+)
+set
+(
+94505044775856 1 1073741824 
+primitive
+<
+94505044722240 1 0 
+plane\point\-0.836584, 0.547838, 0/, 35.0921/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044775696 30 0 |
+set
+(
+94505044775536 6 1073741824 &
+set
+(
+94505044775376 3 1073741824 &
+set
+(
+94505044775216 1 1073741824 
+primitive
+<
+94505044722080 1 0 
+plane\point\0, 0, -1/, 7.9/
+>
+0
+0
+)
+set
+(
+94505044775056 2 1073741824 &
+set
+(
+94505044774896 1 1073741824 
+primitive
+<
+94505044721920 1 0 
+plane\point\-0.587784, -0.809018, 0/, 151.062/
+>
+0
+0
+)
+set
+(
+94505044774736 1 1073741824 
+primitive
+<
+94505044721760 1 0 
+plane\point\0.809018, -0.587784, 0/, -27.9953/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044774576 3 1073741824 &
+set
+(
+94505044774416 1 1073741824 
+primitive
+<
+94505044721600 1 0 
+plane\point\0, 0, 1/, -8.1/
+>
+0
+0
+)
+set
+(
+94505044774256 2 1073741824 &
+set
+(
+94505044774096 1 1073741824 
+primitive
+<
+94505044721440 1 0 
+plane\point\0.587784, 0.809018, 0/, -156.234/
+>
+0
+0
+)
+set
+(
+94505044773936 1 1073741824 
+primitive
+<
+94505044721280 1 0 
+plane\point\-0.809018, 0.587784, 0/, 27.7953/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044773776 24 0 |
+set
+(
+94505044773616 6 1073741824 &
+set
+(
+94505044773456 3 1073741824 &
+set
+(
+94505044773296 1 1073741824 
+primitive
+<
+94505044721120 1 0 
+plane\point\0.329474, 0.499637, -0.80113/, -86.3428/
+>
+0
+0
+)
+set
+(
+94505044773136 2 1073741824 &
+set
+(
+94505044772976 1 1073741824 
+primitive
+<
+94505044720960 1 0 
+plane\point\-0.44103, -0.668807, -0.59849/, 122.127/
+>
+0
+0
+)
+set
+(
+94505044772816 1 1073741824 
+primitive
+<
+94505044720800 1 0 
+plane\point\0.834829, -0.550509, 3.56728e-08/, -35.0484/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044772656 3 1073741824 &
+set
+(
+94505044772496 1 1073741824 
+primitive
+<
+94505044720640 1 0 
+plane\point\-0.329474, -0.499637, 0.80113/, 86.1428/
+>
+0
+0
+)
+set
+(
+94505044772336 2 1073741824 &
+set
+(
+94505044772176 1 1073741824 
+primitive
+<
+94505044720480 1 0 
+plane\point\0.44103, 0.668807, 0.59849/, -128.811/
+>
+0
+0
+)
+set
+(
+94505044772016 1 1073741824 
+primitive
+<
+94505044720320 1 0 
+plane\point\-0.834829, 0.550509, -3.56728e-08/, 34.8484/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044771856 18 0 |
+set
+(
+94505044771696 6 1073741824 &
+set
+(
+94505044771536 3 1073741824 &
+set
+(
+94505044771376 1 1073741824 
+primitive
+<
+94505044720160 1 0 
+plane\point\0, 0, -1/, 3.9/
+>
+0
+0
+)
+set
+(
+94505044771216 2 1073741824 &
+set
+(
+94505044771056 1 1073741824 
+primitive
+<
+94505044720000 1 0 
+plane\point\-0.587785, -0.809017, 0/, 150.886/
+>
+0
+0
+)
+set
+(
+94505044770896 1 1073741824 
+primitive
+<
+94505044719840 1 0 
+plane\point\0.809017, -0.587785, 0/, -28.2379/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044770736 3 1073741824 &
+set
+(
+94505044770576 1 1073741824 
+primitive
+<
+94505044719680 1 0 
+plane\point\0, 0, 1/, -4.1/
+>
+0
+0
+)
+set
+(
+94505044770416 2 1073741824 &
+set
+(
+94505044770256 1 1073741824 
+primitive
+<
+94505044719520 1 0 
+plane\point\0.587785, 0.809017, 0/, -156.411/
+>
+0
+0
+)
+set
+(
+94505044770096 1 1073741824 
+primitive
+<
+94505044719360 1 0 
+plane\point\-0.809017, 0.587785, 0/, 28.0379/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044769936 12 0 |
+set
+(
+94505044769776 6 1073741824 &
+set
+(
+94505044769616 3 1073741824 &
+set
+(
+94505044769456 1 1073741824 
+primitive
+<
+94505044719200 1 0 
+plane\point\-0.308152, 0.948393, -0.0747899/, -65.5405/
+>
+0
+0
+)
+set
+(
+94505044769296 2 1073741824 &
+set
+(
+94505044769136 1 1073741824 
+primitive
+<
+94505044719040 1 0 
+plane\point\0.0231114, -0.0711294, -0.997199/, 4.90803/
+>
+0
+0
+)
+set
+(
+94505044768976 1 1073741824 
+primitive
+<
+94505044718880 1 0 
+plane\point\0.951056, 0.309017, 8.71779e-08/, -138.708/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044768816 3 1073741824 &
+set
+(
+94505044768656 1 1073741824 
+primitive
+<
+94505044718720 1 0 
+plane\point\0.308152, -0.948393, 0.0747899/, 65.3405/
+>
+0
+0
+)
+set
+(
+94505044768496 2 1073741824 &
+set
+(
+94505044768336 1 1073741824 
+primitive
+<
+94505044718560 1 0 
+plane\point\-0.0231114, 0.0711294, 0.997199/, -24.9642/
+>
+0
+0
+)
+set
+(
+94505044768176 1 1073741824 
+primitive
+<
+94505044718400 1 0 
+plane\point\-0.951056, -0.309017, -8.71779e-08/, 138.508/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044768016 6 1073741824 &
+set
+(
+94505044767856 3 1073741824 &
+set
+(
+94505044767696 1 1073741824 
+primitive
+<
+94505044718240 1 0 
+plane\point\0.317319, 0.478284, -0.818873/, -85.8323/
+>
+0
+0
+)
+set
+(
+94505044767536 2 1073741824 &
+set
+(
+94505044767376 1 1073741824 
+primitive
+<
+94505044718080 1 0 
+plane\point\-0.45271, -0.682353, -0.573975/, 122.312/
+>
+0
+0
+)
+set
+(
+94505044767216 1 1073741824 
+primitive
+<
+94505044717920 1 0 
+plane\point\0.833284, -0.552845, -5.13174e-08/, -34.8647/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044767056 3 1073741824 &
+set
+(
+94505044766896 1 1073741824 
+primitive
+<
+94505044717760 1 0 
+plane\point\-0.317319, -0.478284, 0.818873/, 85.6323/
+>
+0
+0
+)
+set
+(
+94505044766736 2 1073741824 &
+set
+(
+94505044766576 1 1073741824 
+primitive
+<
+94505044717600 1 0 
+plane\point\0.45271, 0.682353, 0.573975/, -129.281/
+>
+0
+0
+)
+set
+(
+94505044766416 1 1073741824 
+primitive
+<
+94505044717440 1 0 
+plane\point\-0.833284, 0.552845, 5.13174e-08/, 34.6647/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044766256 264 0 |
+set
+(
+94505044766096 66 0 |
+set
+(
+94505044765936 6 1073741824 &
+set
+(
+94505044765776 3 1073741824 &
+set
+(
+94505044765616 1 1073741824 
+primitive
+<
+94505044717280 1 0 
+plane\point\0, 0, -1/, 19.9/
+>
+0
+0
+)
+set
+(
+94505044765456 2 1073741824 &
+set
+(
+94505044765296 1 1073741824 
+primitive
+<
+94505044717120 1 0 
+plane\point\-0.951057, 0.309017, 0/, 68.5672/
+>
+0
+0
+)
+set
+(
+94505044765136 1 1073741824 
+primitive
+<
+94505044716960 1 0 
+plane\point\-0.309017, -0.951057, 0/, 135.676/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044764976 3 1073741824 &
+set
+(
+94505044764816 1 1073741824 
+primitive
+<
+94505044716800 1 0 
+plane\point\0, 0, 1/, -20.1/
+>
+0
+0
+)
+set
+(
+94505044764656 2 1073741824 &
+set
+(
+94505044764496 1 1073741824 
+primitive
+<
+94505044716640 1 0 
+plane\point\0.951057, -0.309017, 0/, -72.6817/
+>
+0
+0
+)
+set
+(
+94505044764336 1 1073741824 
+primitive
+<
+94505044716480 1 0 
+plane\point\0.309017, 0.951057, 0/, -135.876/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044764176 60 0 |
+set
+(
+94505044764016 6 1073741824 &
+set
+(
+94505044763856 3 1073741824 &
+set
+(
+94505044763696 1 1073741824 
+primitive
+<
+94505044716320 1 0 
+plane\point\0.65881, -0.173604, -0.732004/, -40.123/
+>
+0
+0
+)
+set
+(
+94505044763536 2 1073741824 &
+set
+(
+94505044763376 1 1073741824 
+primitive
+<
+94505044716160 1 0 
+plane\point\-0.707841, 0.186525, -0.6813/, 66.4861/
+>
+0
+0
+)
+set
+(
+94505044763216 1 1073741824 
+primitive
+<
+94505044716000 1 0 
+plane\point\-0.254814, -0.96699, -8.12173e-08/, 131.355/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044763056 3 1073741824 &
+set
+(
+94505044762896 1 1073741824 
+primitive
+<
+94505044715840 1 0 
+plane\point\-0.65881, 0.173604, 0.732004/, 39.923/
+>
+0
+0
+)
+set
+(
+94505044762736 2 1073741824 &
+set
+(
+94505044762576 1 1073741824 
+primitive
+<
+94505044715680 1 0 
+plane\point\0.707841, -0.186525, 0.6813/, -72.3573/
+>
+0
+0
+)
+set
+(
+94505044762416 1 1073741824 
+primitive
+<
+94505044715520 1 0 
+plane\point\0.254814, 0.96699, 8.12173e-08/, -131.555/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044762256 54 0 |
+set
+(
+94505044762096 6 1073741824 &
+set
+(
+94505044761936 3 1073741824 &
+set
+(
+94505044761776 1 1073741824 
+primitive
+<
+94505044715360 1 0 
+plane\point\0, 0, -1/, 15.9/
+>
+0
+0
+)
+set
+(
+94505044761616 2 1073741824 &
+set
+(
+94505044761456 1 1073741824 
+primitive
+<
+94505044715200 1 0 
+plane\point\-0.951057, 0.309017, 0/, 68.3908/
+>
+0
+0
+)
+set
+(
+94505044761296 1 1073741824 
+primitive
+<
+94505044715040 1 0 
+plane\point\-0.309017, -0.951057, 0/, 135.434/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044761136 3 1073741824 &
+set
+(
+94505044760976 1 1073741824 
+primitive
+<
+94505044714880 1 0 
+plane\point\0, 0, 1/, -16.1/
+>
+0
+0
+)
+set
+(
+94505044760816 2 1073741824 &
+set
+(
+94505044760656 1 1073741824 
+primitive
+<
+94505044714720 1 0 
+plane\point\0.951057, -0.309017, 0/, -72.858/
+>
+0
+0
+)
+set
+(
+94505044760496 1 1073741824 
+primitive
+<
+94505044714560 1 0 
+plane\point\0.309017, 0.951057, 0/, -135.634/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044760336 48 0 |
+set
+(
+94505044760176 6 1073741824 &
+set
+(
+94505044760016 3 1073741824 &
+set
+(
+94505044759856 1 1073741824 
+primitive
+<
+94505044714400 1 0 
+plane\point\0.6299, -0.168876, -0.758094/, -40.0331/
+>
+0
+0
+)
+set
+(
+94505044759696 2 1073741824 &
+set
+(
+94505044759536 1 1073741824 
+primitive
+<
+94505044714240 1 0 
+plane\point\-0.732235, 0.196312, -0.652145/, 64.8216/
+>
+0
+0
+)
+set
+(
+94505044759376 1 1073741824 
+primitive
+<
+94505044714080 1 0 
+plane\point\-0.258955, -0.965889, 5.83063e-08/, 131.446/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044759216 3 1073741824 &
+set
+(
+94505044759056 1 1073741824 
+primitive
+<
+94505044713920 1 0 
+plane\point\-0.6299, 0.168876, 0.758094/, 39.8331/
+>
+0
+0
+)
+set
+(
+94505044758896 2 1073741824 &
+set
+(
+94505044758736 1 1073741824 
+primitive
+<
+94505044713760 1 0 
+plane\point\0.732235, -0.196312, 0.652145/, -70.9552/
+>
+0
+0
+)
+set
+(
+94505044758576 1 1073741824 
+primitive
+<
+94505044713600 1 0 
+plane\point\0.258955, 0.965889, -5.83063e-08/, -131.646/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044758416 42 0 |
+set
+(
+94505044758256 6 1073741824 &
+set
+(
+94505044758096 3 1073741824 &
+set
+(
+94505044757936 1 1073741824 
+primitive
+<
+94505044713440 1 0 
+plane\point\0, 0, -1/, 11.9/
+>
+0
+0
+)
+set
+(
+94505044757776 2 1073741824 &
+set
+(
+94505044757616 1 1073741824 
+primitive
+<
+94505044713280 1 0 
+plane\point\-0.951057, 0.309017, 0/, 68.2145/
+>
+0
+0
+)
+set
+(
+94505044757456 1 1073741824 
+primitive
+<
+94505044713120 1 0 
+plane\point\-0.309017, -0.951057, 0/, 135.191/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044757296 3 1073741824 &
+set
+(
+94505044757136 1 1073741824 
+primitive
+<
+94505044712960 1 0 
+plane\point\0, 0, 1/, -12.1/
+>
+0
+0
+)
+set
+(
+94505044756976 2 1073741824 &
+set
+(
+94505044756816 1 1073741824 
+primitive
+<
+94505044712800 1 0 
+plane\point\0.951057, -0.309017, 0/, -73.0343/
+>
+0
+0
+)
+set
+(
+94505044756656 1 1073741824 
+primitive
+<
+94505044712640 1 0 
+plane\point\0.309017, 0.951057, 0/, -135.391/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044756496 36 0 |
+set
+(
+94505044756336 6 1073741824 &
+set
+(
+94505044756176 3 1073741824 &
+set
+(
+94505044756016 1 1073741824 
+primitive
+<
+94505044712480 1 0 
+plane\point\0.602635, -0.163945, -0.780995/, -40.3868/
+>
+0
+0
+)
+set
+(
+94505044755856 2 1073741824 &
+set
+(
+94505044755696 1 1073741824 
+primitive
+<
+94505044712320 1 0 
+plane\point\-0.753606, 0.205016, -0.624538/, 63.1888/
+>
+0
+0
+)
+set
+(
+94505044755536 1 1073741824 
+primitive
+<
+94505044712160 1 0 
+plane\point\-0.262506, -0.96493, 0/, 131.488/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044755376 3 1073741824 &
+set
+(
+94505044755216 1 1073741824 
+primitive
+<
+94505044712000 1 0 
+plane\point\-0.602635, 0.163945, 0.780995/, 40.1868/
+>
+0
+0
+)
+set
+(
+94505044755056 2 1073741824 &
+set
+(
+94505044754896 1 1073741824 
+primitive
+<
+94505044711840 1 0 
+plane\point\0.753606, -0.205016, 0.624538/, -69.5936/
+>
+0
+0
+)
+set
+(
+94505044754736 1 1073741824 
+primitive
+<
+94505044711680 1 0 
+plane\point\0.262506, 0.96493, 0/, -131.688/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044754576 30 0 |
+set
+(
+94505044754416 6 1073741824 &
+set
+(
+94505044754256 3 1073741824 &
+set
+(
+94505044754096 1 1073741824 
+primitive
+<
+94505044711520 1 0 
+plane\point\0, 0, -1/, 7.9/
+>
+0
+0
+)
+set
+(
+94505044753936 2 1073741824 &
+set
+(
+94505044753776 1 1073741824 
+primitive
+<
+94505044711360 1 0 
+plane\point\-0.951057, 0.309016, 0/, 68.0382/
+>
+0
+0
+)
+set
+(
+94505044753616 1 1073741824 
+primitive
+<
+94505044711200 1 0 
+plane\point\-0.309016, -0.951057, 0/, 134.948/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044753456 3 1073741824 &
+set
+(
+94505044753296 1 1073741824 
+primitive
+<
+94505044711040 1 0 
+plane\point\0, 0, 1/, -8.1/
+>
+0
+0
+)
+set
+(
+94505044753136 2 1073741824 &
+set
+(
+94505044752976 1 1073741824 
+primitive
+<
+94505044710880 1 0 
+plane\point\0.951057, -0.309016, 0/, -73.2107/
+>
+0
+0
+)
+set
+(
+94505044752816 1 1073741824 
+primitive
+<
+94505044710720 1 0 
+plane\point\0.309016, 0.951057, 0/, -135.148/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044752656 24 0 |
+set
+(
+94505044752496 6 1073741824 &
+set
+(
+94505044752336 3 1073741824 &
+set
+(
+94505044752176 1 1073741824 
+primitive
+<
+94505044710560 1 0 
+plane\point\0.576996, -0.158952, -0.80113/, -41.1254/
+>
+0
+0
+)
+set
+(
+94505044752016 2 1073741824 &
+set
+(
+94505044751856 1 1073741824 
+primitive
+<
+94505044710400 1 0 
+plane\point\-0.772359, 0.212771, -0.59849/, 61.5996/
+>
+0
+0
+)
+set
+(
+94505044751696 1 1073741824 
+primitive
+<
+94505044710240 1 0 
+plane\point\-0.265589, -0.964086, 3.56728e-08/, 131.491/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044751536 3 1073741824 &
+set
+(
+94505044751376 1 1073741824 
+primitive
+<
+94505044710080 1 0 
+plane\point\-0.576996, 0.158952, 0.80113/, 40.9254/
+>
+0
+0
+)
+set
+(
+94505044751216 2 1073741824 &
+set
+(
+94505044751056 1 1073741824 
+primitive
+<
+94505044709920 1 0 
+plane\point\0.772359, -0.212771, 0.59849/, -68.2831/
+>
+0
+0
+)
+set
+(
+94505044750896 1 1073741824 
+primitive
+<
+94505044709760 1 0 
+plane\point\0.265589, 0.964086, -3.56728e-08/, -131.691/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044750736 18 0 |
+set
+(
+94505044750576 6 1073741824 &
+set
+(
+94505044750416 3 1073741824 &
+set
+(
+94505044750256 1 1073741824 
+primitive
+<
+94505044709600 1 0 
+plane\point\0, 0, -1/, 3.9/
+>
+0
+0
+)
+set
+(
+94505044750096 2 1073741824 &
+set
+(
+94505044749936 1 1073741824 
+primitive
+<
+94505044709440 1 0 
+plane\point\-0.951057, 0.309017, 0/, 67.8618/
+>
+0
+0
+)
+set
+(
+94505044749776 1 1073741824 
+primitive
+<
+94505044709280 1 0 
+plane\point\-0.309017, -0.951057, 0/, 134.706/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044749616 3 1073741824 &
+set
+(
+94505044749456 1 1073741824 
+primitive
+<
+94505044709120 1 0 
+plane\point\0, 0, 1/, -4.1/
+>
+0
+0
+)
+set
+(
+94505044749296 2 1073741824 &
+set
+(
+94505044749136 1 1073741824 
+primitive
+<
+94505044708960 1 0 
+plane\point\0.951057, -0.309017, 0/, -73.387/
+>
+0
+0
+)
+set
+(
+94505044748976 1 1073741824 
+primitive
+<
+94505044708800 1 0 
+plane\point\0.309017, 0.951057, 0/, -134.906/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044748816 12 0 |
+set
+(
+94505044748656 6 1073741824 &
+set
+(
+94505044748496 3 1073741824 &
+set
+(
+94505044748336 1 1073741824 
+primitive
+<
+94505044708640 1 0 
+plane\point\0.806751, 0.586139, -0.0747899/, -148.332/
+>
+0
+0
+)
+set
+(
+94505044748176 2 1073741824 &
+set
+(
+94505044748016 1 1073741824 
+primitive
+<
+94505044708480 1 0 
+plane\point\-0.0605063, -0.0439605, -0.997199/, 11.1174/
+>
+0
+0
+)
+set
+(
+94505044747856 1 1073741824 
+primitive
+<
+94505044708320 1 0 
+plane\point\0.587785, -0.809017, 8.71779e-08/, 24.2355/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044747696 3 1073741824 &
+set
+(
+94505044747536 1 1073741824 
+primitive
+<
+94505044708160 1 0 
+plane\point\-0.806751, -0.586139, 0.0747899/, 148.132/
+>
+0
+0
+)
+set
+(
+94505044747376 2 1073741824 &
+set
+(
+94505044747216 1 1073741824 
+primitive
+<
+94505044708000 1 0 
+plane\point\0.0605063, 0.0439605, 0.997199/, -31.1736/
+>
+0
+0
+)
+set
+(
+94505044747056 1 1073741824 
+primitive
+<
+94505044707840 1 0 
+plane\point\-0.587785, 0.809017, -8.71779e-08/, -24.4355/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044746896 6 1073741824 &
+set
+(
+94505044746736 3 1073741824 &
+set
+(
+94505044746576 1 1073741824 
+primitive
+<
+94505044707680 1 0 
+plane\point\0.552932, -0.153991, -0.818873/, -42.1995/
+>
+0
+0
+)
+set
+(
+94505044746416 2 1073741824 &
+set
+(
+94505044746256 1 1073741824 
+primitive
+<
+94505044707520 1 0 
+plane\point\-0.788852, 0.219694, -0.573975/, 60.0621/
+>
+0
+0
+)
+set
+(
+94505044746096 1 1073741824 
+primitive
+<
+94505044707360 1 0 
+plane\point\-0.268288, -0.963339, -5.13174e-08/, 131.463/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044745936 3 1073741824 &
+set
+(
+94505044745776 1 1073741824 
+primitive
+<
+94505044707200 1 0 
+plane\point\-0.552932, 0.153991, 0.818873/, 41.9995/
+>
+0
+0
+)
+set
+(
+94505044745616 2 1073741824 &
+set
+(
+94505044745456 1 1073741824 
+primitive
+<
+94505044707040 1 0 
+plane\point\0.788852, -0.219694, 0.573975/, -67.031/
+>
+0
+0
+)
+set
+(
+94505044745296 1 1073741824 
+primitive
+<
+94505044706880 1 0 
+plane\point\0.268288, 0.963339, 5.13174e-08/, -131.663/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044745136 198 0 |
+set
+(
+94505044744976 66 0 |
+set
+(
+94505044744816 6 1073741824 &
+set
+(
+94505044744656 3 1073741824 &
+set
+(
+94505044744496 1 1073741824 
+primitive
+<
+94505044706720 1 0 
+plane\point\-0, 0, -1/, 19.9/
+>
+0
+0
+)
+set
+(
+94505044744336 2 1073741824 &
+set
+(
+94505044744176 1 1073741824 
+primitive
+<
+94505044706560 1 0 
+plane\point\-5.06639e-07, 1, 0/, -112.057/
+>
+0
+0
+)
+set
+(
+94505044744016 1 1073741824 
+primitive
+<
+94505044706400 1 0 
+plane\point\-1, -5.06639e-07, 0/, 107.068/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044743856 3 1073741824 &
+set
+(
+94505044743696 1 1073741824 
+primitive
+<
+94505044706240 1 0 
+plane\point\0, 0, 1/, -20.1/
+>
+0
+0
+)
+set
+(
+94505044743536 2 1073741824 &
+set
+(
+94505044743376 1 1073741824 
+primitive
+<
+94505044706080 1 0 
+plane\point\5.06639e-07, -1, 0/, 107.943/
+>
+0
+0
+)
+set
+(
+94505044743216 1 1073741824 
+primitive
+<
+94505044705920 1 0 
+plane\point\1, 5.06639e-07, 0/, -107.268/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044743056 60 0 |
+set
+(
+94505044742896 6 1073741824 &
+set
+(
+94505044677264 3 1073741824 &
+set
+(
+94505044677104 1 1073741824 
+primitive
+<
+94505044705760 1 0 
+plane\point\0.038476, -0.680213, -0.732004/, 83.8407/
+>
+0
+0
+)
+set
+(
+94505044676944 2 1073741824 &
+set
+(
+94505044676784 1 1073741824 
+primitive
+<
+94505044705600 1 0 
+plane\point\-0.0413394, 0.730836, -0.6813/, -66.7033/
+>
+0
+0
+)
+set
+(
+94505044676624 1 1073741824 
+primitive
+<
+94505044705440 1 0 
+plane\point\-0.998404, -0.0564743, -8.12173e-08/, 112.993/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044676464 3 1073741824 &
+set
+(
+94505044676304 1 1073741824 
+primitive
+<
+94505044705280 1 0 
+plane\point\-0.038476, 0.680213, 0.732004/, -84.0407/
+>
+0
+0
+)
+set
+(
+94505044676144 2 1073741824 &
+set
+(
+94505044675984 1 1073741824 
+primitive
+<
+94505044705120 1 0 
+plane\point\0.0413394, -0.730836, 0.6813/, 60.8322/
+>
+0
+0
+)
+set
+(
+94505044675824 1 1073741824 
+primitive
+<
+94505044704960 1 0 
+plane\point\0.998404, 0.0564743, 8.12173e-08/, -113.193/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044675664 54 0 |
+set
+(
+94505044675504 6 1073741824 &
+set
+(
+94505044675344 3 1073741824 &
+set
+(
+94505044675184 1 1073741824 
+primitive
+<
+94505044704800 1 0 
+plane\point\-0, 0, -1/, 15.9/
+>
+0
+0
+)
+set
+(
+94505044675024 2 1073741824 &
+set
+(
+94505044674864 1 1073741824 
+primitive
+<
+94505044704640 1 0 
+plane\point\-8.9407e-08, 1, 0/, -112.234/
+>
+0
+0
+)
+set
+(
+94505044674704 1 1073741824 
+primitive
+<
+94505044704480 1 0 
+plane\point\-1, -8.9407e-08, 0/, 106.826/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044674544 3 1073741824 &
+set
+(
+94505044674384 1 1073741824 
+primitive
+<
+94505044704320 1 0 
+plane\point\0, 0, 1/, -16.1/
+>
+0
+0
+)
+set
+(
+94505044674224 2 1073741824 &
+set
+(
+94505044674064 1 1073741824 
+primitive
+<
+94505044704160 1 0 
+plane\point\8.9407e-08, -1, 0/, 107.766/
+>
+0
+0
+)
+set
+(
+94505044673904 1 1073741824 
+primitive
+<
+94505044704000 1 0 
+plane\point\1, 8.9407e-08, 0/, -107.026/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044673744 48 0 |
+set
+(
+94505044673584 6 1073741824 &
+set
+(
+94505044673424 3 1073741824 &
+set
+(
+94505044673264 1 1073741824 
+primitive
+<
+94505044703840 1 0 
+plane\point\0.0340392, -0.651256, -0.758094/, 78.5734/
+>
+0
+0
+)
+set
+(
+94505044673104 2 1073741824 &
+set
+(
+94505044672944 1 1073741824 
+primitive
+<
+94505044703680 1 0 
+plane\point\-0.0395693, 0.757061, -0.652145/, -73.054/
+>
+0
+0
+)
+set
+(
+94505044672784 1 1073741824 
+primitive
+<
+94505044703520 1 0 
+plane\point\-0.998637, -0.0521957, 5.83063e-08/, 112.305/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044672624 3 1073741824 &
+set
+(
+94505044672464 1 1073741824 
+primitive
+<
+94505044703360 1 0 
+plane\point\-0.0340392, 0.651256, 0.758094/, -78.7734/
+>
+0
+0
+)
+set
+(
+94505044672304 2 1073741824 &
+set
+(
+94505044672144 1 1073741824 
+primitive
+<
+94505044703200 1 0 
+plane\point\0.0395693, -0.757061, 0.652145/, 66.9204/
+>
+0
+0
+)
+set
+(
+94505044671984 1 1073741824 
+primitive
+<
+94505044703040 1 0 
+plane\point\0.998637, 0.0521957, -5.83063e-08/, -112.505/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044671824 42 0 |
+set
+(
+94505044671664 6 1073741824 &
+set
+(
+94505044671504 3 1073741824 &
+set
+(
+94505044671344 1 1073741824 
+primitive
+<
+94505044702880 1 0 
+plane\point\-0, 0, -1/, 11.9/
+>
+0
+0
+)
+set
+(
+94505044671184 2 1073741824 &
+set
+(
+94505044671024 1 1073741824 
+primitive
+<
+94505044702720 1 0 
+plane\point\-5.06639e-07, 1, 0/, -112.41/
+>
+0
+0
+)
+set
+(
+94505044670864 1 1073741824 
+primitive
+<
+94505044702560 1 0 
+plane\point\-1, -5.06639e-07, 0/, 106.583/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044670704 3 1073741824 &
+set
+(
+94505044670544 1 1073741824 
+primitive
+<
+94505044702400 1 0 
+plane\point\0, 0, 1/, -12.1/
+>
+0
+0
+)
+set
+(
+94505044670384 2 1073741824 &
+set
+(
+94505044670224 1 1073741824 
+primitive
+<
+94505044702240 1 0 
+plane\point\5.06639e-07, -1, 0/, 107.59/
+>
+0
+0
+)
+set
+(
+94505044670064 1 1073741824 
+primitive
+<
+94505044702080 1 0 
+plane\point\1, 5.06639e-07, 0/, -106.783/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044669904 36 0 |
+set
+(
+94505044669744 6 1073741824 &
+set
+(
+94505044669584 3 1073741824 &
+set
+(
+94505044669424 1 1073741824 
+primitive
+<
+94505044701920 1 0 
+plane\point\0.0303037, -0.623802, -0.780995/, 73.154/
+>
+0
+0
+)
+set
+(
+94505044669264 2 1073741824 &
+set
+(
+94505044669104 1 1073741824 
+primitive
+<
+94505044701760 1 0 
+plane\point\-0.0378953, 0.780075, -0.624538/, -78.7958/
+>
+0
+0
+)
+set
+(
+94505044668944 1 1073741824 
+primitive
+<
+94505044701600 1 0 
+plane\point\-0.998822, -0.0485218, 0/, 111.678/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044668784 3 1073741824 &
+set
+(
+94505044668624 1 1073741824 
+primitive
+<
+94505044701440 1 0 
+plane\point\-0.0303037, 0.623802, 0.780995/, -73.354/
+>
+0
+0
+)
+set
+(
+94505044668464 2 1073741824 &
+set
+(
+94505044668304 1 1073741824 
+primitive
+<
+94505044701280 1 0 
+plane\point\0.0378953, -0.780075, 0.624538/, 72.3911/
+>
+0
+0
+)
+set
+(
+94505044668144 1 1073741824 
+primitive
+<
+94505044701120 1 0 
+plane\point\0.998822, 0.0485218, 0/, -111.878/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044667984 30 0 |
+set
+(
+94505044667824 6 1073741824 &
+set
+(
+94505044667664 3 1073741824 &
+set
+(
+94505044667504 1 1073741824 
+primitive
+<
+94505044700960 1 0 
+plane\point\-0, 0, -1/, 7.9/
+>
+0
+0
+)
+set
+(
+94505044667344 2 1073741824 &
+set
+(
+94505044667184 1 1073741824 
+primitive
+<
+94505044700800 1 0 
+plane\point\-1.04308e-06, 1, 0/, -112.586/
+>
+0
+0
+)
+set
+(
+94505044667024 1 1073741824 
+primitive
+<
+94505044700640 1 0 
+plane\point\-1, -1.04308e-06, 0/, 106.34/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044666864 3 1073741824 &
+set
+(
+94505044666704 1 1073741824 
+primitive
+<
+94505044700480 1 0 
+plane\point\0, 0, 1/, -8.1/
+>
+0
+0
+)
+set
+(
+94505044666544 2 1073741824 &
+set
+(
+94505044666384 1 1073741824 
+primitive
+<
+94505044700320 1 0 
+plane\point\1.04308e-06, -1, 0/, 107.414/
+>
+0
+0
+)
+set
+(
+94505044666224 1 1073741824 
+primitive
+<
+94505044700160 1 0 
+plane\point\1, 1.04308e-06, 0/, -106.54/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044666064 24 0 |
+set
+(
+94505044665904 6 1073741824 &
+set
+(
+94505044665744 3 1073741824 &
+set
+(
+94505044665584 1 1073741824 
+primitive
+<
+94505044700000 1 0 
+plane\point\0.0271288, -0.597875, -0.80113/, 67.6414/
+>
+0
+0
+)
+set
+(
+94505044665424 2 1073741824 &
+set
+(
+94505044665264 1 1073741824 
+primitive
+<
+94505044699840 1 0 
+plane\point\-0.0363143, 0.800307, -0.59849/, -83.9942/
+>
+0
+0
+)
+set
+(
+94505044665104 1 1073741824 
+primitive
+<
+94505044699680 1 0 
+plane\point\-0.998972, -0.0453288, 3.56728e-08/, 111.1/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044664944 3 1073741824 &
+set
+(
+94505044664784 1 1073741824 
+primitive
+<
+94505044699520 1 0 
+plane\point\-0.0271288, 0.597875, 0.80113/, -67.8414/
+>
+0
+0
+)
+set
+(
+94505044664624 2 1073741824 &
+set
+(
+94505044664464 1 1073741824 
+primitive
+<
+94505044699360 1 0 
+plane\point\0.0363143, -0.800307, 0.59849/, 77.3107/
+>
+0
+0
+)
+set
+(
+94505044664304 1 1073741824 
+primitive
+<
+94505044699200 1 0 
+plane\point\0.998972, 0.0453288, -3.56728e-08/, -111.3/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044664144 18 0 |
+set
+(
+94505044663984 6 1073741824 &
+set
+(
+94505044663824 3 1073741824 &
+set
+(
+94505044663664 1 1073741824 
+primitive
+<
+94505044699040 1 0 
+plane\point\-0, 0, -1/, 3.9/
+>
+0
+0
+)
+set
+(
+94505044663504 2 1073741824 &
+set
+(
+94505044663344 1 1073741824 
+primitive
+<
+94505044698880 1 0 
+plane\point\-2.98023e-07, 1, 0/, -112.763/
+>
+0
+0
+)
+set
+(
+94505044663184 1 1073741824 
+primitive
+<
+94505044698720 1 0 
+plane\point\-1, -2.98023e-07, 0/, 106.098/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044663024 3 1073741824 &
+set
+(
+94505044662864 1 1073741824 
+primitive
+<
+94505044698560 1 0 
+plane\point\0, 0, 1/, -4.1/
+>
+0
+0
+)
+set
+(
+94505044662704 2 1073741824 &
+set
+(
+94505044662544 1 1073741824 
+primitive
+<
+94505044698400 1 0 
+plane\point\2.98023e-07, -1, 0/, 107.237/
+>
+0
+0
+)
+set
+(
+94505044662384 1 1073741824 
+primitive
+<
+94505044698240 1 0 
+plane\point\1, 2.98023e-07, 0/, -106.298/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044662224 12 0 |
+set
+(
+94505044662064 6 1073741824 &
+set
+(
+94505044661904 3 1073741824 &
+set
+(
+94505044661744 1 1073741824 
+primitive
+<
+94505044698080 1 0 
+plane\point\0.806751, -0.586139, -0.0747899/, -19.3814/
+>
+0
+0
+)
+set
+(
+94505044661584 2 1073741824 &
+set
+(
+94505044661424 1 1073741824 
+primitive
+<
+94505044697920 1 0 
+plane\point\-0.0605064, 0.0439603, -0.997199/, 1.44612/
+>
+0
+0
+)
+set
+(
+94505044661264 1 1073741824 
+primitive
+<
+94505044697760 1 0 
+plane\point\-0.587785, -0.809017, 8.71779e-08/, 153.548/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044661104 3 1073741824 &
+set
+(
+94505044660944 1 1073741824 
+primitive
+<
+94505044697600 1 0 
+plane\point\-0.806751, 0.586139, 0.0747899/, 19.1814/
+>
+0
+0
+)
+set
+(
+94505044660784 2 1073741824 &
+set
+(
+94505044660624 1 1073741824 
+primitive
+<
+94505044697440 1 0 
+plane\point\0.0605064, -0.0439603, 0.997199/, -21.5023/
+>
+0
+0
+)
+set
+(
+94505044660464 1 1073741824 
+primitive
+<
+94505044697280 1 0 
+plane\point\0.587785, 0.809017, -8.71779e-08/, -153.748/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044660304 6 1073741824 &
+set
+(
+94505044660144 3 1073741824 &
+set
+(
+94505044659984 1 1073741824 
+primitive
+<
+94505044697120 1 0 
+plane\point\0.0244115, -0.573456, -0.818873/, 62.0789/
+>
+0
+0
+)
+set
+(
+94505044659824 2 1073741824 &
+set
+(
+94505044659664 1 1073741824 
+primitive
+<
+94505044696960 1 0 
+plane\point\-0.0348271, 0.818132, -0.573975/, -88.7088/
+>
+0
+0
+)
+set
+(
+94505044659504 1 1073741824 
+primitive
+<
+94505044696800 1 0 
+plane\point\-0.999095, -0.0425305, -5.13174e-08/, 110.562/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044659344 3 1073741824 &
+set
+(
+94505044659184 1 1073741824 
+primitive
+<
+94505044696640 1 0 
+plane\point\-0.0244115, 0.573456, 0.818873/, -62.2789/
+>
+0
+0
+)
+set
+(
+94505044659024 2 1073741824 &
+set
+(
+94505044658864 1 1073741824 
+primitive
+<
+94505044696480 1 0 
+plane\point\0.0348271, -0.818132, 0.573975/, 81.7399/
+>
+0
+0
+)
+set
+(
+94505044658704 1 1073741824 
+primitive
+<
+94505044696320 1 0 
+plane\point\0.999095, 0.0425305, 5.13174e-08/, -110.762/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044658544 132 0 |
+set
+(
+94505044637584 66 0 |
+set
+(
+94505044637424 6 1073741824 &
+set
+(
+94505044637264 3 1073741824 &
+set
+(
+94505044637104 1 1073741824 
+primitive
+<
+94505044685600 1 0 
+plane\point\0, 0, -1/, 19.9/
+>
+0
+0
+)
+set
+(
+94505044636944 2 1073741824 &
+set
+(
+94505044636784 1 1073741824 
+primitive
+<
+94505044685440 1 0 
+plane\point\0.587786, -0.809017, 0/, 22.2782/
+>
+0
+0
+)
+set
+(
+94505044636624 1 1073741824 
+primitive
+<
+94505044685280 1 0 
+plane\point\0.809017, 0.587786, 0/, -156.58/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044636464 3 1073741824 &
+set
+(
+94505044636304 1 1073741824 
+primitive
+<
+94505044685120 1 0 
+plane\point\0, 0, 1/, -20.1/
+>
+0
+0
+)
+set
+(
+94505044636144 2 1073741824 &
+set
+(
+94505044635984 1 1073741824 
+primitive
+<
+94505044684960 1 0 
+plane\point\-0.587786, 0.809017, 0/, -26.3927/
+>
+0
+0
+)
+set
+(
+94505044635824 1 1073741824 
+primitive
+<
+94505044684800 1 0 
+plane\point\-0.809017, -0.587786, 0/, 156.38/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044635664 60 0 |
+set
+(
+94505044635504 6 1073741824 &
+set
+(
+94505044635344 3 1073741824 &
+set
+(
+94505044635184 1 1073741824 
+primitive
+<
+94505044684640 1 0 
+plane\point\-0.430947, 0.527688, -0.732004/, 2.60811/
+>
+0
+0
+)
+set
+(
+94505044635024 2 1073741824 &
+set
+(
+94505044634864 1 1073741824 
+primitive
+<
+94505044684480 1 0 
+plane\point\0.463019, -0.56696, -0.6813/, 20.5749/
+>
+0
+0
+)
+set
+(
+94505044634704 1 1073741824 
+primitive
+<
+94505044684320 1 0 
+plane\point\0.774531, 0.632536, -8.12173e-08/, -157.821/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044634544 3 1073741824 &
+set
+(
+94505044634384 1 1073741824 
+primitive
+<
+94505044684160 1 0 
+plane\point\0.430947, -0.527688, 0.732004/, -2.80812/
+>
+0
+0
+)
+set
+(
+94505044634224 2 1073741824 &
+set
+(
+94505044634064 1 1073741824 
+primitive
+<
+94505044684000 1 0 
+plane\point\-0.463019, 0.56696, 0.6813/, -26.446/
+>
+0
+0
+)
+set
+(
+94505044633904 1 1073741824 
+primitive
+<
+94505044683840 1 0 
+plane\point\-0.774531, -0.632536, 8.12173e-08/, 157.621/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044633744 54 0 |
+set
+(
+94505044633584 6 1073741824 &
+set
+(
+94505044633424 3 1073741824 &
+set
+(
+94505044633264 1 1073741824 
+primitive
+<
+94505044683680 1 0 
+plane\point\0, 0, -1/, 15.9/
+>
+0
+0
+)
+set
+(
+94505044633104 2 1073741824 &
+set
+(
+94505044632944 1 1073741824 
+primitive
+<
+94505044683520 1 0 
+plane\point\0.587785, -0.809017, 0/, 22.1019/
+>
+0
+0
+)
+set
+(
+94505044632784 1 1073741824 
+primitive
+<
+94505044683360 1 0 
+plane\point\0.809017, 0.587785, 0/, -156.823/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044632624 3 1073741824 &
+set
+(
+94505044632464 1 1073741824 
+primitive
+<
+94505044683200 1 0 
+plane\point\0, 0, 1/, -16.1/
+>
+0
+0
+)
+set
+(
+94505044632304 2 1073741824 &
+set
+(
+94505044632144 1 1073741824 
+primitive
+<
+94505044683040 1 0 
+plane\point\-0.587785, 0.809017, 0/, -26.5691/
+>
+0
+0
+)
+set
+(
+94505044631984 1 1073741824 
+primitive
+<
+94505044682880 1 0 
+plane\point\-0.809017, -0.587785, 0/, 156.622/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044631824 48 0 |
+set
+(
+94505044631664 6 1073741824 &
+set
+(
+94505044631504 3 1073741824 &
+set
+(
+94505044631344 1 1073741824 
+primitive
+<
+94505044682720 1 0 
+plane\point\-0.410337, 0.50687, -0.758094/, 0.0609117/
+>
+0
+0
+)
+set
+(
+94505044631184 2 1073741824 &
+set
+(
+94505044631024 1 1073741824 
+primitive
+<
+94505044682560 1 0 
+plane\point\0.477001, -0.589217, -0.652145/, 18.2137/
+>
+0
+0
+)
+set
+(
+94505044630864 1 1073741824 
+primitive
+<
+94505044682400 1 0 
+plane\point\0.777234, 0.629211, 5.83063e-08/, -157.996/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044630704 3 1073741824 &
+set
+(
+94505044630544 1 1073741824 
+primitive
+<
+94505044682240 1 0 
+plane\point\0.410337, -0.50687, 0.758094/, -0.260921/
+>
+0
+0
+)
+set
+(
+94505044630384 2 1073741824 &
+set
+(
+94505044630224 1 1073741824 
+primitive
+<
+94505044682080 1 0 
+plane\point\-0.477001, 0.589217, 0.652145/, -24.3473/
+>
+0
+0
+)
+set
+(
+94505044630064 1 1073741824 
+primitive
+<
+94505044681920 1 0 
+plane\point\-0.777234, -0.629211, -5.83063e-08/, 157.796/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044629904 42 0 |
+set
+(
+94505044629744 6 1073741824 &
+set
+(
+94505044629584 3 1073741824 &
+set
+(
+94505044629424 1 1073741824 
+primitive
+<
+94505044681760 1 0 
+plane\point\0, 0, -1/, 11.9/
+>
+0
+0
+)
+set
+(
+94505044629264 2 1073741824 &
+set
+(
+94505044629104 1 1073741824 
+primitive
+<
+94505044681600 1 0 
+plane\point\0.587786, -0.809017, 0/, 21.9255/
+>
+0
+0
+)
+set
+(
+94505044628944 1 1073741824 
+primitive
+<
+94505044681440 1 0 
+plane\point\0.809017, 0.587786, 0/, -157.065/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044628784 3 1073741824 &
+set
+(
+94505044628624 1 1073741824 
+primitive
+<
+94505044681280 1 0 
+plane\point\0, 0, 1/, -12.1/
+>
+0
+0
+)
+set
+(
+94505044628464 2 1073741824 &
+set
+(
+94505044628304 1 1073741824 
+primitive
+<
+94505044681120 1 0 
+plane\point\-0.587786, 0.809017, 0/, -26.7454/
+>
+0
+0
+)
+set
+(
+94505044628144 1 1073741824 
+primitive
+<
+94505044680960 1 0 
+plane\point\-0.809017, -0.587786, 0/, 156.865/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044627984 36 0 |
+set
+(
+94505044627824 6 1073741824 &
+set
+(
+94505044627664 3 1073741824 &
+set
+(
+94505044627504 1 1073741824 
+primitive
+<
+94505044680800 1 0 
+plane\point\-0.391178, 0.486854, -0.780995/, -2.65529/
+>
+0
+0
+)
+set
+(
+94505044627344 2 1073741824 &
+set
+(
+94505044627184 1 1073741824 
+primitive
+<
+94505044680640 1 0 
+plane\point\0.489174, -0.60882, -0.624538/, 16.0049/
+>
+0
+0
+)
+set
+(
+94505044627024 1 1073741824 
+primitive
+<
+94505044680480 1 0 
+plane\point\0.779544, 0.626348, 0/, -158.178/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044626864 3 1073741824 &
+set
+(
+94505044626704 1 1073741824 
+primitive
+<
+94505044680320 1 0 
+plane\point\0.391178, -0.486854, 0.780995/, 2.45528/
+>
+0
+0
+)
+set
+(
+94505044626544 2 1073741824 &
+set
+(
+94505044626384 1 1073741824 
+primitive
+<
+94505044680160 1 0 
+plane\point\-0.489174, 0.60882, 0.624538/, -22.4097/
+>
+0
+0
+)
+set
+(
+94505044626224 1 1073741824 
+primitive
+<
+94505044680000 1 0 
+plane\point\-0.779544, -0.626348, 0/, 157.978/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044626064 30 0 |
+set
+(
+94505044625904 6 1073741824 &
+set
+(
+94505044625744 3 1073741824 &
+set
+(
+94505044625584 1 1073741824 
+primitive
+<
+94505044679840 1 0 
+plane\point\0, 0, -1/, 7.9/
+>
+0
+0
+)
+set
+(
+94505044625424 2 1073741824 &
+set
+(
+94505044625264 1 1073741824 
+primitive
+<
+94505044679680 1 0 
+plane\point\0.587786, -0.809016, 0/, 21.7491/
+>
+0
+0
+)
+set
+(
+94505044625104 1 1073741824 
+primitive
+<
+94505044679520 1 0 
+plane\point\0.809016, 0.587786, 0/, -157.308/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044624944 3 1073741824 &
+set
+(
+94505044624784 1 1073741824 
+primitive
+<
+94505044679360 1 0 
+plane\point\0, 0, 1/, -8.1/
+>
+0
+0
+)
+set
+(
+94505044624624 2 1073741824 &
+set
+(
+94505044624464 1 1073741824 
+primitive
+<
+94505044679200 1 0 
+plane\point\-0.587786, 0.809016, 0/, -26.9216/
+>
+0
+0
+)
+set
+(
+94505044624304 1 1073741824 
+primitive
+<
+94505044679040 1 0 
+plane\point\-0.809016, -0.587786, 0/, 157.108/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044624144 24 0 |
+set
+(
+94505044623984 6 1073741824 &
+set
+(
+94505044623824 3 1073741824 &
+set
+(
+94505044623664 1 1073741824 
+primitive
+<
+94505044678880 1 0 
+plane\point\-0.37337, 0.467745, -0.80113/, -5.52193/
+>
+0
+0
+)
+set
+(
+94505044623504 2 1073741824 &
+set
+(
+94505044623344 1 1073741824 
+primitive
+<
+94505044678720 1 0 
+plane\point\0.499788, -0.626117, -0.59849/, 13.9412/
+>
+0
+0
+)
+set
+(
+94505044623184 1 1073741824 
+primitive
+<
+94505044678560 1 0 
+plane\point\0.781542, 0.623853, 3.56728e-08/, -158.367/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044623024 3 1073741824 &
+set
+(
+94505044622864 1 1073741824 
+primitive
+<
+94505044678400 1 0 
+plane\point\0.37337, -0.467745, 0.80113/, 5.32193/
+>
+0
+0
+)
+set
+(
+94505044622704 2 1073741824 &
+set
+(
+94505044622544 1 1073741824 
+primitive
+<
+94505044678240 1 0 
+plane\point\-0.499788, 0.626117, 0.59849/, -20.6247/
+>
+0
+0
+)
+set
+(
+94505044622384 1 1073741824 
+primitive
+<
+94505044678080 1 0 
+plane\point\-0.781542, -0.623853, -3.56728e-08/, 158.167/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044622224 18 0 |
+set
+(
+94505044622064 6 1073741824 &
+set
+(
+94505044621904 3 1073741824 &
+set
+(
+94505044621744 1 1073741824 
+primitive
+<
+94505044677920 1 0 
+plane\point\0, 0, -1/, 3.9/
+>
+0
+0
+)
+set
+(
+94505044621584 2 1073741824 &
+set
+(
+94505044621424 1 1073741824 
+primitive
+<
+94505044677760 1 0 
+plane\point\0.587785, -0.809017, 0/, 21.5729/
+>
+0
+0
+)
+set
+(
+94505044621264 1 1073741824 
+primitive
+<
+94505044677600 1 0 
+plane\point\0.809017, 0.587785, 0/, -157.551/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044621104 3 1073741824 &
+set
+(
+94505044620944 1 1073741824 
+primitive
+<
+94505044677440 1 0 
+plane\point\0, 0, 1/, -4.1/
+>
+0
+0
+)
+set
+(
+94505044620784 2 1073741824 &
+set
+(
+94505044620624 1 1073741824 
+primitive
+<
+94505044608384 1 0 
+plane\point\-0.587785, 0.809017, 0/, -27.098/
+>
+0
+0
+)
+set
+(
+94505044620464 1 1073741824 
+primitive
+<
+94505044608224 1 0 
+plane\point\-0.809017, -0.587785, 0/, 157.351/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044620304 12 0 |
+set
+(
+94505044620144 6 1073741824 &
+set
+(
+94505044619984 3 1073741824 &
+set
+(
+94505044619824 1 1073741824 
+primitive
+<
+94505044608064 1 0 
+plane\point\-0.997199, 0, -0.0747899/, 114.578/
+>
+0
+0
+)
+set
+(
+94505044619664 2 1073741824 &
+set
+(
+94505044619504 1 1073741824 
+primitive
+<
+94505044607904 1 0 
+plane\point\0.0747899, 8.74228e-08, -0.997199/, -8.60085/
+>
+0
+0
+)
+set
+(
+94505044619344 1 1073741824 
+primitive
+<
+94505044607744 1 0 
+plane\point\-6.53834e-09, 1, 8.71779e-08/, -110.1/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044619184 3 1073741824 &
+set
+(
+94505044619024 1 1073741824 
+primitive
+<
+94505044607584 1 0 
+plane\point\0.997199, 0, 0.0747899/, -114.778/
+>
+0
+0
+)
+set
+(
+94505044618864 2 1073741824 &
+set
+(
+94505044618704 1 1073741824 
+primitive
+<
+94505044607424 1 0 
+plane\point\-0.0747899, -8.74228e-08, 0.997199/, -11.4553/
+>
+0
+0
+)
+set
+(
+94505044618544 1 1073741824 
+primitive
+<
+94505044607264 1 0 
+plane\point\6.53834e-09, -1, -8.71779e-08/, 109.9/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044618384 6 1073741824 &
+set
+(
+94505044618224 3 1073741824 &
+set
+(
+94505044614544 1 1073741824 
+primitive
+<
+94505044595904 1 0 
+plane\point\-0.356818, 0.449587, -0.818873/, -8.52045/
+>
+0
+0
+)
+set
+(
+94505044614384 2 1073741824 &
+set
+(
+94505044526480 1 1073741824 
+primitive
+<
+94505044595744 1 0 
+plane\point\0.509062, -0.641412, -0.573975/, 12.0132/
+>
+0
+0
+)
+set
+(
+94505044526320 1 1073741824 
+primitive
+<
+94505044596064 1 0 
+plane\point\0.783286, 0.621661, -5.13174e-08/, -158.561/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044541040 3 1073741824 &
+set
+(
+94505044540880 1 1073741824 
+primitive
+<
+94505044596384 1 0 
+plane\point\0.356818, -0.449587, 0.818873/, 8.32045/
+>
+0
+0
+)
+set
+(
+94505044537200 2 1073741824 &
+set
+(
+94505044527280 1 1073741824 
+primitive
+<
+94505044596224 1 0 
+plane\point\-0.509062, 0.641412, 0.573975/, -18.9822/
+>
+0
+0
+)
+set
+(
+94505044527120 1 1073741824 
+primitive
+<
+94505044596544 1 0 
+plane\point\-0.783286, -0.621661, 5.13174e-08/, 158.361/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044658384 66 0 |
+set
+(
+94505044658224 6 1073741824 &
+set
+(
+94505044658064 3 1073741824 &
+set
+(
+94505044657904 1 1073741824 
+primitive
+<
+94505044696160 1 0 
+plane\point\0, 0, -1/, 19.9/
+>
+0
+0
+)
+set
+(
+94505044657744 2 1073741824 &
+set
+(
+94505044657584 1 1073741824 
+primitive
+<
+94505044696000 1 0 
+plane\point\0.951056, 0.309017, 0/, -140.665/
+>
+0
+0
+)
+set
+(
+94505044657424 1 1073741824 
+primitive
+<
+94505044695840 1 0 
+plane\point\-0.309017, 0.951056, 0/, -73.5558/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044657264 3 1073741824 &
+set
+(
+94505044657104 1 1073741824 
+primitive
+<
+94505044695680 1 0 
+plane\point\0, 0, 1/, -20.1/
+>
+0
+0
+)
+set
+(
+94505044656944 2 1073741824 &
+set
+(
+94505044656784 1 1073741824 
+primitive
+<
+94505044695520 1 0 
+plane\point\-0.951056, -0.309017, 0/, 136.551/
+>
+0
+0
+)
+set
+(
+94505044656624 1 1073741824 
+primitive
+<
+94505044695360 1 0 
+plane\point\0.309017, -0.951056, 0/, 73.3559/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044656464 60 0 |
+set
+(
+94505044656304 6 1073741824 &
+set
+(
+94505044656144 3 1073741824 &
+set
+(
+94505044655984 1 1073741824 
+primitive
+<
+94505044695200 1 0 
+plane\point\-0.635031, -0.24679, -0.732004/, 110.25/
+>
+0
+0
+)
+set
+(
+94505044655824 2 1073741824 &
+set
+(
+94505044655664 1 1073741824 
+primitive
+<
+94505044695040 1 0 
+plane\point\0.682292, 0.265157, -0.6813/, -95.078/
+>
+0
+0
+)
+set
+(
+94505044655504 1 1073741824 
+primitive
+<
+94505044694880 1 0 
+plane\point\-0.362234, 0.932087, -8.12173e-08/, -65.7271/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044655344 3 1073741824 &
+set
+(
+94505044655184 1 1073741824 
+primitive
+<
+94505044694720 1 0 
+plane\point\0.635031, 0.24679, 0.732004/, -110.45/
+>
+0
+0
+)
+set
+(
+94505044655024 2 1073741824 &
+set
+(
+94505044654864 1 1073741824 
+primitive
+<
+94505044694560 1 0 
+plane\point\-0.682292, -0.265157, 0.6813/, 89.2069/
+>
+0
+0
+)
+set
+(
+94505044654704 1 1073741824 
+primitive
+<
+94505044694400 1 0 
+plane\point\0.362234, -0.932087, 8.12173e-08/, 65.5271/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044654544 54 0 |
+set
+(
+94505044654384 6 1073741824 &
+set
+(
+94505044654224 3 1073741824 &
+set
+(
+94505044654064 1 1073741824 
+primitive
+<
+94505044694240 1 0 
+plane\point\0, 0, -1/, 15.9/
+>
+0
+0
+)
+set
+(
+94505044653904 2 1073741824 &
+set
+(
+94505044653744 1 1073741824 
+primitive
+<
+94505044694080 1 0 
+plane\point\0.951057, 0.309017, 0/, -140.842/
+>
+0
+0
+)
+set
+(
+94505044653584 1 1073741824 
+primitive
+<
+94505044693920 1 0 
+plane\point\-0.309017, 0.951057, 0/, -73.7986/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044653424 3 1073741824 &
+set
+(
+94505044653264 1 1073741824 
+primitive
+<
+94505044693760 1 0 
+plane\point\0, 0, 1/, -16.1/
+>
+0
+0
+)
+set
+(
+94505044653104 2 1073741824 &
+set
+(
+94505044652944 1 1073741824 
+primitive
+<
+94505044693600 1 0 
+plane\point\-0.951057, -0.309017, 0/, 136.375/
+>
+0
+0
+)
+set
+(
+94505044652784 1 1073741824 
+primitive
+<
+94505044693440 1 0 
+plane\point\0.309017, -0.951057, 0/, 73.5986/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044652624 48 0 |
+set
+(
+94505044652464 6 1073741824 &
+set
+(
+94505044652304 3 1073741824 &
+set
+(
+94505044652144 1 1073741824 
+primitive
+<
+94505044693280 1 0 
+plane\point\-0.608863, -0.233622, -0.758094/, 103.353/
+>
+0
+0
+)
+set
+(
+94505044651984 2 1073741824 &
+set
+(
+94505044651824 1 1073741824 
+primitive
+<
+94505044693120 1 0 
+plane\point\0.70778, 0.271577, -0.652145/, -101.859/
+>
+0
+0
+)
+set
+(
+94505044651664 1 1073741824 
+primitive
+<
+94505044692960 1 0 
+plane\point\-0.358237, 0.933631, 5.83063e-08/, -66.58/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044651504 3 1073741824 &
+set
+(
+94505044651344 1 1073741824 
+primitive
+<
+94505044692800 1 0 
+plane\point\0.608863, 0.233622, 0.758094/, -103.553/
+>
+0
+0
+)
+set
+(
+94505044651184 2 1073741824 &
+set
+(
+94505044651024 1 1073741824 
+primitive
+<
+94505044692640 1 0 
+plane\point\-0.70778, -0.271577, 0.652145/, 95.7256/
+>
+0
+0
+)
+set
+(
+94505044650864 1 1073741824 
+primitive
+<
+94505044692480 1 0 
+plane\point\0.358237, -0.933631, -5.83063e-08/, 66.38/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044650704 42 0 |
+set
+(
+94505044650544 6 1073741824 &
+set
+(
+94505044650384 3 1073741824 &
+set
+(
+94505044650224 1 1073741824 
+primitive
+<
+94505044692320 1 0 
+plane\point\0, 0, -1/, 11.9/
+>
+0
+0
+)
+set
+(
+94505044650064 2 1073741824 &
+set
+(
+94505044649904 1 1073741824 
+primitive
+<
+94505044692160 1 0 
+plane\point\0.951056, 0.309017, 0/, -141.018/
+>
+0
+0
+)
+set
+(
+94505044649744 1 1073741824 
+primitive
+<
+94505044692000 1 0 
+plane\point\-0.309017, 0.951056, 0/, -74.0412/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044649584 3 1073741824 &
+set
+(
+94505044649424 1 1073741824 
+primitive
+<
+94505044691840 1 0 
+plane\point\0, 0, 1/, -12.1/
+>
+0
+0
+)
+set
+(
+94505044649264 2 1073741824 &
+set
+(
+94505044649104 1 1073741824 
+primitive
+<
+94505044691680 1 0 
+plane\point\-0.951056, -0.309017, 0/, 136.198/
+>
+0
+0
+)
+set
+(
+94505044648944 1 1073741824 
+primitive
+<
+94505044691520 1 0 
+plane\point\0.309017, -0.951056, 0/, 73.8413/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044648784 36 0 |
+set
+(
+94505044648624 6 1073741824 &
+set
+(
+94505044648464 3 1073741824 &
+set
+(
+94505044648304 1 1073741824 
+primitive
+<
+94505044691360 1 0 
+plane\point\-0.583907, -0.221586, -0.780995/, 96.4733/
+>
+0
+0
+)
+set
+(
+94505044648144 2 1073741824 &
+set
+(
+94505044647984 1 1073741824 
+primitive
+<
+94505044691200 1 0 
+plane\point\0.730185, 0.277097, -0.624538/, -107.957/
+>
+0
+0
+)
+set
+(
+94505044647824 1 1073741824 
+primitive
+<
+94505044691040 1 0 
+plane\point\-0.3548, 0.934942, 0/, -67.3457/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044647664 3 1073741824 &
+set
+(
+94505044647504 1 1073741824 
+primitive
+<
+94505044690880 1 0 
+plane\point\0.583907, 0.221586, 0.780995/, -96.6733/
+>
+0
+0
+)
+set
+(
+94505044647344 2 1073741824 &
+set
+(
+94505044647184 1 1073741824 
+primitive
+<
+94505044690720 1 0 
+plane\point\-0.730185, -0.277097, 0.624538/, 101.552/
+>
+0
+0
+)
+set
+(
+94505044647024 1 1073741824 
+primitive
+<
+94505044690560 1 0 
+plane\point\0.3548, -0.934942, 0/, 67.1456/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044646864 30 0 |
+set
+(
+94505044646704 6 1073741824 &
+set
+(
+94505044646544 3 1073741824 &
+set
+(
+94505044646384 1 1073741824 
+primitive
+<
+94505044690400 1 0 
+plane\point\0, 0, -1/, 7.9/
+>
+0
+0
+)
+set
+(
+94505044646224 2 1073741824 &
+set
+(
+94505044646064 1 1073741824 
+primitive
+<
+94505044690240 1 0 
+plane\point\0.951056, 0.309018, 0/, -141.194/
+>
+0
+0
+)
+set
+(
+94505044645904 1 1073741824 
+primitive
+<
+94505044690080 1 0 
+plane\point\-0.309018, 0.951056, 0/, -74.2839/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044645744 3 1073741824 &
+set
+(
+94505044645584 1 1073741824 
+primitive
+<
+94505044689920 1 0 
+plane\point\0, 0, 1/, -8.1/
+>
+0
+0
+)
+set
+(
+94505044645424 2 1073741824 &
+set
+(
+94505044645264 1 1073741824 
+primitive
+<
+94505044689760 1 0 
+plane\point\-0.951056, -0.309018, 0/, 136.022/
+>
+0
+0
+)
+set
+(
+94505044645104 1 1073741824 
+primitive
+<
+94505044689600 1 0 
+plane\point\0.309018, -0.951056, 0/, 74.0839/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044644944 24 0 |
+set
+(
+94505044644784 6 1073741824 &
+set
+(
+94505044644624 3 1073741824 &
+set
+(
+94505044644464 1 1073741824 
+primitive
+<
+94505044689440 1 0 
+plane\point\-0.560229, -0.210554, -0.80113/, 89.6456/
+>
+0
+0
+)
+set
+(
+94505044644304 2 1073741824 &
+set
+(
+94505044644144 1 1073741824 
+primitive
+<
+94505044689280 1 0 
+plane\point\0.749915, 0.281845, -0.59849/, -113.449/
+>
+0
+0
+)
+set
+(
+94505044643984 1 1073741824 
+primitive
+<
+94505044689120 1 0 
+plane\point\-0.35181, 0.936072, 3.56728e-08/, -68.0421/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044643824 3 1073741824 &
+set
+(
+94505044643664 1 1073741824 
+primitive
+<
+94505044688960 1 0 
+plane\point\0.560229, 0.210554, 0.80113/, -89.8456/
+>
+0
+0
+)
+set
+(
+94505044643504 2 1073741824 &
+set
+(
+94505044643344 1 1073741824 
+primitive
+<
+94505044688800 1 0 
+plane\point\-0.749915, -0.281845, 0.59849/, 106.765/
+>
+0
+0
+)
+set
+(
+94505044643184 1 1073741824 
+primitive
+<
+94505044688640 1 0 
+plane\point\0.35181, -0.936072, -3.56728e-08/, 67.8421/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044643024 18 0 |
+set
+(
+94505044642864 6 1073741824 &
+set
+(
+94505044642704 3 1073741824 &
+set
+(
+94505044642544 1 1073741824 
+primitive
+<
+94505044688480 1 0 
+plane\point\0, 0, -1/, 3.9/
+>
+0
+0
+)
+set
+(
+94505044642384 2 1073741824 &
+set
+(
+94505044642224 1 1073741824 
+primitive
+<
+94505044688320 1 0 
+plane\point\0.951056, 0.309017, 0/, -141.371/
+>
+0
+0
+)
+set
+(
+94505044642064 1 1073741824 
+primitive
+<
+94505044688160 1 0 
+plane\point\-0.309017, 0.951056, 0/, -74.5267/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044641904 3 1073741824 &
+set
+(
+94505044641744 1 1073741824 
+primitive
+<
+94505044688000 1 0 
+plane\point\0, 0, 1/, -4.1/
+>
+0
+0
+)
+set
+(
+94505044641584 2 1073741824 &
+set
+(
+94505044641424 1 1073741824 
+primitive
+<
+94505044687840 1 0 
+plane\point\-0.951056, -0.309017, 0/, 135.846/
+>
+0
+0
+)
+set
+(
+94505044641264 1 1073741824 
+primitive
+<
+94505044687680 1 0 
+plane\point\0.309017, -0.951056, 0/, 74.3267/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044641104 12 0 |
+set
+(
+94505044640944 6 1073741824 &
+set
+(
+94505044640784 3 1073741824 &
+set
+(
+94505044640624 1 1073741824 
+primitive
+<
+94505044687520 1 0 
+plane\point\-0.308152, -0.948393, -0.0747899/, 143.106/
+>
+0
+0
+)
+set
+(
+94505044640464 2 1073741824 &
+set
+(
+94505044640304 1 1073741824 
+primitive
+<
+94505044687360 1 0 
+plane\point\0.0231113, 0.0711295, -0.997199/, -10.7404/
+>
+0
+0
+)
+set
+(
+94505044640144 1 1073741824 
+primitive
+<
+94505044687200 1 0 
+plane\point\-0.951057, 0.309017, 8.71779e-08/, 70.5244/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044639984 3 1073741824 &
+set
+(
+94505044639824 1 1073741824 
+primitive
+<
+94505044687040 1 0 
+plane\point\0.308152, 0.948393, 0.0747899/, -143.306/
+>
+0
+0
+)
+set
+(
+94505044639664 2 1073741824 &
+set
+(
+94505044639504 1 1073741824 
+primitive
+<
+94505044686880 1 0 
+plane\point\-0.0231113, -0.0711295, 0.997199/, -9.31574/
+>
+0
+0
+)
+set
+(
+94505044639344 1 1073741824 
+primitive
+<
+94505044686720 1 0 
+plane\point\0.951057, -0.309017, -8.71779e-08/, -70.7243/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044639184 6 1073741824 &
+set
+(
+94505044639024 3 1073741824 &
+set
+(
+94505044638864 1 1073741824 
+primitive
+<
+94505044686560 1 0 
+plane\point\-0.537845, -0.200424, -0.818873/, 82.8937/
+>
+0
+0
+)
+set
+(
+94505044638704 2 1073741824 &
+set
+(
+94505044638544 1 1073741824 
+primitive
+<
+94505044686400 1 0 
+plane\point\0.767328, 0.285939, -0.573975/, -118.405/
+>
+0
+0
+)
+set
+(
+94505044638384 1 1073741824 
+primitive
+<
+94505044686240 1 0 
+plane\point\-0.349186, 0.937053, -5.13174e-08/, -68.6818/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+set
+(
+94505044638224 3 1073741824 &
+set
+(
+94505044638064 1 1073741824 
+primitive
+<
+94505044686080 1 0 
+plane\point\0.537845, 0.200424, 0.818873/, -83.0937/
+>
+0
+0
+)
+set
+(
+94505044637904 2 1073741824 &
+set
+(
+94505044637744 1 1073741824 
+primitive
+<
+94505044685920 1 0 
+plane\point\-0.767328, -0.285939, 0.573975/, 111.436/
+>
+0
+0
+)
+set
+(
+94505044526000 1 1073741824 
+primitive
+<
+94505044685760 1 0 
+plane\point\0.349186, -0.937053, 5.13174e-08/, 68.4818/
+>
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+1
+attribute
+<
+94505044808560 -32
+user_attribute
+\
+94505044808352 32
+surface
+\
+1
+point\0.1, 0.1, 0.1/
+0
+point\0.5, 0.5, 0.5/
+1
+0
+1
+1
+0.9
+0
+point\0, 0, 0/
+point\1, 0, 0/
+point\1, 1, 0/
+0
+0
+0
+/
+
+/
+0
+>
+attribute
+<
+0
+>
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+0
+0
+)
+]
+set_list
+[
+0
+]
+0
+}
@@ -72,6 +72,220 @@ static sv_integer num_roots;
 static sv_real roots[MAX_ROOTS];
 static sv_integer too_many_roots;
 
+// Flag for marching along rays using bounds on the grad (see
+// arf_march() below) rather than just subdividing them; off unless
+// asked for
+
+static sv_integer arf_lip = 0;
+
+void set_arf_march(sv_integer m) { arf_lip = m; }
+sv_integer get_arf_march() { return(arf_lip); }
+
+// Most steps to take pinning down a root (at worst every other one
+// halves the bracket, so this is far more than single precision needs)
+
+#define ARF_REFINE 100
+
+// A primitive can be marched if its grads are its true derivatives.
+// Those of s_sqrt, division and sign aren't, and the torus's grad is
+// a cyclide's.  s_sqrt at the top doesn't change the signs or the
+// roots, so that is just skipped.
+
+static int arf_marchable(const sv_primitive& p)
+{
+	sv_integer k = p.kind();
+
+	switch(k)
+	{
+	case SV_REAL:
+	case SV_PLANE:
+		return(1);
+
+	case SV_TORUS:
+		return(0);
+
+	case SV_CYLINDER:
+	case SV_SPHERE:
+	case SV_CONE:
+	case SV_CYCLIDE:
+	case SV_GENERAL:
+		switch(p.op())
+		{
+		case SV_DIVIDE:
+		case SV_SSQRT:
+		case SV_SIGN:
+			return(0);
+
+		case SV_POW:
+			if( (p.child_2().kind() != SV_REAL) || (p.child_2().real() < 2) ) 
+				return(0);
+			return(arf_marchable(p.child_1()));
+
+		default:
+			break;
+		}
+		if(!arf_marchable(p.child_1())) return(0);
+		if(diadic(p.op())) return(arf_marchable(p.child_2()));
+		return(1);
+
+	default:
+		break;
+	}
+
+	return( (k >= SV_U_REG) && !((k - SV_U_REG)%4) && user_prim(k) );
+}
+
+// The box round a piece of a ray
+
+static sv_box arf_box(const sv_line& ray, sv_real t0, sv_real t1)
+{
+	sv_point lo = ray.point(t0);
+	sv_point hi = ray.point(t1);
+	return(sv_box(sv_interval(min(lo.x, hi.x), max(lo.x, hi.x)),
+		sv_interval(min(lo.y, hi.y), max(lo.y, hi.y)),
+		sv_interval(min(lo.z, hi.z), max(lo.z, hi.z))));
+}
+
+// The range of a grad component in a box
+
+static sv_interval arf_grad(const sv_primitive& g, const sv_box& b)
+{
+	if(g.kind() == SV_REAL) return(sv_interval(g.real(), g.real()));
+	return(g.range(b));
+}
+
+// The range of the primitive's slope along the ray in a box
+
+static sv_interval arf_slope(const sv_line& ray, const sv_primitive& p, const sv_box& b)
+{
+	return(ray.direction.x*arf_grad(p.grad_x(), b) +
+		ray.direction.y*arf_grad(p.grad_y(), b) +
+		ray.direction.z*arf_grad(p.grad_z(), b));
+}
+
+// Pin down a root between t0 and t1, where the values f0 and f1 have
+// different signs, to within tol_t (the Illinois version of false
+// position).  A step that doesn't at least halve the bracket is
+// followed by a bisection, so it closes even on a root that false
+// position approaches from one side.
+
+static sv_real arf_refine(const sv_line& ray, const sv_primitive& p, 
+	sv_real t0, sv_real f0, sv_real t1, sv_real f1, sv_real tol_t)
+{
+	sv_real t, f, len;
+	int side = 0;
+	int halve = 0;
+
+	for(sv_integer i = 0; i < ARF_REFINE; i++)
+	{
+		len = fabs(t1 - t0);
+		if( (len < tol_t) || (f1 == f0) ) break;
+		if(halve)
+			t = 0.5*(t0 + t1);
+		else
+			t = t1 - f1*(t1 - t0)/(f1 - f0);
+		if( (t <= min(t0, t1)) || (t >= max(t0, t1)) ) t = 0.5*(t0 + t1);
+		f = p.value(ray.point(t));
+		if(f == 0) return(t);
+		if( (f > 0) == (f1 > 0) )
+		{
+			t1 = t;
+			f1 = f;
+			if(side == -1) f0 = 0.5*f0;
+			side = -1;
+		} else
+		{
+			t0 = t;
+			f0 = f;
+			if(side == 1) f1 = 0.5*f1;
+			side = 1;
+		}
+		halve = (fabs(t1 - t0) > 0.5*len);
+	}
+	if(f1 == f0) return(0.5*(t0 + t1));
+	return(t1 - f1*(t1 - t0)/(f1 - f0));
+}
+
+// March along the piece of the ray from t0 to t1, where the values
+// are f0 and f1, putting the roots in r[n...] in order.  If the
+// primitive's range over the piece doesn't include 0 there are no
+// roots.  If its slope along the ray can't be 0 it has at most one
+// root, which is there if the ends' signs differ, and which is then
+// found by false position.  Otherwise the slope's largest magnitude,
+// l, is a Lipschitz constant.  No root is closer to the ends than
+// their values divided by l, so those lengths are stepped over from
+// each end (and if they add up to the whole piece there are no roots)
+// and what remains is halved.  Pieces shorter than tol_t are settled
+// by the signs of their ends, as in arf_r().  Returns the new n, or
+// -1 if there are too many roots.
+
+static sv_integer arf_march(const sv_line& ray, const sv_primitive& prim,
+	sv_real t0, sv_real f0, sv_real t1, sv_real f1, sv_real tol_t, 
+	sv_integer max_root_count, double* r, sv_integer n)
+{
+	sv_real len = t1 - t0;
+	sv_box b = arf_box(ray, t0, t1);
+	int change = ( (f0 > 0) != (f1 > 0) );
+
+	if( !change && (prim.range(b).member() != SV_SURFACE) ) return(n);
+
+// Rounding can make the bounds say there are no roots when the ends'
+// signs say there is one; the signs win
+
+	if(len > tol_t)
+	{
+		sv_interval d = arf_slope(ray, prim, b);
+		sv_real l = max(-d.lo(), d.hi());
+		if( (d.lo() <= 0) && (d.hi() >= 0) && (l > 0) &&
+			(fabs(f0) + fabs(f1) < l*len) )
+		{
+			sv_real s0 = fabs(f0)/l;
+			sv_real s1 = fabs(f1)/l;
+			sv_real ta = t0;
+			sv_real fa = f0;
+			sv_real tb = t1;
+			sv_real fb = f1;
+			if(s0 > 0)
+			{
+				t0 = t0 + s0;
+				f0 = prim.value(ray.point(t0));
+			}
+			if(s1 > 0)
+			{
+				t1 = t1 - s1;
+				f1 = prim.value(ray.point(t1));
+			}
+
+// Rounding can take a step just past a root that it was closing in
+// on; if so the root is in the step
+
+			if( (f0 > 0) != (fa > 0) )
+			{
+				if(n >= max_root_count) return(-1);
+				r[n++] = arf_refine(ray, prim, ta, fa, t0, f0, tol_t);
+			}
+			sv_real tm = 0.5*(t0 + t1);
+			sv_real fm = prim.value(ray.point(tm));
+			n = arf_march(ray, prim, t0, f0, tm, fm, tol_t, max_root_count, r, n);
+			if(n < 0) return(n);
+			n = arf_march(ray, prim, tm, fm, t1, f1, tol_t, max_root_count, r, n);
+			if(n < 0) return(n);
+			if( (f1 > 0) != (fb > 0) )
+			{
+				if(n >= max_root_count) return(-1);
+				r[n++] = arf_refine(ray, prim, t1, f1, tb, fb, tol_t);
+			}
+			return(n);
+		} else if(!change && (d.lo() <= 0) && (d.hi() >= 0))
+			return(n);
+	}
+
+	if(!change) return(n);
+	if(n >= max_root_count) return(-1);
+	r[n++] = arf_refine(ray, prim, t0, f0, t1, f1, tol_t);
+	return(n);
+}
+
 sv_integer
 arf(const sv_line& ray,			// Ray to intersect with primitive
     const sv_primitive& prim,		// Primitive for which roots are required
@@ -87,6 +301,22 @@ arf(const sv_line& ray,			// Ray to intersect with primitive
 
    num_roots = 0;
    too_many_roots = 0;
+   sv_stat(SV_ST_SOLVE);
+
+   // March if the grads allow it
+
+   if(arf_lip) {
+      sv_primitive p = prim;
+      while( (p.kind() != SV_REAL) && (p.kind() != SV_PLANE) && (p.kind() < S_U_PRIM) &&
+	     (p.op() == SV_SSQRT) )
+	 p = p.child_1();
+      if(arf_marchable(p))
+	 return(arf_march(ray, p, rootfinding_range.lo(), 
+			  p.value(ray.point(rootfinding_range.lo())),
+			  rootfinding_range.hi(), 
+			  p.value(ray.point(rootfinding_range.hi())), 
+			  tol_t, max_root_count, returned_roots, 0));
+   }
 
 #if DEBUG
    cout << "arf: range = " << rootfinding_range.lo << ", " << rootfinding_range.hi() <<
@@ -184,6 +184,8 @@ arpors(polynomial poly,			// Polynomial for which roots are required
    sv_integer lo_val_gt_0;		// Flag to say that lo_val > 0.0
    sv_integer hi_val_gt_0;		// Flag to say that hi_val > 0.0
 
+   sv_stat(SV_ST_SOLVE);
+
 // ---- Check for error type -1
 
    degree = poly.degree();
@@ -61,6 +61,10 @@
 #include "geometry.h"
 #include "interval.h"
 #include "sv_b_cls.h"
+#include "sv_stats.h"
+#include "sv_pool.h"
+#include "sv_index.h"
+#include "sv_xform.h"
 #include "prim.h"
 #include "attrib.h"
 #include "sv_set.h"
@@ -0,0 +1,239 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Conservative boxes round primitive surfaces and set solids
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#if macintosh
+ #pragma export on
+#endif
+
+static sv_integer bound_depth = 9;
+
+void set_bound_depth(sv_integer d)
+{
+	if(d < 0)
+	{
+		svlis_error("set_bound_depth","negative depth - using 0", SV_WARNING);
+		d = 0;
+	}
+	bound_depth = d;
+}
+
+sv_integer get_bound_depth() { return(bound_depth); }
+
+int box_void(const sv_box& b)
+{
+	return(b.xi.empty() || b.yi.empty() || b.zi.empty());
+}
+
+// Chop a box in half across its longest side
+
+void bound_halve(const sv_box& b, sv_box* b1, sv_box* b2)
+{
+	sv_real x = b.xi.hi() - b.xi.lo();
+	sv_real y = b.yi.hi() - b.yi.lo();
+	sv_real z = b.zi.hi() - b.zi.lo();
+	sv_real c;
+
+	*b1 = b;
+	*b2 = b;
+	if( (x >= y) && (x >= z) )
+	{
+		c = 0.5*(b.xi.lo() + b.xi.hi());
+		b1->xi = sv_interval(b.xi.lo(), c);
+		b2->xi = sv_interval(c, b.xi.hi());
+	} else if(y >= z)
+	{
+		c = 0.5*(b.yi.lo() + b.yi.hi());
+		b1->yi = sv_interval(b.yi.lo(), c);
+		b2->yi = sv_interval(c, b.yi.hi());
+	} else
+	{
+		c = 0.5*(b.zi.lo() + b.zi.hi());
+		b1->zi = sv_interval(b.zi.lo(), c);
+		b2->zi = sv_interval(c, b.zi.hi());
+	}
+}
+
+// Add to result the bits of b that may contain the surface
+// (surface != 0) or the solid (surface == 0) of p
+
+static void bound_r(const sv_primitive& p, const sv_box& b, sv_integer level,
+	int surface, sv_box* result)
+{
+	sv_interval r = p.range(b);
+
+	if(r.lo() > 0) return;
+	if(r.hi() < 0)
+	{
+		if(!surface) *result = *result | b;
+		return;
+	}
+	if(level <= 0)
+	{
+		*result = *result | b;
+		return;
+	}
+
+	sv_box b1, b2;
+	bound_halve(b, &b1, &b2);
+	bound_r(p, b1, level - 1, surface, result);
+	bound_r(p, b2, level - 1, surface, result);
+}
+
+// The surface bounds cache.  Each entry remembers the box it was 
+// worked out for; it's reused for boxes inside that one until they
+// get to be an eighth of its volume, when it's worth working out a 
+// tighter one.
+
+#define BOUND_CACHE 4096
+
+struct bound_entry
+{
+	sv_primitive p;		// Held so its unique() can't be reused
+	sv_box domain;		// The box the bound was found in
+	sv_box bound;		// The bound
+};
+
+static bound_entry* bound_cache = 0;
+static sv_lock bound_lock;
+
+void clear_bounds_cache()
+{
+	bound_lock.shut();
+	delete [] bound_cache;
+	bound_cache = 0;
+	bound_lock.open();
+}
+
+sv_box surface_bounds(const sv_primitive& p, const sv_box& b)
+{
+	sv_box result;
+	long u = p.unique();
+	sv_integer slot = (sv_integer)((((unsigned long)u) >> 4) % BOUND_CACHE);
+
+	bound_lock.shut();
+	if(!bound_cache) bound_cache = new bound_entry[BOUND_CACHE];
+	bound_entry* e = &bound_cache[slot];
+	if( (e->p.unique() == u) && b.inside(e->domain) && 
+		(8*b.vol() >= e->domain.vol()) )
+	{
+		result = e->bound & b;
+		bound_lock.open();
+		return(result);
+	}
+	bound_lock.open();
+
+	bound_r(p, b, bound_depth, 1, &result);
+
+	bound_lock.shut();
+	if(bound_cache)
+	{
+		e = &bound_cache[slot];
+		e->p = p;
+		e->domain = b;
+		e->bound = result;
+	}
+	bound_lock.open();
+	return(result);
+}
+
+sv_box solid_bounds(const sv_primitive& p, const sv_box& b)
+{
+	sv_box result;
+	bound_r(p, b, bound_depth, 0, &result);
+	return(result);
+}
+
+// For a set, unions make the bound bigger, intersections smaller
+
+sv_box solid_bounds(const sv_set& s, const sv_box& b)
+{
+	sv_box nothing;
+
+	switch(s.contents())
+	{
+	case SV_EVERYTHING:
+		return(b);
+
+	case SV_NOTHING:
+		return(nothing);
+
+	case 1:
+		return(solid_bounds(s.primitive(), b));
+
+	default:
+		break;
+	}
+
+	sv_box b1 = solid_bounds(s.child_1(), b);
+
+	if(s.op() == SV_INTERSECTION)
+	{
+		if(box_void(b1)) return(nothing);
+		sv_box b2 = solid_bounds(s.child_2(), b1);
+		if(box_void(b2)) return(nothing);
+		return(b1 & b2);
+	}
+
+	sv_box b2 = solid_bounds(s.child_2(), b);
+	if(box_void(b1)) return(b2);
+	if(box_void(b2)) return(b1);
+	return(b1 | b2);
+}
+
+#if macintosh
+ #pragma export off
+#endif
@@ -395,6 +395,284 @@ void smart_decision(const sv_model& m, sv_integer level, void* vp, mod_kind* k,
 	return;
 }
 
+// Cost-model division.  The cost of a box is taken to be proportional to 
+// its surface area times the number of primitives in it (the chance of 
+// a ray or a query landing in a box goes roughly as its area).  Candidate
+// cuts are scored from bounds on each primitive's surface in the box
+// (which are cached - see bounds.cxx) rather than by pruning the set list.
+
+static sv_real cost_trav = 0.2;
+static sv_integer cost_bins = 8;
+
+void set_cost_traverse(sv_real c) { cost_trav = c; }
+sv_real get_cost_traverse() { return(cost_trav); }
+
+void set_cost_bins(sv_integer b)
+{
+	if(b < 2)
+	{
+		svlis_error("set_cost_bins","need at least 2 bins", SV_WARNING);
+		b = 2;
+	}
+	cost_bins = b;
+}
+
+sv_integer get_cost_bins() { return(cost_bins); }
+
+// Count and collect the primitives in a set
+
+static void cost_count(const sv_set& s, sv_integer* n)
+{
+	switch(s.contents())
+	{
+	case SV_EVERYTHING:
+	case SV_NOTHING:
+		return;
+
+	case 1:
+		(*n)++;
+		return;
+
+	default:
+		cost_count(s.child_1(), n);
+		cost_count(s.child_2(), n);
+	}
+}
+
+static void cost_collect(const sv_set& s, sv_primitive* p, sv_integer* n)
+{
+	switch(s.contents())
+	{
+	case SV_EVERYTHING:
+	case SV_NOTHING:
+		return;
+
+	case 1:
+		p[(*n)++] = s.primitive();
+		return;
+
+	default:
+		cost_collect(s.child_1(), p, n);
+		cost_collect(s.child_2(), p, n);
+	}
+}
+
+// Work out surface bounds for some of the primitives (a thread's worth)
+
+struct cost_job
+{
+	const sv_primitive* p;
+	sv_box* bound;
+	sv_integer first;
+	sv_integer last;
+	sv_box b;
+};
+
+static void* cost_bounds(void* vcj)
+{
+	cost_job* cj = (cost_job*) vcj;
+	for(sv_integer i = cj->first; i < cj->last; i++)
+		cj->bound[i] = surface_bounds(cj->p[i], cj->b);
+	return(0);
+}
+
+static sv_interval cost_axis_interval(const sv_box& b, sv_integer axis)
+{
+	switch(axis)
+	{
+	case 0: return(b.xi);
+	case 1: return(b.yi);
+	default: return(b.zi);
+	}
+}
+
+// Surface area of a box with sides x, y and z
+
+static sv_real cost_area(sv_real x, sv_real y, sv_real z)
+{
+	return(2*(x*y + y*z + z*x));
+}
+
+// Score all the candidate cuts across one axis, keeping the best.
+// Counting is done by dropping each primitive's bound into the bins 
+// where it starts and stops, then running sums across them.
+
+static void cost_axis(const sv_box* bound, sv_integer n, const sv_box& mb, 
+	sv_integer axis, sv_real* best, mod_kind* k, sv_real* c)
+{
+	sv_interval ai = cost_axis_interval(mb, axis);
+	sv_real lo = ai.lo();
+	sv_real hi = ai.hi();
+	sv_real w = hi - lo;
+	if(w <= 0) return;
+
+	sv_real ex = mb.xi.hi() - mb.xi.lo();
+	sv_real ey = mb.yi.hi() - mb.yi.lo();
+	sv_real ez = mb.zi.hi() - mb.zi.lo();
+	sv_real area = cost_area(ex, ey, ez);
+	if(area <= 0) return;
+
+	sv_integer kb = cost_bins;
+	sv_real swell = 1 + get_swell_fac();
+	sv_real step = w*swell/(sv_real)kb;
+	sv_integer* starts = new sv_integer[kb + 1];
+	sv_integer* stops = new sv_integer[kb + 1];
+	sv_integer j, jj;
+	sv_interval bi;
+
+	for(j = 0; j <= kb; j++)
+	{
+		starts[j] = 0;
+		stops[j] = 0;
+	}
+
+// Primitive i is in child_1 of cut j if its bound starts below the
+// top of child_1's (swelled) box, and in child_2 if it stops above
+// the bottom of child_2's.
+
+	for(sv_integer i = 0; i < n; i++)
+	{
+		if(box_void(bound[i])) continue;
+		bi = cost_axis_interval(bound[i], axis);
+		j = (sv_integer)floor((bi.lo() - lo)/step) + 1;
+		if(j < 1) j = 1;
+		if(j < kb) starts[j]++;
+		jj = kb - (sv_integer)floor((hi - bi.hi())/step) - 1;
+		if(jj > kb - 1) jj = kb - 1;
+		if(jj >= 1) stops[jj]++;
+	}
+
+	for(j = 2; j < kb; j++) starts[j] += starts[j-1];
+	for(j = kb - 2; j >= 1; j--) stops[j] += stops[j+1];
+
+	sv_real cut, s1, s2, a1, a2, cost;
+	for(j = 1; j < kb; j++)
+	{
+		cut = lo + w*(sv_real)j/(sv_real)kb;
+		s1 = (cut - lo)*swell;
+		s2 = (hi - cut)*swell;
+		switch(axis)
+		{
+		case 0:
+			a1 = cost_area(s1, ey, ez);
+			a2 = cost_area(s2, ey, ez);
+			break;
+		case 1:
+			a1 = cost_area(ex, s1, ez);
+			a2 = cost_area(ex, s2, ez);
+			break;
+		default:
+			a1 = cost_area(ex, ey, s1);
+			a2 = cost_area(ex, ey, s2);
+		}
+		cost = cost_trav + (a1*starts[j] + a2*stops[j])/area;
+		if(cost < *best)
+		{
+			*best = cost;
+			*c = cut;
+			switch(axis)
+			{
+			case 0: *k = X_DIV; break;
+			case 1: *k = Y_DIV; break;
+			default: *k = Z_DIV;
+			}
+		}
+	}
+
+	delete [] starts;
+	delete [] stops;
+}
+
+void cost_decision(const sv_model& m, sv_integer level, void* vp, mod_kind* k, sv_real* c, 
+		sv_model* c_1, sv_model* c_2)
+{
+	sv_box mb = m.box();
+	sv_set_list sl = m.set_list();
+	sv_integer dont_divide = 1;
+	sv_integer contents;
+
+// The same stopping rules as the other decisions
+
+	while(sl.exists() && dont_divide)
+	{
+		contents = sl.set().contents();
+		if (contents > user_low_contents()) dont_divide = 0;
+		sl = sl.next();
+	}
+
+	*k = LEAF_M;
+	if(dont_divide) return;
+	if (mb.vol() < user_little_box()) return;
+
+// Gather the primitives
+
+	sv_integer n = 0;
+	sl = m.set_list();
+	while(sl.exists())
+	{
+		cost_count(sl.set(), &n);
+		sl = sl.next();
+	}
+	if(!n) return;
+
+	sv_primitive* p = new sv_primitive[n];
+	sv_box* bound = new sv_box[n];
+	n = 0;
+	sl = m.set_list();
+	while(sl.exists())
+	{
+		cost_collect(sl.set(), p, &n);
+		sl = sl.next();
+	}
+
+// Bound them, in parallel if we can
+
+	cost_job cj;
+	cj.p = p;
+	cj.bound = bound;
+	cj.first = 0;
+	cj.last = n;
+	cj.b = mb;
+
+#ifdef SV_PARALLEL
+#define COST_THREADS 4
+	if(n >= 16*COST_THREADS)
+	{
+		cost_job jobs[COST_THREADS];
+		pthread_t th[COST_THREADS];
+		sv_integer ok[COST_THREADS];
+		void* rtval;
+		sv_integer i;
+		for(i = 0; i < COST_THREADS; i++)
+		{
+			jobs[i] = cj;
+			jobs[i].first = (n*i)/COST_THREADS;
+			jobs[i].last = (n*(i + 1))/COST_THREADS;
+			ok[i] = !pthread_create(&th[i], 0, cost_bounds, (void*)&jobs[i]);
+			if(!ok[i]) cost_bounds((void*)&jobs[i]);
+		}
+		for(i = 0; i < COST_THREADS; i++)
+		{
+			if(ok[i])
+			  if(pthread_join(th[i], &rtval))
+				svlis_error("cost_decision","can't join thread",SV_WARNING);
+		}
+	} else
+		cost_bounds((void*)&cj);
+#else
+	cost_bounds((void*)&cj);
+#endif
+
+// Divide only if some cut is cheaper than leaving the box whole
+
+	sv_real best = (sv_real)n;
+	for(sv_integer axis = 0; axis < 3; axis++)
+		cost_axis(bound, n, mb, axis, &best, k, c);
+
+	delete [] p;
+	delete [] bound;
+}
+
 #if macintosh
  #pragma export off
 #endif
@@ -0,0 +1,490 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Frozen models: a divided model flattened into arrays
+ * for fast point location, membership and ray-tracing
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#if macintosh
+ #pragma export on
+#endif
+
+// Count the nodes, leaves and sets in a model
+
+void sv_frozen_model::frozen_data::count(const sv_model& mod)
+{
+	node_count++;
+	if( (mod.kind() == LEAF_M) || (mod.kind() == INSTANCE_M) )
+	{
+		leaf_count++;
+		set_count += mod.set_list().count();
+		return;
+	}
+	count(mod.child_1());
+	count(mod.child_2());
+}
+
+// Lay a model out depth-first; node_count, leaf_count and
+// set_count are used as the next free slots.
+
+void sv_frozen_model::frozen_data::fill(const sv_model& mod)
+{
+	sv_integer here = node_count++;
+	sv_frozen_node* n = &node[here];
+	sv_set_list sl;
+	sv_box b1, b2;
+
+	n->kind = (int)mod.kind();
+	n->coord = mod.coord();
+
+	switch(mod.kind())
+	{
+
+// Instances are frozen as leaves, and handed back to the model
+
+	case LEAF_M:
+	case INSTANCE_M:
+		n->index = (int)leaf_count;
+		n->c1_hi = 0;
+		n->c2_lo = 0;
+		leaf_box[leaf_count] = mod.box();
+		leaf_model[leaf_count] = mod;
+		leaf_first[leaf_count] = set_count;
+		sl = mod.set_list();
+		while(sl.exists())
+		{
+			set[set_count++] = sl.set();
+			sl = sl.next();
+		}
+		leaf_count++;
+		leaf_first[leaf_count] = set_count;
+		return;
+
+	case X_DIV:
+		b1 = mod.child_1().box();
+		b2 = mod.child_2().box();
+		n->c1_hi = b1.xi.hi();
+		n->c2_lo = b2.xi.lo();
+		break;
+
+	case Y_DIV:
+		b1 = mod.child_1().box();
+		b2 = mod.child_2().box();
+		n->c1_hi = b1.yi.hi();
+		n->c2_lo = b2.yi.lo();
+		break;
+
+	case Z_DIV:
+		b1 = mod.child_1().box();
+		b2 = mod.child_2().box();
+		n->c1_hi = b1.zi.hi();
+		n->c2_lo = b2.zi.lo();
+		break;
+
+	default:
+		svlis_error("sv_frozen_model::fill","dud model kind",SV_CORRUPT);
+		return;
+	}
+
+	fill(mod.child_1());
+	node[here].index = (int)node_count;
+	fill(mod.child_2());
+}
+
+// Build the arrays; keep says whether to hold on to the model
+
+sv_frozen_model::frozen_data::frozen_data(const sv_model& mod, int keep)
+{
+	node = 0;
+	leaf_box = 0;
+	leaf_model = 0;
+	leaf_first = 0;
+	set = 0;
+	node_count = 0;
+	leaf_count = 0;
+	set_count = 0;
+	owner = 0;
+
+	if(!mod.exists())
+	{
+		svlis_error("sv_frozen_model","freezing a null model", SV_WARNING);
+		return;
+	}
+
+	if(keep)
+	{
+		m = mod;
+		owner = 0;
+	} else
+		owner = (void*)mod.model_info.operator->();
+	b = mod.box();
+	count(mod);
+
+	node = new sv_frozen_node[node_count];
+	leaf_box = new sv_box[leaf_count];
+	leaf_model = new sv_model[leaf_count];
+	leaf_first = new sv_integer[leaf_count + 1];
+	set = new sv_set[set_count > 0 ? set_count : 1];
+
+	node_count = 0;
+	leaf_count = 0;
+	set_count = 0;
+	leaf_first[0] = 0;
+	fill(mod);
+}
+
+// The owner of a model's own copy is cleared when the model goes, under
+// this lock, so while it's held a non-null owner is still in memory
+
+static sv_lock& owner_lock()
+{
+	static sv_lock* l = new sv_lock;
+	return(*l);
+}
+
+// The original model (null if it was a model's own copy and the model
+// has gone, or is going)
+
+sv_model sv_frozen_model::model() const
+{
+	sv_model result = frozen_info->m;
+	sv_model::model_data* md;
+
+	owner_lock().shut();
+	md = (sv_model::model_data*)frozen_info->owner;
+	if(md && md->add_live_reference())
+	{
+		result.model_info = md;
+		md->remove_reference();
+	}
+	owner_lock().open();
+	return(result);
+}
+
+// A model's own copy, made the first time it's asked for.  The lock
+// is not held while freezing; if two threads both freeze, the first
+// wins.  Leaves and instances are frozen afresh each time, as they
+// would be in their own copies and would never be let go.
+
+sv_frozen_model sv_model::model_data::frozen(const sv_model& mod)
+{
+	sv_frozen_model result;
+
+	if( (kind == LEAF_M) || (kind == INSTANCE_M) )
+		return(sv_frozen_model(mod));
+
+	lock.shut();
+	if(fz) result = *fz;
+	lock.open();
+	if(result.exists()) return(result);
+
+	sv_frozen_model built = sv_frozen_model(mod, 0);
+
+	lock.shut();
+	if(!fz) fz = new sv_frozen_model(built);
+	result = *fz;
+	lock.open();
+	return(result);
+}
+
+// Let go of the frozen copy (the tree has changed)
+
+void sv_model::model_data::thaw()
+{
+	lock.shut();
+	sv_frozen_model* f = fz;
+	fz = 0;
+	lock.open();
+	if(f) sv_frozen_drop(f);
+}
+
+// A model's copy is let go when the model goes (or changes), but
+// anyone else sharing the copy can go on using it
+
+void sv_frozen_drop(sv_frozen_model* f)
+{
+	owner_lock().shut();
+	f->frozen_info->owner = 0;
+	owner_lock().open();
+	delete f;
+}
+
+sv_frozen_model sv_model::frozen() const
+{
+	if(flags() & SV_PAGE_FLAG) return(sv_frozen_model());
+	return(model_info->frozen(*this));
+}
+
+// Walk down to the leaf containing a point
+
+sv_integer sv_frozen_model::frozen_data::leaf_index(const sv_point& p) const
+{
+	sv_integer i = 0;
+	const sv_frozen_node* n;
+
+	if(!node_count) return(-1);
+
+	for(;;)
+	{
+		n = &node[i];
+		switch(n->kind)
+		{
+		case X_DIV:
+			i = (p.x < n->coord) ? i + 1 : n->index;
+			break;
+
+		case Y_DIV:
+			i = (p.y < n->coord) ? i + 1 : n->index;
+			break;
+
+		case Z_DIV:
+			i = (p.z < n->coord) ? i + 1 : n->index;
+			break;
+
+		default:
+			return(n->index);
+		}
+	}
+}
+
+// Return the leaf containing a point
+
+sv_model sv_frozen_model::leaf(const sv_point& p) const
+{
+	sv_model nothing;
+	sv_integer l = frozen_info->leaf_index(p);
+	if(l < 0) return(nothing);
+	if(frozen_info->leaf_box[l].member(p) == SV_AIR) return(nothing);
+	return(frozen_info->leaf_model[l]);
+}
+
+// Membership test - the sets in a leaf are unioned
+
+mem_test sv_frozen_model::member(const sv_point& p, sv_primitive* ks) const
+{
+	mem_test result = SV_AIR;
+	mem_test temp;
+	const frozen_data* fd = &(*frozen_info);
+
+	if(!fd->node_count) return(SV_AIR);
+	if(fd->b.member(p) == SV_AIR) return(SV_AIR);
+
+	sv_integer l = fd->leaf_index(p);
+	if(fd->leaf_model[l].kind() == INSTANCE_M)
+		return(fd->leaf_model[l].member(p, ks));
+	sv_integer top = fd->leaf_first[l + 1];
+	for(sv_integer k = fd->leaf_first[l]; k < top; k++)
+	{
+		temp = fd->set[k].member(p, ks);
+		if(temp == SV_SURFACE) result = SV_SURFACE;
+		if(temp == SV_SOLID) return(SV_SOLID);
+	}
+	return(result);
+}
+
+// The ray-tracer's walk down the tree.  This is ray_model_test in
+// raytrace.cxx, but with the direction tests done per call rather
+// than in statics, so that many threads can trace at once.
+
+sv_set sv_frozen_model::frozen_data::ray(sv_integer i, const sv_line& l, 
+	const sv_real& tmax, const sv_interval& valid, sv_real* t) const
+{
+	sv_set hit_surface;
+	const sv_frozen_node* n = &node[i];
+	sv_real o, d;
+
+	switch(n->kind)
+	{
+	case X_DIV:
+		o = l.origin.x;
+		d = l.direction.x;
+		break;
+
+	case Y_DIV:
+		o = l.origin.y;
+		d = l.direction.y;
+		break;
+
+	case Z_DIV:
+		o = l.origin.z;
+		d = l.direction.z;
+		break;
+
+	case INSTANCE_M:
+
+// NB this goes through the model's ray-tracer, which isn't thread safe
+
+		return(ray_instance_test(leaf_model[n->index], l, tmax, valid, t));
+
+	default:
+		return(ray_leaf_node_test(&set[leaf_first[n->index]],
+			leaf_first[n->index + 1] - leaf_first[n->index], 
+			l, tmax, valid, t));
+	}
+
+	sv_interval c1_int, c2_int;
+
+	if(d > 0.0)
+	{
+		c1_int = sv_interval(valid.lo(), min(valid.hi(), (n->c1_hi - o)/d));
+		c2_int = sv_interval(max(valid.lo(), (n->c2_lo - o)/d), valid.hi());
+	} else if(d < 0.0)
+	{
+		c1_int = sv_interval(max(valid.lo(), (n->c1_hi - o)/d), valid.hi());
+		c2_int = sv_interval(valid.lo(), min(valid.hi(), (n->c2_lo - o)/d));
+	} else
+	{
+
+// Ray parallel to the cut
+
+		if(o <= n->c1_hi) c1_int = valid;
+		if(o >= n->c2_lo) c2_int = valid;
+	}
+
+	sv_integer c1 = i + 1;
+	sv_integer c2 = n->index;
+
+	if(c1_int.empty() && c2_int.empty()) return(hit_surface);
+	if(c1_int.empty()) return(ray(c2, l, tmax, c2_int, t));
+	if(c2_int.empty()) return(ray(c1, l, tmax, c1_int, t));
+
+	if(c1_int.lo() < c2_int.lo())
+	{
+		hit_surface = ray(c1, l, tmax, c1_int, t);
+		if(hit_surface.exists()) return(hit_surface);
+		return(ray(c2, l, tmax, c2_int, t));
+	}
+
+	hit_surface = ray(c2, l, tmax, c2_int, t);
+	if(hit_surface.exists()) return(hit_surface);
+	return(ray(c1, l, tmax, c1_int, t));
+}
+
+// Fire a ray into a frozen model
+
+sv_set sv_frozen_model::fire_ray(const sv_line& l, const sv_interval& i, 
+	sv_real* t) const
+{
+	sv_set nothing;
+	sv_stat(SV_ST_RAY);
+	if(!frozen_info->node_count || i.empty()) return(nothing);
+	return(frozen_info->ray(0, l, i.hi(), i, t));
+}
+
+// Shadow rays: as the walk above, but any crossing will do, so the
+// children are taken in turn, not in order along the ray
+
+sv_integer sv_frozen_model::frozen_data::occluded(sv_integer i, const sv_line& l, 
+	const sv_real& tmax, const sv_interval& valid) const
+{
+	const sv_frozen_node* n = &node[i];
+	sv_real o, d;
+
+	switch(n->kind)
+	{
+	case X_DIV:
+		o = l.origin.x;
+		d = l.direction.x;
+		break;
+
+	case Y_DIV:
+		o = l.origin.y;
+		d = l.direction.y;
+		break;
+
+	case Z_DIV:
+		o = l.origin.z;
+		d = l.direction.z;
+		break;
+
+	case INSTANCE_M:
+		return(ray_instance_occluded(leaf_model[n->index], l, tmax, valid));
+
+	default:
+		return(ray_leaf_node_occluded(&set[leaf_first[n->index]],
+			leaf_first[n->index + 1] - leaf_first[n->index], 
+			l, tmax, valid));
+	}
+
+	sv_interval c1_int, c2_int;
+
+	if(d > 0.0)
+	{
+		c1_int = sv_interval(valid.lo(), min(valid.hi(), (n->c1_hi - o)/d));
+		c2_int = sv_interval(max(valid.lo(), (n->c2_lo - o)/d), valid.hi());
+	} else if(d < 0.0)
+	{
+		c1_int = sv_interval(max(valid.lo(), (n->c1_hi - o)/d), valid.hi());
+		c2_int = sv_interval(valid.lo(), min(valid.hi(), (n->c2_lo - o)/d));
+	} else
+	{
+		if(o <= n->c1_hi) c1_int = valid;
+		if(o >= n->c2_lo) c2_int = valid;
+	}
+
+	if(!c1_int.empty() && occluded(i + 1, l, tmax, c1_int)) return(1);
+	if(!c2_int.empty()) return(occluded(n->index, l, tmax, c2_int));
+	return(0);
+}
+
+sv_integer sv_frozen_model::occluded(const sv_line& l, const sv_interval& i) const
+{
+	sv_stat(SV_ST_SHADOW);
+	if(!frozen_info->node_count || i.empty()) return(0);
+	return(frozen_info->occluded(0, l, i.hi(), i));
+}
+
+#if macintosh
+ #pragma export off
+#endif
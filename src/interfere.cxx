@@ -0,0 +1,294 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Interference (clash) detection between two divided models
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#if macintosh
+ #pragma export on
+#endif
+
+// How far to chop up an overlap box looking for a definite clash
+
+static sv_integer clash_depth = 12;
+
+void set_clash_depth(sv_integer d)
+{
+	if(d < 0)
+	{
+		svlis_error("set_clash_depth","negative depth - using 0", SV_WARNING);
+		d = 0;
+	}
+	clash_depth = d;
+}
+
+sv_integer get_clash_depth() { return(clash_depth); }
+
+// Clash list housekeeping
+
+void sv_clash_list::add(const sv_box& b, const sv_set& sa, const sv_set& sb, mem_test c)
+{
+	sv_clash* e = new sv_clash;
+	e->b = b;
+	e->set_a = sa;
+	e->set_b = sb;
+	e->certainty = c;
+	e->next = 0;
+	if(last)
+		last->next = e;
+	else
+		list = e;
+	last = e;
+	n++;
+}
+
+void sv_clash_list::clear()
+{
+	sv_clash* e;
+	while(list)
+	{
+		e = list->next;
+		delete list;
+		list = e;
+	}
+	last = 0;
+	n = 0;
+}
+
+sv_integer sv_clash_list::definite() const
+{
+	sv_integer d = 0;
+	sv_clash* e = list;
+	while(e)
+	{
+		if(e->certainty == SV_SOLID) d++;
+		e = e->next;
+	}
+	return(d);
+}
+
+// Do two boxes overlap in a region of non-zero volume?  Swelled
+// leaf boxes meet in thin slabs all the time, but sharing a face
+// is not interference.
+
+static int real_overlap(const sv_box& b)
+{
+	if(b.xi.empty() || b.yi.empty() || b.zi.empty()) return(0);
+	return( (b.xi.hi() > b.xi.lo()) && (b.yi.hi() > b.yi.lo()) && 
+		(b.zi.hi() > b.zi.lo()) );
+}
+
+// Is there nothing at all in a set list?
+
+static int nothing_in(const sv_set_list& sl)
+{
+	sv_set_list l = sl;
+	while(l.exists())
+	{
+		if(l.set().contents() != SV_NOTHING) return(0);
+		l = l.next();
+	}
+	return(1);
+}
+
+// Classify the intersection of two sets in a box: SV_AIR if
+// the interval arithmetic shows there's nothing there, SV_SOLID
+// if some point is definitely in both, SV_SURFACE if we ran out
+// of subdivision before deciding.
+
+static mem_test clash_r(const sv_set& s, const sv_box& b, sv_integer level)
+{
+	sv_set p = s.prune(b);
+
+	switch(p.contents())
+	{
+	case SV_NOTHING:
+		return(SV_AIR);
+	case SV_EVERYTHING:
+		return(SV_SOLID);
+	default:
+		;
+	}
+
+	if(p.member(b.centroid()) == SV_SOLID) return(SV_SOLID);
+	if(level >= clash_depth) return(SV_SURFACE);
+
+	sv_box b1, b2;
+	bound_halve(b, &b1, &b2);
+	mem_test r1 = clash_r(p, b1, level + 1);
+	if(r1 == SV_SOLID) return(SV_SOLID);
+	mem_test r2 = clash_r(p, b2, level + 1);
+	if(r2 == SV_SOLID) return(SV_SOLID);
+	if( (r1 == SV_SURFACE) || (r2 == SV_SURFACE) ) return(SV_SURFACE);
+	return(SV_AIR);
+}
+
+// What the traversal is accumulating
+
+struct clash_walk
+{
+	sv_clash_list* report;	// Where to put the clashes (0 for none)
+	int early;		// Stop at the first definite clash?
+	mem_test worst;		// The worst thing found so far
+	sv_integer found;	// How many clashes
+};
+
+// Record a clash; return 1 if the walk should stop
+
+static int clash_found(clash_walk* cw, const sv_box& b, const sv_set& sa, 
+	const sv_set& sb, mem_test c)
+{
+	cw->found++;
+	if(cw->report) cw->report->add(b, sa, sb, c);
+	if(c == SV_SOLID)
+	{
+		cw->worst = SV_SOLID;
+		return(cw->early);
+	}
+	if(cw->worst == SV_AIR) cw->worst = SV_SURFACE;
+	return(0);
+}
+
+// Two overlapping leaves: only now look at the sets.  Both lists are
+// pruned to the overlap once, not once per pair.
+
+static int leaf_clash(const sv_model& a, const sv_model& b, const sv_box& ov,
+	clash_walk* cw)
+{
+	sv_set_list la = a.set_list().prune(ov);
+	sv_set_list pb = b.set_list().prune(ov);
+	sv_set_list lb;
+	sv_set sa, sb;
+	mem_test c;
+
+	while(la.exists())
+	{
+		sa = la.set();
+		la = la.next();
+		if(sa.contents() == SV_NOTHING) continue;
+		lb = pb;
+		while(lb.exists())
+		{
+			sb = lb.set();
+			lb = lb.next();
+			if(sb.contents() == SV_NOTHING) continue;
+			c = clash_r(sa & sb, ov, 0);
+			if(c != SV_AIR)
+			{
+				if(clash_found(cw, ov, sa, sb, c)) return(1);
+			}
+		}
+	}
+	return(0);
+}
+
+// Walk the two trees together.  Box pairs that don't overlap
+// are discarded without looking any further down; otherwise
+// the bigger of the two non-leaf boxes is split.
+
+static int clash_walk_r(const sv_model& a, const sv_model& b, clash_walk* cw)
+{
+	sv_box ov = a.box() & b.box();
+	if(!real_overlap(ov)) return(0);
+	if( (a.flags() | b.flags()) & SV_INST_FLAG )
+	{
+		svlis_error("clash_walk_r", "instances are not checked", SV_WARNING);
+		return(0);
+	}
+	if(nothing_in(a.set_list()) || nothing_in(b.set_list())) return(0);
+
+	int a_leaf = (a.kind() == LEAF_M);
+	int b_leaf = (b.kind() == LEAF_M);
+
+	if(a_leaf && b_leaf) return(leaf_clash(a, b, ov, cw));
+
+	if(b_leaf || (!a_leaf && (a.box().vol() >= b.box().vol())))
+	{
+		if(clash_walk_r(a.child_1(), b, cw)) return(1);
+		return(clash_walk_r(a.child_2(), b, cw));
+	}
+
+	if(clash_walk_r(a, b.child_1(), cw)) return(1);
+	return(clash_walk_r(a, b.child_2(), cw));
+}
+
+// All the clashes between two models
+
+sv_integer interference(const sv_model& a, const sv_model& b, sv_clash_list& report)
+{
+	clash_walk cw;
+	cw.report = &report;
+	cw.early = 0;
+	cw.worst = SV_AIR;
+	cw.found = 0;
+	clash_walk_r(a, b, &cw);
+	return(cw.found);
+}
+
+// Do two models clash at all?
+
+mem_test interfere(const sv_model& a, const sv_model& b)
+{
+	clash_walk cw;
+	cw.report = 0;
+	cw.early = 1;
+	cw.worst = SV_AIR;
+	cw.found = 0;
+	clash_walk_r(a, b, &cw);
+	return(cw.worst);
+}
+
+#if macintosh
+ #pragma export off
+#endif
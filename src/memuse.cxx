@@ -0,0 +1,314 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Memory accounting for models and everything they hold
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#ifdef SV_UNIX
+ #include <sys/resource.h>
+#endif
+#if macintosh
+ #pragma export on
+#endif
+
+// Roughly what malloc really takes for a block of n bytes (a
+// word of overhead, 16-byte granularity, 32 bytes minimum)
+
+static long heap_bytes(long n)
+{
+	n = (n + sizeof(long) + 15) & ~15L;
+	if(n < 32) n = 32;
+	return(n);
+}
+
+// The nodes already seen, keyed on the node address (the handles'
+// unique() value), with how many times each has been reached
+
+class mem_seen
+{
+	key_table<sv_integer> hits;
+
+public:
+
+	mem_seen() : hits(4096) { }
+
+// Record a visit to k; true if it is the first
+
+	int visit(long k, sv_mem_count* c)
+	{
+		int added;
+		sv_integer* h = hits.add(k, &added);
+		c->refs++;
+		if(!added)
+		{
+			if(++(*h) == 2) c->shared++;
+			return(0);
+		}
+		*h = 1;
+		c->nodes++;
+		return(1);
+	}
+};
+
+// The walk itself; the classes make this a friend so it can see
+// the sizes of their data records and the primitives' grads
+
+class sv_mem_walk
+{
+public:
+	mem_seen seen;
+	sv_mem_stats* ms;
+	sv_mem_count index_count;	// Set-list indexes (bytes go in set_list)
+
+	void prim(const sv_primitive& p);
+	void set(const sv_set& s);
+	void attribute(const sv_attribute& a);
+	void set_list(const sv_set_list& sl);
+	void model(const sv_model& m);
+};
+
+void sv_mem_walk::prim(const sv_primitive& p)
+{
+	if(!p.exists()) return;
+	if(!seen.visit(p.unique(), &ms->prim)) return;
+	ms->prim.bytes += sv_pool_bytes(sizeof(sv_primitive::prim_data));
+	if(p.prim_info->op == SV_XFORM)
+		ms->prim.bytes += heap_bytes(sizeof(sv_xform));
+	else if( (p.prim_info->kind == SV_BLOCK) && p.prim_info->block) 
+		ms->prim.bytes += heap_bytes(sizeof(sv_box));
+	if(p.prim_info->shape) ms->prim.bytes += heap_bytes(sizeof(sv_shape_data));
+	prim(sv_primitive::wrap(p.prim_info->child_1));
+	prim(sv_primitive::wrap(p.prim_info->child_2));
+	prim(sv_primitive::wrap(p.prim_info->grad_x));
+	prim(sv_primitive::wrap(p.prim_info->grad_y));
+	prim(sv_primitive::wrap(p.prim_info->grad_z));
+}
+
+void sv_mem_walk::attribute(const sv_attribute& aa)
+{
+	sv_attribute a = aa;
+	sv_p_gon pt;
+	sv_p_gon* pg;
+	sv_integer v;
+
+	while(a.exists())
+	{
+		if(!seen.visit(a.unique(), &ms->attribute)) return;
+		ms->attribute.bytes += heap_bytes(sizeof(sv_attribute::attribute_data)) +
+			heap_bytes(sizeof(sv_attribute));
+		if(!a.user_attribute())
+		{
+			a = a.next();
+			continue;
+		}
+		ms->attribute.bytes += heap_bytes(sizeof(sv_user_attribute));
+		if(a.tag_val() == -pt.tag())
+		{
+			pg = (sv_p_gon*)(a.user_attribute()->pointer);
+			v = p_gon_vertex_count(pg);
+			ms->polygons++;
+			ms->vertices += v;
+			ms->polygon_bytes += v*heap_bytes(sizeof(sv_p_gon));
+		}
+		a = a.next();
+	}
+}
+
+// Sets are walked with a stack of their own rather than by recursion,
+// as a chain of unions built up a part at a time can be very deep
+
+void sv_mem_walk::set(const sv_set& top)
+{
+	sv_integer max = 64;
+	sv_integer sp = 0;
+	sv_set* stack = new sv_set[max];
+	sv_set s;
+
+	stack[sp++] = top;
+	while(sp)
+	{
+		s = stack[--sp];
+		if(!s.exists()) continue;
+		attribute(s.attribute());
+		if(!seen.visit(s.unique(), &ms->set)) continue;
+		ms->set.bytes += sv_pool_bytes(sizeof(sv_set::set_data));
+		if(s.cv_packed()) ms->set.bytes += s.cv_packed()->bytes();
+		if(s.balance_bounds()) ms->set.bytes += heap_bytes(2*sizeof(sv_box));
+		if(sp + 3 > max)
+		{
+			sv_set* bigger = new sv_set[2*max];
+			for(sv_integer i = 0; i < sp; i++) bigger[i] = stack[i];
+			delete [] stack;
+			stack = bigger;
+			max = 2*max;
+		}
+		stack[sp++] = s.complement();
+		if(s.contents() == 1)
+			prim(s.primitive());
+		else
+		{
+			stack[sp++] = s.child_2();
+			stack[sp++] = s.child_1();
+		}
+	}
+	delete [] stack;
+}
+
+void sv_mem_walk::set_list(const sv_set_list& sll)
+{
+	sv_set_list sl = sll;
+	while(sl.exists())
+	{
+		if(!seen.visit(sl.unique(), &ms->set_list)) return;
+		ms->set_list.bytes += heap_bytes(sizeof(sv_set_list::set_list_data)) +
+			heap_bytes(sizeof(sv_set_list));
+		if(sl.set_list_info->index.exists() && 
+		   seen.visit(sl.set_list_info->index.unique(), &index_count))
+			ms->set_list.bytes += sl.set_list_info->index->bytes();
+		set(sl.set());
+		sl = sl.next();
+	}
+}
+
+void sv_mem_walk::model(const sv_model& m)
+{
+	if(!m.exists()) return;
+	if(!seen.visit(m.unique(), &ms->model)) return;
+	ms->model.bytes += heap_bytes(sizeof(sv_model::model_data)) + 
+		3*heap_bytes(sizeof(sv_model));
+	set_list(m.set_list());
+	if(m.kind() == INSTANCE_M)
+		ms->model.bytes += heap_bytes(2*sizeof(sv_xform));
+	if(m.kind() != LEAF_M)
+	{
+		model(m.child_1());
+		model(m.child_2());
+	}
+}
+
+static void zero_count(sv_mem_count* c)
+{
+	c->nodes = 0;
+	c->refs = 0;
+	c->shared = 0;
+	c->bytes = 0;
+}
+
+long peak_rss()
+{
+#ifdef SV_UNIX
+	struct rusage ru;
+	if(!getrusage(RUSAGE_SELF, &ru)) return(ru.ru_maxrss);
+#endif
+	return(-1);
+}
+
+void memory_use(const sv_model& m, sv_mem_stats* ms)
+{
+	zero_count(&ms->model);
+	zero_count(&ms->set_list);
+	zero_count(&ms->set);
+	zero_count(&ms->prim);
+	zero_count(&ms->attribute);
+	ms->polygons = 0;
+	ms->vertices = 0;
+	ms->polygon_bytes = 0;
+
+	sv_mem_walk w;
+	w.ms = ms;
+	zero_count(&w.index_count);
+	w.model(m);
+
+	ms->total_bytes = ms->model.bytes + ms->set_list.bytes + ms->set.bytes +
+		ms->prim.bytes + ms->attribute.bytes + ms->polygon_bytes;
+	ms->peak_rss = peak_rss();
+}
+
+// One line of the report
+
+static void mem_line(ostream& f, const char* name, const sv_mem_count& c, long total)
+{
+	f << "  " << name << ": " << c.nodes << " nodes, " << c.bytes << " bytes";
+	if(total > 0) f << " (" << 100.0*(sv_real)c.bytes/(sv_real)total << "%)";
+	f << SV_EL;
+	if(c.nodes)
+		f << "    " << c.shared << " of them shared; reached " << 
+			(sv_real)c.refs/(sv_real)c.nodes << " times each on average." << SV_EL;
+}
+
+void sv_model::mem_stat_report(ostream& f) const
+{
+	sv_mem_stats ms;
+	memory_use(*this, &ms);
+
+	f << SV_EL << "SvLis memory statistics" << SV_EL << SV_EL;
+	f << "  Note: nodes shared between handles are counted once." << SV_EL << SV_EL;
+	mem_line(f, "Model nodes", ms.model, ms.total_bytes);
+	mem_line(f, "Set list nodes", ms.set_list, ms.total_bytes);
+	mem_line(f, "Set nodes", ms.set, ms.total_bytes);
+	mem_line(f, "Primitive nodes", ms.prim, ms.total_bytes);
+	mem_line(f, "Attribute nodes", ms.attribute, ms.total_bytes);
+	f << "  Polygons: " << ms.polygons << " with " << ms.vertices << 
+		" vertices in all, taking " << ms.polygon_bytes << " bytes" << SV_EL << SV_EL;
+	f << "  Total: " << ms.total_bytes << " bytes." << SV_EL;
+	if(ms.peak_rss >= 0)
+		f << "  The process's peak resident size so far is " << ms.peak_rss << " kB." << SV_EL;
+	f << SV_EL;
+
+	f.flush();
+}
+
+#if macintosh
+ #pragma export off
+#endif
@@ -61,12 +61,18 @@
 #include "geometry.h"
 #include "interval.h"
 #include "sv_b_cls.h"
+#include "sv_stats.h"
+#include "sv_pool.h"
+#include "sv_index.h"
+#include "sv_xform.h"
+#include "sv_trace.h"
 #include "prim.h"
 #include "attrib.h"
 #include "sv_set.h"
 #include "decision.h"
 #include "polygon.h"
 #include "model.h"
+#include "sv_util.h"
 #if macintosh
  #pragma export on
 #endif
@@ -81,6 +87,7 @@ sv_integer sv_model::tag() const { return(SVT_F*SVT_MODEL); }
 
 ostream& operator<<(ostream& s, sv_model& m)
 {
+	sv_trace_span span("write model");
 	unwrite(m);
 	write_svlis_header(s);
 	write(s, m, 0);
@@ -90,12 +97,47 @@ ostream& operator<<(ostream& s, sv_model& m)
 
 istream& operator>>(istream& s, sv_model& m)
 {
+	sv_trace_span span("read model");
 	sv_clear_input_tables();
 	check_svlis_header(s);
 	read(s, m);
 	return(s);
 }
 
+// Instances
+
+sv_model::sv_model(const sv_model& prototype, const sv_xform& place, const sv_model& rest)
+{
+	model_info = new model_data(prototype, place, rest);
+}
+
+// With nothing else, the rest is an empty leaf round the instance
+
+sv_model::sv_model(const sv_model& prototype, const sv_xform& place)
+{
+	sv_model rest = sv_model(sv_set_list(sv_set(SV_NOTHING)), 
+		place.map(prototype.box()), LEAF_M);
+	model_info = new model_data(prototype, place, rest);
+}
+
+// A prototype set placed in the world, kept by the prototype set's
+// address; the copy holds the prototype set, so the address can't be
+// reused while it's in the table
+
+sv_set sv_model::model_data::placed(const sv_set& s)
+{
+	sv_set result;
+	int added;
+
+	lock.shut();
+	if(!ws) ws = new key_table<sv_set>(16);
+	sv_set* w = ws->add(s.unique(), &added);
+	if(added) *w = s.transform(xf[1]);
+	result = *w;
+	lock.open();
+	return(result);
+}
+
 // Set some flag bits
 
 // Set some flag bits - needs to be here as FLAG_MASK is defined in private.h
@@ -115,6 +157,7 @@ void write(ostream& s, const mod_kind& k, sv_integer level)
 	case X_DIV: s << 'X'; break;
 	case Y_DIV: s << 'Y'; break;
 	case Z_DIV: s << 'Z'; break;
+	case INSTANCE_M: s << 'I'; break;
 
 	default:
 		svlis_error("write(.. mod_kind)","dud value",SV_CORRUPT);
@@ -177,7 +220,7 @@ void write(ostream& s, sv_model& a, sv_integer level)
 	{
 		s << ' ';
 		write(s, a.kind(), 0); s << ' ';
-		writei(s, a.flags(), 0); s << SV_EL;
+		writei(s, a.flags() & ~SV_PAGE_FLAG, 0); s << SV_EL;
 		a.set_flags_priv(WRIT_BIT);
 		write(s, a.box(), nxl); s << SV_EL;
 		sl = a.set_list();
@@ -205,6 +248,14 @@ void write(ostream& s, sv_model& a, sv_integer level)
 			write(s, m_temp, nxl);
 			break;
 
+		case INSTANCE_M:
+			write(s, a.place(), nxl); s << SV_EL;
+			m_temp = a.child_1();
+			write(s, m_temp, nxl);
+			m_temp = a.child_2();
+			write(s, m_temp, nxl);
+			break;
+
 		default:
 			svlis_error("write(model)", "dud kind", SV_CORRUPT);
 		}
@@ -238,87 +289,124 @@ static sv_real swell_fac = DEF_SWELL_FAC;
 void set_swell_fac(sv_real sf) {swell_fac = sf;}
 sv_real get_swell_fac() {return(swell_fac);}
 
-void redivide_r(void* vsdd)
+// Make the two children of a model cut at c (unless the decision
+// procedure has already made them)
+
+static void make_children(const sv_model& m, const sv_set_list& s, mod_kind k, 
+	sv_real cut, sv_model* c_1, sv_model* c_2)
 {
-	sv_div_data *sdd = (sv_div_data*) vsdd;
-	sv_set_list s = sdd->set_list();
-	sv_model m = sv_model(sdd->model().parent(), s, sdd->model().box(), sdd->model().child_1(),
-		sdd->model().child_2(), sdd->model().kind(), sdd->model().coord(), sdd->model().flags()); 
-	sv_integer level = sdd->level();
-	void* vp = sdd->pointer();
-	sv_model result;
-	sv_model c_1;			// The two children that may be created by decision
-	sv_model c_2;
-	mod_kind k;			// The result from decision
-	sv_real cut;			// The result from decision
 	sv_box b = m.box();
 	sv_interval x = b.xi;		// The parent box intervals
 	sv_interval y = b.yi;
 	sv_interval z = b.zi;
 	sv_interval i_part;		// The lower and upper halves of the divided interval
 	sv_box b_part;			// The sub-boxes
-	sv_model nul;			// Get rid of unwanted sub-trees by assigning this
 
-	sv_decision decis = sdd->decision();
-	(*decis) (m, level, vp, &k, &cut, &c_1, &c_2);
+	sv_stat_n(SV_ST_NODE, 2);
 
 	switch (k)
 	{ 
-	case LEAF_M:
-		if (c_1.exists())  // User done the work?
-		{
-			sdd->result(c_1);
-			return;
-		}
-		result = sv_model(m.set_list(), m.box(), m.parent());
-		sdd->result(result);
-		return;
-
 	case X_DIV:
-		if ( !c_1.exists() )
+		if ( !c_1->exists() )
 		{
 			i_part = sv_interval(x.lo(), cut + (cut - x.lo())*swell_fac);
           		b_part = sv_box(i_part, y, z);
-			c_1 = sv_model(s, b_part, m);
+			*c_1 = sv_model(s, b_part, m);
 		}
-		if ( !c_2.exists() )
+		if ( !c_2->exists() )
 		{
 			i_part = sv_interval(cut - (x.hi() - cut)*swell_fac, x.hi());
 			b_part = sv_box(i_part, y, z);
-			c_2 = sv_model(s, b_part, m);
+			*c_2 = sv_model(s, b_part, m);
 		}
 		break;
 
 	  case Y_DIV:
-		if ( !c_1.exists() )
+		if ( !c_1->exists() )
 		{
 			i_part = sv_interval(y.lo(), cut + (cut - y.lo())*swell_fac);
           		b_part = sv_box(x, i_part, z);
-			c_1 = sv_model(s, b_part, m);
+			*c_1 = sv_model(s, b_part, m);
 		}
-		if ( !c_2.exists() )
+		if ( !c_2->exists() )
 		{
 			i_part = sv_interval(cut - (y.hi() - cut)*swell_fac, y.hi());
 			b_part = sv_box(x, i_part, z);
-			c_2 = sv_model(s, b_part, m);
+			*c_2 = sv_model(s, b_part, m);
 		}
 		break;
 
 	  case Z_DIV:
-		if ( !c_1.exists() )
+		if ( !c_1->exists() )
 		{
 			i_part = sv_interval(z.lo(), cut + (cut - z.lo())*swell_fac);
           		b_part = sv_box(x, y, i_part);
-			c_1 = sv_model(s, b_part, m);
+			*c_1 = sv_model(s, b_part, m);
 		}
-		if ( !c_2.exists() )
+		if ( !c_2->exists() )
 		{
 			i_part = sv_interval(cut - (z.hi() - cut)*swell_fac, z.hi());
 			b_part = sv_box(x, y, i_part);
-			c_2 = sv_model(s, b_part, m);
+			*c_2 = sv_model(s, b_part, m);
 		}
 		break;
 
+	  default:
+	  	svlis_error("make_children", "dud model kind", SV_CORRUPT);
+	}
+}
+
+void redivide_r(void* vsdd)
+{
+	sv_div_data *sdd = (sv_div_data*) vsdd;
+
+// Trees of instances are built already divided, and are left alone
+
+	if(sdd->model().flags() & SV_INST_FLAG)
+	{
+		sdd->result(sdd->model());
+		return;
+	}
+
+	sv_set_list s = sdd->set_list();
+	sv_model m = sv_model(sdd->model().parent(), s, sdd->model().box(), sdd->model().child_1(),
+		sdd->model().child_2(), sdd->model().kind(), sdd->model().coord(), 
+		sdd->model().flags() & ~SV_PAGE_FLAG); 
+	sv_integer level = sdd->level();
+	sv_trace_span span("redivide_r", level);
+	void* vp = sdd->pointer();
+	sv_model result;
+	sv_model c_1;			// The two children that may be created by decision
+	sv_model c_2;
+	mod_kind k;			// The result from decision
+	sv_real cut;			// The result from decision
+	sv_model nul;			// Get rid of unwanted sub-trees by assigning this
+
+	sv_decision decis = sdd->decision();
+	{
+		sv_trace_span ds("decision", level);
+		(*decis) (m, level, vp, &k, &cut, &c_1, &c_2);
+	}
+	sv_stat(SV_ST_DIVIDE);
+
+	switch (k)
+	{ 
+	case LEAF_M:
+		if (c_1.exists())  // User done the work?
+		{
+			sdd->result(c_1);
+			return;
+		}
+		result = sv_model(m.set_list(), m.box(), m.parent());
+		sdd->result(result);
+		return;
+
+	case X_DIV:
+	case Y_DIV:
+	case Z_DIV:
+		make_children(m, s, k, cut, &c_1, &c_2);
+		break;
+
 	  default:
 	  	svlis_error("redivide_r", "dud model kind", SV_CORRUPT);
 	}
@@ -439,11 +527,21 @@ sv_model root_model() { return(r_m); }
 
 // Initialize recursive division 
 
+// Whether to balance long union and intersection chains in the sets
+// before dividing
+
+static sv_integer balance_div = 0;
+
+void set_balance_division(sv_integer b) { balance_div = b; }
+sv_integer get_balance_division() { return(balance_div); }
+
 sv_model sv_model::redivide(const sv_set_list& s, void* vp, sv_decision decision ) const
 {
+	sv_trace_span span("redivide");
 	r_m = *this;
 	sv_model nul;
-	sv_div_data sdd = sv_div_data(*this, s, 0, vp, decision);
+	sv_set_list sl = balance_div ? s.balance(box()) : s;
+	sv_div_data sdd = sv_div_data(*this, sl, 0, vp, decision);
 	sv_model result;
 	redivide_r((void*)&sdd);
 	result = sdd.result();
@@ -453,6 +551,227 @@ sv_model sv_model::redivide(const sv_set_list& s, void* vp, sv_decision decision
 	return(result);
 }
 
+// Best-first division under a budget.  The tree is grown in a work
+// structure, always dividing the open leaf with the biggest contents
+// times volume next, until the decision procedure closes every leaf
+// or the budget runs out.  Then the sv_model is built bottom up.
+
+struct bf_node
+{
+	sv_model m;		// This box (as it was before any division)
+	bf_node* c1;		// Children if divided
+	bf_node* c2;
+	mod_kind k;
+	sv_real cut;
+	sv_integer level;
+	sv_real priority;
+
+	bf_node() { c1 = 0; c2 = 0; k = LEAF_M; cut = 0; level = 0; priority = 0; }
+	~bf_node() { delete c1; delete c2; }
+};
+
+// A heap of open leaves, biggest priority at the top
+
+class bf_heap
+{
+	bf_node** h;
+	sv_integer n;
+	sv_integer size;
+
+public:
+
+	bf_heap() { size = 64; n = 0; h = new bf_node*[size]; }
+	~bf_heap() { delete [] h; }
+
+	sv_integer count() const { return(n); }
+
+	void push(bf_node* b)
+	{
+		if(n >= size)
+		{
+			bf_node** hn = new bf_node*[2*size];
+			for(sv_integer j = 0; j < n; j++) hn[j] = h[j];
+			delete [] h;
+			h = hn;
+			size = 2*size;
+		}
+		sv_integer i = n++;
+		while(i > 0)
+		{
+			sv_integer up = (i - 1)/2;
+			if(h[up]->priority >= b->priority) break;
+			h[i] = h[up];
+			i = up;
+		}
+		h[i] = b;
+	}
+
+	bf_node* pop()
+	{
+		bf_node* top = h[0];
+		bf_node* b = h[--n];
+		sv_integer i = 0;
+		sv_integer c;
+		while((c = 2*i + 1) < n)
+		{
+			if((c + 1 < n) && (h[c + 1]->priority > h[c]->priority)) c++;
+			if(b->priority >= h[c]->priority) break;
+			h[i] = h[c];
+			i = c;
+		}
+		h[i] = b;
+		return(top);
+	}
+};
+
+// Contents times volume
+
+static sv_real bf_priority(const sv_model& m)
+{
+	sv_integer c = 0;
+	sv_integer cs;
+	sv_set_list sl = m.set_list();
+	while(sl.exists())
+	{
+		cs = sl.set().contents();
+		if(cs > 0) c += cs;
+		sl = sl.next();
+	}
+	return((sv_real)c*m.box().vol());
+}
+
+// Load an existing model into the work tree, putting its leaves on the heap
+
+static bf_node* bf_load(const sv_model& m, sv_integer level, bf_heap* h, sv_integer* nodes)
+{
+	bf_node* n = new bf_node;
+	n->m = m;
+	n->level = level;
+	(*nodes)++;
+	if(m.flags() & SV_INST_FLAG) return(n);  // Instances are left alone
+	if(m.kind() == LEAF_M)
+	{
+		n->priority = bf_priority(m);
+		h->push(n);
+	} else
+	{
+		n->k = m.kind();
+		n->cut = m.coord();
+		n->c1 = bf_load(m.child_1(), level + 1, h, nodes);
+		n->c2 = bf_load(m.child_2(), level + 1, h, nodes);
+	}
+	return(n);
+}
+
+// Build the model from the work tree; parts that didn't change are
+// returned as they were.  New nodes are in memory, so they lose any
+// page flag (see redivide_r()).
+
+static sv_model bf_build(bf_node* n)
+{
+	if(n->k == LEAF_M) return(n->m);
+	sv_model c1 = bf_build(n->c1);
+	sv_model c2 = bf_build(n->c2);
+	if( (n->m.kind() != LEAF_M) && (n->m.child_1() == c1) && (n->m.child_2() == c2) )
+		return(n->m);
+	return(sv_model(n->m, n->m.set_list(), n->m.box(), c1, c2, n->k, n->cut,
+		n->m.flags() & ~SV_PAGE_FLAG));
+}
+
+// Rough heap cost of a new leaf: the model node and its handles,
+// plus its set list and the pruned sets in it
+
+#define BF_ENTRY_BYTES 80
+
+static long bf_bytes(const sv_model& m, long node_bytes)
+{
+	sv_integer c = m.set_list().contents();
+	if(c < 0) c = 0;
+	return(node_bytes + (m.set_list().count() + c)*BF_ENTRY_BYTES);
+}
+
+sv_model sv_model::divide_budget(void* vp, sv_decision decision, 
+	const sv_div_budget& budget, sv_integer* complete) const
+{
+	const long node_bytes = sizeof(model_data) + 3*sizeof(sv_model);
+	bf_heap heap;
+	sv_integer nodes = 0;
+	long bytes = 0;
+	sv_integer stopped = 0;
+	clock_t start = clock();
+	sv_model nul;
+	sv_trace_span span("divide_budget");
+
+	r_m = *this;
+
+// As in redivide(), a fresh division may balance the sets first
+
+	sv_model first = *this;
+	if(balance_div && (kind() == LEAF_M))
+		first = sv_model(parent(), set_list().balance(box()), box(), child_1(), 
+			child_2(), LEAF_M, coord(), flags() & ~SV_PAGE_FLAG);
+	bf_node* root = bf_load(first, 0, &heap, &nodes);
+	bytes = nodes*node_bytes;
+
+	while(heap.count())
+	{
+		if( (budget.nodes > 0) && (nodes + 2 > budget.nodes) )
+		{
+			stopped = 1;
+			break;
+		}
+		if( (budget.millisecs > 0) && 
+		  (1000.0*(sv_real)(clock() - start)/(sv_real)CLOCKS_PER_SEC >= budget.millisecs) )
+		{
+			stopped = 1;
+			break;
+		}
+
+		bf_node* n = heap.pop();
+		mod_kind k;
+		sv_real cut;
+		sv_model c_1, c_2;
+
+		(*decision) (n->m, n->level, vp, &k, &cut, &c_1, &c_2);
+
+		if(k == LEAF_M)
+		{
+			if(c_1.exists()) n->m = c_1;  // User done the work?
+			continue;
+		}
+
+		make_children(n->m, n->m.set_list(), k, cut, &c_1, &c_2);
+		long more = bf_bytes(c_1, node_bytes) + bf_bytes(c_2, node_bytes);
+		if( (budget.bytes > 0) && (bytes + more > budget.bytes) )
+		{
+			heap.push(n);
+			stopped = 1;
+			break;
+		}
+
+		n->k = k;
+		n->cut = cut;
+		n->c1 = new bf_node;
+		n->c1->m = c_1;
+		n->c1->level = n->level + 1;
+		n->c1->priority = bf_priority(c_1);
+		n->c2 = new bf_node;
+		n->c2->m = c_2;
+		n->c2->level = n->level + 1;
+		n->c2->priority = bf_priority(c_2);
+		heap.push(n->c1);
+		heap.push(n->c2);
+		nodes += 2;
+		bytes += more;
+	}
+
+	sv_model result = bf_build(root);
+	delete root;
+	r_m = nul;
+	if(complete) *complete = !stopped;
+	return(result);
+}
+
 int sv_model::has_polygons() const 
 {
 	return((flags() & SV_POLYGON_FLAG) != 0);
@@ -478,6 +797,10 @@ sv_model sv_model::deep() const
 	case LEAF_M:
 		return(sv_model(set_list().deep(), box(), LEAF_M, parent()));
 		break;			
+
+	case INSTANCE_M:
+		svlis_error("sv_model::deep()","deep copy of an instance",SV_WARNING);
+		return(*this);
 	
 	default:
 		svlis_error("sv_model::deep()","dud model kind",SV_CORRUPT);
@@ -494,6 +817,7 @@ mem_test sv_model::member(const sv_point& p, sv_primitive* ks) const
 	sv_set_list sl;
 	mem_test result = SV_AIR;
 	mem_test temp;
+	sv_primitive k1;
 	
 	if (box().member(p) == SV_AIR) return(SV_AIR);
 	
@@ -527,6 +851,22 @@ mem_test sv_model::member(const sv_point& p, sv_primitive* ks) const
 			sl = sl.next();
 		}
 		break;			
+
+// Test the prototype in its own space, and then the rest; the key
+// primitive is mapped back to the world
+
+	case INSTANCE_M:
+		result = child_1().member(unplace().map(p), &k1);
+		if(ks && k1.exists()) k1 = k1.transform(place());
+		if(result == SV_SOLID)
+		{
+			if(ks) *ks = k1;
+			return(SV_SOLID);
+		}
+		temp = child_2().member(p, ks);
+		if(temp != SV_AIR) return(temp);
+		if((result == SV_SURFACE) && ks) *ks = k1;
+		break;
 	
 	default:
 		svlis_error("sv_model::member(...)","dud model kind",SV_CORRUPT);
@@ -535,6 +875,94 @@ mem_test sv_model::member(const sv_point& p, sv_primitive* ks) const
 	return(result);
 }
 
+// Reorder a model for faster membership tests.  In a leaf each set
+// is reordered on its own, then the list (which member() unions) is
+// sorted so sets that are more often solid for their cost come first.
+// Parts that don't change are returned as they were.
+
+sv_model sv_model::reorder(sv_integer samples) const
+{
+	if(kind() == INSTANCE_M)
+	{
+		sv_model c1 = child_1().reorder(samples);
+		sv_model c2 = child_2().reorder(samples);
+		if( (c1 == child_1()) && (c2 == child_2()) ) return(*this);
+		return(sv_model(c1, place(), c2));
+	}
+
+	if(kind() != LEAF_M)
+	{
+		sv_model c1 = child_1().reorder(samples);
+		sv_model c2 = child_2().reorder(samples);
+		if( (c1 == child_1()) && (c2 == child_2()) ) return(*this);
+		return(sv_model(*this, set_list(), box(), c1, c2, kind(), coord(), flags()));
+	}
+
+	sv_integer n = set_list().count();
+	if( (samples < 1) || !n ) return(*this);
+
+	sv_point* p = new sv_point[samples];
+	mem_test* m = new mem_test[samples];
+	sv_real* c = new sv_real[samples];
+	sv_set* s = new sv_set[n];
+	sv_real* rank = new sv_real[n];
+	sv_integer i, j, solid;
+	sv_real cost, r;
+	sv_set t;
+	int changed = 0;
+
+	for(i = 0; i < samples; i++) p[i] = ran_point(box());
+	sv_set_list sl = set_list();
+	for(i = 0; i < n; i++)
+	{
+		s[i] = sl.set().reorder(p, samples, m, c);
+		if(s[i] != sl.set()) changed = 1;
+		solid = 0;
+		cost = 0;
+		for(j = 0; j < samples; j++)
+		{
+			if(m[j] == SV_SOLID) solid++;
+			cost = cost + c[j];
+		}
+
+// Cost per solid answer; sets that are never solid go last
+
+		rank[i] = solid ? cost/(sv_real)solid : (1 + cost)*(sv_real)samples;
+		sl = sl.next();
+	}
+
+// Insertion sort - leaf lists are short
+
+	for(i = 1; i < n; i++)
+	{
+		t = s[i];
+		r = rank[i];
+		for(j = i - 1; (j >= 0) && (rank[j] > r); j--)
+		{
+			s[j + 1] = s[j];
+			rank[j + 1] = rank[j];
+			changed = 1;
+		}
+		s[j + 1] = t;
+		rank[j + 1] = r;
+	}
+
+	sv_model result = *this;
+	if(changed)
+	{
+		sv_set_list nl = sv_set_list(s[n - 1]);
+		for(i = n - 2; i >= 0; i--) nl = sv_set_list(s[i], nl);
+		result = sv_model(nl, box(), LEAF_M, parent());
+	}
+
+	delete [] p;
+	delete [] m;
+	delete [] c;
+	delete [] s;
+	delete [] rank;
+	return(result);
+}
+
 // Return the leaf containing a point
 
 sv_model sv_model::leaf(const sv_point& p) const
@@ -568,6 +996,15 @@ sv_model sv_model::leaf(const sv_point& p) const
 		else
 			return(nothing);
 
+// Inside a placed prototype the leaf is the prototype's, which is in
+// its own space
+
+	case INSTANCE_M:
+		if(child_1().box().member(unplace().map(p)) != SV_AIR)
+			return(child_1().leaf(unplace().map(p)));
+		else
+			return(child_2().leaf(p));
+
 	default:
 		svlis_error("sv_model::leaf", "dud model kind", SV_CORRUPT);
 	}
@@ -575,6 +1012,131 @@ sv_model sv_model::leaf(const sv_point& p) const
 	return(nothing);
 }
 
+// Build a model of placed prototypes.  The instances in box b are
+// split at the mean of their centres along b's longest side.  Ones
+// that straddle the cut are chained in front of the divided box, so
+// each instance is in the tree once.  When there are few left, or no
+// split separates them, they are all chained.  The cuts are not
+// swollen, as the boxes are exact.
+
+#define INST_CHAIN 2		// Chain this many instances (or fewer)
+#define INST_DEPTH 40		// Deepest tree to build
+
+static sv_model inst_tree(const sv_model* proto, const sv_xform* place, 
+	const sv_box* ib, sv_integer* i, sv_integer n, const sv_box& b, sv_integer depth)
+{
+	sv_set_list nothing = sv_set_list(sv_set(SV_NOTHING));
+	sv_model nul;
+	sv_model result;
+	sv_integer j, n1, n2, n3;
+	sv_integer* i3 = i;
+
+	n3 = n;
+	if( (n > INST_CHAIN) && (depth < INST_DEPTH) )
+	{
+		sv_real dx = b.xi.hi() - b.xi.lo();
+		sv_real dy = b.yi.hi() - b.yi.lo();
+		sv_real dz = b.zi.hi() - b.zi.lo();
+		mod_kind k = X_DIV;
+		if( (dy > dx) && (dy >= dz) ) k = Y_DIV;
+		if( (dz > dx) && (dz > dy) ) k = Z_DIV;
+
+		sv_interval* iv = new sv_interval[n];
+		sv_interval bi;
+		sv_real cut = 0;
+		for(j = 0; j < n; j++)
+		{
+			switch(k)
+			{
+			case X_DIV: iv[j] = ib[i[j]].xi; bi = b.xi; break;
+			case Y_DIV: iv[j] = ib[i[j]].yi; bi = b.yi; break;
+			default: iv[j] = ib[i[j]].zi; bi = b.zi; break;
+			}
+			cut = cut + 0.5*(iv[j].lo() + iv[j].hi());
+		}
+		cut = cut/(sv_real)n;
+		if( (cut <= bi.lo()) || (cut >= bi.hi()) ) cut = 0.5*(bi.lo() + bi.hi());
+
+		sv_integer* i1 = new sv_integer[n];
+		sv_integer* i2 = new sv_integer[n];
+		i3 = new sv_integer[n];
+		n1 = 0;
+		n2 = 0;
+		n3 = 0;
+		for(j = 0; j < n; j++)
+		{
+			if(iv[j].hi() < cut) 
+				i1[n1++] = i[j];
+			else if(iv[j].lo() >= cut)
+				i2[n2++] = i[j];
+			else
+				i3[n3++] = i[j];
+		}
+
+		if(n3 < n)
+		{
+			sv_box b1 = b;
+			sv_box b2 = b;
+			switch(k)
+			{
+			case X_DIV:
+				b1.xi = sv_interval(b.xi.lo(), cut);
+				b2.xi = sv_interval(cut, b.xi.hi());
+				break;
+			case Y_DIV:
+				b1.yi = sv_interval(b.yi.lo(), cut);
+				b2.yi = sv_interval(cut, b.yi.hi());
+				break;
+			default:
+				b1.zi = sv_interval(b.zi.lo(), cut);
+				b2.zi = sv_interval(cut, b.zi.hi());
+				break;
+			}
+			sv_model c1 = inst_tree(proto, place, ib, i1, n1, b1, depth + 1);
+			sv_model c2 = inst_tree(proto, place, ib, i2, n2, b2, depth + 1);
+			result = sv_model(nul, nothing, b, c1, c2, k, cut, SV_INST_FLAG);
+		} else
+		{
+			delete [] i3;
+			i3 = i;
+		}
+		delete [] iv;
+		delete [] i1;
+		delete [] i2;
+	}
+
+	if(!result.exists())
+		result = sv_model(nul, nothing, b, nul, nul, LEAF_M, 0, SV_INST_FLAG);
+	for(j = n3 - 1; j >= 0; j--)
+		result = sv_model(proto[i3[j]], place[i3[j]], result);
+	if(i3 != i) delete [] i3;
+	return(result);
+}
+
+sv_model instance_model(const sv_model* proto, const sv_xform* place, sv_integer n)
+{
+	sv_model result;
+	if(n < 1)
+	{
+		svlis_error("instance_model", "no instances", SV_WARNING);
+		return(result);
+	}
+
+	sv_box* ib = new sv_box[n];
+	sv_integer* i = new sv_integer[n];
+	sv_box b;
+	for(sv_integer j = 0; j < n; j++)
+	{
+		ib[j] = place[j].map(proto[j].box());
+		i[j] = j;
+		b = j ? (b | ib[j]) : ib[j];
+	}
+	result = inst_tree(proto, place, ib, i, n, b, 0);
+	delete [] ib;
+	delete [] i;
+	return(result);
+}
+
 // Gather model statistics
 
 void m_stats::model_stats(const sv_model& m, m_stats* ms)
@@ -659,6 +1221,7 @@ void m_stats::model_stats(const sv_model& m, m_stats* ms)
 	case X_DIV:
 	case Y_DIV:
 	case Z_DIV:
+	case INSTANCE_M:
 			m_stats::model_stats(m.child_1(), ms);
 			m_stats::model_stats(m.child_2(), ms);
 			break;
@@ -786,6 +1349,9 @@ void sv_model::div_stat_report(ostream& f) const
 			ms->max_pg_count << SV_EL;
 	}
 
+	f << SV_EL << "  Event counts since the program started (or reset_stats()):" << SV_EL;
+	stat_report(f);
+
 	f << SV_EL << SV_EL;
 
 	f.flush();
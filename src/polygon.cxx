@@ -62,6 +62,11 @@
 #include "geometry.h"
 #include "interval.h"
 #include "sv_b_cls.h"
+#include "sv_stats.h"
+#include "sv_pool.h"
+#include "sv_index.h"
+#include "sv_xform.h"
+#include "sv_trace.h"
 #include "prim.h"
 #include "attrib.h"
 #include "sv_set.h"
@@ -1599,6 +1604,9 @@ sv_integer did_facet(const sv_model& mm, const sv_set& s, int force)
 	sv_integer div_dir;
 
 
+	sv_stat(SV_ST_FACET);
+	sv_trace_span span("did_facet");
+
 // Decide what to do.
 
 // Does this box just contain one convex polyhedron?
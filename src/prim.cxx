@@ -62,7 +62,12 @@
 #include "geometry.h"
 #include "interval.h"
 #include "sv_b_cls.h"
+#include "sv_stats.h"
+#include "sv_pool.h"
+#include "sv_index.h"
+#include "sv_xform.h"
 #include "prim.h"
+#include "sv_uprim.h"
 #if macintosh
  #pragma export on
 #endif
@@ -78,6 +83,23 @@ sv_integer sv_primitive::tag() const { return(SVT_F*SVT_PRIM); }
 
 static const sv_primitive zero = sv_primitive(0);
 
+// a*g0 + b*g1 + c*g2, leaving out the zero terms
+
+static sv_primitive grad_sum(sv_real a, const sv_primitive& g0, sv_real b,
+	const sv_primitive& g1, sv_real c, const sv_primitive& g2)
+{
+	sv_primitive r;
+	sv_real k[3] = {a, b, c};
+	const sv_primitive* g[3] = {&g0, &g1, &g2};
+	for(sv_integer i = 0; i < 3; i++)
+	{
+		if(k[i] == 0.0) continue;
+		sv_primitive t = (k[i] == 1.0) ? *g[i] : sv_primitive(k[i])*(*g[i]);
+		r = r.exists() ? r + t : t;
+	}
+	return(r.exists() ? r : zero);
+}
+
 void lazy_grad(const sv_primitive& p, sv_primitive& x, sv_primitive& y, sv_primitive& z)
 {
 	sv_primitive x1, y1, z1, x2, y2, z2, pm;
@@ -213,15 +235,36 @@ void lazy_grad(const sv_primitive& p, sv_primitive& x, sv_primitive& y, sv_primi
 			z = zero;
 			return;	
 
+// The child's grad, evaluated at the mapped point, goes back through
+// the transpose of the map
+
+		case SV_XFORM:
+		{
+			sv_xform m = p.xform();
+			if(x1.kind() != SV_REAL) x1 = sv_primitive(x1, m);
+			if(y1.kind() != SV_REAL) y1 = sv_primitive(y1, m);
+			if(z1.kind() != SV_REAL) z1 = sv_primitive(z1, m);
+			x = grad_sum(m.r0.x, x1, m.r1.x, y1, m.r2.x, z1);
+			y = grad_sum(m.r0.y, x1, m.r1.y, y1, m.r2.y, z1);
+			z = grad_sum(m.r0.z, x1, m.r1.z, y1, m.r2.z, z1);
+			return;
+		}
+
 		default:
 			svlis_error("lazy_grad", "dud operator", SV_CORRUPT);
 		}
 
 	default:
-		if (k <= S_U_PRIM)
-				;
-			else
-				;
+
+// Registered user shapes have kinds for their grad components
+
+		if ((k >= SV_U_REG) && !((k - SV_U_REG)%4) && user_prim(k))
+		{
+			x = sv_primitive(k + 1, 0, 0, 0);
+			y = sv_primitive(k + 2, 0, 0, 0);
+			z = sv_primitive(k + 3, 0, 0, 0);
+			return;
+		}
 		svlis_error("lazy_grad", "user primitive", SV_WARNING);
 
 	}
@@ -564,6 +607,7 @@ void write(ostream& s, const prim_op& o, sv_integer level)
 	case SV_EXP: s << 'E'; break;
 	case SV_SSQRT: s << '@'; break; // Well, any better ideas?
         case SV_SIGN: s << '%'; break;  //  "     "     "     "  ?
+	case SV_XFORM: s << 'X'; break;
 
 	default:
 		svlis_error("prim_op::operator<<","dud value",SV_CORRUPT);
@@ -607,6 +651,10 @@ void write(ostream& s, sv_primitive& p, sv_integer level)
 		case SV_CYCLIDE:
 		case SV_GENERAL:
 			write(s, p.op(), 0); s << SV_EL;
+			if (p.op() == SV_XFORM)
+			{
+				write(s, p.xform(), nxl); s << SV_EL;
+			}
 			if (diadic(p.op()))
 			{
 				p_temp = p.child_1();
@@ -800,9 +848,9 @@ sv_primitive p_torus(const sv_line& axis, sv_real rr, sv_real r)
 
 // explicitly set the gradients
 
-	*(t.prim_info->grad_x) = x;
-	*(t.prim_info->grad_y) = y;
-	*(t.prim_info->grad_z) = z;
+	t.prim_info->grad_x = x.prim_info;
+	t.prim_info->grad_y = y.prim_info;
+	t.prim_info->grad_z = z.prim_info;
 
         return(t);
 }
@@ -810,6 +858,296 @@ sv_primitive p_torus(const sv_line& axis, sv_real rr, sv_real r)
 
 
 
+// Closed forms for the special shapes (see sv_shape_data in prim.h)
+
+// How far the planes' normals can be from orthogonal and of equal length
+
+#define SHAPE_TOL 1.0e-4
+
+// Walk down a primitive's tree; path is a string of 1s and 2s.  Returns
+// a null primitive if the tree isn't that shape.
+
+static sv_primitive shape_walk(const sv_primitive& p, const char* path)
+{
+	sv_primitive q = p;
+	sv_primitive nul;
+	for(; *path; path++)
+	{
+		if(!q.exists()) return(nul);
+		if( (q.kind() == SV_REAL) || (q.op() == SV_ZERO) ) return(nul);
+		if(*path == '1')
+			q = q.child_1();
+		else
+		{
+			if(!diadic(q.op())) return(nul);
+			q = q.child_2();
+		}
+	}
+	return(q);
+}
+
+static int shape_plane(const sv_primitive& p, const char* path, sv_plane* f)
+{
+	sv_primitive q = shape_walk(p, path);
+	if(!q.exists()) return(0);
+	if( (q.kind() != SV_PLANE) || (q.op() != SV_ZERO) ) return(0);
+	*f = q.plane();
+	return(1);
+}
+
+static int shape_real(const sv_primitive& p, const char* path, sv_real* r)
+{
+	sv_primitive q = shape_walk(p, path);
+	if(!q.exists()) return(0);
+	if(q.kind() != SV_REAL) return(0);
+	*r = q.real();
+	return(1);
+}
+
+// Are the normals of n planes orthogonal and of equal length?
+
+static int shape_frame(const sv_plane* f, sv_integer n, sv_real* k2)
+{
+	*k2 = f[0].normal*f[0].normal;
+	if(*k2 <= 0) return(0);
+	for(sv_integer i = 0; i < n; i++)
+	{
+		if(fabs(f[i].normal*f[i].normal - *k2) > SHAPE_TOL*(*k2)) return(0);
+		for(sv_integer j = i + 1; j < n; j++)
+			if(fabs(f[i].normal*f[j].normal) > SHAPE_TOL*(*k2)) return(0);
+	}
+	return(1);
+}
+
+// The point on n planes of that frame closest to the origin
+
+static sv_point shape_centre(const sv_plane* f, sv_integer n, sv_real k2)
+{
+	sv_point c = SV_OO;
+	for(sv_integer i = 0; i < n; i++)
+		c = c - f[i].normal*(f[i].d/k2);
+	return(c);
+}
+
+// The value from the closed form
+
+static sv_real shape_value(sv_integer k, const sv_shape_data* s, const sv_point& q)
+{
+	sv_point d = q - s->c;
+	sv_real d2 = d*d;
+	sv_real h, r;
+
+	switch(k)
+	{
+	case SV_SPHERE:
+		return(s->k2*d2 - s->a);
+
+	case SV_CYLINDER:
+		h = d*s->ax;
+		return(s->k2*(d2 - h*h) - s->a);
+
+	case SV_CONE:
+		h = d*s->ax;
+		return(s->k2*(d2 - (1 + s->a)*h*h));
+
+	default:
+		h = d*s->ax;
+		r = d2 - h*h;
+		r = (r > 0) ? sqrt(r) : 0;
+		r = s->k*r - s->a;
+		return(s->k2*h*h + r*r - s->b);
+	}
+}
+
+// The exact range of the square of an interval
+
+static sv_interval shape_sq(const sv_interval& i)
+{
+	sv_real l = i.lo()*i.lo();
+	sv_real h = i.hi()*i.hi();
+	if( (i.lo() <= 0) && (i.hi() >= 0) ) return(sv_interval(0, max(l, h)));
+	return(sv_interval(min(l, h), max(l, h)));
+}
+
+// The exact range of the squared distance from the axis over a box.
+// The function is convex, so its maximum is at a corner and, if the
+// axis misses the box, its minimum is on an edge.
+
+static sv_real shape_rho2(const sv_shape_data* s, const sv_point& q)
+{
+	sv_point d = q - s->c;
+	sv_real h = d*s->ax;
+	return(d*d - h*h);
+}
+
+static sv_interval shape_rho2(const sv_shape_data* s, const sv_box& b)
+{
+	switch(s->along)
+	{
+	case 0: return(shape_sq(b.yi - s->c.y) + shape_sq(b.zi - s->c.z));
+	case 1: return(shape_sq(b.xi - s->c.x) + shape_sq(b.zi - s->c.z));
+	case 2: return(shape_sq(b.xi - s->c.x) + shape_sq(b.yi - s->c.y));
+	default: break;
+	}
+
+	sv_real lo, hi, r, a, bb, v;
+	sv_point e, w, p;
+	sv_integer i, j;
+	sv_point corner[8];
+
+	for(i = 0; i < 8; i++)
+		corner[i] = sv_point( (i & 1) ? b.xi.hi() : b.xi.lo(),
+			(i & 2) ? b.yi.hi() : b.yi.lo(),
+			(i & 4) ? b.zi.hi() : b.zi.lo() );
+	hi = 0;
+	for(i = 0; i < 8; i++)
+	{
+		r = shape_rho2(s, corner[i]);
+		if(r > hi) hi = r;
+	}
+
+	if(!line_box(sv_line(s->ax, s->c), b).empty()) return(sv_interval(0, hi));
+
+// The twelve edges join corners that differ in one bit
+
+	lo = hi;
+	for(i = 0; i < 8; i++)
+	  for(j = 1; j < 8; j = j << 1)
+	  {
+		if(i & j) continue;
+		w = corner[i] - s->c;
+		e = corner[i | j] - corner[i];
+		a = e*e - (e*s->ax)*(e*s->ax);
+		bb = w*e - (w*s->ax)*(e*s->ax);
+		v = 0;
+		if(a > 0) v = -bb/a;
+		if(v < 0) v = 0;
+		if(v > 1) v = 1;
+		p = corner[i] + e*v;
+		r = shape_rho2(s, p);
+		if(r < lo) lo = r;
+	  }
+	return(sv_interval(max(lo, (sv_real)0), hi));
+}
+
+// The range from the closed form; exact for spheres and cylinders, 
+// and for cones and tori with only the link between the distances
+// along and from the axis lost
+
+static sv_interval shape_range(sv_integer k, const sv_shape_data* s, const sv_box& b)
+{
+	sv_interval r2, h;
+
+	switch(k)
+	{
+	case SV_SPHERE:
+		r2 = shape_sq(b.xi - s->c.x) + shape_sq(b.yi - s->c.y) + 
+			shape_sq(b.zi - s->c.z);
+		return(s->k2*r2 - s->a);
+
+	case SV_CYLINDER:
+		return(s->k2*shape_rho2(s, b) - s->a);
+
+	default:
+		break;
+	}
+
+	r2 = shape_rho2(s, b);
+	h = s->ax.x*(b.xi - s->c.x) + s->ax.y*(b.yi - s->c.y) + 
+		s->ax.z*(b.zi - s->c.z);
+
+	if(k == SV_CONE)
+		return(s->k2*(r2 - s->a*shape_sq(h)));
+
+	r2 = sv_interval(sqrt(r2.lo()), sqrt(r2.hi()));
+	return(s->k2*shape_sq(h) + shape_sq(s->k*r2 - s->a) - s->b);
+}
+
+// Find the closed form for a special shape from its planes.  The
+// result is checked against the tree at some points round it, and
+// dropped if they don't agree.
+
+void sv_primitive::fit_shape()
+{
+	delete prim_info->shape;
+	prim_info->shape = 0;
+
+	sv_integer k = kind();
+	sv_plane f[3];
+	sv_real k2, r, t;
+	sv_shape_data s;
+
+	switch(k)
+	{
+	case SV_SPHERE:
+		if(!shape_plane(*this, "1111", &f[0]) || !shape_plane(*this, "1121", &f[1]) ||
+		   !shape_plane(*this, "121", &f[2]) || !shape_real(*this, "2", &r)) return;
+		if(!shape_frame(f, 3, &k2)) return;
+		s.c = shape_centre(f, 3, k2);
+		s.ax = SV_Z;
+		s.a = r;
+		s.b = 0;
+		break;
+
+	case SV_CYLINDER:
+		if(!shape_plane(*this, "111", &f[0]) || !shape_plane(*this, "121", &f[1]) ||
+		   !shape_real(*this, "2", &r)) return;
+		if(!shape_frame(f, 2, &k2)) return;
+		s.c = shape_centre(f, 2, k2);
+		s.ax = (f[0].normal^f[1].normal).norm();
+		s.a = r;
+		s.b = 0;
+		break;
+
+	case SV_CONE:
+		if(!shape_plane(*this, "111", &f[0]) || !shape_plane(*this, "121", &f[1]) ||
+		   !shape_plane(*this, "211", &f[2]) || !shape_real(*this, "212", &t)) return;
+		if(!shape_frame(f, 3, &k2)) return;
+		s.c = shape_centre(f, 3, k2);
+		s.ax = f[2].normal.norm();
+		s.a = t*t;
+		s.b = 0;
+		break;
+
+	case SV_TORUS:
+		if(!shape_plane(*this, "1211121", &f[0]) || !shape_plane(*this, "1211111", &f[1]) ||
+		   !shape_plane(*this, "111", &f[2]) || !shape_real(*this, "1212", &t) ||
+		   !shape_real(*this, "2", &r)) return;
+		if(!shape_frame(f, 3, &k2)) return;
+		s.c = shape_centre(f, 3, k2);
+		s.ax = f[2].normal.norm();
+		s.a = t;
+		s.b = r;
+		break;
+
+	default:
+		return;
+	}
+
+	s.k2 = k2;
+	s.k = sqrt(k2);
+	s.along = -1;
+	if( (fabs(s.ax.y) < SHAPE_TOL) && (fabs(s.ax.z) < SHAPE_TOL) ) s.along = 0;
+	if( (fabs(s.ax.x) < SHAPE_TOL) && (fabs(s.ax.z) < SHAPE_TOL) ) s.along = 1;
+	if( (fabs(s.ax.x) < SHAPE_TOL) && (fabs(s.ax.y) < SHAPE_TOL) ) s.along = 2;
+	if(s.along >= 0) s.ax = sv_point(s.along == 0, s.along == 1, s.along == 2);
+
+// Check the closed form against the tree
+
+	sv_point u = right(s.ax);
+	sv_point q;
+	sv_real v, w, scale = fabs(s.a) + fabs(s.b) + k2;
+	for(sv_integer i = 0; i < 4; i++)
+	{
+		q = s.c + s.ax*(0.7*i - 1.1) + u*(0.9*i + 0.3) + (u^s.ax)*(0.5 - 0.4*i);
+		v = value(q);
+		w = shape_value(k, &s, q);
+		if(fabs(v - w) > SHAPE_TOL*(scale + fabs(v))) return;
+	}
+
+	prim_info->shape = new sv_shape_data(s);
+}
+
 // Return the parameters of a primitive
 //
 // 		k is the kind; if this is SV_GENERAL no other information is returned
@@ -1147,6 +1485,8 @@ prim_op same(const sv_primitive& aa, const sv_primitive& bb)
 	sv_line axis_a, axis_b;
 	prim_op param_a, param_b, result, r2, op_a, op_b;
 	int flip = 0;
+
+	sv_stat(SV_ST_SAME);
 	
 	if (aa == bb) return(SV_PLUS); // Well, that bit was easy...
 	
@@ -1232,6 +1572,11 @@ prim_op same(const sv_primitive& aa, const sv_primitive& bb)
 				if (r2 != result) result = SV_ZERO;			
 			} else
 			{
+
+// Transforms are only the same if they move their children the same way
+
+				if( (op_a == SV_XFORM) && (same(a.xform(), b.xform()) != SV_PLUS) )
+					return(SV_ZERO);
 				result = same(a.child_1(), b.child_1());
 			}
 		}
@@ -1471,6 +1816,10 @@ sv_primitive sv_primitive::deep() const
 			c = sign(child_1().deep());
 			break;
 
+		case SV_XFORM:
+			c = sv_primitive(child_1().deep(), xform());
+			break;
+
 		default:
 			svlis_error("sv_primitive::deep()", "dud operator", SV_CORRUPT);
 		}
@@ -1566,6 +1915,10 @@ sv_primitive operator+(const sv_primitive& a, const sv_point& q)
 			c = sign(a.child_1() + q);
 			break;
 
+		case SV_XFORM:
+			c = a.transform(xf_translate(q));
+			break;
+
 		default:
 			svlis_error("primitive + point", "dud operator", SV_CORRUPT);
 		}
@@ -1577,8 +1930,13 @@ sv_primitive operator+(const sv_primitive& a, const sv_point& q)
 
 	default:
 
+// Registered shapes go under a transform node, so the moved copies
+// share the shape
+
 		if (k < S_U_PRIM)
 			c = translate_s(k, q);
+		else if (k >= SV_U_REG)
+			c = a.transform(xf_translate(q));
 		else
 			c = translate_user(k, q);
 		break;
@@ -1669,6 +2027,10 @@ sv_primitive sv_primitive::scale(const sv_point& cen, sv_real s) const
 			c = sign(child_1().scale(cen, s));
 			break;
 
+		case SV_XFORM:
+			c = transform(xf_scale(cen, s));
+			break;
+
 		default:
 			svlis_error("sv_primitive::scale()", "dud operator", SV_CORRUPT);
 		}
@@ -1682,6 +2044,8 @@ sv_primitive sv_primitive::scale(const sv_point& cen, sv_real s) const
 
 		if (k < S_U_PRIM)
 			c = scale_s(k, cen, s);
+		else if (k >= SV_U_REG)
+			c = transform(xf_scale(cen, s));
 		else
 			c = scale_user(k, cen, s);
 		break;
@@ -1782,6 +2146,10 @@ sv_primitive sv_primitive::scale(const sv_line& s_ax, sv_real s) const
 			c = sign(child_1().scale(s_ax, s));
 			break;
 
+		case SV_XFORM:
+			c = transform(xf_scale(s_ax, s));
+			break;
+
 		default:
 			svlis_error("sv_primitive::scale()", "(1D); dud operator", SV_CORRUPT);
 		}
@@ -1795,6 +2163,8 @@ sv_primitive sv_primitive::scale(const sv_line& s_ax, sv_real s) const
 
 		if (k < S_U_PRIM)
 			c = scale_s(k, s_ax, s);
+		else if (k >= SV_U_REG)
+			c = transform(xf_scale(s_ax, s));
 		else
 			c = scale_user(k, s_ax, s);
 		break;
@@ -1877,6 +2247,10 @@ sv_primitive sv_primitive::spin(const sv_line& l, sv_real angle) const
 			c = sign(child_1().spin(l, angle));
 			break;
 
+		case SV_XFORM:
+			c = transform(xf_spin(l, angle));
+			break;
+
 		default:
 			svlis_error("sv_primitive::spin()", "dud operator", SV_CORRUPT);
 		}
@@ -1889,6 +2263,8 @@ sv_primitive sv_primitive::spin(const sv_line& l, sv_real angle) const
 	default:
 		if (k < S_U_PRIM)
 			c = spin_s(k, l, angle);
+		else if (k >= SV_U_REG)
+			c = transform(xf_spin(l, angle));
 		else
 			c = spin_user(k, l, angle);
 		break;
@@ -1970,6 +2346,10 @@ sv_primitive sv_primitive::mirror(const sv_plane& m) const
 			c = sign(child_1().mirror(m));
 			break;
 
+		case SV_XFORM:
+			c = transform(xf_mirror(m));
+			break;
+
 		default:
 		    svlis_error("primitive::mirror()", "dud operator", SV_CORRUPT);
 		}
@@ -1982,6 +2362,8 @@ sv_primitive sv_primitive::mirror(const sv_plane& m) const
 	default:
 		if (k < S_U_PRIM)
 			c = mirror_s(k, m);
+		else if (k >= SV_U_REG)
+			c = transform(xf_mirror(m));
 		else
 			c = mirror_user(k, m);
 
@@ -1990,6 +2372,129 @@ sv_primitive sv_primitive::mirror(const sv_plane& m) const
 	return(c);
 }
 
+// A plane taken back through a map (0 for none)
+
+static sv_primitive plane_back(const sv_primitive& p, const sv_xform* m)
+{
+	if(!m) return(p);
+	sv_plane f = p.plane();
+	sv_point n = m->transpose(f.normal);
+	sv_real l = n.mod();
+	sv_primitive c = sv_primitive(sv_plane(n, f.normal*m->t + f.d));
+	if(fabs(l - 1) > sv_same_tol)
+		c = c*sv_primitive(l);	// Keep the potential function
+	return(c);
+}
+
+// Lazy transform.  Reals are unaffected and planes are cheap to do
+// at once; anything else gets a node holding the map back.
+
+sv_primitive sv_primitive::transform(const sv_xform& m) const
+{
+	switch(kind())
+	{
+	case SV_REAL:
+		return(*this);
+
+	case SV_PLANE:
+	{
+		sv_xform b = m.inverse();
+		return(plane_back(*this, &b));
+	}
+
+	default:
+		break;
+	}
+
+	sv_xform b = m.inverse();
+	if(op() != SV_XFORM) return(sv_primitive(*this, b));
+	b = xform()*b;
+	if(b.identity()) return(child_1());
+	return(sv_primitive(child_1(), b));
+}
+
+// Push the maps in a primitive down to its planes; m is the map
+// applied to points before they get to p.  Anything untouched is
+// shared with the original.
+
+sv_primitive sv_primitive::bake_back(const sv_primitive& p, const sv_xform* m)
+{
+	sv_primitive c, c1, c2;
+	sv_integer k = p.kind();
+	prim_op o;
+
+	switch(k)
+	{
+	case SV_REAL:
+		return(p);
+
+	case SV_PLANE:
+		return(plane_back(p, m));
+
+	case SV_CYLINDER:
+	case SV_SPHERE:
+	case SV_CONE:
+	case SV_TORUS:
+	case SV_CYCLIDE:
+	case SV_GENERAL:
+		o = p.op();
+		if(o == SV_XFORM)
+		{
+			sv_xform b = p.xform();
+			if(m) b = b*(*m);
+			return(bake_back(p.child_1(), &b));
+		}
+		c1 = bake_back(p.child_1(), m);
+		if(diadic(o))
+		{
+			c2 = bake_back(p.child_2(), m);
+			if(!m && (c1 == p.child_1()) && (c2 == p.child_2())) return(p);
+			switch(o)
+			{
+			case SV_PLUS: c = c1 + c2; break;
+			case SV_MINUS: c = c1 - c2; break;
+			case SV_TIMES: c = c1*c2; break;
+			case SV_DIVIDE: c = c1/c2; break;
+			default: c = c1^c2; break;
+			}
+		} else
+		{
+			if(!m && (c1 == p.child_1())) return(p);
+			switch(o)
+			{
+			case SV_COMP: c = -c1; break;
+			case SV_ABS: c = abs(c1); break;
+			case SV_SIN: c = sin(c1); break;
+			case SV_COS: c = cos(c1); break;
+			case SV_EXP: c = exp(c1); break;
+			case SV_SSQRT: c = s_sqrt(c1); break;
+			case SV_SIGN: c = sign(c1); break;
+			default:
+				svlis_error("sv_primitive::bake()", "dud operator", SV_CORRUPT);
+				return(p);
+			}
+		}
+
+// Special shapes survive rigid motions and uniform scales
+
+		if(!m || m->similar())
+			c.set_kind(k);
+		return(c);
+
+	default:
+
+// Blocks, hard-coded and user primitives stay lazy
+
+		if(!m) return(p);
+		return(sv_primitive(p, *m));
+	}
+}
+
+sv_primitive sv_primitive::bake() const
+{
+	return(bake_back(*this, 0));
+}
+
 // Value of a primitive for a point
 
 sv_real sv_primitive::value(const sv_point& q) const
@@ -1997,7 +2502,10 @@ sv_real sv_primitive::value(const sv_point& q) const
 	sv_real c;
 	sv_integer k;
 
-	switch(k = kind())
+	k = kind();
+	sv_stat_value(k);
+
+	switch(k)
 	{
 	case SV_REAL:
 		c = real();
@@ -2014,6 +2522,12 @@ sv_real sv_primitive::value(const sv_point& q) const
 	case SV_SPHERE:
 	case SV_CONE:
 	case SV_TORUS:
+		if(prim_info->shape)
+		{
+			c = shape_value(k, prim_info->shape, q);
+			break;
+		}
+		// Falls through - shapes without parameters are done as general ones
 	case SV_CYCLIDE:
 	case SV_GENERAL:
 		switch(op())
@@ -2066,6 +2580,10 @@ sv_real sv_primitive::value(const sv_point& q) const
 			c = sign(child_1().value(q));
 			break;
 
+		case SV_XFORM:
+			c = child_1().value(prim_info->xform->map(q));
+			break;
+
 		default:
 			svlis_error("sv_primitive::value(point)", "dud operator", SV_CORRUPT);
 		}
@@ -2074,6 +2592,8 @@ sv_real sv_primitive::value(const sv_point& q) const
 	default:
 		if (k < S_U_PRIM)
 			c = value_s(k, q);
+		else if (prim_info->user)
+			c = prim_info->user->value(prim_info->user->shape, q);
 		else
 			c = value_user(k, q);
 		break;
@@ -2090,7 +2610,10 @@ sv_interval sv_primitive::range(const sv_box& b) const
 	sv_integer k;
 	int c_1, c_2;			// Logical - T if child is a real
 
-	switch(k = kind())
+	k = kind();
+	sv_stat_range(k);
+
+	switch(k)
 	{
 	case SV_REAL:
 		svlis_error("sv_primitive::range(box)","primitive is a single constant",
@@ -2116,6 +2639,12 @@ sv_interval sv_primitive::range(const sv_box& b) const
 	case SV_SPHERE:
 	case SV_CONE:
 	case SV_TORUS:
+		if(prim_info->shape)
+		{
+			c = shape_range(k, prim_info->shape, b);
+			break;
+		}
+		// Falls through - shapes without parameters are done as general ones
 	case SV_CYCLIDE:
 	case SV_GENERAL:
 		if (diadic(op()))
@@ -2254,6 +2783,10 @@ sv_interval sv_primitive::range(const sv_box& b) const
 			c = sign(child_1().range(b));
 			break;
 
+		case SV_XFORM:
+			c = child_1().range(prim_info->xform->map(b));
+			break;
+
 		default:
 			svlis_error("sv_primitive::range(box)", "dud operator", SV_CORRUPT);
 		}
@@ -2262,6 +2795,8 @@ sv_interval sv_primitive::range(const sv_box& b) const
 	default:
 		if (k < S_U_PRIM)
 			c = range_s(k, b);
+		else if (prim_info->user)
+			c = prim_info->user->range(prim_info->user->shape, b);
 		else
 			c = range_user(k, b);
 		break;
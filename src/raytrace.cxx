@@ -220,10 +220,144 @@ enum ray_direction {
 static ray_direction ray_x_dir;
 static ray_direction ray_y_dir;
 static ray_direction ray_z_dir;
+
+// Set the ray direction flags
+
+static void
+set_ray_directions(const sv_line& ray)
+{
+   if(ray.direction.x < 0.0)
+      ray_x_dir = Negative;
+   else if(ray.direction.x > 0.0)
+      ray_x_dir = Positive;
+   else
+      ray_x_dir = Zero;
+
+   if(ray.direction.y < 0.0)
+      ray_y_dir = Negative;
+   else if(ray.direction.y > 0.0)
+      ray_y_dir = Positive;
+   else
+      ray_y_dir = Zero;
+
+   if(ray.direction.z < 0.0)
+      ray_z_dir = Negative;
+   else if(ray.direction.z > 0.0)
+      ray_z_dir = Positive;
+   else
+      ray_z_dir = Zero;
+}
 #endif
 
 
 
+//
+// Work out the pieces of a ray that lie in the two children of a
+// divided model node
+//
+
+static void
+ray_child_intervals(const sv_model& mod,		// the divided node
+		    const sv_model& child_1_model,	// its children
+		    const sv_model& child_2_model,
+		    const sv_line& ray,			// ray to fire
+		    const sv_interval& valid_model_interval, // the limits within which the model is valid
+		    /* Returns */
+		    sv_interval* child_1_valid_int,	// the piece in each child
+		    sv_interval* child_2_valid_int)
+{
+#if USE_LINE_BOX
+   *child_1_valid_int = line_box(ray, child_1_model.box()) & valid_model_interval;
+   *child_2_valid_int = line_box(ray, child_2_model.box()) & valid_model_interval;
+
+#else
+   switch(mod.kind()) {
+    case X_DIV:
+	 switch(ray_x_dir) {
+	  case Positive:
+	    *child_1_valid_int = sv_interval(valid_model_interval.lo(),
+               min(valid_model_interval.hi(), (child_1_model.box().xi.hi() - ray.origin.x)/ray.direction.x));
+
+         *child_2_valid_int = sv_interval(max(valid_model_interval.lo(), (child_2_model.box().xi.lo() - ray.origin.x)/ray.direction.x),
+	          valid_model_interval.hi());
+	    break;
+
+	 case Negative:
+	   *child_1_valid_int = sv_interval(max(valid_model_interval.lo(), (child_1_model.box().xi.hi() - ray.origin.x)/ray.direction.x),
+	           valid_model_interval.hi());
+
+	   *child_2_valid_int = sv_interval(valid_model_interval.lo(),
+               min(valid_model_interval.hi(), (child_2_model.box().xi.lo() - ray.origin.x)/ray.direction.x));
+	    break;
+
+	  default:
+	    // ray is parallel to division plane
+	    *child_1_valid_int = line_box(ray, child_1_model.box());
+	    *child_2_valid_int = line_box(ray, child_2_model.box());
+	    break;
+	 }
+	 break;
+
+    case Y_DIV:
+	 switch(ray_y_dir) {
+	  case Positive:
+	    *child_1_valid_int = sv_interval(valid_model_interval.lo(),
+                    min(valid_model_interval.hi(), (child_1_model.box().yi.hi() - ray.origin.y)/ray.direction.y));
+
+         *child_2_valid_int = sv_interval(max(valid_model_interval.lo(), (child_2_model.box().yi.lo() - ray.origin.y)/ray.direction.y),
+	               valid_model_interval.hi());
+	    break;
+
+	 case Negative:
+	   *child_1_valid_int = sv_interval(max(valid_model_interval.lo(), (child_1_model.box().yi.hi() - ray.origin.y)/ray.direction.y),
+	              valid_model_interval.hi());
+
+	   *child_2_valid_int = sv_interval(valid_model_interval.lo(),
+                   min(valid_model_interval.hi(), (child_2_model.box().yi.lo() - ray.origin.y)/ray.direction.y));
+	    break;
+
+	  default:
+	    // ray is parallel to division plane
+	    *child_1_valid_int = line_box(ray, child_1_model.box());
+	    *child_2_valid_int = line_box(ray, child_2_model.box());
+	    break;
+	 }
+	 break;
+
+    case Z_DIV:
+	 switch(ray_z_dir) {
+	  case Positive:
+	    *child_1_valid_int = sv_interval(valid_model_interval.lo(),
+                  min(valid_model_interval.hi(), (child_1_model.box().zi.hi() - ray.origin.z)/ray.direction.z));
+
+         *child_2_valid_int = sv_interval(max(valid_model_interval.lo(), (child_2_model.box().zi.lo() - ray.origin.z)/ray.direction.z),
+	             valid_model_interval.hi());
+	    break;
+
+	 case Negative:
+	   *child_1_valid_int = sv_interval(max(valid_model_interval.lo(), (child_1_model.box().zi.hi() - ray.origin.z)/ray.direction.z),
+	            valid_model_interval.hi());
+
+	   *child_2_valid_int = sv_interval(valid_model_interval.lo(),
+                 min(valid_model_interval.hi(), (child_2_model.box().zi.lo() - ray.origin.z)/ray.direction.z));
+	    break;
+
+	  default:
+	    // ray is parallel to division plane
+	    *child_1_valid_int = line_box(ray, child_1_model.box());
+	    *child_2_valid_int = line_box(ray, child_2_model.box());
+	    break;
+	 }
+	 break;
+
+    default:
+    	svlis_error("ray_model_test", "invalid model kind", SV_CORRUPT);
+	 break;
+   }
+#endif
+}
+
+
 //
 // Fire a ray into a model and report what it hits
 // (not only used to create images)
@@ -238,6 +372,7 @@ sv_model::fire_ray(
 {
 	sv_model mod = *this;
    current_ray_number++;
+   sv_stat(SV_ST_RAY);
 
 #if DEBUG
    if((debug_ray_number >= 0) && (current_ray_number != debug_ray_number)) {
@@ -250,26 +385,7 @@ sv_model::fire_ray(
 #if ~USE_LINE_BOX
    // Set ray direction flags
 
-   if(ray.direction.x < 0.0)
-      ray_x_dir = Negative;
-   else if(ray.direction.x > 0.0)
-      ray_x_dir = Positive;
-   else
-      ray_x_dir = Zero;
-
-   if(ray.direction.y < 0.0)
-      ray_y_dir = Negative;
-   else if(ray.direction.y > 0.0)
-      ray_y_dir = Positive;
-   else
-      ray_y_dir = Zero;
-
-   if(ray.direction.z < 0.0)
-      ray_z_dir = Negative;
-   else if(ray.direction.z > 0.0)
-      ray_z_dir = Positive;
-   else
-      ray_z_dir = Zero;
+   set_ray_directions(ray);
 #endif
 
 #if DEBUG
@@ -317,6 +433,9 @@ ray_model_test(const sv_model& mod,		// model to fire ray into
 #endif
 
 
+   if(mod.kind() == INSTANCE_M)			// Placed prototype
+      return ray_instance_test(mod, ray, rootfinding_tmax, valid_model_interval, hit_ray_param);
+
    if(mod.kind() == LEAF_M) {			// At leaf node in model tree
       // We know that ray intersects this box since test was done one level up!
       return ray_leaf_node_test(mod.set_list(), ray, rootfinding_tmax, valid_model_interval, hit_ray_param);
@@ -325,98 +444,10 @@ ray_model_test(const sv_model& mod,		// model to fire ray into
       sv_model child_1_model = mod.child_1();
       sv_model child_2_model = mod.child_2();
 
-#if USE_LINE_BOX
-      sv_interval child_1_valid_int = line_box(ray, child_1_model.box()) & valid_model_interval;
-      sv_interval child_2_valid_int = line_box(ray, child_2_model.box()) & valid_model_interval;
-
-#else
       sv_interval child_1_valid_int;
       sv_interval child_2_valid_int;
-
-      switch(mod.kind()) {
-       case X_DIV:
-	 switch(ray_x_dir) {
-	  case Positive:
-	    child_1_valid_int = sv_interval(valid_model_interval.lo(),
-                  min(valid_model_interval.hi(), (child_1_model.box().xi.hi() - ray.origin.x)/ray.direction.x));
-
-            child_2_valid_int = sv_interval(max(valid_model_interval.lo(), (child_2_model.box().xi.lo() - ray.origin.x)/ray.direction.x),
-	          valid_model_interval.hi());
-	    break;
-
-	 case Negative:
-	   child_1_valid_int = sv_interval(max(valid_model_interval.lo(), (child_1_model.box().xi.hi() - ray.origin.x)/ray.direction.x),
-	           valid_model_interval.hi());
-
-	   child_2_valid_int = sv_interval(valid_model_interval.lo(),
-                  min(valid_model_interval.hi(), (child_2_model.box().xi.lo() - ray.origin.x)/ray.direction.x));
-	    break;
-
-	  default:
-	    // ray is parallel to division plane
-	    child_1_valid_int = line_box(ray, child_1_model.box());
-	    child_2_valid_int = line_box(ray, child_2_model.box());
-	    break;
-	 }
-	 break;
-
-       case Y_DIV:
-	 switch(ray_y_dir) {
-	  case Positive:
-	    child_1_valid_int = sv_interval(valid_model_interval.lo(),
-                       min(valid_model_interval.hi(), (child_1_model.box().yi.hi() - ray.origin.y)/ray.direction.y));
-
-            child_2_valid_int = sv_interval(max(valid_model_interval.lo(), (child_2_model.box().yi.lo() - ray.origin.y)/ray.direction.y),
-	               valid_model_interval.hi());
-	    break;
-
-	 case Negative:
-	   child_1_valid_int = sv_interval(max(valid_model_interval.lo(), (child_1_model.box().yi.hi() - ray.origin.y)/ray.direction.y),
-	              valid_model_interval.hi());
-
-	   child_2_valid_int = sv_interval(valid_model_interval.lo(),
-                      min(valid_model_interval.hi(), (child_2_model.box().yi.lo() - ray.origin.y)/ray.direction.y));
-	    break;
-
-	  default:
-	    // ray is parallel to division plane
-	    child_1_valid_int = line_box(ray, child_1_model.box());
-	    child_2_valid_int = line_box(ray, child_2_model.box());
-	    break;
-	 }
-	 break;
-
-       case Z_DIV:
-	 switch(ray_z_dir) {
-	  case Positive:
-	    child_1_valid_int = sv_interval(valid_model_interval.lo(),
-                     min(valid_model_interval.hi(), (child_1_model.box().zi.hi() - ray.origin.z)/ray.direction.z));
-
-            child_2_valid_int = sv_interval(max(valid_model_interval.lo(), (child_2_model.box().zi.lo() - ray.origin.z)/ray.direction.z),
-	             valid_model_interval.hi());
-	    break;
-
-	 case Negative:
-	   child_1_valid_int = sv_interval(max(valid_model_interval.lo(), (child_1_model.box().zi.hi() - ray.origin.z)/ray.direction.z),
-	            valid_model_interval.hi());
-
-	   child_2_valid_int = sv_interval(valid_model_interval.lo(),
-                    min(valid_model_interval.hi(), (child_2_model.box().zi.lo() - ray.origin.z)/ray.direction.z));
-	    break;
-
-	  default:
-	    // ray is parallel to division plane
-	    child_1_valid_int = line_box(ray, child_1_model.box());
-	    child_2_valid_int = line_box(ray, child_2_model.box());
-	    break;
-	 }
-	 break;
-
-       default:
-       	svlis_error("ray_model_test", "invalid model kind", SV_CORRUPT);
-	 break;
-      }
-#endif
+      ray_child_intervals(mod, child_1_model, child_2_model, ray, valid_model_interval,
+	 &child_1_valid_int, &child_2_valid_int);
 
       if(child_1_valid_int.empty() && child_2_valid_int.empty())
 	 return hit_surface;	// empty set!
@@ -447,34 +478,127 @@ ray_model_test(const sv_model& mod,		// model to fire ray into
 
 
 //
-// Generate intersections between ray and primitive (within given ray interval)
+// The ray in an instance's prototype.  It starts where the world ray
+// (mapped into the prototype) meets the prototype's box, at t0 along
+// the world ray, and it has a unit direction, so if the placement
+// scales by s then t along it is (t - t0)*s for t along the world ray.
+// Returns 0 if the ray misses the prototype's box.
 //
 
-sv_set							// return set that was hit by ray
-ray_leaf_node_test(const sv_set_list &sets,		// set_list to test ray against
-		   const sv_line& ray,			// ray to test
-		   const sv_real& rootfinding_tmax,	// the max t value to find roots for
-		   const sv_interval& valid_model_interval,// the limits within which the model is valid
-		   /* Returns */
-		   sv_real*	hit_ray_param)		// parametric value at intersection
+struct instance_ray
 {
-   sv_set slo,shi,result;
-   sv_interval i;
+   sv_line ray;			// The ray in the prototype
+   sv_real t0;			// Where it starts on the world ray
+   sv_real s;			// Prototype t per world t
+   sv_interval valid;		// The prototype's part of it (prototype t)
+   sv_real tmax;		// Root-finding limit (prototype t)
 
-   // Find all roots (within the ray parameter interval) for THE FIRST SET in this leaf node
+   sv_real world_t(sv_real t) const { return(t0 + t/s); }
+};
 
-   sorted_interval_list solid_int_list;
+static int
+instance_rebase(const sv_model& mod,		// the instance
+	       const sv_line& ray,			// world ray
+	       const sv_real& rootfinding_tmax,	// world root-finding limit
+	       const sv_interval& valid_model_interval, // world limits
+	       instance_ray* ir)
+{
+   sv_line proto_ray = mod.unplace().map(ray);
+   sv_interval proto_int = line_box(proto_ray, mod.child_1().box()) & valid_model_interval;
+   if(proto_int.empty()) return 0;
+
+   ir->s = proto_ray.direction.mod();
+   ir->t0 = proto_int.lo();
+   ir->ray.origin = line_point(proto_ray, ir->t0);
+   ir->ray.direction = proto_ray.direction/ir->s;
+   ir->valid = sv_interval(0, (proto_int.hi() - ir->t0)*ir->s);
+   ir->tmax = (rootfinding_tmax - ir->t0)*ir->s;
+   return 1;
+}
 
-   sv_set_list tmp_sets = sets;
+//
+// Fire a ray into an instance: the ray is re-based in the prototype
+// (see instance_rebase()) and traced there, then the rest of the model
+// is traced up to any hit found.  A hit in the prototype is mapped back
+// out to the world.
+//
 
-// Added by AB - assume set lists are unioned.
+sv_set						// return set that was hit by ray
+ray_instance_test(const sv_model& mod,		// instance to fire ray into
+	       const sv_line& ray,			// ray to fire
+	       const sv_real& rootfinding_tmax,	// the max t value to find roots for
+	       const sv_interval& valid_model_interval, // the limits within which the model is valid
+	       // Returns
+	       sv_real*	hit_ray_param)		// parametric value at intersection
+{
+   sv_set hit_surface, rest_surface;
+   sv_real rest_param;
+   sv_model rest = mod.child_2();
+   instance_ray ir;
+   sv_interval rest_int = line_box(ray, rest.box()) & valid_model_interval;
 
-   while(tmp_sets.exists()) {
-   solid_int_list = solid_int_list | ray_set_intersection_test(tmp_sets.set(), ray, 
-	valid_model_interval.lo(), rootfinding_tmax);
-      tmp_sets = tmp_sets.next();
+#if ~USE_LINE_BOX
+   // The direction flags are set here, as frozen models don't set them
+
+   ray_direction xd = ray_x_dir;
+   ray_direction yd = ray_y_dir;
+   ray_direction zd = ray_z_dir;
+#endif
+
+   // The ray starts where it meets the prototype's box, as root
+   // finding far from the origin loses accuracy
+
+   if(instance_rebase(mod, ray, rootfinding_tmax, valid_model_interval, &ir)) {
+#if ~USE_LINE_BOX
+      set_ray_directions(ir.ray);
+#endif
+      current_ray_number++;		// It's a different ray as far as caches go
+      hit_surface = ray_model_test(mod.child_1(), ir.ray, ir.tmax, ir.valid, hit_ray_param);
+      if(hit_surface.exists())
+	 *hit_ray_param = ir.world_t(*hit_ray_param);
+      current_ray_number++;
    }
 
+   if(hit_surface.exists())
+      rest_int = rest_int & sv_interval(rest_int.lo(), *hit_ray_param);
+
+   if(!rest_int.empty()) {
+#if ~USE_LINE_BOX
+      set_ray_directions(ray);
+#endif
+      rest_surface = ray_model_test(rest, ray, rootfinding_tmax, rest_int, &rest_param);
+   }
+
+#if ~USE_LINE_BOX
+   ray_x_dir = xd;
+   ray_y_dir = yd;
+   ray_z_dir = zd;
+#endif
+
+   if(rest_surface.exists()) {
+      *hit_ray_param = rest_param;
+      return rest_surface;
+   }
+
+   if(hit_surface.exists())
+      return mod.placed(hit_surface);
+   return hit_surface;
+}
+
+
+
+//
+// Pick the first hit out of the solid intervals found in a leaf node
+//
+
+static sv_set
+leaf_first_hit(sorted_interval_list& solid_int_list,	// union of solid along the ray
+	       const sv_interval& valid_model_interval,// the limits within which the model is valid
+	       /* Returns */
+	       sv_real*	hit_ray_param)		// parametric value at intersection
+{
+   sv_set slo,shi,result;
+   sv_interval i;
 
 // Added by AB - are we starting in solid?
 
@@ -520,6 +644,394 @@ ray_leaf_node_test(const sv_set_list &sets,		// set_list to test ray against
 }
 
 
+//
+// Lazy classification for leaf tests.  Only the first entry into the
+// solid along the ray is wanted (unless the ray starts in solid), so
+// the sets' trees are walked front-to-back and each piece is only
+// classified over the part of the ray that can still matter.  The
+// lists that come back are right within their [tmin, tmax]; beyond
+// that roots have not been looked for.
+//
+
+// Where does a list first enter solid after tmin?  Returns 0 if it
+// starts in solid, or doesn't enter it before tmax.
+
+static int
+sil_first_entry(sorted_interval_list& sil,
+		const sv_real& tmin,
+		const sv_real& tmax,
+		/* Returns */
+		sv_real* t)
+{
+   interval_list_entry* ile = sil.entry();
+
+   while(ile && (ile->intrval.hi() < tmin))
+      ile = ile->next;
+   if(!ile) return 0;
+   if(ile->intrval.lo() <= tmin) return 0;
+   if(ile->intrval.lo() > tmax) return 0;
+   *t = ile->intrval.lo();
+   return 1;
+}
+
+// Is tmin inside a list's solid (the test in leaf_first_hit())?
+
+static int
+sil_in_solid(sorted_interval_list& sil, const sv_real& tmin)
+{
+   interval_list_entry* ile = sil.entry();
+
+   while(ile) {
+      if(ile->intrval.member(tmin) == SV_SOLID)
+	 return 1;
+      ile = ile->next;
+   }
+   return 0;
+}
+
+// The span [lo, hi] of a list's solid within [tmin, tmax]; returns 0
+// if there isn't any
+
+static int
+sil_span(sorted_interval_list& sil,
+	 const sv_real& tmin,
+	 const sv_real& tmax,
+	 /* Returns */
+	 sv_real* lo,
+	 sv_real* hi)
+{
+   interval_list_entry* ile = sil.entry();
+   int found = 0;
+
+   while(ile) {
+      if( (ile->intrval.hi() >= tmin) && (ile->intrval.lo() <= tmax) ) {
+	 if(!found) *lo = max(tmin, ile->intrval.lo());
+	 *hi = min(tmax, ile->intrval.hi());
+	 found = 1;
+      }
+      ile = ile->next;
+   }
+   return found;
+}
+
+// Classify a set along the ray between tmin and tmax.  The second
+// child of an intersection is only classified where the first is
+// solid, and is not classified at all if the first is air.  If first
+// is set only the first entry (or, starting in solid, the whole list)
+// is wanted, so the second child of a union is only classified up to
+// where the first enters solid.  If it turns out the ray starts in
+// solid the union is redone in full, as the exit point is wanted then.
+
+static sorted_interval_list
+ray_set_lazy_test(const sv_set& set_to_test,
+		  const sv_line& ray,
+		  const sv_real& rootfinding_tmin,
+		  const sv_real& rootfinding_tmax,
+		  int first)
+{
+   // The lists are built by initialisation, not assignment, as
+   // assigning copies them (twice)
+
+   sv_integer c = set_to_test.contents();
+   sv_real lo, hi, t;
+
+   if( (c != SV_EVERYTHING) && (c != SV_NOTHING) && (c != 1) && !set_to_test.cv_pol() ) {
+      switch(set_to_test.op()) {
+       case SV_INTERSECTION: {
+	 sorted_interval_list a(ray_set_lazy_test(set_to_test.child_1(), ray, 
+		rootfinding_tmin, rootfinding_tmax, 0));
+	 if(!sil_span(a, rootfinding_tmin, rootfinding_tmax, &lo, &hi))
+	    return sorted_interval_list();
+	 return a & ray_set_lazy_test(set_to_test.child_2(), ray, lo, hi, 0);
+       }
+
+       case SV_UNION: {
+	 sorted_interval_list a(ray_set_lazy_test(set_to_test.child_1(), ray, 
+		rootfinding_tmin, rootfinding_tmax, first));
+	 if(!first || !sil_first_entry(a, rootfinding_tmin, rootfinding_tmax, &t))
+	    return a | ray_set_lazy_test(set_to_test.child_2(), ray, rootfinding_tmin, 
+		rootfinding_tmax, first);
+	 sorted_interval_list b(ray_set_lazy_test(set_to_test.child_2(), ray, 
+		rootfinding_tmin, t, 1));
+	 if(sil_in_solid(b, rootfinding_tmin))
+	    return ray_set_lazy_test(set_to_test, ray, rootfinding_tmin, rootfinding_tmax, 0);
+	 return a | b;
+       }
+
+       default:
+	 break;
+      }
+   }
+
+   return ray_set_intersection_test(set_to_test, ray, rootfinding_tmin, rootfinding_tmax);
+}
+
+// Add one of a leaf's sets to the union of those so far; if first is
+// set, tmax is brought down to the union's first entry.  Returns 1 if
+// it was.
+
+static int
+ray_set_lazy_add(sorted_interval_list& solid_int_list,
+		 const sv_set& s,
+		 const sv_line& ray,
+		 const sv_real& rootfinding_tmin,
+		 sv_real* rootfinding_tmax,
+		 int first)
+{
+   sv_real t;
+
+   solid_int_list = solid_int_list | ray_set_lazy_test(s, ray, rootfinding_tmin, 
+	*rootfinding_tmax, first);
+   if(!first || !sil_first_entry(solid_int_list, rootfinding_tmin, *rootfinding_tmax, &t))
+      return 0;
+   *rootfinding_tmax = t;
+   return 1;
+}
+
+// The same for all the sets in a leaf, which are unioned into
+// solid_int_list (which should start empty)
+
+static void
+ray_sets_lazy_test(const sv_set_list* list,		// the sets as a list ...
+		   const sv_set* sets,			// ... or an array
+		   sv_integer set_count,
+		   const sv_line& ray,
+		   const sv_real& rootfinding_tmin,
+		   const sv_real& rootfinding_tmax,
+		   int first,
+		   /* Returns */
+		   sorted_interval_list& solid_int_list)
+{
+   sv_real tmax = rootfinding_tmax;
+   int cut = 0;
+
+   if(list) {
+      sv_set_list tmp_sets = *list;
+      while(tmp_sets.exists()) {
+	 cut |= ray_set_lazy_add(solid_int_list, tmp_sets.set(), ray, rootfinding_tmin, 
+		&tmax, first);
+	 tmp_sets = tmp_sets.next();
+      }
+   } else {
+      for(sv_integer k = 0; k < set_count; k++)
+	 cut |= ray_set_lazy_add(solid_int_list, sets[k], ray, rootfinding_tmin, 
+		&tmax, first);
+   }
+
+   if(cut && sil_in_solid(solid_int_list, rootfinding_tmin)) {
+      solid_int_list = sorted_interval_list();
+      ray_sets_lazy_test(list, sets, set_count, ray, rootfinding_tmin, 
+	rootfinding_tmax, 0, solid_int_list);
+   }
+}
+
+
+//
+// Generate intersections between ray and primitive (within given ray interval)
+//
+
+sv_set							// return set that was hit by ray
+ray_leaf_node_test(const sv_set_list &sets,		// set_list to test ray against
+		   const sv_line& ray,			// ray to test
+		   const sv_real& rootfinding_tmax,	// the max t value to find roots for
+		   const sv_interval& valid_model_interval,// the limits within which the model is valid
+		   /* Returns */
+		   sv_real*	hit_ray_param)		// parametric value at intersection
+{
+   // Find all roots (within the ray parameter interval) for THE FIRST SET in this leaf node
+
+// Added by AB - assume set lists are unioned.
+
+   sorted_interval_list solid_int_list;
+   ray_sets_lazy_test(&sets, 0, 0, ray, valid_model_interval.lo(), 
+	rootfinding_tmax, 1, solid_int_list);
+
+   return leaf_first_hit(solid_int_list, valid_model_interval, hit_ray_param);
+}
+
+// The same for a leaf whose sets are held in an array (see frozen.cxx)
+
+sv_set
+ray_leaf_node_test(const sv_set* sets,			// sets to test ray against
+		   sv_integer set_count,		// how many
+		   const sv_line& ray,			// ray to test
+		   const sv_real& rootfinding_tmax,	// the max t value to find roots for
+		   const sv_interval& valid_model_interval,// the limits within which the model is valid
+		   /* Returns */
+		   sv_real*	hit_ray_param)		// parametric value at intersection
+{
+   sorted_interval_list solid_int_list;
+   ray_sets_lazy_test(0, sets, set_count, ray, valid_model_interval.lo(), 
+	rootfinding_tmax, 1, solid_int_list);
+
+   return leaf_first_hit(solid_int_list, valid_model_interval, hit_ray_param);
+}
+
+
+
+
+//
+// Does a ray cross a surface anywhere in a model?  This is for shadows,
+// where which surface is hit and where don't matter.  It stops at the
+// first crossing found in any leaf and doesn't bother to visit the
+// leaves in order along the ray.
+//
+
+sv_integer
+sv_model::occluded(
+	 const sv_line& ray,			// ray to fire
+	 const sv_interval& ray_param_interval) const	// parameter range that is of interest
+{
+   current_ray_number++;
+   sv_stat(SV_ST_SHADOW);
+
+#if ~USE_LINE_BOX
+   set_ray_directions(ray);
+#endif
+
+   return ray_model_occluded(*this, ray, ray_param_interval.hi(), ray_param_interval);
+}
+
+
+
+sv_integer					// non-zero if the ray crosses a surface
+ray_model_occluded(const sv_model& mod,		// model to fire ray into
+	       const sv_line& ray,			// ray to fire
+	       const sv_real& rootfinding_tmax,	// the max t value to find roots for
+	       const sv_interval& valid_model_interval) // the limits within which the model is valid
+{
+   if(mod.kind() == INSTANCE_M)
+      return ray_instance_occluded(mod, ray, rootfinding_tmax, valid_model_interval);
+
+   if(mod.kind() == LEAF_M)
+      return ray_leaf_node_occluded(mod.set_list(), ray, rootfinding_tmax, valid_model_interval);
+
+   sv_model child_1_model = mod.child_1();
+   sv_model child_2_model = mod.child_2();
+   sv_interval child_1_valid_int;
+   sv_interval child_2_valid_int;
+   ray_child_intervals(mod, child_1_model, child_2_model, ray, valid_model_interval,
+	 &child_1_valid_int, &child_2_valid_int);
+
+   if(!child_1_valid_int.empty() &&
+	 ray_model_occluded(child_1_model, ray, rootfinding_tmax, child_1_valid_int))
+      return 1;
+
+   if(!child_2_valid_int.empty())
+      return ray_model_occluded(child_2_model, ray, rootfinding_tmax, child_2_valid_int);
+
+   return 0;
+}
+
+
+
+//
+// The same for an instance (see ray_instance_test())
+//
+
+sv_integer
+ray_instance_occluded(const sv_model& mod,	// instance to fire ray into
+	       const sv_line& ray,			// ray to fire
+	       const sv_real& rootfinding_tmax,	// the max t value to find roots for
+	       const sv_interval& valid_model_interval) // the limits within which the model is valid
+{
+   sv_integer result = 0;
+   sv_model rest = mod.child_2();
+   instance_ray ir;
+   sv_interval rest_int = line_box(ray, rest.box()) & valid_model_interval;
+
+#if ~USE_LINE_BOX
+   ray_direction xd = ray_x_dir;
+   ray_direction yd = ray_y_dir;
+   ray_direction zd = ray_z_dir;
+#endif
+
+   if(instance_rebase(mod, ray, rootfinding_tmax, valid_model_interval, &ir)) {
+#if ~USE_LINE_BOX
+      set_ray_directions(ir.ray);
+#endif
+      current_ray_number++;
+      result = ray_model_occluded(mod.child_1(), ir.ray, ir.tmax, ir.valid);
+      current_ray_number++;
+   }
+
+   if(!result && !rest_int.empty()) {
+#if ~USE_LINE_BOX
+      set_ray_directions(ray);
+#endif
+      result = ray_model_occluded(rest, ray, rootfinding_tmax, rest_int);
+   }
+
+#if ~USE_LINE_BOX
+   ray_x_dir = xd;
+   ray_y_dir = yd;
+   ray_z_dir = zd;
+#endif
+
+   return result;
+}
+
+
+
+//
+// Does the ray cross a surface of a set in a leaf node?  As in
+// leaf_first_hit() the solid is clipped to the leaf's piece of the
+// ray, and only ends that come from a surface count.
+//
+
+static sv_integer
+ray_set_occludes(const sv_set& s,			// set to test ray against
+		 const sv_line& ray,			// ray to test
+		 const sv_real& rootfinding_tmax,	// the max t value to find roots for
+		 const sv_interval& valid_model_interval)// the limits within which the model is valid
+{
+   sv_set no_set;
+   sorted_interval_list solid_int_list(ray_set_lazy_test(s, ray, 
+	valid_model_interval.lo(), rootfinding_tmax, 1));
+   solid_int_list = solid_int_list & sorted_interval_list(valid_model_interval, no_set, no_set);
+   interval_list_entry* ile = solid_int_list.entry();
+   while(ile) {
+      if(ile->slo.exists() || ile->shi.exists())
+	 return 1;
+      ile = ile->next;
+   }
+   return 0;
+}
+
+sv_integer
+ray_leaf_node_occluded(const sv_set_list &sets,	// set_list to test ray against
+		   const sv_line& ray,			// ray to test
+		   const sv_real& rootfinding_tmax,	// the max t value to find roots for
+		   const sv_interval& valid_model_interval)// the limits within which the model is valid
+{
+   sv_set_list tmp_sets = sets;
+
+   while(tmp_sets.exists()) {
+      if(ray_set_occludes(tmp_sets.set(), ray, rootfinding_tmax, valid_model_interval))
+	 return 1;
+      tmp_sets = tmp_sets.next();
+   }
+
+   return 0;
+}
+
+// The same for a leaf whose sets are held in an array (see frozen.cxx)
+
+sv_integer
+ray_leaf_node_occluded(const sv_set* sets,		// sets to test ray against
+		   sv_integer set_count,		// how many
+		   const sv_line& ray,			// ray to test
+		   const sv_real& rootfinding_tmax,	// the max t value to find roots for
+		   const sv_interval& valid_model_interval)// the limits within which the model is valid
+{
+   for(sv_integer k = 0; k < set_count; k++)
+      if(ray_set_occludes(sets[k], ray, rootfinding_tmax, valid_model_interval))
+	 return 1;
+
+   return 0;
+}
+
+
 sorted_interval_list
 ray_set_intersection_test(const sv_set& set_to_test,
 			  const sv_line& ray,
@@ -561,6 +1073,17 @@ ray_set_intersection_test(const sv_set& set_to_test,
 	rootfinding_tmax);
 
     default:
+
+// Convex polyhedra clip the ray against all their planes at once
+
+      if(set_to_test.cv_pol()) {
+	 sv_interval t;
+	 sv_set slo, shi;
+	 if(set_to_test.cv_pol()->clip(ray, LARGE, &t, &slo, &shi))
+	    return sorted_interval_list(t, slo, shi);
+	 return sorted_interval_list();
+      }
+
       switch(set_to_test.op()) {
        case SV_UNION:
 #if DEBUG
@@ -597,6 +1120,53 @@ ray_set_intersection_test(const sv_set& set_to_test,
 // univariate polynomial are stored in `t_coeffs[]'.  The functions
 // this polynomial
 
+// The special shapes' polynomials straight from their closed forms
+// (see sv_shape_data in prim.h).  For a ring torus the quartic is
+// (k2|d|^2 + R^2 - r^2)^2 - 4k2R^2rho^2, which is the value times
+// something positive, so it has the same roots and signs.
+
+static int shape_polynomial(sv_integer k, const sv_shape_data* s)
+{
+	if(!s) return(0);
+	if(k != SV_TORUS) return(1);
+	return( (s->b > 0) && (s->a*s->a > s->b) );
+}
+
+static polynomial shape_t_coefficients(const sv_line& l, sv_integer k, 
+				       const sv_shape_data* s)
+{
+	polynomial d2, h2, r2, c;
+	sv_point o = l.origin - s->c;
+	sv_real ho = o*s->ax;
+	sv_real hv = l.direction*s->ax;
+
+	d2.set_coeff(0, o*o);
+	d2.set_coeff(1, 2*(o*l.direction));
+	d2.set_coeff(2, l.direction*l.direction);
+	h2.set_coeff(0, ho*ho);
+	h2.set_coeff(1, 2*ho*hv);
+	h2.set_coeff(2, hv*hv);
+
+	switch(k)
+	{
+	case SV_SPHERE:
+		return(polynomial(s->k2)*d2 - polynomial(s->a));
+
+	case SV_CYLINDER:
+		return(polynomial(s->k2)*(d2 - h2) - polynomial(s->a));
+
+	case SV_CONE:
+		return(polynomial(s->k2)*(d2 - polynomial(1 + s->a)*h2));
+
+	default:
+		break;
+	}
+
+	r2 = d2 - h2;
+	c = polynomial(s->k2)*d2 + polynomial(s->a*s->a - s->b);
+	return(c*c - polynomial(4*s->k2*s->a*s->a)*r2);
+}
+
 polynomial
 get_t_coefficients(const sv_line& l,
 		   const sv_primitive& p)
@@ -619,6 +1189,9 @@ get_t_coefficients(const sv_line& l,
     case SV_SPHERE:
     case SV_CONE:
     case SV_TORUS:
+      if(shape_polynomial(p.kind(), p.shape()))
+	return(shape_t_coefficients(l, p.kind(), p.shape()));
+      // Falls through - the rest are expanded as general primitives
     case SV_CYCLIDE:
     case SV_GENERAL:
       switch(p.op()) {
@@ -656,6 +1229,11 @@ get_t_coefficients(const sv_line& l,
 	case SV_ABS:
 		return(get_t_coefficients(l, p.child_1()));
 
+	// The mapped line has the same parameter values
+
+	case SV_XFORM:
+		return(get_t_coefficients(p.xform().map(l), p.child_1()));
+
        case SV_DIVIDE:
        default:
        		svlis_error("get_t_coefficients", "dud operator", SV_CORRUPT);
@@ -687,6 +1265,10 @@ prim_is_polynomial(const sv_primitive& p)
       result = 1;
       break;
 
+    case SV_TORUS:
+      result = shape_polynomial(p.kind(), p.shape());
+      break;
+
     case SV_GENERAL:
       switch(p.op()) {
        case SV_PLUS:
@@ -705,6 +1287,7 @@ prim_is_polynomial(const sv_primitive& p)
 
        case SV_COMP:
        case SV_ABS:
+       case SV_XFORM:
 	result = prim_is_polynomial(p.child_1());
 	 break;
 
@@ -730,6 +1313,7 @@ ray_test(const sv_set& set_leaf_node,	// NB: this better be a leaf-node!!
 {
    sv_primitive prim;
    sv_set no_set;
+   sv_line base;
    sv_real tt;
    sv_integer poly_prim;
    polynomial t_coeffs;
@@ -739,6 +1323,7 @@ ray_test(const sv_set& set_leaf_node,	// NB: this better be a leaf-node!!
 
    sv_real test_t;
    sv_point test_point;
+   int solid_after;
    sv_integer i;
    flag_val flag;
 
@@ -795,15 +1380,57 @@ ray_test(const sv_set& set_leaf_node,	// NB: this better be a leaf-node!!
        case SV_TORUS:
        case SV_CYCLIDE:
        case SV_GENERAL:
+       default:
+
+// Shapes registered by the user may find their own roots.  A moved
+// one gets the ray taken back through its map, which leaves parameter
+// values along the ray as they were.
+
+	 if( (prim.kind() >= S_U_PRIM) || ((prim.op() == SV_XFORM) &&
+		(prim.child_1().kind() >= SV_U_REG)) ) {
+	    sv_primitive up = prim;
+	    sv_line uray = ray;
+	    if(prim.op() == SV_XFORM) {
+	       up = prim.child_1();
+	       uray = prim.xform().map(ray);
+	    }
+	    sv_user_prim_base* u = user_prim(up.kind());
+	    if(!u) {
+	       svlis_error("ray_test", "ray cast into a user-defined primitive", SV_WARNING);
+	       break;
+	    }
+	    nroots = u->ray_roots(uray, sv_interval(rootfinding_tmin, rootfinding_tmax),
+			arf_tol_t, MAX_ROOTS - 1, roots);
+	    if(nroots == SV_U_ARF)
+	       nroots = arf(ray,prim,sv_interval(rootfinding_tmin, rootfinding_tmax),
+			    arf_tol_t, MAX_ROOTS, roots);
+	    if(nroots < 0)
+	       svlis_error("ray_test","user root finder returns error status",
+			SV_WARNING);
+	    poly_prim = 0;
+	 } else {
 	 poly_prim = prim_is_polynomial(prim);
-	 if(poly_prim)
-	    t_coeffs = get_t_coefficients(ray, prim);
+	 base = ray;
+	 tt = 0;
+	 if(poly_prim) {
+
+// Special shapes are solved about the ray's closest approach to their
+// centres, which keeps the roots accurate for distant rays
+
+	    if(prim.shape()) {
+	       tt = ((prim.shape()->c - ray.origin)*ray.direction)/
+			(ray.direction*ray.direction);
+	       base.origin = line_point(ray, tt);
+	    }
+	    t_coeffs = get_t_coefficients(base, prim);
+	 }
 
 //  --- AB: solve directly for degree < 4
 
-	if(poly_prim && (t_coeffs.degree() <= 4))
+	if(poly_prim && (t_coeffs.degree() <= 4)) {
 		nroots = low_d_roots(t_coeffs, 1.0e-10, roots);
-	else {
+		for(i = 0; i < nroots; i++) roots[i] += tt;
+	} else {
 	    if(poly_prim) {
 	       // Use ARPORS to find roots
 
@@ -843,6 +1470,9 @@ ray_test(const sv_set& set_leaf_node,	// NB: this better be a leaf-node!!
 			SV_WARNING);
 	    }
 	}
+	 }
+
+	    if(nroots > 0) sv_stat_n(SV_ST_ROOT, nroots);
 
 	    if(nroots == 0) {
 	       // No roots - decide if air or solid
@@ -878,9 +1508,16 @@ ray_test(const sv_set& set_leaf_node,	// NB: this better be a leaf-node!!
 		  }
 
 	       } else {
-		  // Single root
+		  // Single root - which side is solid is found at the
+		  // end of the range further from it, as the range may
+		  // not include the ray's origin, and there may be roots
+		  // outside the range
 
-		  if((prim.value(ray.origin) > 0.0) == (roots[0] > 0.0))
+		  if(roots[0] - rootfinding_tmin > rootfinding_tmax - roots[0])
+		     solid_after = (prim.value(line_point(ray, rootfinding_tmin)) > 0.0);
+		  else
+		     solid_after = (prim.value(line_point(ray, rootfinding_tmax)) <= 0.0);
+		  if(solid_after)
 		     result = sorted_interval_list(sv_interval(roots[0],LARGE),
 			set_leaf_node,no_set);
 		  else
@@ -890,9 +1527,6 @@ ray_test(const sv_set& set_leaf_node,	// NB: this better be a leaf-node!!
 	    }
 	//XXXX }
 	 break;
-
-       default:
-       svlis_error("ray_test", "ray cast into a user-defined primitive", SV_WARNING);
       }
 
 #if CACHEING
@@ -62,6 +62,10 @@
 #include "geometry.h"
 #include "interval.h"
 #include "sv_b_cls.h"
+#include "sv_stats.h"
+#include "sv_pool.h"
+#include "sv_index.h"
+#include "sv_xform.h"
 #include "prim.h"
 #include "attrib.h"
 #include "sv_set.h"
@@ -99,6 +103,16 @@ void read(istream& s, sv_line& l)
 	check_token(s, SVT_CB);
 }
 
+void read(istream& s, sv_xform& m)
+{
+	check_token(s, SVT_OB);
+	read(s, m.r0);
+	read(s, m.r1);
+	read(s, m.r2);
+	read(s, m.t);
+	check_token(s, SVT_CB);
+}
+
 void read(istream& s, sv_plane& f)
 {
 	sv_integer id;
@@ -169,6 +183,7 @@ void read(istream& s, prim_op& o)
 	case 'E': o = SV_EXP; break;
 	case '@': o = SV_SSQRT; break;
         case '%': o = SV_SIGN; break;
+	case 'X': o = SV_XFORM; break;
 
 	default:
 		svlis_error("prim_op::operator>>","dud value read",SV_CORRUPT);
@@ -197,6 +212,7 @@ void read(istream& s, sv_primitive& p)
 	sv_integer fl;
 	sv_real r, rd;
 	sv_plane f;
+	sv_xform m;
 
 	if(check_token(s, SVT_PRIM))
 	{
@@ -225,6 +241,7 @@ void read(istream& s, sv_primitive& p)
 			case SV_GENERAL:
 				junk_junk(s);
 				s >> o;
+				if (o == SV_XFORM) read(s, m);
 				if (diadic(o))
 				{
 					read(s, c_1);
@@ -235,6 +252,8 @@ void read(istream& s, sv_primitive& p)
 				get_token(s, id, rd, 1);
 				if (diadic(o))
 					result = sv_primitive(c_1, c_2, o);
+				else if (o == SV_XFORM)
+					result = sv_primitive(c_1, m);
 				else
 					result = sv_primitive(c_1, o);
 
@@ -343,6 +362,11 @@ void read(istream& s, sv_set& sr)
 			}
 
 			s_write_list.add(result, s_ptr);
+		} else if(s_ref_attributes)
+		{
+			get_token(s, id, rd, 1);
+			if (id) read(s, at);
+			result = result.attribute(at);
 		}
 		check_token(s, SVT_CB_S);
 	}
@@ -468,6 +492,7 @@ void read(istream& s, mod_kind& k)
 	case 'X': k = X_DIV; break;
 	case 'Y': k = Y_DIV; break;
 	case 'Z': k = Z_DIV; break;
+	case 'I': k = INSTANCE_M; break;
 
 	default:
 		svlis_error("read(.. mod_kind)","dud value read",SV_CORRUPT);
@@ -492,9 +517,10 @@ void read(istream& s, sv_model& mr)
 
 	long m_ptr;
 	sv_set_list sl;
-	sv_integer f, id;
+	sv_integer f, pf, id;
 	mod_kind k;
 	sv_box b;
+	sv_xform place;
 	sv_model result, c_1, c_2, pp, m_temp;
 	sv_real cut, rd;
 
@@ -508,8 +534,8 @@ void read(istream& s, sv_model& mr)
 			get_token(s, f, rd, 1);
 			read(s, b);
 			read(s, sl);
-			get_token(s, f, rd, 1);
-			if(f) read(s, pp);
+			get_token(s, pf, rd, 1);
+			if(pf) read(s, pp);
 			m_temp = sv_model(sl, b, LEAF_M, pp);
 			switch(k)
 			{
@@ -524,6 +550,13 @@ void read(istream& s, sv_model& mr)
 				result = sv_model(m_temp, c_1, c_2, k, cut);
 				break;
 
+			case INSTANCE_M:
+				read(s, place);
+				read(s, c_1);
+				read(s, c_2);
+				result = sv_model(c_1, place, c_2);
+				break;
+
 			default:
 				svlis_error("read(sv_model)", "dud kind", SV_CORRUPT);
 			}
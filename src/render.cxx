@@ -63,13 +63,21 @@
  #pragma export on
 #endif
 
+// Render the pixels from (x0, y0) up to but not including (x1, y1)
+// of a picture, tracing primary rays through a frozen copy of the
+// model (or the model itself if the copy is null), and shading with
+// the render's materials (looked up as hit if null).  The picture must
+// already have its resolution set.
+
 sv_integer
-generate_picture(const sv_model& modl,
+generate_picture_tile(const sv_model& modl,
+		 const sv_frozen_model& frozen,
+		 const sv_shade_materials* mats,
 		 const sv_view& view_params,
 		 const sv_light_list& light_list,
 		 sv_picture& picture_params,
-		 sv_real progress_report_step,
-		 void report_procedure(sv_real percent))
+		 sv_integer x0, sv_integer y0,
+		 sv_integer x1, sv_integer y1)
 {
    sv_integer ix, iy, xdif, ydif;
    sv_point ray_origin;
@@ -100,15 +108,11 @@ generate_picture(const sv_model& modl,
 
    // Loop for each pixel
 
-//   sv_integer report_interval_line_count = max(1,sv_integer(sv_real(y_res)*progress_report_step/100.0));
-// GMB 06-12-94
-   sv_integer report_interval_line_count = max(1,long(sv_real(y_res)*progress_report_step/100.0));
-   sv_integer next_report_line = report_interval_line_count;
    sv_integer missed;
-   ydif = -y_res/2;
-   for(iy=0;iy<y_res;iy++) {
-      xdif = -x_res/2;      
-      for(ix=0;ix<x_res;ix++) {
+   for(iy=y0;iy<y1;iy++) {
+      ydif = iy - y_res/2;
+      for(ix=x0;ix<x1;ix++) {
+	 xdif = ix - x_res/2;
 	 // ***************************** Do we really need to normalise the ray vector?
 	 ray_dir = (view_vector + xdif*screen_h + ydif*screen_v).norm();
 	 missed=1;
@@ -116,11 +120,14 @@ generate_picture(const sv_model& modl,
 	 interval = line_box(ray, modl.box()); 
 	 if(!interval.empty()) { // AB 15/5/96
 	    if(interval.lo() < 0.0) interval = sv_interval(0.0, interval.hi());
-	    hit_surf = modl.fire_ray(ray, interval, &t);
+	    if(frozen.exists())
+	       hit_surf = frozen.fire_ray(ray, interval, &t);
+	    else
+	       hit_surf = modl.fire_ray(ray, interval, &t);
 	    if(hit_surf.exists()) {
 	       hit_point = line_point(ray,t);
 	       pix_col = shade(modl, ray_dir, hit_surf, hit_point, 
-		view_params, light_list, (sv_real)1.0,t);
+		view_params, light_list, (sv_real)1.0, t, mats);
 	       missed=0;
 	    }
 	 }
@@ -129,23 +136,63 @@ generate_picture(const sv_model& modl,
 
 	 pixel_colour = sv_pixel(pix_col);
 	 picture_params.pixel(ix,iy,pixel_colour);
-	 xdif++;
       }
+   }
+
+   return 1;
+}
+
+sv_integer
+generate_picture(const sv_model& modl,
+		 const sv_view& view_params,
+		 const sv_light_list& light_list,
+		 sv_picture& picture_params,
+		 sv_real progress_report_step,
+		 void report_procedure(sv_real percent))
+{
+   sv_integer iy;
+   sv_trace_span span("generate_picture");
+
+   sv_integer x_res = picture_params.x_resolution();
+   sv_integer y_res = picture_params.y_resolution();
+
+   // Primary rays go through the model's frozen copy (kept with the
+   // model, so it's only made once), and the surfaces of all the sets
+   // are looked up once.  Neither is done if parts of the model are
+   // paged out, as that would read them all in.
+
+   sv_frozen_model frozen;
+   sv_shade_materials* mats = 0;
+   if(!(modl.flags() & SV_PAGE_FLAG))
+   {
+      frozen = modl.frozen();
+      mats = make_shade_materials(modl);
+   }
+
+   // Loop for each row
+
+//   sv_integer report_interval_line_count = max(1,sv_integer(sv_real(y_res)*progress_report_step/100.0));
+// GMB 06-12-94
+   sv_integer report_interval_line_count = max(1,long(sv_real(y_res)*progress_report_step/100.0));
+   sv_integer next_report_line = report_interval_line_count;
+   for(iy=0;iy<y_res;iy++) {
+      sv_trace_span row("picture row", iy);
+      generate_picture_tile(modl, frozen, mats, view_params, light_list, 
+	 picture_params, 0, iy, x_res, iy + 1);
 
       if(iy == next_report_line) {
 	 next_report_line += report_interval_line_count;
 	 report_procedure((sv_real(iy)*100.0/sv_real(y_res)));
       }
-      ydif++;
    }
 
 
+   drop_shade_materials(mats);
    report_procedure(100.0);
    return 1;
 }
 
 
-
 void
 dummy_picture_report(sv_real)
 {
@@ -63,11 +63,20 @@
 #include "geometry.h"
 #include "interval.h"
 #include "sv_b_cls.h"
+#include "sv_stats.h"
+#include "sv_trace.h"
+#include "sv_pool.h"
+#include "sv_index.h"
+#include "sv_xform.h"
 #include "prim.h"
 #include "attrib.h"
 #include "sv_set.h"
+#include "sv_cvpol.h"
+#include "bounds.h"
 #include "decision.h"
 #include "polygon.h"
+#include "model.h"
+#include "sv_util.h"
 #if macintosh
  #pragma export on
 #endif
@@ -94,6 +103,103 @@ sv_integer sv_c_flag(const sv_primitive& p)
 	return(0);
 }
 
+// The packed planes and balance bounds belong to the set
+
+sv_set::set_data::~set_data() { delete cv; delete [] bal; }
+
+// Is a box (or a point) inside the box a balanced node was made in,
+// but outside the node's bounds there?  If so the node is all air in it.
+
+static int balance_miss(const sv_box* bal, const sv_box& b)
+{
+	if(!b.inside(bal[0])) return(0);
+	sv_box c = b & bal[1];
+	return(c.xi.empty() || c.yi.empty() || c.zi.empty());
+}
+
+// Gather the half-spaces of an intersection into h[], starting at
+// h[n].  Returns the new count, or -1 if there are too many or any
+// of them (or any node below the top) can't be packed.
+
+static sv_integer cv_leaves(const sv_set& s, sv_set* h, sv_integer n)
+{
+	if(n < 0) return(n);
+	if(s.contents() == 1)
+	{
+		if( (n >= SV_CV_MAX) || !sv_cv_pol::packable(s) ) return(-1);
+		h[n] = s;
+		return(n + 1);
+	}
+	if( (s.contents() < 1) || (s.op() != SV_INTERSECTION) || s.has_attribute() )
+		return(-1);
+	n = cv_leaves(s.child_1(), h, n);
+	return(cv_leaves(s.child_2(), h, n));
+}
+
+// Pack the planes of a convex intersection (see sv_cvpol.h).  Finding
+// the vertices is slow, so it's not done as the set is made (most of the
+// sets the operators and prune() make are never tested), but the first
+// time the packed planes are wanted.  Sets that prune() made are left
+// for it to take apart: only a membership test or a ray packs them.
+// The set may be shared between threads by then, so whichever packing
+// gets there first is kept.
+
+#define CV_UNTRIED 0	// Not packed yet
+#define CV_PRUNED 1	// Not packed yet, and made by prune()
+#define CV_DONE 2	// Packed (or can't be)
+
+const sv_cv_pol* sv_set::cv_find(int for_prune) const
+{
+	int state = __atomic_load_n(&set_info->cv_state, __ATOMIC_ACQUIRE);
+	if(state == CV_DONE) return(set_info->cv);
+	if( !(flags() & SV_CV_POL) || (for_prune && (state == CV_PRUNED)) ) 
+		return(0);
+
+	sv_cv_pol* cv = 0;
+	sv_cv_pol* none = 0;
+	if( (contents() >= 2) && (contents() <= SV_CV_MAX) && 
+	    (op() == SV_INTERSECTION) )
+	{
+		sv_set h[SV_CV_MAX];
+		sv_integer n = cv_leaves(child_1(), h, 0);
+		n = cv_leaves(child_2(), h, n);
+		if(n >= 2) cv = new sv_cv_pol(h, n);
+	}
+	if(cv && !__atomic_compare_exchange_n(&set_info->cv, &none, cv, 0, 
+			__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+	{
+		delete cv;
+		cv = none;
+	}
+	__atomic_store_n(&set_info->cv_state, CV_DONE, __ATOMIC_RELEASE);
+	return(cv);
+}
+
+// The packed planes if they've been packed, without packing them
+
+const sv_cv_pol* sv_set::cv_packed() const
+{
+	return(__atomic_load_n(&set_info->cv, __ATOMIC_ACQUIRE));
+}
+
+// Shared EVERYTHING and NOTHING sets for the trivial results of the
+// operators and prune.  They are never flagged and never have a 
+// complement remembered, so they can be handed out freely.  Each thread
+// has its own pair, so that threads dividing a model at once aren't all
+// queueing for the lock on one reference count.
+
+static const sv_set& set_everything()
+{
+	static thread_local sv_set s = sv_set(SV_EVERYTHING);
+	return(s);
+}
+
+static const sv_set& set_nothing()
+{
+	static thread_local sv_set s = sv_set(SV_NOTHING);
+	return(s);
+}
+
 // Unique tag
 
 sv_integer sv_set::tag() const { return(SVT_F*SVT_SET); }
@@ -169,6 +275,7 @@ sv_set sv_set::attribute(const sv_attribute& aa) const
 // This ought to be a self-organizing list
 
 look_up<sv_set> s_write_list;
+sv_integer s_ref_attributes = 0;
 
 void clean_set_lookup()
 {
@@ -298,6 +405,18 @@ void write(ostream& s, const sv_set& aa, sv_integer level)
 			writei(s, 0, nxl);
 			s << SV_EL;
 		}
+	} else if(s_ref_attributes)
+	{
+		if (a.has_attribute())
+		{
+			writei(s, 1, 0); s << SV_EL;
+			a_temp = a.attribute();
+			write(s, a_temp, nxl);
+		} else
+		{
+			writei(s, 0, 0);
+			s << SV_EL;
+		}
 	}
 	put_white(s, level);
 	put_token(s, SVT_CB_S, 0, 0);
@@ -336,6 +455,8 @@ prim_op same(const sv_set& a, const sv_set& b)
 {
 	prim_op r1, r2;
 	int flip = 0;
+
+	sv_stat(SV_ST_SAME);
 	
 	if (a == b) return(SV_PLUS);  // Simple things first...
 
@@ -575,6 +696,62 @@ sv_set sv_set::mirror(const sv_plane& m) const
 	return(att_mirror(b, *this, m));
 }
 
+// Transform a set lazily
+
+sv_set sv_set::transform(const sv_xform& m) const
+{
+	sv_set b;
+
+	switch (contents())
+	{
+	case SV_EVERYTHING:
+	case SV_NOTHING:
+		return(*this);
+
+	case 1:
+		b = sv_set(primitive().transform(m));
+		break;
+
+	default:
+		if (op() == SV_UNION)
+			b = child_1().transform(m) | child_2().transform(m);
+		else
+			b = child_1().transform(m) & child_2().transform(m);
+		break;
+	}
+
+	if (has_attribute()) b = b.attribute(attribute());
+	return(b);
+}
+
+// Bake the transforms in a set's primitives
+
+sv_set sv_set::bake() const
+{
+	sv_set b;
+
+	switch (contents())
+	{
+	case SV_EVERYTHING:
+	case SV_NOTHING:
+		return(*this);
+
+	case 1:
+		b = sv_set(primitive().bake());
+		break;
+
+	default:
+		if (op() == SV_UNION)
+			b = child_1().bake() | child_2().bake();
+		else
+			b = child_1().bake() & child_2().bake();
+		break;
+	}
+
+	if (has_attribute()) b = b.attribute(attribute());
+	return(b);
+}
+
 // Complement a set.  If this has been done already, the result is
 // in a.complement(); if not it needs to be computed.
 
@@ -585,17 +762,15 @@ sv_set operator-(const sv_set& aa)
 	if (a.complement().exists()) return (a.complement());    // NB: does not call
 								 // att_complement
 
+// The trivial sets are shared, so don't remember their complements
+
+	if (a.contents() == SV_EVERYTHING) return(att_complement(set_nothing(), a));
+	if (a.contents() == SV_NOTHING) return(att_complement(set_everything(), a));
+
 	sv_set b;
 
 	switch (a.contents())
 	{
-	case SV_EVERYTHING:
-		b = sv_set(SV_NOTHING);
-		break;
-
-	case SV_NOTHING:	
-		b = sv_set(SV_EVERYTHING);
-		break;
 
 	case 1:
 		b = sv_set(-a.primitive());
@@ -636,7 +811,7 @@ int quickor(const sv_set& a, const sv_set& b, sv_set* c)
 		if (a.complement().exists())
 			if (a.complement() == b) 
 			{
-				*c = sv_set(SV_EVERYTHING);
+				*c = set_everything();
 				result = 1;
 			}
 	}
@@ -652,7 +827,7 @@ sv_set operator|(const sv_set& a, const sv_set& b)
 		switch (a.contents())
 		{
 		case SV_EVERYTHING:
-			c = sv_set(SV_EVERYTHING);
+			c = set_everything();
 			break;
 
 		case SV_NOTHING:	
@@ -663,7 +838,7 @@ sv_set operator|(const sv_set& a, const sv_set& b)
 			switch (b.contents())
 			{
 			case SV_EVERYTHING:
-				c = sv_set(SV_EVERYTHING); 
+				c = set_everything(); 
 				break;
 			case SV_NOTHING:
 				c = a;
@@ -684,7 +859,7 @@ sv_set operator|(const sv_set& a, const sv_set& b)
 			switch (b.contents())
 			{
 			case SV_EVERYTHING:
-				c = sv_set(SV_EVERYTHING); 
+				c = set_everything(); 
 				break;
 			case SV_NOTHING:
 				c = a;
@@ -723,7 +898,7 @@ int quickand(const sv_set& a, const sv_set& b, sv_set* c)
 		if (a.complement().exists())
 			if (a.complement() == b) 
 			{
-				*c = sv_set(SV_NOTHING);
+				*c = set_nothing();
 				result = 1;
 			}
 	}
@@ -743,7 +918,7 @@ sv_set operator&(const sv_set& a, const sv_set& b)
 			c = b;
 			break;
 		case SV_NOTHING:	
-			c = sv_set(SV_NOTHING); 
+			c = set_nothing(); 
 			break;
 		case 1:
 			switch (b.contents())
@@ -752,7 +927,7 @@ sv_set operator&(const sv_set& a, const sv_set& b)
 				c = a; 
 				break;
 			case SV_NOTHING:
-				c = sv_set(SV_NOTHING);
+				c = set_nothing();
 				break;
 			case 1:
 				if (a.primitive().degree() > b.primitive().degree())
@@ -773,7 +948,7 @@ sv_set operator&(const sv_set& a, const sv_set& b)
 				c = a; 
 				break;
 			case SV_NOTHING:
-				c = sv_set(SV_NOTHING);
+				c = set_nothing();
 				break;	 
 			case 1:
 				c = sv_set(b,a,SV_INTERSECTION);
@@ -789,7 +964,8 @@ sv_set operator&(const sv_set& a, const sv_set& b)
 		}
 	}
 
-	if( (a.flags() & SV_CV_POL) && (b.flags() & SV_CV_POL) ) c.set_flags_priv(SV_CV_POL);
+	if( (a.flags() & SV_CV_POL) && (b.flags() & SV_CV_POL) && (c.contents() >= 1) )
+		c.set_flags_priv(SV_CV_POL);
 
 	return(att_intersection(c, a, b));
 }
@@ -1000,6 +1176,9 @@ mem_test sv_set::member(const sv_point& p, sv_primitive known_surface[]) const
 	mem_test result_2 = SV_AIR;
 	sv_integer i = 0;
 	sv_real work;
+	const sv_cv_pol* cv;
+
+	sv_stat(SV_ST_MEMBER);
 
 	switch (contents())
 	{
@@ -1028,6 +1207,16 @@ mem_test sv_set::member(const sv_point& p, sv_primitive known_surface[]) const
 	
 	default:
 
+// Balanced nodes know where they are air; convex polyhedra test all
+// their planes at once
+
+		if(set_info->bal && !known_surface[0].exists() &&
+				balance_miss(set_info->bal, sv_box(p, p)))
+			return(SV_AIR);
+
+		if(!known_surface[0].exists() && (cv = cv_pol()))
+			return(cv->member(p));
+
 // child_1 should have a lower complexity than child_2
 
 		result_1 = child_1().member(p,known_surface);
@@ -1061,6 +1250,212 @@ mem_test sv_set::member(const sv_point& p, sv_primitive known_surface[]) const
 	return(result_1);   
 }
 
+// Rough cost of evaluating a primitive: the number of nodes in it
+
+static sv_real prim_cost(const sv_primitive& p)
+{
+	sv_real c = 1;
+	if(p.child_1().exists()) c = c + prim_cost(p.child_1());
+	if(p.child_2().exists()) c = c + prim_cost(p.child_2());
+	return(c);
+}
+
+// Membership and cost at each sample point of a leaf of a set
+
+static void reorder_leaf(const sv_set& s, const sv_point p[], sv_integer n, 
+	mem_test m[], sv_real cost[])
+{
+	sv_integer i;
+	sv_real w;
+
+	if(s.contents() == 1)
+	{
+		w = prim_cost(s.primitive());
+		for(i = 0; i < n; i++)
+		{
+			m[i] = ::member(s.primitive().value(p[i]));
+			cost[i] = w;
+		}
+	} else
+	{
+		for(i = 0; i < n; i++)
+		{
+			m[i] = (s.contents() == SV_EVERYTHING) ? SV_SOLID : SV_AIR;
+			cost[i] = 0;
+		}
+	}
+}
+
+// One node of a set being reordered: the set, and whether its
+// children have been pushed
+
+struct reorder_frame
+{
+	sv_set s;
+	int down;
+};
+
+// Reorder for n given points.  Each child is done first, giving its
+// membership and cost at every point.  Then the child that more often
+// settles the answer on its own (SOLID for a union, AIR for an
+// intersection) for its cost goes first.  The totals over the sample
+// points for the two orders are compared directly.
+//
+// Sets can be very deep, so this doesn't recurse.  The tree is walked
+// with a stack of nodes, and the reordered children, with their
+// memberships and costs, are kept on a second stack until their parent
+// is done; the memberships and costs are n at a time in one buffer,
+// which grows as needed.
+
+sv_set sv_set::reorder(const sv_point p[], sv_integer n, mem_test m[], sv_real cost[]) const
+{
+	if(contents() < 2)
+	{
+		reorder_leaf(*this, p, n, m, cost);
+		return(*this);
+	}
+
+	sv_integer i;
+	sv_integer max_f = 2*contents() + 2;
+	reorder_frame* f = new reorder_frame[max_f];
+	sv_integer fp = 0;
+
+	sv_integer max_d = 8;
+	sv_set* done = new sv_set[max_d];
+	mem_test* dm = new mem_test[max_d*n];
+	sv_real* dc = new sv_real[max_d*n];
+	sv_integer dp = 0;
+
+	sv_set x, a, b, r;
+	mem_test *m_1, *m_2;
+	sv_real *c_1, *c_2;
+	mem_test decides, other;
+	sv_real ab, ba;
+	int swap;
+
+	f[fp].s = *this;
+	f[fp++].down = 0;
+	while(fp)
+	{
+		x = f[fp - 1].s;
+		if( (x.contents() >= 2) && !f[fp - 1].down )
+		{
+			f[fp - 1].down = 1;
+			f[fp].s = x.child_2();
+			f[fp++].down = 0;
+			f[fp].s = x.child_1();
+			f[fp++].down = 0;
+			continue;
+		}
+		f[--fp].s = sv_set();
+
+		if(dp >= max_d)
+		{
+			sv_integer new_d = 2*max_d;
+			sv_set* nd = new sv_set[new_d];
+			mem_test* nm = new mem_test[new_d*n];
+			sv_real* nc = new sv_real[new_d*n];
+			for(i = 0; i < dp; i++) nd[i] = done[i];
+			for(i = 0; i < dp*n; i++)
+			{
+				nm[i] = dm[i];
+				nc[i] = dc[i];
+			}
+			delete [] done;
+			delete [] dm;
+			delete [] dc;
+			done = nd;
+			dm = nm;
+			dc = nc;
+			max_d = new_d;
+		}
+
+		if(x.contents() < 2)
+		{
+			reorder_leaf(x, p, n, &dm[dp*n], &dc[dp*n]);
+			done[dp++] = x;
+			continue;
+		}
+
+// Both children are done; they are the top two on the stack, and the
+// result replaces them
+
+		a = done[dp - 2];
+		b = done[dp - 1];
+		m_1 = &dm[(dp - 2)*n];
+		c_1 = &dc[(dp - 2)*n];
+		m_2 = &dm[(dp - 1)*n];
+		c_2 = &dc[(dp - 1)*n];
+		decides = (x.op() == SV_UNION) ? SV_SOLID : SV_AIR;
+		other = (x.op() == SV_UNION) ? SV_AIR : SV_SOLID;
+
+		ab = 0;
+		ba = 0;
+		for(i = 0; i < n; i++)
+		{
+			ab = ab + c_1[i] + ((m_1[i] == decides) ? 0 : c_2[i]);
+			ba = ba + c_2[i] + ((m_2[i] == decides) ? 0 : c_1[i]);
+		}
+		swap = (ba < ab);
+
+		for(i = 0; i < n; i++)
+		{
+			if(swap)
+				c_1[i] = c_2[i] + ((m_2[i] == decides) ? 0 : c_1[i]);
+			else
+				c_1[i] = c_1[i] + ((m_1[i] == decides) ? 0 : c_2[i]);
+			if( (m_1[i] == decides) || (m_2[i] == decides) )
+				m_1[i] = decides;
+			else if ( (m_1[i] == SV_SURFACE) || (m_2[i] == SV_SURFACE) )
+				m_1[i] = SV_SURFACE;
+			else
+				m_1[i] = other;
+		}
+
+		if(!swap && (a == x.child_1()) && (b == x.child_2())) 
+			r = x;
+		else
+		{
+			r = swap ? sv_set(b, a, x.op()) : sv_set(a, b, x.op());
+			if(x.flags() & SV_CV_POL) r.set_flags_priv(SV_CV_POL);
+			if(x.has_attribute()) r = r.attribute(x.attribute());
+		}
+		done[--dp] = sv_set();
+		done[dp - 1] = r;
+	}
+
+	for(i = 0; i < n; i++)
+	{
+		m[i] = dm[i];
+		cost[i] = dc[i];
+	}
+	sv_set result = done[0];
+
+	delete [] f;
+	delete [] done;
+	delete [] dm;
+	delete [] dc;
+	return(result);
+}
+
+// Reorder by sampling a box
+
+sv_set sv_set::reorder(const sv_box& b, sv_integer samples) const
+{
+	if( (contents() < 2) || (samples < 1) ) return(*this);
+
+	sv_trace_span span("reorder", samples);
+	sv_point* p = new sv_point[samples];
+	mem_test* m = new mem_test[samples];
+	sv_real* c = new sv_real[samples];
+	for(sv_integer i = 0; i < samples; i++) p[i] = ran_point(b);
+	sv_set result = reorder(p, samples, m, c);
+	delete [] p;
+	delete [] m;
+	delete [] c;
+	return(result);
+}
+
 // Value for a point (and winning leaf)
 
 sv_real sv_set::value(const sv_point& p, sv_set* winner) const
@@ -1183,9 +1578,13 @@ void regular_prune(sv_integer p) { reg_prune = p; }
 
 sv_set sv_set::prune(const sv_box& b) const
 {
-	sv_set pruned, temp;
+	sv_set pruned, temp, made;
 	mem_test m = SV_AIR;
 	int c_1_same;
+	sv_integer cv;
+	const sv_cv_pol* cv_p;
+
+	sv_stat(SV_ST_PRUNE);
 
 	switch (contents())
 	{
@@ -1199,13 +1598,13 @@ sv_set sv_set::prune(const sv_box& b) const
 		switch (m)
 		{
 		case SV_AIR:
-			pruned = sv_set(SV_NOTHING);
+			pruned = set_nothing();
 			break;
 		case SV_SURFACE:
 			pruned = *this;
 			break;
 		case SV_SOLID:
-			pruned = sv_set(SV_EVERYTHING);
+			pruned = set_everything();
 			break;
 		default:
 			svlis_error("sv_set::prune(sv_box)", "dud mem test", SV_CORRUPT);
@@ -1213,6 +1612,34 @@ sv_set sv_set::prune(const sv_box& b) const
 		break;
 					
 	default:
+
+		if(set_info->bal && balance_miss(set_info->bal, b))
+		{
+			pruned = set_nothing();
+			break;
+		}
+
+// Convex polyhedra test all their planes at once, and also find boxes
+// that miss them near their edges and corners
+
+		cv_p = cv_find(1);
+		cv = cv_p ? cv_p->box_test(b) : -1;
+		if(cv == SV_AIR)
+		{
+			pruned = set_nothing();
+			break;
+		}
+		if(cv == SV_SOLID)
+		{
+			pruned = set_everything();
+			break;
+		}
+		if(cv == SV_SURFACE)
+		{
+			pruned = *this;
+			break;
+		}
+
 		pruned = child_1().prune(b);
 		c_1_same = ( pruned == child_1() );
 		if (op() == SV_UNION)
@@ -1248,7 +1675,13 @@ sv_set sv_set::prune(const sv_box& b) const
 				if (c_1_same && (temp == child_2()))
 					pruned = *this;
 				else
-					pruned = pruned & temp;
+				{
+					made = pruned & temp;
+					if( (made.contents() > 1) && (made.unique() != pruned.unique()) &&
+					    (made.unique() != temp.unique()) )
+						made.set_info->cv_state = CV_PRUNED;
+					pruned = made;
+				}
 				break;
 			}
 		}
@@ -1676,6 +2109,60 @@ prim_op same(const sv_set_list& a, const sv_set_list& b)
 }
 
 
+// Set lists at least this long get indexed
+
+static sv_integer index_min = 64;
+
+void set_index_min(sv_integer n) { index_min = n; }
+sv_integer get_index_min() { return(index_min); }
+
+// How many times each box is bisected when finding bounds
+
+#define SV_BOUND_DEPTH 15
+
+// Conservative bounds of a set inside a box, found by bisecting the
+// box along its longest side and discarding the halves that the set
+// prunes to nothing in.  Boxes already inside the bounds found so far
+// can't add anything.
+
+static void set_bound(const sv_set& s, const sv_box& b, sv_integer depth, sv_box* bound)
+{
+	if(!bound->xi.empty() && b.inside(*bound)) return;
+
+	sv_set p = s.prune(b);
+	if(p.contents() == SV_NOTHING) return;
+	if( (depth <= 0) || (p.contents() == SV_EVERYTHING) )
+	{
+		*bound = *bound | b;
+		return;
+	}
+
+	sv_box b_1, b_2;
+	bound_halve(b, &b_1, &b_2);
+	set_bound(p, b_1, depth - 1, bound);
+	set_bound(p, b_2, depth - 1, bound);
+}
+
+// An index of the bounds of the sets in a list inside box b
+
+static sv_smart_ptr<sv_box_index> build_index(const sv_set_list& sl, const sv_box& b)
+{
+	sv_integer n = sl.count();
+	sv_trace_span span("index build", n);
+	sv_smart_ptr<sv_box_index> ix = new sv_box_index(b, n);
+	sv_set_list l = sl;
+	sv_box bound;
+	for(sv_integer i = 0; i < n; i++)
+	{
+		bound = sv_box();
+		set_bound(l.set(), b, SV_BOUND_DEPTH, &bound);
+		ix->item(i, bound);
+		l = l.next();
+	}
+	ix->make_tree();
+	return(ix);
+}
+
 // Create a new set list that is a copy of an old one, with the sets
 // each pruned to a box
 
@@ -1690,6 +2177,21 @@ sv_set_list sv_set_list::prune(const sv_box& b) const
 		return(result);
 	}
 
+// Long lists are pruned by index_prune() (they get an index the 
+// first time, if they are long enough to be worth it)
+
+	sv_smart_ptr<sv_box_index> ix = set_list_info->index;
+	if(ix.exists())
+	{
+		if(!ix->covers(b)) ix = sv_smart_ptr<sv_box_index>();
+		return(index_prune(b, ix));
+	}
+	if(index_min && (count() >= index_min))
+	{
+		ix = build_index(*this, b);
+		return(index_prune(b, ix));
+	}
+
 	n = next();
 
 	if(n.exists())
@@ -1700,6 +2202,262 @@ sv_set_list sv_set_list::prune(const sv_box& b) const
 	return(result);
 }
 
+// For finding repeated sets: sets by record, last in the list first
+
+struct prune_entry
+{
+	long u;
+	sv_integer i;
+};
+
+static int prune_entry_cmp(const void* va, const void* vb)
+{
+	const prune_entry* a = (const prune_entry*)va;
+	const prune_entry* b = (const prune_entry*)vb;
+	if(a->u != b->u) return( (a->u < b->u) ? -1 : 1 );
+	return( (a->i > b->i) ? -1 : ((a->i < b->i) ? 1 : 0) );
+}
+
+// Prune a long list, taking the sets whose bounds in index ix miss
+// the box to be NOTHING without pruning them (all of them are pruned
+// if ix is null).  The result is the list the recursive prune above
+// gives, but it is made in one pass rather than by merging a list at
+// a time: each merge reverses the list so far and puts the new set at
+// its head, unless it is already there.  If the result is long enough
+// it gets an index made from its sets' bounds in ix.
+
+sv_set_list sv_set_list::index_prune(const sv_box& b, const sv_smart_ptr<sv_box_index>& ix) const
+{
+	sv_integer n = count();
+	sv_integer i, j, k;
+	char* hit = new char[n];
+	for(i = 0; i < n; i++) hit[i] = !ix.exists();
+	if(ix.exists()) ix->query(b, hit);
+
+	sv_set* p = new sv_set[n];
+	prune_entry* e = new prune_entry[n];
+	sv_set_list l = *this;
+	for(i = 0; i < n; i++)
+	{
+		if(hit[i])
+			p[i] = l.set().prune(b);
+		else
+			p[i] = att_prune(set_nothing(), l.set(), b);
+		hit[i] = 1;
+		e[i].u = p[i].unique();
+		e[i].i = i;
+		l = l.next();
+	}
+
+// Drop the earlier of any sets that are the same
+
+	qsort(e, n, sizeof(prune_entry), prune_entry_cmp);
+	for(i = 0; i < n; i++)
+	{
+		for(j = i - 1; (j >= 0) && (e[j].u == e[i].u); j--)
+		{
+			if(p[e[j].i] == p[e[i].i])
+			{
+				hit[e[i].i] = 0;
+				break;
+			}
+		}
+	}
+
+// Lay out the result as the merges would have: the list so far is
+// reversed once for each set before it, so where the set goes
+// alternates between the two ends
+
+	sv_integer* pos = new sv_integer[2*n + 1];
+	sv_integer front = n;
+	sv_integer back = n;
+	for(i = n - 1; i >= 0; i--)
+	{
+		if(!hit[i]) continue;
+		if((n - 1 - i) & 1)
+			pos[back++] = i;
+		else
+			pos[--front] = i;
+	}
+	k = back - front;
+
+	sv_set_list result;
+	int reversed = (int)((n - 1) & 1);
+	for(j = 0; j < k; j++)
+	{
+		i = reversed ? pos[front + j] : pos[back - 1 - j];
+		result = sv_set_list(p[i], result);
+	}
+	if(ix.exists() && index_min && (k >= index_min))
+	{
+		sv_smart_ptr<sv_box_index> rx = new sv_box_index(ix->region(), k);
+		for(j = 0; j < k; j++)
+			rx->item(j, *ix, reversed ? pos[back - 1 - j] : pos[front + j]);
+		rx->make_tree();
+		result.set_list_info->index = rx;
+	}
+
+	delete [] hit;
+	delete [] p;
+	delete [] e;
+	delete [] pos;
+	return(result);
+}
+
+// Chains of unions or intersections shorter than this aren't rebuilt,
+// and this is how many times boxes are bisected to find the bounds
+// used to group a chain's operands
+
+#define SV_BALANCE_MIN 8
+#define SV_BALANCE_DEPTH 9
+
+// Build a balanced tree over s[0...n-1] with operator op.  The new
+// nodes have no attributes; the operands keep theirs.  If the
+// operands' bounds in box b are given (in sb[]) each new node is given
+// its own, and they are returned in bound.
+
+sv_set sv_set::balance_tree(const sv_set* s, const sv_box* sb, sv_integer n, 
+	set_op op, const sv_box& b, sv_box* bound)
+{
+	if(n == 1)
+	{
+		if(sb) *bound = sb[0];
+		return(s[0]);
+	}
+	sv_integer h = n/2;
+	sv_box b_1, b_2;
+	sv_set c_1 = balance_tree(s, sb, h, op, b, &b_1);
+	sv_set c_2 = balance_tree(&s[h], sb ? &sb[h] : 0, n - h, op, b, &b_2);
+	sv_set c = sv_set(c_1, c_2, op);
+	if( (op == SV_INTERSECTION) && (c_1.flags() & SV_CV_POL) && (c_2.flags() & SV_CV_POL) )
+		c.set_flags_priv(SV_CV_POL);
+	if(sb)
+	{
+		*bound = (op == SV_UNION) ? (b_1 | b_2) : (b_1 & b_2);
+		c.set_info->bal = new sv_box[2];
+		c.set_info->bal[0] = b;
+		c.set_info->bal[1] = *bound;
+	}
+	return(c);
+}
+
+// Rebuild long chains of unions or intersections (such as come from
+// building a model up with s = s | part) as balanced trees, with
+// operands that are near each other in box b grouped together.
+// Nodes in a chain that have attributes of their own end the chain,
+// and the result has this set's attribute.  Sets with nothing to
+// rebuild are returned as they are.
+
+sv_set sv_set::balance(const sv_box& b) const
+{
+	if(contents() < 2) return(*this);
+
+	set_op o = op();
+
+// Flatten the chain without recursion; chains can be very deep
+
+	sv_integer max_ops = contents();
+	sv_set* ops = new sv_set[max_ops];
+	sv_set* stack = new sv_set[max_ops];
+	sv_integer n = 0;
+	sv_integer sp = 0;
+	sv_set x;
+	int changed = 0;
+
+	stack[sp++] = child_2();
+	stack[sp++] = child_1();
+	while(sp)
+	{
+		x = stack[--sp];
+		if( (x.contents() >= 2) && (x.op() == o) && !x.has_attribute() )
+		{
+			stack[sp++] = x.child_2();
+			stack[sp++] = x.child_1();
+		} else
+		{
+			ops[n] = x.balance(b);
+			if(ops[n] != x) changed = 1;
+			n++;
+		}
+	}
+	delete [] stack;
+
+	if( (n < SV_BALANCE_MIN) && !changed )
+	{
+		delete [] ops;
+		return(*this);
+	}
+
+// Group the operands by their bounds
+
+	sv_set* sorted = new sv_set[n];
+	sv_box* bounds = 0;
+	sv_integer i;
+	if(n >= SV_BALANCE_MIN)
+	{
+		sv_trace_span span("balance", n);
+		sv_smart_ptr<sv_box_index> ix = new sv_box_index(b, n);
+		sv_box* bound = new sv_box[n];
+		for(i = 0; i < n; i++)
+		{
+			set_bound(ops[i], b, SV_BALANCE_DEPTH, &bound[i]);
+			ix->item(i, bound[i]);
+		}
+		ix->make_tree();
+		sv_integer* order = new sv_integer[n];
+		ix->spatial_order(order);
+		bounds = new sv_box[n];
+		for(i = 0; i < n; i++) 
+		{
+			sorted[i] = ops[order[i]];
+			bounds[i] = bound[order[i]];
+		}
+		delete [] order;
+		delete [] bound;
+	} else
+	{
+		for(i = 0; i < n; i++) sorted[i] = ops[i];
+	}
+	delete [] ops;
+
+	sv_box all;
+	sv_set result = balance_tree(sorted, bounds, n, o, b, &all);
+	delete [] sorted;
+	delete [] bounds;
+
+	if(has_attribute()) result = result.attribute(attribute());
+	return(result);
+}
+
+// Balance all the sets in a list
+
+sv_set_list sv_set_list::balance(const sv_box& b) const
+{
+	sv_set_list result;
+	sv_set_list l = *this;
+	sv_integer n = count();
+	if(!n) return(result);
+
+	sv_set* s = new sv_set[n];
+	int changed = 0;
+	sv_integer i;
+	for(i = 0; i < n; i++)
+	{
+		s[i] = l.set().balance(b);
+		if(s[i] != l.set()) changed = 1;
+		l = l.next();
+	}
+	if(!changed)
+		result = *this;
+	else
+	{
+		result = sv_set_list(s[n - 1]);
+		for(i = n - 2; i >= 0; i--) result = sv_set_list(s[i], result);
+	}
+	delete [] s;
+	return(result);
+}
+
 // Return all the elements of a set list as a union or intersection
 
 sv_set sv_set_list::unite() const
@@ -98,8 +98,154 @@ sv_integer mist_active() { return mist_def; }
 static sv_integer debug = 0;
 static sv_surface stag;
 
+// The material table.  Each attribute chain that a hit set might have
+// has its surface found once, and the values shade() wants copied out
+// of it, so a hit costs a hash lookup on the chain's address.  The
+// chains are held by handle so that address can't be reused while
+// it's in the table.  Each render makes its own table before its
+// pixels are rendered and passes it down; it is only read while they
+// are, so the threads rendering them can share it, and two renders at
+// once don't touch each other's.
+
+struct shade_material
+{
+	sv_attribute a;
+	const sv_surface* surf;
+	sv_real diffuse_coeff;
+	sv_point diffuse_colour;
+	sv_real specular_coeff;
+	sv_point specular_colour;
+	sv_real specular_power;
+	sv_real transmission;
+	sv_integer shadow;
+	sv_integer mist;
+	sv_picture* texture;
+	sv_integer map_type;
+	sv_integer map_0_xmit;
+};
+
+struct sv_shade_materials
+{
+	key_table<shade_material> table;
+	shade_material none;		// For sets with no attributes
+};
+
+// Sets with no surface get this
+
+static sv_surface default_surface;
+
+// Copy the values shade() wants out of the surface on an attribute
+// chain (or out of the default surface if it hasn't one)
+
+static void fill_material(shade_material* m, const sv_attribute& a)
+{
+	const sv_surface* surf = &default_surface;
+	if(a.exists())
+	{
+		sv_attribute surf_attrib = a.tag_find(-stag.tag());
+		if(surf_attrib.exists())
+			surf = (sv_surface*)(surf_attrib.user_attribute()->pointer);
+	}
+	m->a = a;
+	m->surf = surf;
+	m->diffuse_coeff = surf->diffuse_coeff();
+	m->diffuse_colour = surf->diffuse_colour();
+	m->specular_coeff = surf->specular_coeff();
+	m->specular_colour = surf->specular_colour();
+	m->specular_power = surf->specular_angle_power();
+	m->transmission = surf->transmission();
+	m->shadow = surf->shadow();
+	m->mist = surf->mist();
+	m->texture = surf->texture();
+	m->map_type = surf->map_type();
+	m->map_0_xmit = surf->map_0_xmit();
+}
+
+// Find the material for an attribute chain.  One that isn't in the
+// table (because the model is paged, or the set was made while
+// tracing) has its material filled in m.
+
+static const shade_material* find_material(const sv_shade_materials* mats, 
+	const sv_attribute& a, shade_material* m)
+{
+	if(mats)
+	{
+		if(!a.exists()) return(&mats->none);
+		const shade_material* t = mats->table.find(a.unique());
+		if(t) return(t);
+	}
+	fill_material(m, a);
+	return(m);
+}
+
+static void add_material(sv_shade_materials* mats, const sv_attribute& a)
+{
+	if(!a.exists()) return;
+	int added;
+	shade_material* m = mats->table.add(a.unique(), &added);
+	if(added) fill_material(m, a);
+}
+
+static void add_set_materials(sv_shade_materials* mats, const sv_set& s)
+{
+	switch(s.contents())
+	{
+	case SV_EVERYTHING:
+	case SV_NOTHING:
+		return;
+
+	case 1:
+		add_material(mats, s.attribute());
+		return;
+
+	default:
+		add_set_materials(mats, s.child_1());
+		add_set_materials(mats, s.child_2());
+	}
+}
+
+static void add_model_materials(sv_shade_materials* mats, const sv_model& m)
+{
+	sv_set_list sl;
+
+	switch(m.kind())
+	{
+	case LEAF_M:
+		sl = m.set_list();
+		while(sl.exists())
+		{
+			add_set_materials(mats, sl.set());
+			sl = sl.next();
+		}
+		return;
+
+	default:
+		add_model_materials(mats, m.child_1());
+		add_model_materials(mats, m.child_2());
+	}
+}
+
+// Resolve the materials of all the leaf sets in a model before
+// rendering it (anything missed is looked up each time it's hit)
+
+sv_shade_materials* make_shade_materials(const sv_model& m)
+{
+	sv_shade_materials* mats = new sv_shade_materials;
+	fill_material(&mats->none, sv_attribute());
+	add_model_materials(mats, m);
+	return(mats);
+}
+
+// Get rid of a table, letting go of the attributes
+
+void drop_shade_materials(sv_shade_materials* mats)
+{
+	delete mats;
+}
+
 static void
-get_surface_attributes(const sv_set& hit_surface,
+get_surface_attributes(const sv_shade_materials* mats,
+		       const sv_set& hit_surface,
 		       const sv_point& hit_point,
 		       const sv_point& surface_normal,
 		       sv_real *diffuse_refl_coeff,
@@ -115,27 +261,21 @@ get_surface_attributes(const sv_set& hit_surface,
 // Get surface parameters from surface attribute
 
 
-   sv_attribute set_attribs = hit_surface.attribute();
-   sv_attribute surf_attrib;
-   sv_surface* surf;
-
-   if((surf_attrib = set_attribs.tag_find(-stag.tag())).exists())
-   {
-	surf = (sv_surface*)(surf_attrib.user_attribute()->pointer);
-   } else
-	surf = new sv_surface();
+   shade_material own;
+   const shade_material* m = find_material(mats, hit_surface.attribute(), &own);
+   const sv_surface* surf = m->surf;
 
 // Note defaults are from the sv_surface constructor
 
-   *diffuse_refl_coeff = surf->diffuse_coeff(); 
-   *diffuse_colour = surf->diffuse_colour();
-   *specular_refl_coeff = surf->specular_coeff();
-   *specular_colour = surf->specular_colour();
-   *specular_refl_exp = surf->specular_angle_power();
-   *transmission_coeff = surf->transmission();
-   *shad = surf->shadow();
-   *fog = surf->mist();
-   *texture = surf->texture();
+   *diffuse_refl_coeff = m->diffuse_coeff; 
+   *diffuse_colour = m->diffuse_colour;
+   *specular_refl_coeff = m->specular_coeff;
+   *specular_colour = m->specular_colour;
+   *specular_refl_exp = m->specular_power;
+   *transmission_coeff = m->transmission;
+   *shad = m->shadow;
+   *fog = m->mist;
+   *texture = m->texture;
 
    // If image has an image-map, overwrite the diffuse colour with one from the image
  
@@ -151,7 +291,7 @@ get_surface_attributes(const sv_set& hit_surface,
 
 	if((u < 0) || (u >= map_u_res))
 	{
-		if(surf->map_type() == SV_TILED)
+		if(m->map_type == SV_TILED)
 		{
 			while(u < 0) u += map_u_res; // Is this needed?
 			u = u % map_u_res;
@@ -161,7 +301,7 @@ get_surface_attributes(const sv_set& hit_surface,
 
 	if((v < 0) || (v >= map_v_res))
 	{
-		if(surf->map_type() == SV_TILED)
+		if(m->map_type == SV_TILED)
 		{
 			while(v < 0) v += map_v_res; // Is this needed?
 			v = v % map_v_res;
@@ -176,16 +316,16 @@ get_surface_attributes(const sv_set& hit_surface,
 
 // If it's (nearly) black and that means transparent...
 
-	if (surf->map_0_xmit() && (diffuse_colour->mod() < 0.001) )  // Hack
+	if (m->map_0_xmit && (diffuse_colour->mod() < 0.001) )  // Hack
 		*transmission_coeff = 1;
     }
 
 // Solid texture?
 
-    if(surf->map_type() == SV_SOLID_TEX)
+    if(m->map_type == SV_SOLID_TEX)
     {
 	get_solid_tex(hit_surface, *surf, hit_point, surface_normal, diffuse_colour);
-	if (surf->map_0_xmit() && (diffuse_colour->mod() < 0.001) )
+	if (m->map_0_xmit && (diffuse_colour->mod() < 0.001) )
 		*transmission_coeff = 1;
     }
 }
@@ -199,7 +339,8 @@ shade(const sv_model&  modl,
       const sv_view& view_params,
       const sv_light_list& light_list,
       const sv_real& attenuation,
-      const sv_real& dist)
+      const sv_real& dist,
+      const sv_shade_materials* mats)
 {
    // wot about over or under flows? ;
 
@@ -232,6 +373,11 @@ shade(const sv_model&  modl,
    sv_real t;
    sv_set hit_surf;
 
+   // Shadow and reflected rays go through the model's frozen copy
+   // (null if it has pages on disk)
+
+   sv_frozen_model frozen;
+
    sv_primitive prim = hit_surface.primitive();
    sv_point surface_normal = prim.grad(pnt);
    surface_normal = surface_normal.norm();				// Get surface normal vector at hit point
@@ -241,7 +387,7 @@ shade(const sv_model&  modl,
    
    // Get surface parameters from surface attribute
 
-   get_surface_attributes(hit_surface, pnt, surface_normal, &diffuse_refl_coeff, &diffuse_colour,
+   get_surface_attributes(mats, hit_surface, pnt, surface_normal, &diffuse_refl_coeff, &diffuse_colour,
 			  &specular_refl_coeff, &specular_colour, &specular_angle_power,
 			  &transmission_coeff, &shad, &fog, &tex);
 
@@ -298,15 +444,20 @@ shade(const sv_model&  modl,
 
       		interval = line_box(new_ray, modl.box()); 
       		if(interval.empty())
+		{
 	 	   svlis_error("shade()",
 			"Shadow ray does not intersect object-space",
 			SV_WARNING);
-	  	else 
+		   shad = 0;
+	  	} else 
 		{
 	 		if(interval.lo() < 0.0) interval = sv_interval(0.0, interval.hi());
-	 		hit_surf = modl.fire_ray(new_ray, interval, &t);
+			if(!frozen.exists()) frozen = modl.frozen();
+			if(frozen.exists())
+	 			shad = frozen.occluded(new_ray, interval);
+			else
+	 			shad = modl.occluded(new_ray, interval);
 		}
-	 	shad = hit_surf.exists();
 	}
       
       // Add in diffuse reflection contribution to colour
@@ -395,7 +546,11 @@ shade(const sv_model&  modl,
 	 	svlis_error("shade()","Reflected ray does not intersect object-space",SV_WARNING);
 	  else {
 	 if(interval.lo() < 0.0) interval = sv_interval(0.0, interval.hi());
-	 hit_surf = modl.fire_ray(new_ray, interval, &t);
+	 if(!frozen.exists()) frozen = modl.frozen();
+	 if(frozen.exists())
+	    hit_surf = frozen.fire_ray(new_ray, interval, &t);
+	 else
+	    hit_surf = modl.fire_ray(new_ray, interval, &t);
 	 
 	 if(hit_surf.exists()) {
 	    sv_point hit_point = line_point(new_ray,t);
@@ -404,7 +559,7 @@ shade(const sv_model&  modl,
 	       cout << " secondary ray hit: t = " << t << "\n";
 
 	    colour = colour + shade(modl, new_ray_dir, hit_surf, hit_point, 
-		view_params, light_list, attenuation*specular_refl_coeff,t);
+		view_params, light_list, attenuation*specular_refl_coeff, t, mats);
 	 } else {
 	    // Reflected ray misses
 	    colour = colour + attenuation*surroundings_colour(new_ray_dir);
@@ -457,7 +612,7 @@ shade(const sv_model&  modl,
 	 if(hit_surf.exists()) {
 	    sv_point hit_point = line_point(new_ray,t);
 	    colour = colour + shade(modl, new_ray_dir, hit_surf, hit_point, view_params, light_list,
-				    attenuation*specular_refl_coeff,t);
+				    attenuation*specular_refl_coeff, t, mats);
 	 }
       }
    }
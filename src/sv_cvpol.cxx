@@ -0,0 +1,421 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Convex polyhedra held as packed plane arrays
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#if macintosh
+ #pragma export on
+#endif
+
+// Relative tolerance for vertices, and for boxes being separated
+// from a polyhedron
+
+#define CV_TOL 1.0e-5
+
+// Can a set leaf be packed?
+
+int sv_cv_pol::packable(const sv_set& s)
+{
+	if(s.contents() != 1) return(0);
+	if(s.has_attribute()) return(0);
+	sv_primitive p = s.primitive();
+	if( (p.kind() == SV_PLANE) && (p.op() == SV_ZERO) ) return(1);
+	if( (p.kind() != SV_GENERAL) || (p.op() != SV_TIMES) ) return(0);
+	sv_primitive r = p.child_1();
+	sv_primitive f = p.child_2();
+	if(r.kind() != SV_REAL)
+	{
+		r = p.child_2();
+		f = p.child_1();
+	}
+	if( (r.kind() != SV_REAL) || (f.kind() != SV_PLANE) || (f.op() != SV_ZERO) ) 
+		return(0);
+	if(r.real() > 0) return(1);
+	if(r.real() < 0) return(-1);
+	return(0);
+}
+
+// The plane in a packable leaf (a constant times a plane has the same
+// sign as the plane, or its complement)
+
+static sv_plane cv_leaf_plane(const sv_set& s, int sign)
+{
+	sv_primitive p = s.primitive();
+	sv_plane f;
+	if(p.kind() == SV_PLANE)
+		f = p.plane();
+	else if(p.child_1().kind() == SV_PLANE)
+		f = p.child_1().plane();
+	else
+		f = p.child_2().plane();
+	if(sign < 0) f = -f;
+	return(f);
+}
+
+sv_cv_pol::sv_cv_pol(const sv_set* h, sv_integer count)
+{
+	sv_integer i;
+	sv_plane f;
+
+	n = count;
+	np = ((n + SV_CV_PACK - 1)/SV_CV_PACK)*SV_CV_PACK;
+	px = new sv_real[4*np];
+	py = px + np;
+	pz = py + np;
+	pd = pz + np;
+	leaf = new sv_set[n];
+	for(i = 0; i < n; i++)
+	{
+		leaf[i] = h[i];
+		f = cv_leaf_plane(h[i], packable(h[i]));
+		px[i] = f.normal.x;
+		py[i] = f.normal.y;
+		pz[i] = f.normal.z;
+		pd[i] = f.d;
+	}
+
+// The padding is inside everything
+
+	for(; i < np; i++)
+	{
+		px[i] = 0;
+		py[i] = 0;
+		pz[i] = 0;
+		pd[i] = -1;
+	}
+
+	nv = 0;
+	vert = 0;
+	ne = 0;
+	edge = 0;
+	find_vertices();
+}
+
+sv_cv_pol::~sv_cv_pol()
+{
+	delete [] px;
+	delete [] leaf;
+	delete [] vert;
+	delete [] edge;
+}
+
+sv_plane sv_cv_pol::plane(sv_integer i) const
+{
+	sv_plane f;
+	f.normal = sv_point(px[i], py[i], pz[i]);
+	f.d = pd[i];
+	return(f);
+}
+
+// Find the vertices and edge directions of the polyhedron, if it's
+// bounded.  It is unless its normals are all in one plane, or there's
+// a direction along two planes that goes inside all the others.
+
+void sv_cv_pol::find_vertices()
+{
+	sv_integer i, j, k, m, c, cnt;
+	double cx, cy, cz, det, x, y, z, v, len, tol;
+
+	if( (n < 4) || (n > SV_CV_MAX) ) return;
+
+	int rank_3 = 0;
+	for(i = 0; i < n; i++)
+	  for(j = i + 1; j < n; j++)
+	  {
+		cx = (double)py[i]*pz[j] - (double)pz[i]*py[j];
+		cy = (double)pz[i]*px[j] - (double)px[i]*pz[j];
+		cz = (double)px[i]*py[j] - (double)py[i]*px[j];
+		len = sqrt(cx*cx + cy*cy + cz*cz);
+		if(len < CV_TOL) continue;
+		for(c = -1; c <= 1; c += 2)
+		{
+			for(k = 0; k < n; k++)
+			{
+				if( (k == i) || (k == j) ) continue;
+				v = c*(cx*px[k] + cy*py[k] + cz*pz[k])/len;
+				if(v > CV_TOL) break;
+				if(v < -CV_TOL) rank_3 = 1;
+			}
+			if(k >= n) return;
+		}
+	  }
+	if(!rank_3) return;
+
+// Every three planes that cross in a point inside the rest give
+// a vertex; the mask says which planes each vertex is on
+
+	sv_point* vv = new sv_point[n*n*n/6 + 1];
+	unsigned long* on = new unsigned long[n*n*n/6 + 1];
+	double scale = 0;
+	for(i = 0; i < n; i++) 
+		if(fabs(pd[i]) > scale) scale = fabs(pd[i]);
+	tol = CV_TOL*(1 + scale);
+
+	for(i = 0; i < n; i++)
+	  for(j = i + 1; j < n; j++)
+	    for(k = j + 1; k < n; k++)
+	    {
+		cx = (double)py[j]*pz[k] - (double)pz[j]*py[k];
+		cy = (double)pz[j]*px[k] - (double)px[j]*pz[k];
+		cz = (double)px[j]*py[k] - (double)py[j]*px[k];
+		det = px[i]*cx + py[i]*cy + pz[i]*cz;
+		if(fabs(det) < CV_TOL) continue;
+		x = -pd[i]*cx;
+		y = -pd[i]*cy;
+		z = -pd[i]*cz;
+		cx = (double)py[k]*pz[i] - (double)pz[k]*py[i];
+		cy = (double)pz[k]*px[i] - (double)px[k]*pz[i];
+		cz = (double)px[k]*py[i] - (double)py[k]*px[i];
+		x -= pd[j]*cx;
+		y -= pd[j]*cy;
+		z -= pd[j]*cz;
+		cx = (double)py[i]*pz[j] - (double)pz[i]*py[j];
+		cy = (double)pz[i]*px[j] - (double)px[i]*pz[j];
+		cz = (double)px[i]*py[j] - (double)py[i]*px[j];
+		x = (x - pd[k]*cx)/det;
+		y = (y - pd[k]*cy)/det;
+		z = (z - pd[k]*cz)/det;
+
+		on[nv] = 0;
+		for(m = 0; m < n; m++)
+		{
+			v = px[m]*x + py[m]*y + pz[m]*z + pd[m];
+			if(v > tol) break;
+			if(v > -tol) on[nv] |= 1UL << m;
+		}
+		if(m < n) continue;
+		vv[nv++] = sv_point((sv_real)x, (sv_real)y, (sv_real)z);
+	    }
+
+	if(!nv)
+	{
+		delete [] vv;
+		delete [] on;
+		return;
+	}
+
+	vert = new sv_point[nv];
+	hull = sv_box(vv[0], vv[0]);
+	for(i = 0; i < nv; i++) 
+	{
+		vert[i] = vv[i];
+		hull = hull | sv_box(vv[i], vv[i]);
+	}
+
+// Two planes that share two vertices have an edge between them
+
+	edge = new sv_point[n*(n - 1)/2];
+	sv_point e;
+	for(i = 0; i < n; i++)
+	  for(j = i + 1; j < n; j++)
+	  {
+		cnt = 0;
+		for(m = 0; m < nv; m++)
+			if( (on[m] & (1UL << i)) && (on[m] & (1UL << j)) ) cnt++;
+		if(cnt < 2) continue;
+		e = sv_point(px[i], py[i], pz[i])^sv_point(px[j], py[j], pz[j]);
+		if(e.mod() < CV_TOL) continue;
+		e = e.norm();
+		for(m = 0; m < ne; m++)
+			if(fabs(e*edge[m]) > 1 - CV_TOL) break;
+		if(m >= ne) edge[ne++] = e;
+	  }
+
+	delete [] vv;
+	delete [] on;
+}
+
+// Membership test a point
+
+mem_test sv_cv_pol::member(const sv_point& p) const
+{
+	sv_real x = p.x, y = p.y, z = p.z, v;
+	int out = 0, surf = 0;
+
+	for(sv_integer i = 0; i < np; i++)
+	{
+		v = x*px[i] + y*py[i] + z*pz[i] + pd[i];
+		out |= (v > 0);
+		surf |= (v == 0);
+	}
+
+	if(out) return(SV_AIR);
+	if(surf) return(SV_SURFACE);
+	return(SV_SOLID);
+}
+
+// Classify a box
+
+sv_integer sv_cv_pol::box_test(const sv_box& b) const
+{
+	sv_real x0 = b.xi.lo(), x1 = b.xi.hi();
+	sv_real y0 = b.yi.lo(), y1 = b.yi.hi();
+	sv_real z0 = b.zi.lo(), z1 = b.zi.hi();
+	sv_real lo, hi;
+	sv_integer i, k, out = 0, in = 0;
+
+	for(i = 0; i < np; i++)
+	{
+		lo = ((px[i] > 0) ? x0*px[i] : x1*px[i]) +
+			((py[i] > 0) ? y0*py[i] : y1*py[i]) +
+			((pz[i] > 0) ? z0*pz[i] : z1*pz[i]) + pd[i];
+		hi = ((px[i] > 0) ? x1*px[i] : x0*px[i]) +
+			((py[i] > 0) ? y1*py[i] : y0*py[i]) +
+			((pz[i] > 0) ? z1*pz[i] : z0*pz[i]) + pd[i];
+		out += (lo > 0);
+		in += (hi < 0);
+	}
+
+	if(out) return(SV_AIR);
+	if(in == np) return(SV_SOLID);
+
+// No plane has the box all outside, but the polyhedron still may miss
+// it.  The planes' normals have been tried as separating axes, so if
+// it's bounded try its box, then the edges crossed with x, y and z.
+
+	if(nv)
+	{
+		sv_real gap = CV_TOL*(sqrt(hull.diag_sq()) + sqrt(b.diag_sq()));
+		if( (x0 > hull.xi.hi() + gap) || (x1 < hull.xi.lo() - gap) ||
+		    (y0 > hull.yi.hi() + gap) || (y1 < hull.yi.lo() - gap) ||
+		    (z0 > hull.zi.hi() + gap) || (z1 < hull.zi.lo() - gap) )
+			return(SV_AIR);
+
+		sv_point c = b.centroid();
+		sv_point h = sv_point(x1 - x0, y1 - y0, z1 - z0)*0.5;
+		sv_point ax;
+		sv_real r, p, plo, phi;
+		for(i = 0; i < ne; i++)
+		  for(k = 0; k < 3; k++)
+		  {
+			switch(k)
+			{
+			case 0: ax = sv_point(0, edge[i].z, -edge[i].y); break;
+			case 1: ax = sv_point(-edge[i].z, 0, edge[i].x); break;
+			default: ax = sv_point(edge[i].y, -edge[i].x, 0); break;
+			}
+			if(ax.mod() < CV_TOL) continue;
+			r = fabs(ax.x)*h.x + fabs(ax.y)*h.y + fabs(ax.z)*h.z;
+			p = ax*c;
+			plo = phi = ax*vert[0];
+			for(sv_integer m = 1; m < nv; m++)
+			{
+				sv_real q = ax*vert[m];
+				if(q < plo) plo = q;
+				if(q > phi) phi = q;
+			}
+			if( (p - r > phi + gap) || (p + r < plo - gap) ) return(SV_AIR);
+		  }
+	}
+
+	if(in == np - n) return(SV_SURFACE);
+	return(-1);
+}
+
+// Clip a line to the polyhedron; this does what intersecting the
+// rays' intervals for the planes one by one does
+
+int sv_cv_pol::clip(const sv_line& l, sv_real big, sv_interval* t, sv_set* s_lo, 
+		    sv_set* s_hi) const
+{
+	sv_real lo = -big, hi = big;
+	sv_real num, denom, tt;
+	sv_set no_set;
+	*s_lo = no_set;
+	*s_hi = no_set;
+
+	for(sv_integer i = 0; i < n; i++)
+	{
+		num = l.origin.x*px[i] + l.origin.y*py[i] + l.origin.z*pz[i] + pd[i];
+		denom = px[i]*l.direction.x + py[i]*l.direction.y + pz[i]*l.direction.z;
+		if(denom == 0.0)
+		{
+			if(num < 0.0) continue;
+			return(0);
+		}
+		tt = -num/denom;
+		if( (num > 0.0) == (tt > 0.0) )
+		{
+			if(tt > lo)
+			{
+				lo = tt;
+				*s_lo = leaf[i];
+			}
+		} else
+		{
+			if(tt < hi)
+			{
+				hi = tt;
+				*s_hi = leaf[i];
+			}
+		}
+	}
+
+	if(lo >= hi) return(0);
+	*t = sv_interval(lo, hi);
+	return(1);
+}
+
+// Heap bytes used
+
+long sv_cv_pol::bytes() const
+{
+	return( (long)sizeof(sv_cv_pol) + (long)(4*np)*(long)sizeof(sv_real) + 
+		(long)n*(long)sizeof(sv_set) + (long)(nv + n*(n - 1)/2)*(long)sizeof(sv_point) );
+}
+
+#if macintosh
+ #pragma export off
+#endif
@@ -0,0 +1,427 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Rendering pictures with a farm of worker processes
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#ifdef SV_UNIX
+ #include <sys/socket.h>
+ #include <sys/wait.h>
+ #include <poll.h>
+ #include <errno.h>
+#endif
+#if macintosh
+ #pragma export on
+#endif
+
+static sv_integer farm_tile = SV_FARM_TILE;
+
+void set_farm_tile(sv_integer t) { farm_tile = max((sv_integer)1, t); }
+sv_integer get_farm_tile() { return(farm_tile); }
+
+// Progress reports that go nowhere
+
+static void farm_no_report(sv_real) { ; }
+
+#ifdef SV_UNIX
+
+// A tile, how many workers are rendering it, and whether it's back
+
+struct farm_job
+{
+	int x0, y0, x1, y1;
+	sv_integer out;
+	sv_integer done;
+};
+
+// A worker, and the tile it's doing (-1 if none)
+
+struct farm_worker
+{
+	pid_t pid;
+	int fd;
+	sv_integer job;
+};
+
+// Send or receive exactly n bytes; these return 0 if the other end
+// has gone
+
+static int farm_write(int fd, const void* b, size_t n)
+{
+	const char* p = (const char*)b;
+	while(n)
+	{
+		ssize_t k = write(fd, p, n);
+		if(k < 0)
+		{
+			if(errno == EINTR) continue;
+			return(0);
+		}
+		p += k;
+		n -= k;
+	}
+	return(1);
+}
+
+static int farm_read(int fd, void* b, size_t n)
+{
+	char* p = (char*)b;
+	while(n)
+	{
+		ssize_t k = read(fd, p, n);
+		if(k < 0)
+		{
+			if(errno == EINTR) continue;
+			return(0);
+		}
+		if(!k) return(0);
+		p += k;
+		n -= k;
+	}
+	return(1);
+}
+
+// What a worker does: render the tiles it's sent until it's sent one
+// with a negative corner (or the coordinator goes away).  A tile is
+// returned as its corners followed by its pixels, row by row.
+
+static void farm_work(int fd, const sv_model& m, const sv_frozen_model& f,
+	const sv_shade_materials* mats, const sv_view& v, const sv_light_list& l, sv_picture& pic)
+{
+	int tile[4];
+	GLubyte* buf = new GLubyte[3*farm_tile*farm_tile];
+	sv_integer b, x, y;
+	sv_pixel p;
+
+	while(farm_read(fd, tile, sizeof(tile)) && (tile[0] >= 0))
+	{
+		generate_picture_tile(m, f, mats, v, l, pic, tile[0], tile[1], tile[2], tile[3]);
+		b = 0;
+		for(y = tile[1]; y < tile[3]; y++)
+		   for(x = tile[0]; x < tile[2]; x++)
+		   {
+			p = pic.pixel(x, y);
+			buf[b++] = p.r;
+			buf[b++] = p.g;
+			buf[b++] = p.b;
+		   }
+		if(!farm_write(fd, tile, sizeof(tile))) break;
+		if(!farm_write(fd, buf, b)) break;
+	}
+	delete [] buf;
+}
+
+// The next tile to give out: first any that a dead worker dropped,
+// then ones not yet started, then a copy of one that only one worker
+// has.  -1 if there's nothing useful to do.
+
+static sv_integer farm_next(farm_job* job, sv_integer jobs, sv_integer* next)
+{
+	sv_integer j;
+
+	for(j = 0; j < *next; j++)
+		if(!job[j].done && !job[j].out) return(j);
+	if(*next < jobs) return((*next)++);
+	for(j = 0; j < jobs; j++)
+		if(!job[j].done && (job[j].out == 1)) return(j);
+	return(-1);
+}
+
+// Give a worker a tile (or nothing)
+
+static void farm_give(farm_worker* w, farm_job* job, sv_integer j)
+{
+	w->job = j;
+	if(j < 0) return;
+	job[j].out++;
+
+// If this fails the worker will be seen to have died when it's polled
+
+	farm_write(w->fd, &job[j].x0, 4*sizeof(int));
+}
+
+// A worker has gone; what it was doing needs doing again
+
+static void farm_lost(farm_worker* w, farm_job* job)
+{
+	if(w->job >= 0) job[w->job].out--;
+	w->job = -1;
+	close(w->fd);
+	w->fd = -1;
+	svlis_error("generate_picture_farm", "a worker has died", SV_WARNING);
+}
+
+#endif
+
+sv_integer
+generate_picture_farm(const sv_model& modl,
+		 const sv_view& view_params,
+		 const sv_light_list& light_list,
+		 sv_picture& picture_params,
+		 sv_integer workers,
+		 sv_real progress_report_step,
+		 void report_procedure(sv_real percent))
+{
+#ifndef SV_UNIX
+	return(generate_picture(modl, view_params, light_list, picture_params,
+		progress_report_step, report_procedure));
+#else
+	if(workers < 1)
+		return(generate_picture(modl, view_params, light_list, picture_params,
+			progress_report_step, report_procedure));
+
+	sv_trace_span span("generate_picture_farm");
+	sv_integer x_res = picture_params.x_resolution();
+	sv_integer y_res = picture_params.y_resolution();
+	sv_integer jobs, j, k, i, left, alive, next, b, x, y;
+	int sv[2];
+
+// Cut the picture into tiles
+
+	sv_integer tx = (x_res + farm_tile - 1)/farm_tile;
+	sv_integer ty = (y_res + farm_tile - 1)/farm_tile;
+	jobs = tx*ty;
+	if(!jobs) return(1);
+	farm_job* job = new farm_job[jobs];
+	j = 0;
+	for(y = 0; y < ty; y++)
+	   for(x = 0; x < tx; x++)
+	   {
+		job[j].x0 = x*farm_tile;
+		job[j].y0 = y*farm_tile;
+		job[j].x1 = min(x_res, (x + 1)*farm_tile);
+		job[j].y1 = min(y_res, (y + 1)*farm_tile);
+		job[j].out = 0;
+		job[j].done = 0;
+		j++;
+	   }
+
+// Everything the workers need is made before they are forked (as in
+// generate_picture(), not for a model with pages on disk)
+
+	sv_frozen_model frozen;
+	sv_shade_materials* mats = 0;
+	if(!(modl.flags() & SV_PAGE_FLAG))
+	{
+		frozen = modl.frozen();
+		mats = make_shade_materials(modl);
+	}
+	cout.flush();
+	cerr.flush();
+	void (*old_pipe)(int) = signal(SIGPIPE, SIG_IGN);
+
+	farm_worker* w = new farm_worker[workers];
+	alive = 0;
+	for(i = 0; i < workers; i++)
+	{
+		w[i].pid = -1;
+		w[i].fd = -1;
+		w[i].job = -1;
+		if(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0)
+		{
+			svlis_error("generate_picture_farm", "can't make a socket pair", SV_WARNING);
+			continue;
+		}
+		w[i].pid = fork();
+		if(w[i].pid < 0)
+		{
+			svlis_error("generate_picture_farm", "can't fork a worker", SV_WARNING);
+			close(sv[0]);
+			close(sv[1]);
+			continue;
+		}
+		if(!w[i].pid)
+		{
+
+// This is the worker; it mustn't hold the other workers' sockets
+// open, and it leaves without running any of the coordinator's exit
+// code
+
+			close(sv[0]);
+			for(k = 0; k < i; k++)
+				if(w[k].fd >= 0) close(w[k].fd);
+			farm_work(sv[1], modl, frozen, mats, view_params, light_list, 
+				picture_params);
+			_exit(0);
+		}
+		close(sv[1]);
+		w[i].fd = sv[0];
+		alive++;
+	}
+
+// Give everyone something to do, then hand out tiles as they come back
+
+	next = 0;
+	left = jobs;
+	for(i = 0; i < workers; i++)
+		if(w[i].fd >= 0) farm_give(&w[i], job, farm_next(job, jobs, &next));
+
+	struct pollfd* pf = new struct pollfd[workers];
+	sv_integer* pw = new sv_integer[workers];
+	GLubyte* buf = new GLubyte[3*farm_tile*farm_tile];
+	int tile[4];
+	sv_pixel p;
+	sv_integer n, report_step = max((sv_integer)1, (sv_integer)(jobs*progress_report_step/100.0));
+
+	while(left && alive)
+	{
+		n = 0;
+		for(i = 0; i < workers; i++)
+		{
+			if(w[i].fd < 0) continue;
+
+// A worker that failed to take a tile will show up here as closed
+
+			if(w[i].job < 0) farm_give(&w[i], job, farm_next(job, jobs, &next));
+			if(w[i].job < 0) continue;
+			pf[n].fd = w[i].fd;
+			pf[n].events = POLLIN;
+			pf[n].revents = 0;
+			pw[n++] = i;
+		}
+		if(!n) break;
+		if(poll(pf, n, -1) < 0)
+		{
+			if(errno == EINTR) continue;
+			svlis_error("generate_picture_farm", "poll failed", SV_WARNING);
+			break;
+		}
+		for(k = 0; k < n; k++)
+		{
+			if(!pf[k].revents) continue;
+			i = pw[k];
+			j = w[i].job;
+			if( !farm_read(w[i].fd, tile, sizeof(tile)) || (tile[0] != job[j].x0) ||
+			    (tile[1] != job[j].y0) || (tile[2] != job[j].x1) || (tile[3] != job[j].y1) ||
+			    !farm_read(w[i].fd, buf, 3*(job[j].x1 - job[j].x0)*(job[j].y1 - job[j].y0)) )
+			{
+				farm_lost(&w[i], job);
+				alive--;
+				continue;
+			}
+			job[j].out--;
+			w[i].job = -1;
+			if(job[j].done) continue;	// Someone else's copy was first
+			b = 0;
+			for(y = job[j].y0; y < job[j].y1; y++)
+			   for(x = job[j].x0; x < job[j].x1; x++)
+			   {
+				p.r = buf[b++];
+				p.g = buf[b++];
+				p.b = buf[b++];
+				picture_params.pixel(x, y, p);
+			   }
+			job[j].done = 1;
+			left--;
+			if(!((jobs - left)%report_step))
+				report_procedure(100.0*(sv_real)(jobs - left)/(sv_real)jobs);
+		}
+	}
+
+// Anything the workers couldn't do is done here
+
+	if(left)
+	{
+		svlis_error("generate_picture_farm", 
+			"the workers failed; finishing the picture here", SV_WARNING);
+		for(j = 0; j < jobs; j++)
+			if(!job[j].done)
+				generate_picture_tile(modl, frozen, mats, view_params, 
+					light_list, picture_params, job[j].x0, job[j].y0, 
+					job[j].x1, job[j].y1);
+	}
+
+// Stop the workers; those still on a copy of a finished tile are killed
+
+	tile[0] = tile[1] = tile[2] = tile[3] = -1;
+	for(i = 0; i < workers; i++)
+	{
+		if(w[i].fd >= 0)
+		{
+			if(w[i].job >= 0)
+				kill(w[i].pid, SIGKILL);
+			else
+				farm_write(w[i].fd, tile, sizeof(tile));
+			close(w[i].fd);
+		}
+		if(w[i].pid > 0)
+			while( (waitpid(w[i].pid, 0, 0) < 0) && (errno == EINTR) );
+	}
+
+	signal(SIGPIPE, old_pipe);
+	drop_shade_materials(mats);
+	delete [] buf;
+	delete [] pw;
+	delete [] pf;
+	delete [] w;
+	delete [] job;
+	report_procedure(100.0);
+	return(1);
+#endif
+}
+
+sv_integer
+generate_picture_farm(const sv_model& modl,
+		 const sv_view& view_params,
+		 const sv_light_list& light_list,
+		 sv_picture& picture_params,
+		 sv_integer workers)
+{
+	return(generate_picture_farm(modl, view_params, light_list, picture_params,
+		workers, 0, farm_no_report));
+}
+
+#if macintosh
+ #pragma export off
+#endif
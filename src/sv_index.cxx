@@ -0,0 +1,281 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Bounding-box index over the sets in a set list
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#if macintosh
+ #pragma export on
+#endif
+
+// Item i's centre along axis a (0, 1, 2)
+
+static inline sv_real centre(const sv_real* lim, sv_integer i, sv_integer a)
+{
+	return(lim[6*i + 2*a] + lim[6*i + 2*a + 1]);
+}
+
+// Do two sets of limits overlap?
+
+static inline int overlap(const sv_real* a, const sv_real* b)
+{
+	return( (a[0] <= b[1]) && (b[0] <= a[1]) &&
+		(a[2] <= b[3]) && (b[2] <= a[3]) &&
+		(a[4] <= b[5]) && (b[4] <= a[5]) );
+}
+
+// Make an index with all its items empty
+
+sv_box_index::sv_box_index(const sv_box& r, sv_integer n)
+{
+	reg = r;
+	items = n;
+	lim = new sv_real[6*n];
+	order = new sv_integer[n];
+	node = 0;
+	nodes = 0;
+	filled = 0;
+	for(sv_integer i = 0; i < n; i++)
+	{
+		lim[6*i] = lim[6*i + 2] = lim[6*i + 4] = 1;
+		lim[6*i + 1] = lim[6*i + 3] = lim[6*i + 5] = 0;
+	}
+}
+
+// Record the bounds of item i; empty boxes are left empty
+
+void sv_box_index::item(sv_integer i, const sv_box& b)
+{
+	if( (i < 0) || (i >= items) )
+	{
+		svlis_error("sv_box_index::item", "item number out of range", SV_WARNING);
+		return;
+	}
+	if(b.xi.empty() || b.yi.empty() || b.zi.empty()) return;
+	sv_real* l = &lim[6*i];
+	l[0] = b.xi.lo(); l[1] = b.xi.hi();
+	l[2] = b.yi.lo(); l[3] = b.yi.hi();
+	l[4] = b.zi.lo(); l[5] = b.zi.hi();
+}
+
+void sv_box_index::item(sv_integer i, const sv_box_index& from, sv_integer j)
+{
+	if( (i < 0) || (i >= items) || (j < 0) || (j >= from.items) )
+	{
+		svlis_error("sv_box_index::item", "item number out of range", SV_WARNING);
+		return;
+	}
+	for(sv_integer k = 0; k < 6; k++) lim[6*i + k] = from.lim[6*j + k];
+}
+
+// Build the subtree over order[first...first+count-1] at the next
+// free node, splitting at the median item centre along the longest
+// axis of the centres' spread.  Returns the node's number.
+
+sv_integer sv_box_index::build(sv_integer first, sv_integer count)
+{
+	sv_integer me = nodes++;
+	index_node* n = &node[me];
+	sv_integer i, j, k;
+	sv_real* l;
+
+	sv_real clo[3], chi[3];
+	l = &lim[6*order[first]];
+	for(k = 0; k < 3; k++)
+	{
+		n->lim[2*k] = l[2*k];
+		n->lim[2*k + 1] = l[2*k + 1];
+		clo[k] = chi[k] = centre(lim, order[first], k);
+	}
+	for(i = first + 1; i < first + count; i++)
+	{
+		l = &lim[6*order[i]];
+		for(k = 0; k < 3; k++)
+		{
+			n->lim[2*k] = min(n->lim[2*k], l[2*k]);
+			n->lim[2*k + 1] = max(n->lim[2*k + 1], l[2*k + 1]);
+			clo[k] = min(clo[k], centre(lim, order[i], k));
+			chi[k] = max(chi[k], centre(lim, order[i], k));
+		}
+	}
+
+	if(count <= SV_INDEX_LEAF)
+	{
+		n->first = first;
+		n->count = count;
+		return(me);
+	}
+
+	sv_integer a = 0;
+	if(chi[1] - clo[1] > chi[a] - clo[a]) a = 1;
+	if(chi[2] - clo[2] > chi[a] - clo[a]) a = 2;
+
+// Quickselect the median along axis a
+
+	sv_integer mid = first + count/2;
+	sv_integer lo = first;
+	sv_integer hi = first + count - 1;
+	sv_integer t;
+	sv_real pivot;
+	while(lo < hi)
+	{
+		pivot = centre(lim, order[(lo + hi)/2], a);
+		i = lo;
+		j = hi;
+		while(i <= j)
+		{
+			while(centre(lim, order[i], a) < pivot) i++;
+			while(centre(lim, order[j], a) > pivot) j--;
+			if(i <= j)
+			{
+				t = order[i];
+				order[i] = order[j];
+				order[j] = t;
+				i++;
+				j--;
+			}
+		}
+		if(mid <= j)
+			hi = j;
+		else if(mid >= i)
+			lo = i;
+		else
+			break;
+	}
+
+	n->first = -1;
+	build(first, mid - first);
+	t = build(mid, first + count - mid);
+	node[me].count = t;
+	return(me);
+}
+
+// Build the tree over the non-empty items
+
+void sv_box_index::make_tree()
+{
+	filled = 0;
+	for(sv_integer i = 0; i < items; i++)
+		if(lim[6*i] <= lim[6*i + 1]) order[filled++] = i;
+
+	delete [] node;
+	node = new index_node[2*filled + 1];
+	nodes = 0;
+	if(filled) build(0, filled);
+}
+
+// The items in tree-leaf order, then the empty ones
+
+void sv_box_index::spatial_order(sv_integer* o) const
+{
+	sv_integer i, k;
+	for(i = 0; i < filled; i++) o[i] = order[i];
+	k = filled;
+	for(i = 0; i < items; i++)
+		if(lim[6*i] > lim[6*i + 1]) o[k++] = i;
+}
+
+// Mark all the items whose bounds overlap a box
+
+sv_integer sv_box_index::query(const sv_box& b, char* hit) const
+{
+	if(!nodes) return(0);
+
+	sv_real q[6];
+	q[0] = b.xi.lo(); q[1] = b.xi.hi();
+	q[2] = b.yi.lo(); q[3] = b.yi.hi();
+	q[4] = b.zi.lo(); q[5] = b.zi.hi();
+
+	sv_integer stack[64];
+	sv_integer sp = 0;
+	sv_integer found = 0;
+	sv_integer i, it;
+	const index_node* n;
+
+	stack[sp++] = 0;
+	while(sp)
+	{
+		n = &node[stack[--sp]];
+		if(!overlap(n->lim, q)) continue;
+		if(n->first >= 0)
+		{
+			for(i = n->first; i < n->first + n->count; i++)
+			{
+				it = order[i];
+				if(overlap(&lim[6*it], q))
+				{
+					hit[it] = 1;
+					found++;
+				}
+			}
+		} else
+		{
+			stack[sp++] = n->count;
+			stack[sp++] = (sv_integer)(n - node) + 1;
+		}
+	}
+	return(found);
+}
+
+// Heap bytes used by an index
+
+long sv_box_index::bytes() const
+{
+	return( (long)sizeof(sv_box_index) + (long)(6*items)*(long)sizeof(sv_real) +
+		(long)items*(long)sizeof(sv_integer) + (long)(2*items + 1)*(long)sizeof(index_node) );
+}
+
+#if macintosh
+ #pragma export off
+#endif
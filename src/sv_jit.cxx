@@ -0,0 +1,665 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Compiling primitives and sets to native code
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#include <string.h>
+#ifdef SV_UNIX
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#if macintosh
+ #pragma export on
+#endif
+
+// Settings
+
+static sv_integer jit_on = 1;
+static char* jit_cc = 0;
+static char* jit_dir = 0;
+
+static char* jit_copy(const char* s)
+{
+	char* c = new char[strlen(s) + 1];
+	strcpy(c, s);
+	return(c);
+}
+
+void set_jit(sv_integer j) { jit_on = j; }
+sv_integer get_jit() { return(jit_on); }
+
+void set_jit_compiler(const char* c)
+{
+	delete [] jit_cc;
+	jit_cc = jit_copy(c);
+}
+
+const char* get_jit_compiler() { return(jit_cc ? jit_cc : "c++"); }
+
+void set_jit_cache(const char* d)
+{
+	delete [] jit_dir;
+	jit_dir = jit_copy(d);
+}
+
+// Only one thread compiles (or finds the cache) at a time
+
+static sv_lock& jit_lock()
+{
+	static sv_lock* l = new sv_lock;
+	return(*l);
+}
+
+// The default cache belongs to the user: svlis_jit in their cache
+// directory or, if they haven't got one, a new directory in /tmp
+// that no one else can get at.  "" if there's nowhere.
+
+static char* jit_default = 0;
+
+static char* jit_default_cache()
+{
+#ifdef SV_UNIX
+	string d;
+	const char* x = getenv("XDG_CACHE_HOME");
+	const char* h = getenv("HOME");
+	if(x && *x)
+		d = x;
+	else if(h && *h)
+		d = string(h) + "/.cache";
+	if(d.length())
+	{
+		mkdir(d.c_str(), 0700);
+		return(jit_copy((d + "/svlis_jit").c_str()));
+	}
+	char t[] = "/tmp/svlis_jit_XXXXXX";
+	if(mkdtemp(t)) return(jit_copy(t));
+#endif
+	return(jit_copy(""));
+}
+
+// The cache directory; the lock must be shut
+
+static const char* jit_cache_dir()
+{
+	if(jit_dir) return(jit_dir);
+	const char* e = getenv("SVLIS_JIT_CACHE");
+	if(e) return(e);
+	if(!jit_default) jit_default = jit_default_cache();
+	return(jit_default);
+}
+
+const char* get_jit_cache()
+{
+	jit_lock().shut();
+	const char* d = jit_cache_dir();
+	jit_lock().open();
+	return(d);
+}
+
+// Evaluate part of a primitive that wasn't turned into code
+
+static double jit_callback(void* l, long i, double x, double y, double z)
+{
+	return( ((sv_primitive*)l)[i].value(sv_point(x, y, z)) );
+}
+
+// Table from record pointers to the temporaries that hold their
+// values, so shared parts are only evaluated once
+
+class jit_memo
+{
+	key_table<sv_integer> t;
+
+public:
+
+	void clear() { t.clean(); }
+
+	sv_integer find(long k) const
+	{
+		sv_integer* v = t.find(k);
+		return(v ? *v : -1);
+	}
+
+	void add(long k, sv_integer v)
+	{
+		int added;
+		*(t.add(k, &added)) = v;
+	}
+};
+
+// The code generator.  Each node becomes one line assigning a
+// temporary.
+
+class jit_gen
+{
+public:
+	ostringstream code;
+	jit_memo memo;
+	sv_integer temps;
+	sv_primitive* leaf;
+	sv_integer leaves;
+	sv_integer leaf_max;
+
+	jit_gen()
+	{
+		code.precision(17);
+		temps = 0;
+		leaves = 0;
+		leaf_max = 16;
+		leaf = new sv_primitive[leaf_max];
+	}
+
+	~jit_gen() { delete [] leaf; }
+
+// Start a new function (the leaf numbers carry on)
+
+	void restart()
+	{
+		memo.clear();
+		temps = 0;
+	}
+
+// Open a new temporary and return its number
+
+	sv_integer line()
+	{
+		code << "\tsv_real t" << temps << " = ";
+		return(temps++);
+	}
+
+	sv_integer callback(const sv_primitive&);
+	sv_integer prim(const sv_primitive&);
+	sv_integer set(const sv_set&);
+
+// Hand over the leaves
+
+	sv_primitive* take_leaves()
+	{
+		sv_primitive* l = leaf;
+		leaf = 0;
+		return(l);
+	}
+};
+
+// A part for the interpreter
+
+sv_integer jit_gen::callback(const sv_primitive& p)
+{
+	if(leaves >= leaf_max)
+	{
+		sv_primitive* nl = new sv_primitive[2*leaf_max];
+		for(sv_integer i = 0; i < leaves; i++) nl[i] = leaf[i];
+		delete [] leaf;
+		leaf = nl;
+		leaf_max = 2*leaf_max;
+	}
+	leaf[leaves] = p;
+	sv_integer t = line();
+	code << "(sv_real)fb(l, " << leaves << ", x, y, z);\n";
+	leaves++;
+	return(t);
+}
+
+// The code for a primitive; this follows sv_primitive::value()
+
+sv_integer jit_gen::prim(const sv_primitive& p)
+{
+	sv_integer t = memo.find(p.unique());
+	if(t >= 0) return(t);
+
+	sv_integer a, b, k, n;
+	sv_plane f;
+
+	k = p.kind();
+	switch(k)
+	{
+	case SV_REAL:
+		t = line();
+		code << "(" << p.real() << ");\n";
+		break;
+
+	case SV_PLANE:
+		if(p.op() == SV_ZERO)
+		{
+			f = p.plane();
+			t = line();
+			code << "x*(sv_real)(" << f.normal.x << ") + y*(sv_real)(" << f.normal.y << 
+				") + z*(sv_real)(" << f.normal.z << ") + (sv_real)(" << f.d << ");\n";
+			break;
+		}
+		// Falls through - planes made by operators are done as the other kinds
+
+	case SV_CYLINDER:
+	case SV_SPHERE:
+	case SV_CONE:
+	case SV_TORUS:
+	case SV_CYCLIDE:
+	case SV_GENERAL:
+		switch(p.op())
+		{
+		case SV_PLUS:
+		case SV_MINUS:
+		case SV_TIMES:
+		case SV_DIVIDE:
+			a = prim(p.child_1());
+			b = prim(p.child_2());
+			t = line();
+			code << "t" << a;
+			switch(p.op())
+			{
+			case SV_PLUS: code << " + "; break;
+			case SV_MINUS: code << " - "; break;
+			case SV_TIMES: code << "*"; break;
+			default: code << "/";
+			}
+			code << "t" << b << ";\n";
+			break;
+
+		case SV_POW:
+			a = prim(p.child_1());
+			n = sv_round(p.child_2().real());
+			t = line();
+			code << "(sv_real)pow(t" << a << ", " << n << ");\n";
+			break;
+
+		case SV_COMP:
+			a = prim(p.child_1());
+			t = line();
+			code << "-t" << a << ";\n";
+			break;
+
+		case SV_ABS:
+			a = prim(p.child_1());
+			t = line();
+			code << "fabs(t" << a << ");\n";
+			break;
+
+		case SV_SIN:
+		case SV_COS:
+		case SV_EXP:
+			a = prim(p.child_1());
+			t = line();
+			code << ((p.op() == SV_SIN) ? "(sv_real)sin" : ((p.op() == SV_COS) ? "(sv_real)cos" : "(sv_real)exp")) <<
+				"(t" << a << ");\n";
+			break;
+
+		case SV_SSQRT:
+			a = prim(p.child_1());
+			t = line();
+			code << "(t" << a << " < 0) ? (sv_real)-sqrt(-t" << a << ") : (sv_real)sqrt(t" << a << ");\n";
+			break;
+
+		case SV_SIGN:
+			a = prim(p.child_1());
+			t = line();
+			code << "(t" << a << " > 0) ? 1.0 : -1.0;\n";
+			break;
+
+		default:
+			t = callback(p);
+		}
+		break;
+
+	default:
+		t = callback(p);
+	}
+
+	memo.add(p.unique(), t);
+	return(t);
+}
+
+// The code for a set; this follows sv_set::value()
+
+sv_integer jit_gen::set(const sv_set& s)
+{
+	sv_integer t = memo.find(s.unique());
+	if(t >= 0) return(t);
+
+	sv_integer a, b;
+
+	switch(s.contents())
+	{
+	case SV_EVERYTHING:
+		t = line();
+		code << "-1;\n";
+		break;
+
+	case SV_NOTHING:
+		t = line();
+		code << "1;\n";
+		break;
+
+	case 1:
+		t = prim(s.primitive());
+		break;
+
+	default:
+		a = set(s.child_1());
+		b = set(s.child_2());
+		t = line();
+		if(s.op() == SV_UNION)
+			code << "(t" << a << " > t" << b << ") ? t" << b << " : t" << a << ";\n";
+		else
+			code << "(t" << a << " < t" << b << ") ? t" << b << " : t" << a << ";\n";
+	}
+
+	memo.add(s.unique(), t);
+	return(t);
+}
+
+// The start of each generated file.  The arithmetic is done in
+// sv_real, as the interpreter does it, so the answers agree.
+
+static string jit_head()
+{
+	string h = "// Generated by svLis - do not edit\n\n"
+		"#include <math.h>\n\n"
+		"typedef double (*sv_jit_callback)(void*, long, double, double, double);\n";
+	h = h + "typedef " + ((sizeof(sv_real) == sizeof(float)) ? "float" : "double") + 
+		" sv_real;\n\n";
+	return(h);
+}
+
+// The arguments of each generated function, and its first lines
+
+static const char* jit_args = "double px, double py, double pz";
+static const char* jit_cb = "void* l, sv_jit_callback fb";
+static const char* jit_start = 
+	"\tsv_real x = (sv_real)px;\n\tsv_real y = (sv_real)py;\n\tsv_real z = (sv_real)pz;\n";
+
+// 64-bit FNV-1a hash of a string
+
+static unsigned long long jit_hash(const string& s)
+{
+	unsigned long long h = 14695981039346656037ULL;
+	for(size_t i = 0; i < s.length(); i++)
+	{
+		h = h ^ (unsigned char)s[i];
+		h = h*1099511628211ULL;
+	}
+	return(h);
+}
+
+#ifdef SV_UNIX
+
+// Is path a directory (or, if dir is 0, a plain file) that belongs to
+// this user and that no one else can write to?  Symbolic links aren't
+// followed, so they fail.
+
+static int jit_private(const char* path, int dir)
+{
+	struct stat st;
+	if(lstat(path, &st)) return(0);
+	if(dir ? !S_ISDIR(st.st_mode) : !S_ISREG(st.st_mode)) return(0);
+	if(st.st_uid != getuid()) return(0);
+	return( !(st.st_mode & (S_IWGRP | S_IWOTH)) );
+}
+
+// Run the compiler on c_file to make o_file.  It's run directly,
+// not through the shell, with its output thrown away.  True if it
+// worked.
+
+static int jit_compile(const char* cc, const string& c_file, const string& o_file)
+{
+	char* argv[8];
+	argv[0] = (char*)cc;
+	argv[1] = (char*)"-O2";
+	argv[2] = (char*)"-shared";
+	argv[3] = (char*)"-fPIC";
+	argv[4] = (char*)"-o";
+	argv[5] = (char*)o_file.c_str();
+	argv[6] = (char*)c_file.c_str();
+	argv[7] = 0;
+
+	pid_t pid = fork();
+	if(pid < 0) return(0);
+	if(!pid)
+	{
+		int nul = open("/dev/null", O_WRONLY);
+		if(nul >= 0)
+		{
+			dup2(nul, 1);
+			dup2(nul, 2);
+		}
+		execvp(cc, argv);
+		_exit(127);
+	}
+
+	int status;
+	while(waitpid(pid, &status, 0) < 0)
+		if(errno != EINTR) return(0);
+	return(WIFEXITED(status) && !WEXITSTATUS(status));
+}
+
+#endif
+
+// Find the compiled code in the cache, or compile it there, and load
+// it.  Returns the dlopen handle, or 0 if it can't be done.
+
+static void* jit_load(const string& src)
+{
+#ifdef SV_UNIX
+	if(!jit_on) return(0);
+
+	jit_lock().shut();
+	const char* cc = get_jit_compiler();
+	const char* dir = jit_cache_dir();
+	void* h = 0;
+	if(*dir) mkdir(dir, 0700);
+	if(!*dir || !jit_private(dir, 1))
+	{
+		svlis_error("jit_load", "the cache directory isn't private; using the interpreter", 
+			SV_WARNING);
+		jit_lock().open();
+		return(0);
+	}
+
+	char name[40];
+	sprintf(name, "sv_jit_%016llx", jit_hash(src + cc));
+	string so = string(dir) + "/" + name + ".so";
+
+	struct stat st;
+	if(!lstat(so.c_str(), &st))
+	{
+		if(jit_private(so.c_str(), 0))
+			h = dlopen(so.c_str(), RTLD_NOW | RTLD_LOCAL);
+		else
+		{
+			svlis_error("jit_load", "cached code isn't private; using the interpreter", 
+				SV_WARNING);
+			jit_lock().open();
+			return(0);
+		}
+	}
+
+	if(!h)
+	{
+		sv_trace_span span("jit compile");
+		ostringstream tmp;
+		tmp << dir << "/" << name << "_" << (long)getpid();
+		string c_file = tmp.str() + ".cxx";
+		string o_file = tmp.str() + ".so";
+		ofstream f(c_file.c_str());
+		f << src;
+		f.close();
+		if(f)
+		{
+			if(jit_compile(cc, c_file, o_file)) rename(o_file.c_str(), so.c_str());
+			remove(c_file.c_str());
+			remove(o_file.c_str());
+			if(jit_private(so.c_str(), 0))
+				h = dlopen(so.c_str(), RTLD_NOW | RTLD_LOCAL);
+		}
+		if(!h)
+			svlis_error("jit_load", "can't compile generated code; using the interpreter", 
+				SV_WARNING);
+	}
+	jit_lock().open();
+	return(h);
+#else
+	return(0);
+#endif
+}
+
+// Look up a function in loaded code
+
+static void* jit_find(void* h, const char* fn)
+{
+#ifdef SV_UNIX
+	return(h ? dlsym(h, fn) : 0);
+#else
+	return(0);
+#endif
+}
+
+// ***************************************************************
+
+// Compile a primitive's value and grad
+
+sv_jit_prim::sv_jit_prim(const sv_primitive& pp)
+{
+	p = pp;
+	leaf = 0;
+	v = 0;
+	g = 0;
+	if(!jit_on || !p.exists()) return;
+
+	jit_gen gen;
+	ostringstream src;
+	src << jit_head();
+
+	sv_integer t = gen.prim(p);
+	src << "extern \"C\" double sv_jit_value(" << jit_args << ", " << jit_cb << ")\n{\n" << jit_start <<
+		gen.code.str() << "\treturn(t" << t << ");\n}\n\n";
+
+	gen.restart();
+	gen.code.str("");
+	sv_integer gx = gen.prim(p.grad_x());
+	sv_integer gy = gen.prim(p.grad_y());
+	sv_integer gz = gen.prim(p.grad_z());
+	src << "extern \"C\" void sv_jit_grad(" << jit_args << ", double* g, " << jit_cb << ")\n{\n" << jit_start <<
+		gen.code.str() << "\tg[0] = t" << gx << ";\n\tg[1] = t" << gy << 
+		";\n\tg[2] = t" << gz << ";\n}\n";
+
+	leaf = gen.take_leaves();
+	void* h = jit_load(src.str());
+	v = (sv_jit_value_fn)jit_find(h, "sv_jit_value");
+	g = (sv_jit_grad_fn)jit_find(h, "sv_jit_grad");
+	if(!g) v = 0;
+}
+
+sv_real sv_jit_prim::value(const sv_point& q) const
+{
+	if(!v) return(p.value(q));
+	return(v(q.x, q.y, q.z, (void*)leaf, jit_callback));
+}
+
+sv_point sv_jit_prim::grad(const sv_point& q) const
+{
+	if(!g) return(p.grad(q));
+	double r[3];
+	g(q.x, q.y, q.z, r, (void*)leaf, jit_callback);
+	return(sv_point(r[0], r[1], r[2]));
+}
+
+// Compile a set's value
+
+sv_jit_set::sv_jit_set(const sv_set& ss)
+{
+	s = ss;
+	leaf = 0;
+	v = 0;
+	if(!jit_on || !s.exists()) return;
+
+	jit_gen gen;
+	ostringstream src;
+	src << jit_head();
+	sv_integer t = gen.set(s);
+	src << "extern \"C\" double sv_jit_value(" << jit_args << ", " << jit_cb << ")\n{\n" << jit_start <<
+		gen.code.str() << "\treturn(t" << t << ");\n}\n";
+
+	leaf = gen.take_leaves();
+	v = (sv_jit_value_fn)jit_find(jit_load(src.str()), "sv_jit_value");
+}
+
+sv_real sv_jit_set::value(const sv_point& q) const
+{
+	if(!v)
+	{
+		sv_set w;
+		return(s.value(q, &w));
+	}
+	return(v(q.x, q.y, q.z, (void*)leaf, jit_callback));
+}
+
+// The value's sign is the membership (as sv_set::member() without
+// known surfaces)
+
+mem_test sv_jit_set::member(const sv_point& q) const
+{
+	if(!v) return(s.member(q));
+	sv_real r = v(q.x, q.y, q.z, (void*)leaf, jit_callback);
+	if(r > 0) return(SV_AIR);
+	if(r < 0) return(SV_SOLID);
+	return(SV_SURFACE);
+}
+
+#if macintosh
+ #pragma export off
+#endif
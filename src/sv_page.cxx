@@ -0,0 +1,540 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Out-of-core models: division trees with sub-trees on disk
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 19 October 2026
+ *
+ */
+
+#include "svlis.h"
+#include <stdio.h>
+#include <limits>
+#ifdef SV_UNIX
+ #include <unistd.h>
+#endif
+#if macintosh
+ #pragma export on
+#endif
+
+// The memory limit, and what the paged-in sub-trees take now
+
+static long page_memory = SV_PAGE_MEMORY;
+static long page_bytes = 0;
+
+void set_page_memory(long b) { page_memory = b; }
+long get_page_memory() { return(page_memory); }
+long paged_in_bytes() { return(page_bytes); }
+
+// A page file.  Its pages are written one after another as a model is
+// paged out, and it is deleted when the last of them goes.
+
+struct sv_page_file
+{
+	char* name;
+	ofstream* out;		// Open while pages are being added
+	long end;		// Length so far
+	sv_integer pages;	// Pages using it
+};
+
+// One page: the two children of a model, written as a model file.
+// Their parents (and theirs) stay in memory and aren't written; when
+// the page is read the references to them are resolved by putting
+// them in the input table first.
+
+struct sv_model_page
+{
+	sv_page_file* file;
+	long offset;			// Where it is in the file
+	long length;
+	long bytes;			// Memory taken when it's in (0 till first read)
+	sv_model up_1, up_2;		// The children's parents
+	sv_model::model_data* node;	// The model whose children these are
+	sv_integer in;			// Are the children in memory?
+	sv_model_page* newer;		// Pages in memory, in order of use
+	sv_model_page* older;
+
+	static void mark(sv_model);
+	static void out(const sv_model&, sv_page_file*);
+	static void page_write(const sv_model&, sv_page_file*);
+	static void fault(sv_model_page*);
+	static void drop(sv_model_page*);
+	static sv_model copy(const sv_model&, sv_integer, sv_page_file*);
+	static sv_integer flag(const sv_model&);
+	static void decision(const sv_model&, sv_integer, void*, mod_kind*, 
+		sv_real*, sv_model*, sv_model*);
+};
+
+// The pages in memory, most recently used first
+
+static sv_model_page* newest = 0;
+static sv_model_page* oldest = 0;
+
+static void page_unlink(sv_model_page* pg)
+{
+	if(pg->newer) pg->newer->older = pg->older; else newest = pg->older;
+	if(pg->older) pg->older->newer = pg->newer; else oldest = pg->newer;
+	pg->newer = 0;
+	pg->older = 0;
+}
+
+static void page_link(sv_model_page* pg)
+{
+	pg->newer = 0;
+	pg->older = newest;
+	if(newest) newest->newer = pg; else oldest = pg;
+	newest = pg;
+}
+
+// Open a new page file
+
+static sv_page_file* page_file_open(const char* file)
+{
+	char* name;
+
+	if(file)
+	{
+		name = new char[sv_strlen(file) + 1];
+		sv_strcpy(name, file);
+	} else
+	{
+#ifdef SV_UNIX
+		char t[] = "/tmp/svlis_pageXXXXXX";
+		int fd = mkstemp(t);
+		if(fd < 0)
+		{
+			svlis_error("page_file_open", "can't make a temporary file", SV_WARNING);
+			return(0);
+		}
+		close(fd);
+		name = new char[sv_strlen(t) + 1];
+		sv_strcpy(name, t);
+#else
+		name = new char[L_tmpnam];
+		if(!tmpnam(name))
+		{
+			svlis_error("page_file_open", "can't make a temporary file", SV_WARNING);
+			delete [] name;
+			return(0);
+		}
+#endif
+	}
+
+	sv_page_file* f = new sv_page_file;
+	f->name = name;
+	f->out = new ofstream(name, ios::out | ios::binary | ios::trunc);
+	f->end = 0;
+	f->pages = 0;
+	if(!*(f->out))
+	{
+		svlis_error("page_file_open", "can't open the page file", SV_WARNING);
+		delete f->out;
+		delete [] f->name;
+		delete f;
+		return(0);
+	}
+	return(f);
+}
+
+// Get rid of a page file if nothing uses it
+
+static void page_file_free(sv_page_file* f)
+{
+	if(f->out || f->pages) return;
+	remove(f->name);
+	delete [] f->name;
+	delete f;
+}
+
+// Stop adding pages to a file
+
+static void page_file_close(sv_page_file* f)
+{
+	f->out->close();
+	delete f->out;
+	f->out = 0;
+	page_file_free(f);
+}
+
+// Mark a model and its ancestors as written, so a page refers to
+// them rather than holding copies
+
+void sv_model_page::mark(sv_model m)
+{
+	while(m.exists())
+	{
+		m.set_flags_priv(WRIT_BIT);
+		m = m.parent();
+	}
+}
+
+// ...and put them in the input table when it's read
+
+static void page_seed(sv_model m)
+{
+	while(m.exists())
+	{
+		m_write_list.add(m, m.unique());
+		m = m.parent();
+	}
+}
+
+// Pages are read into input tables of their own, so a fault in the
+// middle of the user reading something doesn't lose what has been read
+
+struct page_tables
+{
+	look_up<sv_attribute> a;
+	look_up<sv_model> m;
+	look_up<sv_set_list> sl;
+	look_up<sv_primitive> p;
+	look_up<sv_set> s;
+
+	void swap()
+	{
+		a_write_list.swap(a);
+		m_write_list.swap(m);
+		sl_write_list.swap(sl);
+		p_write_list.swap(p);
+		s_write_list.swap(s);
+	}
+};
+
+static page_tables& page_input()
+{
+	static page_tables* t = new page_tables;
+	return(*t);
+}
+
+// Pages are written one at a time, though divide_paged() may be
+// dividing in several threads
+
+static sv_lock& page_lock()
+{
+	static sv_lock* l = new sv_lock;
+	return(*l);
+}
+
+// Does a sub-tree hold any polygons?  They don't survive being
+// written and read back, so such sub-trees stay in memory.
+
+static sv_integer page_polygons(const sv_model& m)
+{
+	if(m.kind() == LEAF_M) return(m.has_polygons());
+	if(m.kind() == INSTANCE_M) return(0);
+	return(page_polygons(m.child_1()) || page_polygons(m.child_2()));
+}
+
+// Write the children of a divided model to a page file and let go of
+// them.  Sets are written with the attributes they have in each place
+// they're used, so a set shared under different attributes (different
+// surfaces, say) keeps them all.
+
+void sv_model_page::out(const sv_model& m, sv_page_file* f)
+{
+	if(page_polygons(m)) return;
+	page_lock().shut();
+	page_write(m, f);
+	page_lock().open();
+}
+
+void sv_model_page::page_write(const sv_model& m, sv_page_file* f)
+{
+	sv_model c_1 = m.child_1();
+	sv_model c_2 = m.child_2();
+	sv_model_page* pg = new sv_model_page;
+
+	pg->up_1 = c_1.parent();
+	pg->up_2 = c_2.parent();
+	unwrite(c_1);
+	unwrite(c_2);
+	mark(pg->up_1);
+	mark(pg->up_2);
+
+	ostringstream os;
+	os.precision(numeric_limits<sv_real>::digits10 + 3);	// So it reads back exactly
+	write_svlis_header(os);
+	s_ref_attributes = 1;
+	write(os, c_1, 0);
+	write(os, c_2, 0);
+	s_ref_attributes = 0;
+	string text = os.str();
+	f->out->write(text.data(), text.length());
+	f->out->flush();
+	if(!*(f->out))
+	{
+		svlis_error("sv_model_page::out", "can't write the page file", SV_WARNING);
+		delete pg;
+		return;
+	}
+
+	pg->file = f;
+	pg->offset = f->end;
+	pg->length = text.length();
+	f->end += pg->length;
+	f->pages++;
+	pg->bytes = 0;
+	pg->node = m.model_info.operator->();
+	pg->in = 0;
+	pg->newer = 0;
+	pg->older = 0;
+	m.model_info->pg = pg;
+	*(m.model_info->child_1) = sv_model();
+	*(m.model_info->child_2) = sv_model();
+	m.model_info->set_flags(SV_PAGE_FLAG);
+	m.model_info->thaw();
+}
+
+// Let go of a page's children (they stay on disk)
+
+void sv_model_page::drop(sv_model_page* pg)
+{
+	page_unlink(pg);
+	page_bytes -= pg->bytes;
+	pg->in = 0;
+	sv_stat(SV_ST_PAGE_OUT);
+	*(pg->node->child_1) = sv_model();
+	*(pg->node->child_2) = sv_model();
+}
+
+// A page's children are wanted: read them if they're not in, and
+// drop the least recently used pages to keep under the memory limit.
+// If the page can't be read the model becomes a leaf, which is
+// slower to use but gives the same answers.
+
+void sv_model_page::fault(sv_model_page* pg)
+{
+	if(pg->in)
+	{
+		if(newest != pg)
+		{
+			page_unlink(pg);
+			page_link(pg);
+		}
+		return;
+	}
+
+	sv_trace_span span("page in");
+	char* buf = new char[pg->length];
+	ifstream in(pg->file->name, ios::in | ios::binary);
+	in.seekg(pg->offset);
+	in.read(buf, pg->length);
+	sv_model c_1, c_2;
+	if(in)
+	{
+		istringstream is(string(buf, pg->length));
+		page_tables& t = page_input();
+		sv_integer version = get_read_version();
+		t.swap();
+		page_seed(pg->up_1);
+		page_seed(pg->up_2);
+		s_ref_attributes = 1;
+		check_svlis_header(is);
+		read(is, c_1);
+		read(is, c_2);
+		s_ref_attributes = 0;
+
+// The input tables would keep everything that's just been read alive
+
+		sv_clear_input_tables();
+		t.swap();
+		set_read_version(version);
+	}
+	delete [] buf;
+
+	if(!c_1.exists() || !c_2.exists())
+	{
+		svlis_error("sv_model_page::fault", "can't read a page; using its box as a leaf", 
+			SV_WARNING);
+		sv_model::model_data* n = pg->node;
+		n->kind = LEAF_M;
+		n->pg = 0;
+		n->thaw();
+		sv_page_drop(pg);
+		return;
+	}
+
+	sv_stat(SV_ST_PAGE_IN);
+	*(pg->node->child_1) = c_1;
+	*(pg->node->child_2) = c_2;
+	if(!pg->bytes)
+	{
+		sv_mem_stats ms;
+		sv_model both = sv_model(sv_model(), sv_set_list(), sv_box(), c_1, c_2, 
+			pg->node->kind, pg->node->coord, 0);
+		memory_use(both, &ms);
+		pg->bytes = ms.total_bytes;
+	}
+	pg->in = 1;
+	page_link(pg);
+	page_bytes += pg->bytes;
+	while((page_bytes > page_memory) && (oldest != pg))
+		drop(oldest);
+}
+
+void sv_model::page_in() const
+{
+	sv_model_page::fault(model_info->pg);
+}
+
+// A model whose page is going is being deleted
+
+void sv_page_drop(sv_model_page* pg)
+{
+	if(pg->in)
+	{
+		page_unlink(pg);
+		page_bytes -= pg->bytes;
+	}
+	sv_page_file* f = pg->file;
+	f->pages--;
+	page_file_free(f);
+	delete pg;
+}
+
+// Copy a model, paging out what is below depth
+
+sv_model sv_model_page::copy(const sv_model& m, sv_integer depth, sv_page_file* f)
+{
+	if((m.kind() == LEAF_M) || (m.kind() == INSTANCE_M) || (m.flags() & SV_INST_FLAG))
+		return(m);
+
+	sv_model c_1 = m.child_1();
+	sv_model c_2 = m.child_2();
+	if(depth > 0)
+	{
+		c_1 = copy(c_1, depth - 1, f);
+		c_2 = copy(c_2, depth - 1, f);
+	}
+	sv_model result = sv_model(m.parent(), m.set_list(), m.box(), c_1, c_2, m.kind(), 
+		m.coord(), m.flags() & ~(WRIT_BIT | SV_PAGE_FLAG));
+	if(depth > 0)
+	{
+		if((c_1.flags() | c_2.flags()) & SV_PAGE_FLAG)
+			result.set_flags_priv(SV_PAGE_FLAG);
+	} else
+		out(result, f);
+	return(result);
+}
+
+sv_model page_model(const sv_model& m, sv_integer depth, const char* file)
+{
+	sv_trace_span span("page_model");
+	sv_page_file* f = page_file_open(file);
+	if(!f) return(m);
+	sv_model result = sv_model_page::copy(m, depth, f);
+	page_file_close(f);
+	return(result);
+}
+
+// Division with paging: above the paging depth the user's decision
+// procedure is called as usual; at it the rest of the sub-tree is
+// divided in one go and paged out, and handed back as if the decision
+// procedure had made it.
+
+struct page_div
+{
+	void* vp;		// The user's pointer
+	sv_decision d;		// and decision procedure
+	sv_integer depth;
+	sv_page_file* f;
+};
+
+void sv_model_page::decision(const sv_model& m, sv_integer level, void* vp, 
+	mod_kind* k, sv_real* cut, sv_model* c_1, sv_model* c_2)
+{
+	page_div* pd = (page_div*)vp;
+
+	if(level < pd->depth)
+	{
+		(*(pd->d))(m, level, pd->vp, k, cut, c_1, c_2);
+		return;
+	}
+
+	sv_div_data sd = sv_div_data(m, m.set_list(), level, pd->vp, pd->d);
+	redivide_r((void*)&sd);
+	*c_1 = sd.result();
+	*k = LEAF_M;
+	if((c_1->kind() != LEAF_M) && !(c_1->flags() & SV_INST_FLAG))
+		out(*c_1, pd->f);
+}
+
+// Flag everything above the pages (without reading them)
+
+sv_integer sv_model_page::flag(const sv_model& m)
+{
+	if(!m.exists()) return(0);
+	if(m.model_info->pg) return(1);
+	if((m.kind() == LEAF_M) || (m.kind() == INSTANCE_M)) return(0);
+	sv_integer f1 = flag(*(m.model_info->child_1));
+	sv_integer f2 = flag(*(m.model_info->child_2));
+	if(f1 || f2) m.model_info->set_flags(SV_PAGE_FLAG);
+	return(f1 || f2);
+}
+
+sv_model divide_paged(const sv_model& m, void* vp, sv_decision d, sv_integer depth, 
+	const char* file)
+{
+	sv_trace_span span("divide_paged");
+	page_div pd;
+	pd.f = page_file_open(file);
+	if(!pd.f) return(m.divide(vp, d));
+	pd.vp = vp;
+	pd.d = d;
+	pd.depth = max((sv_integer)0, depth);
+	sv_model result = m.divide((void*)&pd, sv_model_page::decision);
+	sv_model_page::flag(result);
+	page_file_close(pd.f);
+	return(result);
+}
+
+#if macintosh
+ #pragma export off
+#endif
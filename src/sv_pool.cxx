@@ -0,0 +1,217 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Pooled allocation of fixed-size nodes
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#if macintosh
+ #pragma export on
+#endif
+
+SV_THREAD_LOCAL sv_pool_node* sv_pool_free[SV_POOLS];
+SV_THREAD_LOCAL int sv_pool_state;
+
+// Free blocks handed back by finished threads, and the totals.
+// These are plain arrays (no constructors) as primitives are made
+// during static initialisation, possibly before this file's statics.
+
+static sv_pool_node* pool_spare[SV_POOLS];
+static long pool_carved[SV_POOLS];
+static long pool_system;
+
+// Made on first use for the same reason, and never destroyed as
+// static destructors may still be freeing blocks
+
+static sv_lock& pool_lock()
+{
+	static sv_lock* l = new sv_lock;
+	return(*l);
+}
+
+// Put a thread's free list on the spares
+
+static void pool_spare_list(sv_integer pool, sv_pool_node* n)
+{
+	sv_pool_node* t;
+	while(n)
+	{
+		t = n->next;
+		n->next = pool_spare[pool];
+		pool_spare[pool] = n;
+		n = t;
+	}
+}
+
+// When a thread finishes, its free lists go to pool_spare.  This is
+// done by the destructor of a pthread key, as SV_THREAD_LOCAL can't
+// hold an object with a destructor.  Thread-local objects are
+// destroyed before it, so the blocks they free go with the lists;
+// anything freed after it sees sv_pool_state 2, and sv_pool_put()
+// doesn't touch the thread's lists then.
+
+static void pool_finish(void*)
+{
+	sv_pool_state = 2;
+	pool_lock().shut();
+	for(sv_integer i = 0; i < SV_POOLS; i++)
+	{
+		pool_spare_list(i, sv_pool_free[i]);
+		sv_pool_free[i] = 0;
+	}
+	pool_lock().open();
+}
+
+static pthread_key_t pool_key;
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+
+static void pool_key_make()
+{
+	pthread_key_create(&pool_key, pool_finish);
+}
+
+// The first block this thread frees makes sure its lists will be
+// handed on when it finishes
+
+static void pool_owned()
+{
+	if(sv_pool_state) return;
+	sv_pool_state = 1;
+	pthread_once(&pool_once, pool_key_make);
+	pthread_setspecific(pool_key, (void*)&pool_key);
+}
+
+// A block is freed by a thread that has no lists yet, or that is 
+// finishing
+
+void sv_pool_give(sv_integer pool, void* p)
+{
+	sv_pool_node* n = (sv_pool_node*)p;
+	pool_owned();
+	if(sv_pool_state == 1)
+	{
+		n->next = sv_pool_free[pool];
+		sv_pool_free[pool] = n;
+		return;
+	}
+	n->next = 0;
+	pool_lock().shut();
+	pool_spare_list(pool, n);
+	pool_lock().open();
+}
+
+// This thread's free list is empty: take the spares, or carve
+// a new chunk.  A finishing thread keeps none of them.
+
+void* sv_pool_refill(sv_integer pool, size_t bytes)
+{
+	sv_pool_node* n;
+	void* result;
+	bytes = sv_pool_bytes(bytes);
+	pool_owned();
+
+	pool_lock().shut();
+	if((n = pool_spare[pool]))
+	{
+		pool_spare[pool] = 0;
+		pool_lock().open();
+		sv_pool_free[pool] = n->next;
+		result = (void*)n;
+	} else
+	{
+		sv_integer count = SV_POOL_CHUNK/bytes;
+		if(count < 1) count = 1;
+		pool_carved[pool] += count;
+		pool_system += count*bytes;
+		pool_lock().open();
+
+		char* chunk = new char[count*bytes];
+		for(sv_integer i = count - 1; i > 0; i--)
+		{
+			n = (sv_pool_node*)(chunk + i*bytes);
+			n->next = sv_pool_free[pool];
+			sv_pool_free[pool] = n;
+		}
+		result = (void*)chunk;
+	}
+
+	if(sv_pool_state == 2)
+	{
+		pool_lock().shut();
+		pool_spare_list(pool, sv_pool_free[pool]);
+		pool_lock().open();
+		sv_pool_free[pool] = 0;
+	}
+	return(result);
+}
+
+long sv_pool_blocks(sv_integer pool)
+{
+	if((pool < 0) || (pool >= SV_POOLS)) return(0);
+	pool_lock().shut();
+	long r = pool_carved[pool];
+	pool_lock().open();
+	return(r);
+}
+
+long sv_pool_system_bytes()
+{
+	pool_lock().shut();
+	long r = pool_system;
+	pool_lock().open();
+	return(r);
+}
+
+#if macintosh
+ #pragma export off
+#endif
@@ -0,0 +1,253 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Hot-path event counters
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#if macintosh
+ #pragma export on
+#endif
+
+static const char* stat_names[SV_ST_COUNT] =
+{
+	"primitive values",
+	"primitive ranges",
+	"set prunes",
+	"same() tests",
+	"set memberships",
+	"division decisions",
+	"model nodes created",
+	"rays fired into models",
+	"shadow rays",
+	"ray root solves",
+	"ray roots found",
+	"sets faceted",
+	"model pages read in",
+	"model pages dropped"
+};
+
+static const char* kind_names[SV_ST_KINDS] =
+{
+	"real", "plane", "block", "cylinder", "sphere", "cone", "torus",
+	"cyclide", "general", "user"
+};
+
+const char* stat_name(sv_stat_kind k)
+{
+	if((k < 0) || (k >= SV_ST_COUNT)) return("unknown");
+	return(stat_names[k]);
+}
+
+#ifdef SV_NO_STATS
+
+long get_stat(sv_stat_kind) { return(0); }
+long get_prim_stat(sv_integer, int) { return(0); }
+void reset_stats() {}
+
+void stat_report(ostream& f)
+{
+	f << "  Event counting was compiled out (SV_NO_STATS)." << SV_EL;
+}
+
+#else
+
+SV_THREAD_LOCAL sv_stat_block* sv_stat_here = 0;
+
+// All the blocks of living threads, and the totals of those
+// that have finished
+
+static sv_lock stat_lock;
+static sv_stat_block* stat_blocks = 0;
+static sv_stat_block stat_done;
+
+static void stat_zero(sv_stat_block* b)
+{
+	sv_integer i;
+	for(i = 0; i < SV_ST_COUNT; i++) b->count[i] = 0;
+	for(i = 0; i < SV_ST_KINDS; i++)
+	{
+		b->value_k[i] = 0;
+		b->range_k[i] = 0;
+	}
+}
+
+static void stat_add(sv_stat_block* to, const sv_stat_block* from)
+{
+	sv_integer i;
+	for(i = 0; i < SV_ST_COUNT; i++) to->count[i] += from->count[i];
+	for(i = 0; i < SV_ST_KINDS; i++)
+	{
+		to->value_k[i] += from->value_k[i];
+		to->range_k[i] += from->range_k[i];
+	}
+}
+
+// When a thread finishes its counts go into stat_done and its
+// block is freed
+
+class sv_stat_owner
+{
+public:
+	sv_stat_block* b;
+	~sv_stat_owner()
+	{
+		if(!b) return;
+		stat_lock.shut();
+		stat_add(&stat_done, b);
+		sv_stat_block** p = &stat_blocks;
+		while(*p && (*p != b)) p = &((*p)->next);
+		if(*p) *p = b->next;
+		stat_lock.open();
+		delete b;
+		sv_stat_here = 0;
+	}
+};
+
+static thread_local sv_stat_owner stat_owner;
+
+// Give this thread its block
+
+sv_stat_block* sv_stat_attach()
+{
+	sv_stat_block* b = new sv_stat_block;
+	stat_zero(b);
+	stat_lock.shut();
+	b->next = stat_blocks;
+	stat_blocks = b;
+	stat_lock.open();
+	stat_owner.b = b;
+	sv_stat_here = b;
+	return(b);
+}
+
+// Sum everything; counts in other threads' blocks may be a
+// moment out of date
+
+static void stat_total(sv_stat_block* t)
+{
+	stat_lock.shut();
+	*t = stat_done;
+	sv_stat_block* b = stat_blocks;
+	while(b)
+	{
+		stat_add(t, b);
+		b = b->next;
+	}
+	stat_lock.open();
+}
+
+long get_stat(sv_stat_kind k)
+{
+	if((k < 0) || (k >= SV_ST_COUNT)) return(0);
+	sv_stat_block t;
+	stat_total(&t);
+	return(t.count[k]);
+}
+
+long get_prim_stat(sv_integer k, int r)
+{
+	sv_stat_block t;
+	stat_total(&t);
+	if(r) return(t.range_k[stat_kind_slot(k)]);
+	return(t.value_k[stat_kind_slot(k)]);
+}
+
+void reset_stats()
+{
+	stat_lock.shut();
+	stat_zero(&stat_done);
+	sv_stat_block* b = stat_blocks;
+	while(b)
+	{
+		stat_zero(b);
+		b = b->next;
+	}
+	stat_lock.open();
+}
+
+void stat_report(ostream& f)
+{
+	sv_stat_block t;
+	stat_total(&t);
+	sv_integer i, any = 0;
+
+	for(i = 0; i < SV_ST_COUNT; i++)
+	{
+		if(!t.count[i]) continue;
+		f << "  " << stat_names[i] << ": " << t.count[i] << SV_EL;
+		any = 1;
+	}
+	if(!any)
+	{
+		f << "  No events have been counted." << SV_EL;
+		return;
+	}
+
+	if(t.count[SV_ST_VALUE] || t.count[SV_ST_RANGE])
+	{
+		f << "  Primitive values and ranges by kind:" << SV_EL;
+		for(i = 0; i < SV_ST_KINDS; i++)
+		{
+			if(!t.value_k[i] && !t.range_k[i]) continue;
+			f << "    " << kind_names[i] << ": " << t.value_k[i] <<
+				" values, " << t.range_k[i] << " ranges" << SV_EL;
+		}
+	}
+}
+
+#endif
+
+#if macintosh
+ #pragma export off
+#endif
@@ -0,0 +1,262 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Timeline tracing in Chrome trace-event format
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#ifdef SV_UNIX
+ #include <sys/time.h>
+#endif
+#if macintosh
+ #pragma export on
+#endif
+
+// One finished span
+
+struct trace_event
+{
+	const char* name;
+	long arg;
+	double start;		// Microseconds since trace_start()
+	double dur;
+};
+
+// Each thread appends to its own buffer.  Buffers of threads that
+// have finished are kept until the next trace_start() so their
+// spans still get written.
+
+struct trace_buffer
+{
+	trace_event* ev;
+	sv_integer count;
+	sv_integer size;
+	sv_integer tid;
+	int dead;
+	trace_buffer* next;
+};
+
+static SV_THREAD_LOCAL trace_buffer* trace_here = 0;
+static sv_lock trace_lock;
+static trace_buffer* trace_buffers = 0;
+static sv_integer trace_threads = 0;
+static volatile int trace_running = 0;
+static double trace_zero = 0;
+
+// Wall-clock time in microseconds
+
+static double trace_now()
+{
+#ifdef SV_UNIX
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return(1.0e6*(double)tv.tv_sec + (double)tv.tv_usec);
+#else
+	return(1.0e6*(double)clock()/(double)CLOCKS_PER_SEC);
+#endif
+}
+
+// Mark a thread's buffer dead when the thread finishes
+
+class trace_owner
+{
+public:
+	trace_buffer* b;
+	~trace_owner()
+	{
+		if(!b) return;
+		trace_lock.shut();
+		b->dead = 1;
+		trace_lock.open();
+		trace_here = 0;
+	}
+};
+
+static thread_local trace_owner trace_owned;
+
+static trace_buffer* trace_attach()
+{
+	trace_buffer* b = new trace_buffer;
+	b->ev = 0;
+	b->count = 0;
+	b->size = 0;
+	b->dead = 0;
+	trace_lock.shut();
+	b->tid = ++trace_threads;
+	b->next = trace_buffers;
+	trace_buffers = b;
+	trace_lock.open();
+	trace_owned.b = b;
+	trace_here = b;
+	return(b);
+}
+
+sv_trace_span::sv_trace_span(const char* n, long a)
+{
+	live = trace_running;
+	if(!live) return;
+	name = n;
+	arg = a;
+	start = trace_now();
+}
+
+sv_trace_span::~sv_trace_span()
+{
+	if(!live) return;
+	double end = trace_now();
+	trace_buffer* b = trace_here;
+	if(!b) b = trace_attach();
+	if(b->count >= b->size)
+	{
+		sv_integer ns = b->size ? 2*b->size : 1024;
+		trace_event* ne = new trace_event[ns];
+		for(sv_integer i = 0; i < b->count; i++) ne[i] = b->ev[i];
+		delete [] b->ev;
+		b->ev = ne;
+		b->size = ns;
+	}
+	trace_event* e = &(b->ev[b->count++]);
+	e->name = name;
+	e->arg = arg;
+	e->start = start - trace_zero;
+	e->dur = end - start;
+}
+
+// Start and stop.  Call these (and trace_write()) when no other
+// svLis threads are running.
+
+void trace_start()
+{
+	trace_lock.shut();
+	trace_buffer** p = &trace_buffers;
+	trace_buffer* b;
+	while((b = *p))
+	{
+		if(b->dead)
+		{
+			*p = b->next;
+			delete [] b->ev;
+			delete b;
+		} else
+		{
+			b->count = 0;
+			p = &(b->next);
+		}
+	}
+	trace_lock.open();
+	trace_zero = trace_now();
+	trace_running = 1;
+}
+
+void trace_stop() { trace_running = 0; }
+
+int tracing() { return(trace_running); }
+
+// Chrome trace-event JSON: one complete ("X") event per span, plus
+// a name for each thread
+
+void trace_write(ostream& s)
+{
+	sv_integer pid = 1;
+#ifdef SV_UNIX
+	pid = getpid();
+#endif
+	int first = 1;
+	trace_buffer* b;
+	sv_integer i;
+	trace_event* e;
+
+	trace_lock.shut();
+	s << "{\"traceEvents\": [" << SV_EL;
+	for(b = trace_buffers; b; b = b->next)
+	{
+		if(!b->count) continue;
+		if(!first) s << "," << SV_EL;
+		first = 0;
+		s << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid <<
+			", \"tid\": " << b->tid << ", \"args\": {\"name\": \"svlis " <<
+			b->tid << "\"}}";
+		for(i = 0; i < b->count; i++)
+		{
+			e = &(b->ev[i]);
+			s << "," << SV_EL << "{\"name\": \"" << e->name <<
+				"\", \"cat\": \"svlis\", \"ph\": \"X\", \"ts\": " <<
+				(long)e->start << ", \"dur\": " << (long)e->dur <<
+				", \"pid\": " << pid << ", \"tid\": " << b->tid;
+			if(e->arg >= 0) s << ", \"args\": {\"arg\": " << e->arg << "}";
+			s << "}";
+		}
+	}
+	s << SV_EL << "], \"displayTimeUnit\": \"ms\"}" << SV_EL;
+	trace_lock.open();
+}
+
+sv_integer trace_write(const char* file)
+{
+	ofstream f(file);
+	if(!f)
+	{
+		svlis_error("trace_write", "can't open the trace file", SV_WARNING);
+		return(-1);
+	}
+	trace_write(f);
+	sv_integer n = 0;
+	trace_lock.shut();
+	for(trace_buffer* b = trace_buffers; b; b = b->next) n += b->count;
+	trace_lock.open();
+	return(n);
+}
+
+#if macintosh
+ #pragma export off
+#endif
@@ -0,0 +1,254 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Typed user primitives
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 19 October 2026
+ *
+ */
+
+#include "svlis.h"
+#include <string.h>
+#if macintosh
+ #pragma export on
+#endif
+
+// The shapes are kept in blocks that never move, so looking one up
+// needs no lock; only adding, holding and letting go of one does.
+// Blocks and shapes are published with release stores and read with
+// acquire loads, so a thread that finds one finds it filled in.
+
+#define U_BLOCK 1024
+#define U_BLOCKS 1024
+
+#if defined(__GNUC__)
+ #define U_LOAD(p) __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+ #define U_STORE(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+#else
+ #define U_LOAD(p) (p)
+ #define U_STORE(p, v) ((p) = (v))
+#endif
+
+// Each shape is counted by the primitive records whose kinds are its
+// kind numbers; when the last goes, so does the shape, and its
+// numbers are used again
+
+struct u_entry
+{
+	sv_user_prim_base* shape;
+	sv_integer refs;
+};
+
+static u_entry* u_shape[U_BLOCKS];
+static sv_integer u_count = 0;		// Slots ever used
+static sv_integer u_live = 0;		// Shapes there now
+static sv_integer* u_free = 0;		// Slots to use again
+static sv_integer u_frees = 0;
+static sv_integer u_free_max = 0;
+
+static sv_lock& u_lock()
+{
+	static sv_lock* l = new sv_lock;
+	return(*l);
+}
+
+sv_primitive register_user_prim(sv_user_prim_base* u)
+{
+	if(!u) return(sv_primitive());
+	u_lock().shut();
+	sv_integer i;
+	if(u_frees)
+		i = u_free[--u_frees];
+	else
+	{
+		i = u_count;
+		if(i >= U_BLOCK*U_BLOCKS)
+		{
+			u_lock().open();
+			svlis_error("register_user_prim", 
+				"more than a million user shapes in use at once", SV_FATAL);
+			delete u;
+			return(sv_primitive());
+		}
+		sv_integer b = i/U_BLOCK;
+		if(!u_shape[b])
+		{
+			u_entry* e = new u_entry[U_BLOCK];
+			for(sv_integer j = 0; j < U_BLOCK; j++)
+			{
+				e[j].shape = 0;
+				e[j].refs = 0;
+			}
+			U_STORE(u_shape[b], e);
+		}
+		u_count++;
+	}
+	U_STORE(u_shape[i/U_BLOCK][i%U_BLOCK].shape, u);
+	u_live++;
+	u_lock().open();
+
+	sv_integer k = SV_U_REG + 4*i;
+	return(sv_primitive(k, k + 1, k + 2, k + 3));
+}
+
+sv_user_prim_base* user_prim(sv_integer k)
+{
+	if(k < SV_U_REG) return(0);
+	sv_integer i = (k - SV_U_REG)/4;
+	if(i >= U_BLOCK*U_BLOCKS) return(0);
+	u_entry* b = U_LOAD(u_shape[i/U_BLOCK]);
+	if(!b) return(0);
+	return(U_LOAD(b[i%U_BLOCK].shape));
+}
+
+const sv_user_eval* user_prim_eval(sv_integer k)
+{
+	sv_user_prim_base* u = user_prim(k);
+	if(!u) return(0);
+	return(u->evaluator((k - SV_U_REG)%4));
+}
+
+// A primitive record of kind k has been made or is going
+
+void user_prim_hold(sv_integer k)
+{
+	if(k < SV_U_REG) return;
+	sv_integer i = (k - SV_U_REG)/4;
+	u_lock().shut();
+	if(i < u_count) u_shape[i/U_BLOCK][i%U_BLOCK].refs++;
+	u_lock().open();
+}
+
+void user_prim_drop(sv_integer k)
+{
+	if(k < SV_U_REG) return;
+	sv_integer i = (k - SV_U_REG)/4;
+	sv_user_prim_base* gone = 0;
+	u_lock().shut();
+	if(i >= u_count)
+	{
+		u_lock().open();
+		return;
+	}
+	u_entry* e = &u_shape[i/U_BLOCK][i%U_BLOCK];
+	if(--e->refs <= 0)
+	{
+		gone = e->shape;
+		e->refs = 0;
+		U_STORE(e->shape, (sv_user_prim_base*)0);
+		if(gone)
+		{
+			u_live--;
+			if(u_frees >= u_free_max)
+			{
+				sv_integer nm = u_free_max ? 2*u_free_max : 64;
+				sv_integer* nf = new sv_integer[nm];
+				for(sv_integer j = 0; j < u_frees; j++) nf[j] = u_free[j];
+				delete [] u_free;
+				u_free = nf;
+				u_free_max = nm;
+			}
+			u_free[u_frees++] = i;
+		}
+	}
+	u_lock().open();
+	delete gone;
+}
+
+sv_integer user_prim_count() { return(u_live); }
+
+// The shape classes, by name
+
+struct u_type
+{
+	char* name;
+	sv_user_reader reader;
+	u_type* next;
+};
+
+static u_type* u_types = 0;
+
+void register_user_type(const char* name, sv_user_reader r)
+{
+	u_lock().shut();
+	u_type* t = u_types;
+	while(t)
+	{
+		if(!strcmp(t->name, name))
+		{
+			if(t->reader != r)
+				svlis_error("register_user_type",
+					"two shape classes with the same name", SV_WARNING);
+			u_lock().open();
+			return;
+		}
+		t = t->next;
+	}
+	t = new u_type;
+	t->name = new char[strlen(name) + 1];
+	strcpy(t->name, name);
+	t->reader = r;
+	t->next = u_types;
+	u_types = t;
+	u_lock().open();
+}
+
+sv_user_reader user_type(const char* name)
+{
+	u_lock().shut();
+	u_type* t = u_types;
+	while(t && strcmp(t->name, name)) t = t->next;
+	u_lock().open();
+	return(t ? t->reader : 0);
+}
+
+#if macintosh
+ #pragma export off
+#endif
@@ -71,13 +71,39 @@
 // you are being a bit optimistic...
 
 
-// Accumulators for volume, centroid and MoI calculations
+// Accumulators for volume, centroid and MoI calculations; they are
+// per thread so integral() can be called from several at once.  n_use
+// is the working copy of n_to_use for the current call.
 
-static sv_real svx, svy, svz, svx2, svy2, svz2, svs, sva, tsv, svxy, svxz, svyz;
-static sv_integer n_ran_p;
+static SV_THREAD_LOCAL sv_real svx, svy, svz, svx2, svy2, svz2, svs, sva, tsv, svxy, svxz, svyz;
+static SV_THREAD_LOCAL sv_integer n_ran_p;
+static SV_THREAD_LOCAL sv_real n_use;
 static sv_real n_to_use = -1;
 static sv_integer const_work = 0;
 
+// Instances (INSTANCE_M models) have their prototypes integrated
+// once each, to the accuracy wanted for the whole model, and the sums
+// are mapped out to the world.  Each integral() call keeps its own
+// inst_pass on the stack: done lists the prototypes integrated so far,
+// and seen records that the tree had instances, as then its leaves no
+// longer fill its box.
+
+struct inst_sums
+{
+	long id;
+	sv_real s, x, y, z, x2, y2, z2, xy, xz, yz;
+	inst_sums* next;
+};
+
+struct inst_pass
+{
+	inst_sums* done;
+	sv_integer seen;
+	sv_real accy;
+};
+
+static void integrate(const sv_model&, sv_real, inst_pass&);
+
 // Flag for whether to use niederreiter or uniform
 
 static int niederreiter = 0;
@@ -125,11 +151,88 @@ void compute_averages(sv_real& vol, sv_point& centroid, sv_point&
 	}
 }
 
+// Add the sums for an instance to the accumulators
+
+static void instance_sums(const sv_model& m, inst_pass& ip)
+{
+	sv_trace_span span("integral instance");
+	sv_model proto = m.child_1();
+	inst_sums* is = ip.done;
+	while(is && (is->id != proto.unique())) is = is->next;
+
+	if(!is)
+	{
+		sv_real k[10] = {svx, svy, svz, svx2, svy2, svz2, svs, svxy, svxz, svyz};
+		sv_real a = sva, u = tsv, n = n_use;
+
+		integrate(proto, ip.accy, ip);
+
+		is = new inst_sums;
+		is->id = proto.unique();
+		is->s = svs;
+		is->x = svx;
+		is->y = svy;
+		is->z = svz;
+		is->x2 = svx2;
+		is->y2 = svy2;
+		is->z2 = svz2;
+		is->xy = svxy;
+		is->xz = svxz;
+		is->yz = svyz;
+		is->next = ip.done;
+		ip.done = is;
+
+		svx = k[0]; svy = k[1]; svz = k[2];
+		svx2 = k[3]; svy2 = k[4]; svz2 = k[5];
+		svs = k[6]; svxy = k[7]; svxz = k[8]; svyz = k[9];
+		sva = a;
+		tsv = u;
+		n_use = n;
+	}
+
+// Volume and moments in the world: p -> Ap + t scales volumes by 
+// |det A|, and the second moment matrix C goes to 
+// A C A' + (AM)t' + t(AM)' + V tt' where M is the first moment
+
+	sv_xform f = m.place();
+	sv_real j = fabs(f.r0*(f.r1^f.r2));
+	sv_real sxx = 0.5*(is->y2 + is->z2 - is->x2);
+	sv_real syy = 0.5*(is->x2 + is->z2 - is->y2);
+	sv_real szz = 0.5*(is->x2 + is->y2 - is->z2);
+	sv_point c[3];
+	c[0] = sv_point(sxx, is->xy, is->xz);
+	c[1] = sv_point(is->xy, syy, is->yz);
+	c[2] = sv_point(is->xz, is->yz, szz);
+	sv_point am = f.vector(sv_point(is->x, is->y, is->z));
+	sv_point r[3] = {f.r0, f.r1, f.r2};
+	sv_real t[3] = {f.t.x, f.t.y, f.t.z};
+	sv_real a[3] = {am.x, am.y, am.z};
+	sv_real w[3][3];
+	sv_integer p, q;
+	for(p = 0; p < 3; p++)
+	{
+		sv_point ac = r[p].x*c[0] + r[p].y*c[1] + r[p].z*c[2];
+		for(q = 0; q < 3; q++)
+			w[p][q] = j*(ac*r[q] + a[p]*t[q] + t[p]*a[q] + is->s*t[p]*t[q]);
+	}
+
+	svs = svs + j*is->s;
+	svx = svx + j*(am.x + f.t.x*is->s);
+	svy = svy + j*(am.y + f.t.y*is->s);
+	svz = svz + j*(am.z + f.t.z*is->s);
+	svx2 = svx2 + w[1][1] + w[2][2];
+	svy2 = svy2 + w[0][0] + w[2][2];
+	svz2 = svz2 + w[0][0] + w[1][1];
+	svxy = svxy + w[0][1];
+	svxz = svxz + w[0][2];
+	svyz = svyz + w[1][2];
+}
+
 // volume_sa - this just walks the model tree summing boxes that are
 // totally solid or totally air.  Assumes that the accumulators
 // have been zeroed.
 
-void volume_sa(const sv_model& m)
+void volume_sa(const sv_model& m, inst_pass& ip)
 {
 	sv_real x,y,z,v;
 	sv_point p;
@@ -149,9 +252,9 @@ void volume_sa(const sv_model& m)
 			svy = svy + v*y;
 			svz = svz + v*z;
 // JG 24/3/00
-			svyz = svyz + (v*y * v*z);
-			svxy = svxy + (v*x * v*z);
-			svxz = svxz + (v*x * v*y);						
+			svyz = svyz + v*y*z;
+			svxy = svxy + v*x*y;
+			svxz = svxz + v*x*z;
 
 			svx2 = svx2 + v*(y*y + z*z);
 			svy2 = svy2 + v*(x*x + z*z);
@@ -177,8 +280,14 @@ void volume_sa(const sv_model& m)
 	case X_DIV:
 	case Y_DIV:
 	case Z_DIV:
-		volume_sa(m.child_1());
-		volume_sa(m.child_2());
+		volume_sa(m.child_1(), ip);
+		volume_sa(m.child_2(), ip);
+		break;
+
+	case INSTANCE_M:
+		instance_sums(m, ip);
+		ip.seen = 1;
+		volume_sa(m.child_2(), ip);
 		break;
 	
 	default:
@@ -198,7 +307,7 @@ void volume_monte(const sv_model& m, const sv_real accy)
 	sv_point p;
 	sv_real vol;
 	sv_primitive ks;
-	sv_real sx, sy, sz, sx2, sy2, sz2, v, svxy, svxz, svy;
+	sv_real sx, sy, sz, sx2, sy2, sz2, v, sxy, sxz, syz;
 	sv_set ss = m.set_list().set();
 
 	sx = 0;
@@ -207,15 +316,16 @@ void volume_monte(const sv_model& m, const sv_real accy)
 	sx2 = 0;
 	sy2 = 0;
 	sz2 = 0;
-	svxy = 0;	
-	svxz = 0;
-	svyz = 0;
+	sxy = 0;	
+	sxz = 0;
+	syz = 0;
 
 	switch(m.kind())
 	{
 	case LEAF_M:
 		if(ss.contents() >= 1)
 		{
+			sv_trace_span span("integral leaf");
 
 // See - Stephen Parry-Barwick: Multidimensional set-theoretic geometric modelling
 // PhD thesis, University of Bath 1995, pp 163-167
@@ -223,8 +333,8 @@ void volume_monte(const sv_model& m, const sv_real accy)
 			s = 0;
 			n_done = 0;
             		v = m.box().vol();
-			if (n_to_use > 0)
-				n_needed = round(v*n_to_use);
+			if (n_use > 0)
+				n_needed = round(v*n_use);
 			else
 				n_needed = N_MONTE;
 			do
@@ -243,13 +353,14 @@ void volume_monte(const sv_model& m, const sv_real accy)
 						sy2 = sy2 + p.x*p.x + p.z*p.z;
 						sz2 = sz2 + p.y*p.y + p.x*p.x;
 
-// JG 24/3/00					svxy = svxy + (p.x*p.y);
-					        svxz = svxz + (p.x*p.z);
-						svyz = svyz + (p.y*p.z);
+// JG 24/3/00
+						sxy = sxy + p.x*p.y;
+					        sxz = sxz + p.x*p.z;
+						syz = syz + p.y*p.z;
 					}
 				}
 				n_done = n_done + n;
-				if(n_to_use < 0)
+				if(n_use < 0)
 				{
 				   vol = ((sv_real)s)/((sv_real)n_done);
 				   if (vol > 0.5)
@@ -263,9 +374,9 @@ void volume_monte(const sv_model& m, const sv_real accy)
 			svy2 = svy2 + sy2*v;
 			svz2 = svz2 + sz2*v;
 // JG 24/3/00
-                        svxy = svxy + svxy*v;
-			svxz = svxz + svxz*v;
-			svyz = svyz + svyz*v;
+                        svxy = svxy + sxy*v;
+			svxz = svxz + sxz*v;
+			svyz = svyz + syz*v;
 						
 			svx = svx + sx*v;
 			svy = svy + sy*v;
@@ -280,16 +391,21 @@ void volume_monte(const sv_model& m, const sv_real accy)
 		volume_monte(m.child_1(), accy);
 		volume_monte(m.child_2(), accy);
 		break;
+
+// The prototype's done already
+
+	case INSTANCE_M:
+		volume_monte(m.child_2(), accy);
+		break;
 	
 	default:
 		svlis_error("volume_monte", "dud model kind", SV_CORRUPT);
 	}
 }
 
-// This is the function that the user calls
+// Fill the accumulators for a model
 
-void integral(const sv_model& m, sv_real accy, sv_real& vol,
-	sv_point& centroid, sv_point& mxyz, sv_point& nxyz)
+static void integrate(const sv_model& m, sv_real accy, inst_pass& ip)
 {
 	sv_real v_box = m.box().vol();
 	sv_real v_unknown;
@@ -307,35 +423,23 @@ void integral(const sv_model& m, sv_real accy, sv_real& vol,
 	svz2 = 0;
 	svs = 0;
 	sva = 0;
-        n_ran_p = 0;
         tsv = 0;
+	ip.seen = 0;
 
-	volume_sa(m);
+	volume_sa(m, ip);
 
-	sv_real remember = n_to_use;
-
-	if(const_work) n_to_use = (float)const_work/tsv;
+	if(const_work) n_use = (float)const_work/tsv;
 
 // Check if division was fine enough to give an answer already:
 
-	v_unknown = v_box - svs - sva;
+	v_unknown = ip.seen ? tsv : v_box - svs - sva;
 	if (svs > 0)
 	{
-		if ( v_unknown/svs <= accy)
-		{
-			compute_averages(vol, centroid, mxyz, nxyz);
-			n_to_use = remember;
-			return;
-		}
+		if ( v_unknown/svs <= accy) return;
 	} else
 	{
 		if(sva > 0)
-		   if ( v_unknown/sva <= accy)
-		   {
-			compute_averages(vol, centroid, mxyz, nxyz);
-			n_to_use = remember;
-			return;
-		   }
+		   if ( v_unknown/sva <= accy) return;
 	}
 
 // Now is the point to check if the user's been silly		
@@ -352,8 +456,31 @@ void integral(const sv_model& m, sv_real accy, sv_real& vol,
 // accuracy (assume half v_unknown is solid):
 	
 	volume_monte(m, accy*(2*svs/v_unknown + 1));
+}
+
+// This is the function that the user calls
+
+void integral(const sv_model& m, sv_real accy, sv_real& vol,
+	sv_point& centroid, sv_point& mxyz, sv_point& nxyz)
+{
+	sv_trace_span span("integral");
+	inst_pass ip;
+	inst_sums* is;
+
+        n_ran_p = 0;
+	n_use = n_to_use;
+	ip.done = 0;
+	ip.seen = 0;
+	ip.accy = (accy > 0) ? accy : 0.01;
+	integrate(m, accy, ip);
 	compute_averages(vol, centroid, mxyz, nxyz);
-	n_to_use = remember;	
+
+	while(ip.done)
+	{
+		is = ip.done->next;
+		delete ip.done;
+		ip.done = is;
+	}
 }
 
 // Recursively add-up the polygon areas
@@ -1301,6 +1428,16 @@ sv_primitive slice(const sv_primitive& p, const mod_kind d, const sv_real r)
 		    result = sign(res_1);
 		    break;
 
+		case SV_XFORM:
+		    res_1 = p.bake();
+		    if(res_1.op() == SV_XFORM)
+			svlis_error("slice(sv_primitive, mod_kind, real)",
+				"attempt to slice transformed user primitive",
+				SV_WARNING);
+		    else
+			result = slice(res_1, d, r);
+		    break;
+
 		default:
 	    svlis_error(
 		"slice(sv_primitive, mod_kind, real)", 
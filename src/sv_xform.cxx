@@ -0,0 +1,220 @@
+/* 
+ *  The SvLis Geometric Modelling Kernel
+ *  ------------------------------------
+ *
+ *  Copyright (C) 1993, 1997, 1998, 2000 
+ *  University of Bath & Information Geometers Ltd
+ *
+ *  http://www.bath.ac.uk/
+ *  http://www.inge.com/
+ *
+ *  Principal author:
+ *
+ *     Adrian Bowyer
+ *     Department of Mechanical Engineering
+ *     Faculty of Engineering and Design
+ *     University of Bath
+ *     Bath BA2 7AY
+ *     U.K.
+ *
+ *     e-mail: A.Bowyer@bath.ac.uk
+ *        web: http://www.bath.ac.uk/~ensab/
+ *
+ *   SvLis is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   Licence as published by the Free Software Foundation; either
+ *   version 2 of the Licence, or (at your option) any later version.
+ *
+ *   SvLis is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public Licence for more details.
+ *
+ *   You should have received a copy of the GNU Library General Public
+ *   Licence along with svLis; if not, write to the Free
+ *   Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA,
+ *   or see
+ *
+ *      http://www.gnu.org/
+ * 
+ * =====================================================================
+ *
+ * SvLis - Affine transforms
+ *
+ * See the svLis web site for the manual and other details:
+ *
+ *    http://www.bath.ac.uk/~ensab/G_mod/Svlis/
+ *
+ * or see the file
+ *
+ *    docs/svlis.html
+ *
+ * First version: 18 October 2026
+ * This version: 18 October 2026
+ *
+ */
+
+#include "svlis.h"
+#if macintosh
+ #pragma export on
+#endif
+
+// The box enclosing a mapped box: the centre maps to the centre, and
+// the half-widths go through the absolute values of A
+
+sv_box sv_xform::map(const sv_box& b) const
+{
+	sv_point c = map(b.centroid());
+	sv_point h = sv_point(b.xi.hi() - b.xi.lo(), b.yi.hi() - b.yi.lo(),
+		b.zi.hi() - b.zi.lo())*0.5;
+	sv_point w = sv_point(
+		fabs(r0.x)*h.x + fabs(r0.y)*h.y + fabs(r0.z)*h.z,
+		fabs(r1.x)*h.x + fabs(r1.y)*h.y + fabs(r1.z)*h.z,
+		fabs(r2.x)*h.x + fabs(r2.y)*h.y + fabs(r2.z)*h.z);
+	return(sv_box(c - w, c + w));
+}
+
+sv_line sv_xform::map(const sv_line& l) const
+{
+	sv_line m;
+	m.origin = map(l.origin);
+	m.direction = vector(l.direction);
+	return(m);
+}
+
+// Inverse by cofactors
+
+sv_xform sv_xform::inverse() const
+{
+	sv_point c0 = r1^r2;
+	sv_point c1 = r2^r0;
+	sv_point c2 = r0^r1;
+	sv_real det = r0*c0;
+	if(det == 0.0)
+	{
+		svlis_error("sv_xform::inverse()", "singular transform", SV_WARNING);
+		return(sv_xform());
+	}
+	det = 1/det;
+
+// The inverse's columns are the cofactors
+
+	sv_xform i = sv_xform(sv_point(c0.x, c1.x, c2.x)*det,
+		sv_point(c0.y, c1.y, c2.y)*det, sv_point(c0.z, c1.z, c2.z)*det, sv_point(0, 0, 0));
+	i.t = -i.vector(t);
+	return(i);
+}
+
+int sv_xform::identity() const
+{
+	return( (same(r0, SV_X) == SV_PLUS) && (same(r1, SV_Y) == SV_PLUS) &&
+		(same(r2, SV_Z) == SV_PLUS) && (t.mod() <= sv_same_tol) );
+}
+
+// Two maps the same?
+
+prim_op same(const sv_xform& a, const sv_xform& b)
+{
+	if( (same(a.r0, b.r0) == SV_PLUS) && (same(a.r1, b.r1) == SV_PLUS) &&
+	    (same(a.r2, b.r2) == SV_PLUS) && (same(a.t, b.t) == SV_PLUS) )
+		return(SV_PLUS);
+	return(SV_ZERO);
+}
+
+// The rows of a similarity are orthogonal and of equal length
+
+int sv_xform::similar() const
+{
+	sv_real l = r0*r0;
+	sv_real tol = sv_same_tol*l;
+	if(fabs(r1*r1 - l) > tol) return(0);
+	if(fabs(r2*r2 - l) > tol) return(0);
+	if(fabs(r0*r1) > tol) return(0);
+	if(fabs(r1*r2) > tol) return(0);
+	if(fabs(r2*r0) > tol) return(0);
+	return(1);
+}
+
+sv_xform operator*(const sv_xform& a, const sv_xform& b)
+{
+	sv_point c0 = sv_point(b.r0.x, b.r1.x, b.r2.x);
+	sv_point c1 = sv_point(b.r0.y, b.r1.y, b.r2.y);
+	sv_point c2 = sv_point(b.r0.z, b.r1.z, b.r2.z);
+	return(sv_xform(sv_point(a.r0*c0, a.r0*c1, a.r0*c2),
+		sv_point(a.r1*c0, a.r1*c1, a.r1*c2),
+		sv_point(a.r2*c0, a.r2*c1, a.r2*c2), a.map(b.t)));
+}
+
+// Build the map from what a transform does to the origin and the
+// three unit points, so it agrees with sv_point's own transforms
+
+static sv_xform xf_sample(const sv_point& o, const sv_point& x,
+	const sv_point& y, const sv_point& z)
+{
+	sv_point c0 = x - o;
+	sv_point c1 = y - o;
+	sv_point c2 = z - o;
+	return(sv_xform(sv_point(c0.x, c1.x, c2.x), sv_point(c0.y, c1.y, c2.y),
+		sv_point(c0.z, c1.z, c2.z), o));
+}
+
+sv_xform xf_translate(const sv_point& q)
+{
+	return(sv_xform(SV_X, SV_Y, SV_Z, q));
+}
+
+sv_xform xf_spin(const sv_line& l, sv_real a)
+{
+	return(xf_sample(sv_point(0, 0, 0).spin(l, a), SV_X.spin(l, a),
+		SV_Y.spin(l, a), SV_Z.spin(l, a)));
+}
+
+sv_xform xf_mirror(const sv_plane& m)
+{
+	return(xf_sample(sv_point(0, 0, 0).mirror(m), SV_X.mirror(m),
+		SV_Y.mirror(m), SV_Z.mirror(m)));
+}
+
+sv_xform xf_scale(const sv_point& c, sv_real s)
+{
+	return(xf_sample(sv_point(0, 0, 0).scale(c, s), SV_X.scale(c, s),
+		SV_Y.scale(c, s), SV_Z.scale(c, s)));
+}
+
+sv_xform xf_scale(const sv_line& l, sv_real s)
+{
+	return(xf_sample(sv_point(0, 0, 0).scale(l, s), SV_X.scale(l, s),
+		SV_Y.scale(l, s), SV_Z.scale(l, s)));
+}
+
+// I/O: the rows and the translation as four points in brackets
+
+void write(ostream& s, const sv_xform& m, sv_integer level)
+{
+	put_white(s, level);
+	put_token(s, SVT_OB, 0, 0);
+	write(s, m.r0, 0);
+	s << ", ";
+	write(s, m.r1, 0);
+	s << ", ";
+	write(s, m.r2, 0);
+	s << ", ";
+	write(s, m.t, 0);
+	put_token(s, SVT_CB, 0, 0);
+}
+
+ostream& operator<<(ostream& s, const sv_xform& m)
+{
+	write(s, m, 0);
+	return(s);
+}
+
+istream& operator>>(istream& s, sv_xform& m)
+{
+	read(s, m);
+	return(s);
+}
+
+#if macintosh
+ #pragma export off
+#endif
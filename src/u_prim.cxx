@@ -60,6 +60,9 @@
  *  the user wants to code up in C++.  The example is a sinusoidal
  *  wave pattern.
  *
+ *  Primitives written as classes (see sv_uprim.h) have kinds from
+ *  SV_U_REG up, and are dealt with before the switches.
+ *
  */
 
 #include "svlis.h"
@@ -69,12 +72,39 @@
 
 #define SIN_SHEET 2000
 
+// The registered shape for a kind, if it's the shape itself rather than
+// a grad component
+
+static sv_user_prim_base* u_shape(sv_integer up)
+{
+	if((up - SV_U_REG)%4) return(0);
+	return(user_prim(up));
+}
+
 // Input and Output
 
 sv_primitive read_user(istream& s, sv_integer up)
 {
 	sv_primitive result;
 
+	if(up >= SV_U_REG)
+	{
+		char name[128];
+		s.width(sizeof(name));
+		s >> name;
+		sv_user_reader r = user_type(name);
+		if(!r)
+		{
+			svlis_error("read_user","shape class not declared", SV_CORRUPT);
+			return(result);
+		}
+		result = register_user_prim(r(s));
+		sv_integer c = (up - SV_U_REG)%4;
+		if(c)
+			result = sv_primitive(result.kind() + c, 0, 0, 0);
+		return(result);
+	}
+
 	switch (up)
 	{
 	default:
@@ -86,6 +116,13 @@ sv_primitive read_user(istream& s, sv_integer up)
 
 void write_user(ostream& s, sv_integer up)
 {
+	sv_user_prim_base* u = user_prim(up);
+	if(u)
+	{
+		u->write(s);
+		return;
+	}
+
 	switch (up)
 	{
 	default:
@@ -98,6 +135,8 @@ void write_user(ostream& s, sv_integer up)
 
 sv_integer degree_user(sv_integer up)
 {
+	sv_user_prim_base* u = user_prim(up);
+	if(u) return(u->degree());
 	return(2); // well, why not?
 }
 
@@ -180,6 +219,9 @@ sv_real value_user(sv_integer up, const sv_point& q)
 {
 	sv_real result = 0.0;
 
+	const sv_user_eval* u = user_prim_eval(up);
+	if(u) return(u->value(u->shape, q));
+
 	switch(up)
 	{
 	case SIN_SHEET:
@@ -219,6 +261,9 @@ sv_interval range_user(sv_integer up, const sv_box& b)
 {
 	sv_interval result;
 
+	const sv_user_eval* u = user_prim_eval(up);
+	if(u) return(u->range(u->shape, b));
+
 	switch(up)
 	{
 	case SIN_SHEET:
@@ -258,6 +303,16 @@ sv_primitive complement_user(sv_integer up)
 {
 	sv_primitive result;
 
+// The grad components of registered shapes have no complements of
+// their own
+
+	if(up >= SV_U_REG)
+	{
+		sv_user_prim_base* u = u_shape(up);
+		if(u) return(register_user_prim(u->complement()));
+		return(result);
+	}
+
 	switch(up)
 	{
 	case SIN_SHEET: